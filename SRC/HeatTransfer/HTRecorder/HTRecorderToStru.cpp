@@ -27,6 +27,7 @@
 //
 
 #include <HTRecorderToStru.h>
+#include <TemperatureStore.h>
 #include <OPS_Globals.h>
 
 
@@ -47,8 +48,8 @@ using std::vector;
 
 HTRecorderToStru::HTRecorderToStru(int tag)
 :HTRecorder(tag),theNodes(0),theNodes1(0),
-initialRecording(false), response(0), theOutputHandler(0),
- theDomain(0), initializationDone(false), numValidNodes(0), Tolerance(0)
+response(0), theDomain(0), theOutputHandler(0),
+ initializationDone(false), initialRecording(false), numValidNodes(0), Tolerance(0), theStore(0)
 {
     //lastRecorderTag++;
 }
@@ -56,88 +57,35 @@ initialRecording(false), response(0), theOutputHandler(0),
 
 HTRecorderToStru::HTRecorderToStru(int tag, const Vector& theCrds, 
 			           HeatTransferDomain &theDom, double tolerance)
-:HTRecorder(tag), theNodes(0),theNodes1(0), theDomain(&theDom),theOutputHandler(0),
-					 initialRecording(false),response(0),
- 					initializationDone(false), numValidNodes(0), Tolerance(tolerance)
+:HTRecorder(tag), theNodes(0),theNodes1(0), response(0), theDomain(&theDom),theOutputHandler(0),
+ 					initializationDone(false), initialRecording(false), numValidNodes(0), Tolerance(tolerance), theStore(0)
 {
-// create memory to hold nodal ID's
-  // FInding the nodes for required Crds
-  int nRows = theCrds.Size()-1;
-  xCrd = theCrds(0);
-  yCrds.resize(nRows);
-  for(int i=0; i<nRows; i++){
-    yCrds(i)= theCrds(i+1);
-  }
-#ifdef _DEBUG
-  opserr<<"HTRecorderToStru:XcRD "<<xCrd<<endln;
-#endif
+  this->locateNodes(theCrds);
+}
 
-    
-	vector<int> xCrdNodes;
 
-	ID RefNodeTagsL =ID(nRows);
-	ID RefNodeTagsR = ID(nRows);
-	ID RefNodeFound = ID(nRows);
-
-	int SelectedNum =0;
-	double xCrdReference =0;
-		//Finding nodes with xCrd==xCrdReference
-		
-	xCrdReference = xCrd;
-	xCrdNodes.clear();
-	
-	for(int i=0;i<theDomain->getNumNodes();i++){
-		HeatTransferNode* theHTNode= theDomain->getNode(i+1);
-		if((theHTNode->getCrds()(0)<= xCrdReference+Tolerance)&&(theHTNode->getCrds()(0)>= xCrdReference-Tolerance)){
-			xCrdNodes.push_back(i);
-		}
-              
-	}
-	//Finding two reference nodes from xCrdNodes for each ycrd
-	if (xCrdNodes.size()==0){
-			opserr<< "HTRecorderToStru:No node is selected for xCrd: "<<xCrdReference<<endln;
-		}
-
-	for (int m=0;m<nRows;m++){	
-		for(int j=1; j<xCrdNodes.size();j++) {
-		//Need to check order if using other mesh tools
-			HeatTransferNode* theNode = theDomain->getNode(xCrdNodes[j-1]);
-			HeatTransferNode* theNode1 = theDomain->getNode(xCrdNodes[j]);
-			double yLocTolerance = (theNode1->getCrds()(1))-(theNode->getCrds()(1));
-			double yDif = yCrds(m)-(theNode->getCrds()(1));
-			double yDif1 = (theNode1->getCrds()(1))-yCrds(m);
-			if((yLocTolerance>=yDif)&&(yLocTolerance>=yDif1)){
-				//opserr<<"ycrd: "<<yCrds(m)<<"NodeCrd: "<<theNode->getCrds()(1)<<"NodeCrd1: "<<theNode1->getCrds()(1)<<endln;
-				RefNodeTagsL(m) = xCrdNodes[j-1];
-				RefNodeTagsR(m)= xCrdNodes[j];
-				RefNodeFound(m)=1;
-				//if reference yCrd is larger than ycrd of node j-1 and less than node j;put j-1,j into reference NodeTagID
-			}
-		}
-	}
-			
-
-	for(int i =0; i<nRows; i++){
-		if (RefNodeFound(i)==0)
-			opserr<<"HTRecorderToStru:fail to find a Node for y: "<<yCrds(i)<<endln;
-	}
+HTRecorderToStru::HTRecorderToStru(int tag, const Vector& theCrds, 
+			           HeatTransferDomain &theDom, OPS_Stream &theOutputHandler, double tolerance)
+:HTRecorder(tag), theNodes(0),theNodes1(0), response(0), theDomain(&theDom),theOutputHandler(&theOutputHandler),
+ 					initializationDone(false), initialRecording(false), numValidNodes(0), Tolerance(tolerance), theStore(0)
+{
+  this->locateNodes(theCrds);
+}
 
-	theNodeTags = RefNodeTagsL;
-	theNodeTags1 = RefNodeTagsR;
-#ifdef _DEBUG
-	opserr<<"theNodeTags "<<theNodeTags<<endln;
-	opserr<<"theNodeTags1 "<<theNodeTags1<<endln;
-#endif
 
+HTRecorderToStru::HTRecorderToStru(int tag, const Vector& theCrds, 
+			           HeatTransferDomain &theDom, TemperatureStore &theTemperatureStore, double tolerance)
+:HTRecorder(tag), theNodes(0),theNodes1(0), response(0), theDomain(&theDom),theOutputHandler(0),
+ 					initializationDone(false), initialRecording(false), numValidNodes(0), Tolerance(tolerance), theStore(&theTemperatureStore)
+{
+  theStore->attach();
+  this->locateNodes(theCrds);
 }
 
-//
 
-HTRecorderToStru::HTRecorderToStru(int tag, const Vector& theCrds, 
-			           HeatTransferDomain &theDom, OPS_Stream &theOutputHandler, double tolerance)
-:HTRecorder(tag), theNodes(0),theNodes1(0), theDomain(&theDom),theOutputHandler(&theOutputHandler),
-					 initialRecording(false),response(0),
- 					initializationDone(false), numValidNodes(0), Tolerance(tolerance)
+// find the pair of nodes on the section at xCrd bounding each of the yCrds
+void
+HTRecorderToStru::locateNodes(const Vector& theCrds)
 {
 
   // create memory to hold nodal ID's
@@ -222,6 +170,10 @@ HTRecorderToStru::~HTRecorderToStru()
 	    delete theOutputHandler;
 
 	  } 
+	if (theStore != 0) {
+		theStore->finish();
+		theStore->detach();
+	}
 	if (theNodes != 0) 
 		delete [] theNodes;
 	if (theNodes1 != 0) 
@@ -235,7 +187,7 @@ HTRecorderToStru::record(double timeStamp)
 {
 	bool usingHandler=true;
 
-		if (theOutputHandler == 0)
+		if (theOutputHandler == 0 && theStore == 0)
 			usingHandler = false;
 		else 
 			usingHandler = true;
@@ -277,7 +229,10 @@ HTRecorderToStru::record(double timeStamp)
 					}
 					response(i+1)=T-273.15;	
 				}
-		        theOutputHandler->write(response);	
+				if (theOutputHandler != 0)
+					theOutputHandler->write(response);
+				if (theStore != 0)
+					theStore->addRow(response);
 
 	} //end of using outputHandler;
 	else
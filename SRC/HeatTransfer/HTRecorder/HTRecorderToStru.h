@@ -39,6 +39,7 @@
 class Matrix;
 class HeatTransferDomain;
 class HeatTransferNode;
+class TemperatureStore;
 
 class HTRecorderToStru: public HTRecorder
 {
@@ -51,6 +52,12 @@ class HTRecorderToStru: public HTRecorder
     HTRecorderToStru(int tag, const Vector& theCrds, 
 		       HeatTransferDomain& theDomain, OPS_Stream &theOutputHandle,
 			   double tolerance=0.00001); 
+
+    // the temperatures go straight into theStore, from where the
+    // PathTimeSeriesThermal objects of the structural model take them
+    HTRecorderToStru(int tag, const Vector& theCrds, 
+		       HeatTransferDomain& theDomain, TemperatureStore &theStore,
+			   double tolerance=0.00001); 
     
     ~HTRecorderToStru();
 
@@ -62,12 +69,13 @@ class HTRecorderToStru: public HTRecorder
 
     private:	
 	int initialize(void);
-	Vector response;
+	void locateNodes(const Vector& theCrds);
 
 	ID theNodeTags;
 	ID theNodeTags1;
 	HeatTransferNode** theNodes;
 	HeatTransferNode** theNodes1;
+	Vector response;
 
 	HeatTransferDomain* theDomain;
 	OPS_Stream *theOutputHandler;
@@ -78,6 +86,7 @@ class HTRecorderToStru: public HTRecorder
 	double Tolerance;
 	double xCrd;
 	Vector yCrds;
+	TemperatureStore *theStore;
 
 };
 
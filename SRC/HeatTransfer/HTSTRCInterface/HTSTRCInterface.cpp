@@ -27,6 +27,7 @@
 //
 
 #include <HTSTRCInterface.h>
+#include <HTSTRCMapping.h>
 #include <HeatTransferDomain.h>
 #include <HeatTransferNode.h>
 #include <HT_NodeIter.h>
@@ -46,7 +47,8 @@ using namespace std;
 
 HTSTRCInterface::HTSTRCInterface(int numNodes, int numSteps, int numDim, const char* filename)
 :numnodes(numNodes), numsteps(numSteps), numdimensions(numDim), datastored(0), 
- fileName(filename), mytree(0), Temp_history(0),regionCnt2d(0),regionCnt3d(0)
+ fileName(filename), mytree(0), Temp_history(0),regionCnt2d(0),regionCnt3d(0),
+ nodalTemps(0), stepTimes(0)
 {
     if(datastored)
 		delete[]datastored;
@@ -116,12 +118,22 @@ HTSTRCInterface::HTSTRCInterface(int numNodes, int numSteps, int numDim, const c
 
 	mytree = new KDTree(setpoints,numnodes,numdimensions);
 
+	// the temperatures and times by step, for the mappings
+	nodalTemps = new double[col];
+	for(int i=0;i<col;i++)
+		nodalTemps[i] = datastored[i][numdimensions+1];
+
+	stepTimes = new double[numsteps];
+	for(int k=0;k<numsteps;k++)
+		stepTimes[k] = datastored[k*numnodes][0];
+
 }
 
 
 HTSTRCInterface::HTSTRCInterface(int numNodes, int numDim, HeatTransferDomain* theDomain)
 :numnodes(numNodes), numsteps(0), numdimensions(numDim), datastored(0), 
- fileName(0), mytree(0), Temp_history(0),regionCnt2d(0),regionCnt3d(0)
+ fileName(0), mytree(0), Temp_history(0),regionCnt2d(0),regionCnt3d(0),
+ nodalTemps(0), stepTimes(0)
 {
 	if(theDomain == 0) {
 		cout << "FATAL:HTSTRCInterface::HTSTRCInterfacec( ) -";
@@ -170,6 +182,11 @@ HTSTRCInterface::~HTSTRCInterface()
 
 	if(mytree)
 		delete mytree;
+
+	if(nodalTemps)
+		delete [] nodalTemps;
+	if(stepTimes)
+		delete [] stepTimes;
 }
 
 
@@ -183,34 +200,16 @@ HTSTRCInterface::getFiberTemperature(double x1, double x2,
 	  exit(-1);
 	}
 
-  Range* therange = new Range[2];
-  therange[0] = new double[2];
-  therange[1] = new double[2];
-
-  therange[0][0] = x1;
-  therange[0][1] = x2;
-  therange[1][0] = y1;
-  therange[1][1] = y2;
-
-  vector<int> pointsInRange = mytree->get_points_in_range(therange);
-
-  // compute the averaged temperature
-  int numpts = pointsInRange.size();
+  HTSTRCMapping theMapping;
+  this->addRegion2D(theMapping, x1, x2, y1, y2);
 
   if(!Temp_history)
 	  Temp_history = new vector<double>(2*numsteps);
 
-  for(int stps=0;stps<numsteps;stps++){
-	  double Tsum = 0;
-	  for(int i=0;i<numpts;i++){
-		  int n = pointsInRange[i] + stps * numnodes;
-		  Tsum = Tsum + datastored[n][3];
-		  }
-      //half of the vector stores temperature
-	  (*Temp_history)[stps] = Tsum / (double)numpts;
-	  //another half of the vector stores time
-	  (*Temp_history)[stps+numsteps] = datastored[stps*numnodes][0];
-	  }
+  //half of the vector stores temperature, another half stores time
+  this->getTemperatureSeries(theMapping, &(*Temp_history)[0]);
+  for(int stps=0;stps<numsteps;stps++)
+	  (*Temp_history)[stps+numsteps] = stepTimes[stps];
 
   return *Temp_history;
 }
@@ -228,35 +227,15 @@ HTSTRCInterface::getFiberTemperature(double x1, double x2,
 	  exit(-1);
 	}
 
-  Range* therange = new Range[3];
-  therange[0] = new double[2];
-  therange[1] = new double[2];
-  therange[2] = new double[2];
-
-  therange[0][0] = x1;
-  therange[0][1] = x2;
-  therange[1][0] = y1;
-  therange[1][1] = y2;
-  therange[1][0] = z1;
-  therange[1][1] = z2;
-
-  vector<int> pointsInRange = mytree->get_points_in_range(therange);
-
-  // compute the averaged temperature
-  int numpts = pointsInRange.size();
+  HTSTRCMapping theMapping;
+  this->addRegion3D(theMapping, x1, x2, y1, y2, z1, z2);
 
   if(!Temp_history)
 	  Temp_history = new vector<double>(2*numsteps);
 
-  for(int stps=0;stps<numsteps;stps++){
-	  double Tsum = 0;
-	  for(int i=0;i<numpts;i++){
-		  int n = pointsInRange[i] + stps * numnodes;
-		  Tsum = Tsum + datastored[n][3];
-		  }
-	  (*Temp_history)[stps] = Tsum / numpts;
-	  (*Temp_history)[stps+numsteps] = datastored[stps*numnodes][0];
-	  }
+  this->getTemperatureSeries(theMapping, &(*Temp_history)[0]);
+  for(int stps=0;stps<numsteps;stps++)
+	  (*Temp_history)[stps+numsteps] = stepTimes[stps];
 
   return *Temp_history;
 }
@@ -337,6 +316,116 @@ HTSTRCInterface::getClosestPoint3D(double x, double y, double z)
 }
 
 
+int
+HTSTRCInterface::addRegion(HTSTRCMapping& theMapping, double** therange)
+{
+  vector<int> pointsInRange = mytree->get_points_in_range(therange);
+
+  // the temperature of the region is the average over its nodes
+  int numpts = pointsInRange.size();
+  if(numpts == 0)
+	  cerr << "WARNING:HTSTRCInterface::addRegion - no HT node in the region" << endl;
+
+  vector<double> weights(numpts, 1.0/numpts);
+  return theMapping.addRow(pointsInRange, weights);
+}
+
+
+int
+HTSTRCInterface::addRegion2D(HTSTRCMapping& theMapping, double x1, double x2, double y1, double y2)
+{
+  if(numdimensions != 2){
+	  cerr << "Error:HTSTRCInterface::addRegion2D--"
+		   << " dimension not matching" << endl;
+	  exit(-1);
+	}
+
+  double range[2][2] = {{x1, x2}, {y1, y2}};
+  Range therange[2] = {range[0], range[1]};
+
+  return this->addRegion(theMapping, therange);
+}
+
+
+int
+HTSTRCInterface::addRegion3D(HTSTRCMapping& theMapping, double x1, double x2, double y1, double y2,
+	                         double z1, double z2)
+{
+  if(numdimensions != 3){
+	  cerr << "Error:HTSTRCInterface::addRegion3D--"
+		   << " dimension not matching" << endl;
+	  exit(-1);
+	}
+
+  double range[3][2] = {{x1, x2}, {y1, y2}, {z1, z2}};
+  Range therange[3] = {range[0], range[1], range[2]};
+
+  return this->addRegion(theMapping, therange);
+}
+
+
+int
+HTSTRCInterface::addPoint2D(HTSTRCMapping& theMapping, double x, double y)
+{
+  vector<int> node(1, this->getClosestPoint2D(x, y)-1);
+  vector<double> weight(1, 1.0);
+  return theMapping.addRow(node, weight);
+}
+
+
+int
+HTSTRCInterface::addPoint3D(HTSTRCMapping& theMapping, double x, double y, double z)
+{
+  vector<int> node(1, this->getClosestPoint3D(x, y, z)-1);
+  vector<double> weight(1, 1.0);
+  return theMapping.addRow(node, weight);
+}
+
+
+void
+HTSTRCInterface::getTemperatures(const HTSTRCMapping& theMapping, int stps, double* T)
+{
+  if(nodalTemps == 0 || stps < 0 || stps >= numsteps){
+	  cerr << "Error:HTSTRCInterface::getTemperatures--"
+		   << " no temperature data stored for step " << stps << endl;
+	  exit(-1);
+	}
+
+  theMapping.apply(&nodalTemps[(long)stps*numnodes], T);
+}
+
+
+void
+HTSTRCInterface::getTemperatureSeries(const HTSTRCMapping& theMapping, double* T)
+{
+  if(nodalTemps == 0){
+	  cerr << "Error:HTSTRCInterface::getTemperatureSeries--"
+		   << " no temperature data stored" << endl;
+	  exit(-1);
+	}
+
+  int numRows = theMapping.getNumRows();
+
+  #pragma omp parallel for schedule(static)
+  for(int stps=0;stps<numsteps;stps++)
+	  theMapping.apply(&nodalTemps[(long)stps*numnodes], &T[(long)stps*numRows]);
+}
+
+
+int
+HTSTRCInterface::getNumSteps(void)
+{
+  return numsteps;
+}
+
+
+double
+HTSTRCInterface::getTime(int stps)
+{
+  return stepTimes[stps];
+}
+
+
 //save the temperature data to a file for a specified region
 void 
 HTSTRCInterface::getTemperature2DRegion(double x1, double x2, double y1, double y2)
@@ -434,6 +523,28 @@ HTSTRCInterface::getTemperature3DRegion(double x1, double x2, double y1, double
 
 
 
+void
+HTSTRCInterface::addSectionRegions(HTSTRCMapping& theMapping, double h, double t, double s,
+								   double b, double slab_w, double slab_d)
+{
+  double dy = (h-2.0*t)/7.0;
+
+  // bottom flange and the web
+  this->addRegion2D(theMapping, 0.0, b, 0, t);
+  for(int i=1;i<8;i++)
+	  this->addRegion2D(theMapping, 0.5*(b-s), 0.5*(b+s), t+dy*(i-1), t+dy*i);
+
+  if(slab_d > 0.0) {
+	  // top flange and the slab
+	  this->addRegion2D(theMapping, 0.0, b, h-t, h);
+	  double dy1 = slab_d/20.0;
+	  for(int i=0;i<20;i++)
+		  this->addRegion2D(theMapping, 0.5*(b-slab_w), 0.5*(b+slab_w), h+dy1*i, h+dy1*(i+1));
+	  } else
+		  this->addRegion2D(theMapping, 0.5*(b-s), 0.5*(b+s), h-t, h);
+}
+
+
 void 
 HTSTRCInterface::getTemperatureForCompositeSection(double h, double t, double s, double b,
 	                                               double slab_w, double slab_d)
@@ -458,49 +569,19 @@ HTSTRCInterface::getTemperatureForCompositeSection(double h, double t, double s,
 	  }
   output << endl;
 
-  //double mytemp;
-  double** fiberTemperatures;
-  fiberTemperatures = new double*[numsteps];
-  for(int i=0;i<numsteps;i++)
-	  fiberTemperatures[i] = new double[30];
+  // the regions are found once, then each step is one product
+  HTSTRCMapping theMapping;
+  this->addSectionRegions(theMapping, h, t, s, b, slab_w, slab_d);
+  int numRows = theMapping.getNumRows();
 
-  vector<double> thetemp;
-  for(int i=0;i<29;i++){
-	  if(i==0){
-		  thetemp = this->getFiberTemperature(0.0,b,0,t);
-		  for(int k=0;k<numsteps;k++){
-			  fiberTemperatures[k][i] = thetemp[k+numsteps]; //store time
-			  fiberTemperatures[k][i+1] = thetemp[k]; //store temperature
-				 }
-
-		  } else if((i>0)&&(i<8)){
-			  double xx1 = 0.5*(b-s);
-			  double xx2 = 0.5*(b+s);
-			  double yy1 = t+dy*i;
-			  double yy2 = t+dy*(i+1);
-			  thetemp = this->getFiberTemperature(0.5*(b-s),0.5*(b+s),t+dy*(i-1),t+dy*i);
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = thetemp[k];
-				  }
-
-		  }else if(i==8) {
-			  thetemp = this->getFiberTemperature(0.0,b,h-t,h);
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = thetemp[k];
-				  }
-
-			  } else if(i>8){
-				  thetemp = this->getFiberTemperature(0.5*(b-slab_w),0.5*(b+slab_w),h+dy1*(i-9),h+dy1*(i-8));
-				  for(int k=0;k<numsteps;k++){
-					  fiberTemperatures[k][i+1] = thetemp[k];
-					  }
-				 }
-	  }
+  vector<double> fiberTemperatures(numsteps*numRows);
+  this->getTemperatureSeries(theMapping, &fiberTemperatures[0]);
 
   //dump the data to a file
   for(int i=0;i<numsteps;i++){
-	  for(int j=0;j<30;j++){
-		  output << fiberTemperatures[i][j] << " ";
+	  output << stepTimes[i] << " ";
+	  for(int j=0;j<numRows;j++){
+		  output << fiberTemperatures[i*numRows+j] << " ";
 		  }
 	  output << endl;
 	  }
@@ -526,43 +607,18 @@ HTSTRCInterface::getTemperatureForISection(double h, double t, double s, double
   output << "LocBeam9(" << b/2 << "," << h-t/2.0 << ")" << " ";
   output << endl;
 
-  //double mytemp;
-  double** fiberTemperatures;
-  fiberTemperatures = new double*[numsteps];
-  for(int i=0;i<numsteps;i++)
-	  fiberTemperatures[i] = new double[10];
+  HTSTRCMapping theMapping;
+  this->addSectionRegions(theMapping, h, t, s, b, 0.0, 0.0);
+  int numRows = theMapping.getNumRows();
 
-  vector<double> thetemp;
-  for(int i=0;i<10;i++){
-	  if(i==0){
-		  thetemp = this->getFiberTemperature(0,b,0,t);
-		  for(int k=0;k<numsteps;k++){
-			  fiberTemperatures[k][i] = thetemp[k+numsteps]; //store time
-			  fiberTemperatures[k][i+1] = thetemp[k]; //store temperature
-				 }
-
-		  } else if((i>0)&&(i<8)){
-			  double xx1 = 0.5*(b-s);
-			  double xx2 = 0.5*(b+s);
-			  double yy1 = t+dy*i;
-			  double yy2 = t+dy*(i+1);
-			  thetemp = this->getFiberTemperature(0.5*(b-s),0.5*(b+s),t+dy*(i-1),t+dy*i);
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = thetemp[k];
-				  }
-
-		  }else if(i==8) {
-			  thetemp = this->getFiberTemperature(0.5*(b-s),0.5*(b+s),h-t,h);
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = thetemp[k];
-				  }
-			  } 
-	  }
+  vector<double> fiberTemperatures(numsteps*numRows);
+  this->getTemperatureSeries(theMapping, &fiberTemperatures[0]);
 
   //dump the data to a file
   for(int i=0;i<numsteps;i++){
-	  for(int j=0;j<10;j++){
-		  output << fiberTemperatures[i][j] << " ";
+	  output << stepTimes[i] << " ";
+	  for(int j=0;j<numRows;j++){
+		  output << fiberTemperatures[i*numRows+j] << " ";
 		  }
 	  output << endl;
 	  }
@@ -597,67 +653,34 @@ HTSTRCInterface::getTemperatureSeriesForCompositeSection(double h, double t, dou
 	  }
   output << endl;
 
-  //double mytemp;
-  double** fiberTemperatures;
-  fiberTemperatures = new double*[numsteps];
-  for(int i=0;i<numsteps;i++)
-	  fiberTemperatures[i] = new double[30];
+  HTSTRCMapping theMapping;
+  this->addSectionRegions(theMapping, h, t, s, b, slab_w, slab_d);
+  int numRows = theMapping.getNumRows();
 
-  vector<double> thetemp;
-  double dTmax[29];
-
-  for(int i=0;i<29;i++){
-	  if(i==0){
-		  thetemp = this->getFiberTemperature(0.0,b,0,t);
-		  // find the highest temperature in the series
-		  dTmax[0] = *(max_element(thetemp.begin(),thetemp.begin()+numsteps))-20.0;
-
-		  for(int k=0;k<numsteps;k++){
-			  fiberTemperatures[k][i] = thetemp[k+numsteps]; //store time
-			  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[0]; //store temperature
-				 }
-
-		  } else if((i>0)&&(i<8)){
-			  double xx1 = 0.5*(b-s);
-			  double xx2 = 0.5*(b+s);
-			  double yy1 = t+dy*i;
-			  double yy2 = t+dy*(i+1);
-			  thetemp = this->getFiberTemperature(0.5*(b-s),0.5*(b+s),t+dy*(i-1),t+dy*i);
-			  dTmax[i] = *max_element(thetemp.begin(),thetemp.begin()+numsteps)-20.0;
-
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[i];
-				  }
-
-		  }else if(i==8) {
-			  thetemp = this->getFiberTemperature(0.0,b,h-t,h);
-			  dTmax[8] = *max_element(thetemp.begin(),thetemp.begin()+numsteps)-20.0;
-
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[8];
-				  }
-
-			  } else if(i>8){
-				  thetemp = this->getFiberTemperature(0.5*(b-slab_w),0.5*(b+slab_w),h+dy1*(i-9),h+dy1*(i-8));
-				  dTmax[i] = *max_element(thetemp.begin(),thetemp.begin()+numsteps)-20.0;
-
-				  for(int k=0;k<numsteps;k++){
-					  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[i];
-					  }
-				 }
+  vector<double> fiberTemperatures(numsteps*numRows);
+  this->getTemperatureSeries(theMapping, &fiberTemperatures[0]);
+
+  // find the highest temperature rise in each series
+  vector<double> dTmax(numRows);
+  for(int j=0;j<numRows;j++){
+	  double Tmax = fiberTemperatures[j];
+	  for(int i=1;i<numsteps;i++)
+		  Tmax = max(Tmax, fiberTemperatures[i*numRows+j]);
+	  dTmax[j] = Tmax-20.0;
 	  }
 
   //dump the data to a file
   for(int i=0;i<numsteps;i++){
-	  for(int j=0;j<30;j++){
-		  output << fiberTemperatures[i][j] << " ";
+	  output << stepTimes[i] << " ";
+	  for(int j=0;j<numRows;j++){
+		  output << (fiberTemperatures[i*numRows+j]-20.0) / dTmax[j] << " ";
 		  }
 	  output << endl;
 	  }
 
   output << endl;
   output << "dTmax" << " ";
-  for(int i=0;i<29;i++){
+  for(int i=0;i<numRows;i++){
 	  output << dTmax[i]<< " ";
 	  }
 
@@ -684,59 +707,34 @@ HTSTRCInterface::getTemperatureSeriesForISection(double h, double t, double s, d
   output << "LocBeam9(" << b/2 << "," << h << ")" << " ";
   output << endl;
 
-  //double mytemp;
-  double** fiberTemperatures;
-  fiberTemperatures = new double*[numsteps];
-  for(int i=0;i<numsteps;i++)
-	  fiberTemperatures[i] = new double[10];
+  HTSTRCMapping theMapping;
+  this->addSectionRegions(theMapping, h, t, s, b, 0.0, 0.0);
+  int numRows = theMapping.getNumRows();
 
-  vector<double> thetemp;
-  double dTmax[9];
-
-
-  for(int i=0;i<10;i++){
-	  if(i==0){
-		  thetemp = this->getFiberTemperature(0,b,0,t);
-		  dTmax[0] = *max_element(thetemp.begin(),thetemp.begin()+numsteps)-20.0;
-
-		  for(int k=0;k<numsteps;k++){
-			  fiberTemperatures[k][i] = thetemp[k+numsteps]; //store time
-			  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[0]; //store temperature
-				 }
-
-		  } else if((i>0)&&(i<8)){
-			  double xx1 = 0.5*(b-s);
-			  double xx2 = 0.5*(b+s);
-			  double yy1 = t+dy*i;
-			  double yy2 = t+dy*(i+1);
-			  thetemp = this->getFiberTemperature(0.5*(b-s),0.5*(b+s),t+dy*(i-1),t+dy*i);
-			  dTmax[i] = *max_element(thetemp.begin(),thetemp.begin()+numsteps)-20.0;
-
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[i];
-				  }
-
-		  }else if(i==8) {
-			  thetemp = this->getFiberTemperature(0.5*(b-s),0.5*(b+s),h-t,h);
-			  dTmax[8] = *max_element(thetemp.begin(),thetemp.begin()+numsteps)-20.0;
-
-			  for(int k=0;k<numsteps;k++){
-				  fiberTemperatures[k][i+1] = (thetemp[k]-20.0) / dTmax[8];
-				  }
-			  } 
+  vector<double> fiberTemperatures(numsteps*numRows);
+  this->getTemperatureSeries(theMapping, &fiberTemperatures[0]);
+
+  // find the highest temperature rise in each series
+  vector<double> dTmax(numRows);
+  for(int j=0;j<numRows;j++){
+	  double Tmax = fiberTemperatures[j];
+	  for(int i=1;i<numsteps;i++)
+		  Tmax = max(Tmax, fiberTemperatures[i*numRows+j]);
+	  dTmax[j] = Tmax-20.0;
 	  }
 
   //dump the data to a file
   for(int i=0;i<numsteps;i++){
-	  for(int j=0;j<10;j++){
-		  output << fiberTemperatures[i][j] << " ";
+	  output << stepTimes[i] << " ";
+	  for(int j=0;j<numRows;j++){
+		  output << (fiberTemperatures[i*numRows+j]-20.0) / dTmax[j] << " ";
 		  }
 	  output << endl;
 	  }
 
   output << endl;
   output << "dTmax" << " ";
-  for(int i=0;i<10;i++){
+  for(int i=0;i<numRows;i++){
 	  output << dTmax[i]<< " ";
 	  }
 
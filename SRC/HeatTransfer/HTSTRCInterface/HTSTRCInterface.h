@@ -34,6 +34,7 @@
 
 class KDTree;
 class HeatTransferDomain;
+class HTSTRCMapping;
 
 class HTSTRCInterface {
 
@@ -67,6 +68,23 @@ public:
   int getClosestPoint2D(double x, double y);
 
   int getClosestPoint3D(double x, double y, double z);
+
+  // add a row to theMapping for the average temperature of the HT nodes in
+  // a region, or for the temperature of the HT node closest to a point;
+  // the spatial query is run here once, returns the index of the row
+  int addRegion2D(HTSTRCMapping& theMapping, double x1, double x2, double y1, double y2);
+  int addRegion3D(HTSTRCMapping& theMapping, double x1, double x2, double y1, double y2,
+	              double z1, double z2);
+  int addPoint2D(HTSTRCMapping& theMapping, double x, double y);
+  int addPoint3D(HTSTRCMapping& theMapping, double x, double y, double z);
+
+  // temperatures of the rows of theMapping at time step stps (0-based),
+  // and at every step as T[stps*numRows + row], the steps being shared
+  // among the threads
+  void getTemperatures(const HTSTRCMapping& theMapping, int stps, double* T);
+  void getTemperatureSeries(const HTSTRCMapping& theMapping, double* T);
+  int getNumSteps(void);
+  double getTime(int stps);
   
   //save the temperature data to a file for a specified region
   void getTemperature2DRegion(double x1, double x2, double y1, double y2);
@@ -94,6 +112,12 @@ public:
 
 
 private:
+    int addRegion(HTSTRCMapping& theMapping, double** therange);
+    // rows for the bottom flange, the seven layers of the web, the top flange
+    // and, if slab_d > 0, the twenty layers of the slab
+    void addSectionRegions(HTSTRCMapping& theMapping, double h, double t, double s,
+	                       double b, double slab_w, double slab_d);
+
     int regionCnt2d;
 	int regionCnt3d;
 	const char* fileName;
@@ -101,6 +125,8 @@ private:
 	std::vector<double>* Temp_history;
 	KDTree* mytree;
 	int numnodes, numsteps,numdimensions;
+	double* nodalTemps;  // temperature of node i at step k is nodalTemps[k*numnodes + i]
+	double* stepTimes;
 };
 
 #endif
@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+
+#include <HTSTRCMapping.h>
+
+using namespace std;
+
+
+HTSTRCMapping::HTSTRCMapping()
+:rowStart(1, 0)
+{
+
+}
+
+
+HTSTRCMapping::~HTSTRCMapping()
+{
+
+}
+
+
+int
+HTSTRCMapping::addRow(const vector<int>& nodes, const vector<double>& weights)
+{
+  int size = nodes.size();
+  for (int i = 0; i < size; i++) {
+	nodeIndex.push_back(nodes[i]);
+	weight.push_back(weights[i]);
+	}
+  rowStart.push_back(nodeIndex.size());
+
+  return rowStart.size() - 2;
+}
+
+
+void
+HTSTRCMapping::clearAll(void)
+{
+  rowStart.assign(1, 0);
+  nodeIndex.clear();
+  weight.clear();
+}
+
+
+int
+HTSTRCMapping::getNumRows(void) const
+{
+  return rowStart.size() - 1;
+}
+
+
+int
+HTSTRCMapping::getNumEntries(void) const
+{
+  return nodeIndex.size();
+}
+
+
+void
+HTSTRCMapping::apply(const double* nodalT, double* T) const
+{
+  int numRows = rowStart.size() - 1;
+  const int* start = &rowStart[0];
+  const int* node = nodeIndex.empty() ? 0 : &nodeIndex[0];
+  const double* w = weight.empty() ? 0 : &weight[0];
+
+  for (int i = 0; i < numRows; i++) {
+	double sum = 0.0;
+	for (int j = start[i]; j < start[i+1]; j++)
+	  sum += w[j] * nodalT[node[j]];
+	T[i] = sum;
+	}
+}
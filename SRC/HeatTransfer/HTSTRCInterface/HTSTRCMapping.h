@@ -0,0 +1,63 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+
+//
+// HTSTRCMapping is the operator taking the nodal temperatures of a heat
+// transfer analysis to the temperatures of a set of structural points
+// (fibers, section points), stored as a sparse matrix with one row per
+// point. The rows are set up once by HTSTRCInterface, which runs the
+// spatial queries; the temperatures at a time step are then one sparse
+// product with the nodal temperatures of that step.
+//
+
+#ifndef HTSTRCMapping_h
+#define HTSTRCMapping_h
+
+#include <vector>
+
+class HTSTRCMapping {
+
+public:
+  HTSTRCMapping();
+  virtual ~HTSTRCMapping();
+
+  // add a row T = sum weights[i]*T(nodes[i]), nodes being 0-based HT node
+  // indices; returns the index of the row
+  int addRow(const std::vector<int>& nodes, const std::vector<double>& weights);
+  void clearAll(void);
+
+  int getNumRows(void) const;
+  int getNumEntries(void) const;
+
+  // T[row] for every row from the nodal temperatures nodalT
+  void apply(const double* nodalT, double* T) const;
+
+private:
+  std::vector<int> rowStart;
+  std::vector<int> nodeIndex;
+  std::vector<double> weight;
+};
+
+#endif
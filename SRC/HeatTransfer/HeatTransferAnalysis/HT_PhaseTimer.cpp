@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+#include <HT_PhaseTimer.h>
+#include <OPS_Globals.h>
+
+static const char* phaseNames[HT_PhaseTimer::NumPhases] = {
+	"domain update", "form tangent", "form residual", "linear solve"};
+
+
+HT_PhaseTimer::HT_PhaseTimer()
+{
+	this->zero();
+}
+
+
+void
+HT_PhaseTimer::start(int phase)
+{
+	started[phase] = std::chrono::steady_clock::now();
+}
+
+
+void
+HT_PhaseTimer::stop(int phase)
+{
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started[phase];
+	times[phase] += elapsed.count();
+	counts[phase]++;
+}
+
+
+void
+HT_PhaseTimer::zero(void)
+{
+	for (int i = 0; i < NumPhases; i++) {
+		times[i] = 0.0;
+		counts[i] = 0;
+		}
+}
+
+
+double
+HT_PhaseTimer::getTime(int phase) const
+{
+	if (phase < 0 || phase >= NumPhases)
+		return 0.0;
+
+	return times[phase];
+}
+
+
+int
+HT_PhaseTimer::getCount(int phase) const
+{
+	if (phase < 0 || phase >= NumPhases)
+		return 0;
+
+	return counts[phase];
+}
+
+
+void
+HT_PhaseTimer::Print(OPS_Stream& s, int flag)
+{
+	double total = 0.0;
+	for (int i = 0; i < NumPhases; i++)
+		total += times[i];
+
+	s << "HT_PhaseTimer: time per phase (s)\n";
+	for (int i = 0; i < NumPhases; i++) {
+		s << "  " << phaseNames[i] << ": " << times[i] << " in " << counts[i] << " calls";
+		if (total > 0.0)
+			s << " (" << 100.0*times[i]/total << "%)";
+		s << endln;
+		}
+	s << "  total: " << total << endln;
+}
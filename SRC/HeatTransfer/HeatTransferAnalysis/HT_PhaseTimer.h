@@ -0,0 +1,62 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+//
+// HT_PhaseTimer accumulates the wall clock time spent in the phases of a
+// heat transfer analysis: updating the domain (element and material state),
+// forming the tangent, forming the residual and solving the linear system.
+// The integrator owns one, the algorithms and the analysis start and stop
+// the phases around the calls they make.
+//
+
+#ifndef HT_PhaseTimer_h
+#define HT_PhaseTimer_h
+
+#include <chrono>
+
+class OPS_Stream;
+
+class HT_PhaseTimer
+{
+  public:
+	enum Phase {DomainUpdate = 0, FormTangent, FormResidual, LinearSolve, NumPhases};
+
+	HT_PhaseTimer();
+
+	void start(int phase);
+	void stop(int phase);
+	void zero(void);
+
+	double getTime(int phase) const;   // seconds
+	int getCount(int phase) const;
+
+	void Print(OPS_Stream& s, int flag = 0);
+
+  private:
+	std::chrono::steady_clock::time_point started[NumPhases];
+	double times[NumPhases];
+	int counts[NumPhases];
+};
+
+#endif
@@ -46,6 +46,7 @@
 #include <HeatTransferNode.h>
 #include <fstream>
 #include <elementAPI.h>
+#include <math.h>
 
 
 HT_TransientAnalysis::HT_TransientAnalysis(HeatTransferDomain& theDomain,
@@ -64,7 +65,8 @@ HT_TransientAnalysis::HT_TransientAnalysis(HeatTransferDomain& theDomain,
  linear_soe(&theLinSOE), 
  transient_integrator(&theTransientIntegrator), 
  convergence_test(theConvergenceTest),
- domainStamp(0)
+ domainStamp(0), adaptive(false), dtMin(0.0), dtMax(0.0),
+ errorTol(0.0), targetIter(0), dtNext(0.0)
 {
     // first we set up the links needed by the elements in the 
     // aggregation
@@ -148,6 +150,9 @@ HT_TransientAnalysis::initialize(void)
 int 
 HT_TransientAnalysis::analyze(int numSteps, double dT,double& lastTime, double monitortime)
 {
+    if (adaptive == true)
+		return this->analyzeAdaptive(numSteps, dT, lastTime, monitortime);
+
     int result = 0; int monitor = 0;  int displayTag = 1;
 	int laststep = lastTime / dT;
     HeatTransferDomain* the_domain = this->getDomainPtr();
@@ -159,49 +164,46 @@ HT_TransientAnalysis::analyze(int numSteps, double dT,double& lastTime, double m
         if(displayTag ==1)
             opserr << "Current time: " << the_domain->getCurrentTime() << endln;
 
-		if (analysis_model->analysisStep(dT) < 0) {
-			opserr << "HT_TransientAnalysis::analyze() - the HT_AnalysisModel failed";
-			opserr << " at time " << the_domain->getCurrentTime() << endln;
-			the_domain->revertToLastCommit();
-			return -2;
-			}
-
-		// check if domain has undergone change
-		int stamp = the_domain->hasDomainChanged();
-		if (stamp != domainStamp) {
-			domainStamp = stamp;	
-			if (this->domainChanged() < 0) {
-				opserr << "HT_TransientAnalysis::analyze() - domainChanged() failed\n";
+		// an explicit integrator is only stable below a critical step, the
+		// step is then divided into substeps and recorded at the last one
+		int numSub = 1;
+		double dtStable = transient_integrator->getStableTimeStep();
+		if (dtStable > 0.0 && dT > dtStable)
+			numSub = (int)ceil(dT/dtStable);
+		double startTime = the_domain->getCurrentTime();
+
+		for (int j = 0; j < numSub; j++) {
+			if (numSub > 1)
+				the_domain->setRecording(j == numSub-1);
+
+			result = this->solveStep(dT/numSub);
+			if (result < 0)
+				the_domain->setRecording(true);
+			if (result == -1)
 				return -1;
-				}	
-			}
-
-		if (transient_integrator->newStep(dT) < 0) {
-			opserr << "HT_TransientAnalysis::analyze() - the HT_TransientIntegrator failed";
-			opserr << " at time " << the_domain->getCurrentTime() << endln;
-			the_domain->revertToLastCommit();
-			return -2;
+			else if (result < 0) {
+				the_domain->revertToLastCommit();
+				if (result == -3)
+					transient_integrator->revertToLastStep();
+				return result;
+				}
+
+			// land exactly on the end of the step
+			if (numSub > 1 && j == numSub-1)
+				the_domain->setCurrentTime(startTime + dT);
+
+			result = transient_integrator->commit();
+			if (result < 0) {
+				opserr << "DirectIntegrationAnalysis::analyze() - ";
+				opserr << "the HT_TransientIntegrator failed to commit";
+				opserr << " at time " << the_domain->getCurrentTime() << endln;
+				the_domain->setRecording(true);
+				the_domain->revertToLastCommit();	    
+				transient_integrator->revertToLastStep();
+				return -4;
+				} 
 			}
 
-		result = solution_algorithm->solveCurrentStep();
-		if (result < 0) {
-			opserr << "HT_TransientAnalysis::analyze() - the HT_SolutionAlgorithm failed";
-			opserr << " at time " << the_domain->getCurrentTime() << endln;
-			the_domain->revertToLastCommit();	    
-			transient_integrator->revertToLastStep();
-			return -3;
-			}    
-
-		result = transient_integrator->commit();
-		if (result < 0) {
-			opserr << "DirectIntegrationAnalysis::analyze() - ";
-			opserr << "the HT_TransientIntegrator failed to commit";
-			opserr << " at time " << the_domain->getCurrentTime() << endln;
-			the_domain->revertToLastCommit();	    
-			transient_integrator->revertToLastStep();
-			return -4;
-			} 
-
         //HeatTransferDomain* the_domain = this->getDomainPtr();
 		monitor=i;
 		if (the_domain->getCurrentTime() == monitortime) {
@@ -220,6 +222,221 @@ HT_TransientAnalysis::analyze(int numSteps, double dT,double& lastTime, double m
 
 }
 
+
+// take one step of size dT without committing it; on failure the caller
+// reverts the domain (and for -3 the integrator)
+int
+HT_TransientAnalysis::solveStep(double dT)
+{
+    HeatTransferDomain* the_domain = this->getDomainPtr();
+
+    HT_PhaseTimer& theTimer = transient_integrator->getPhaseTimer();
+
+	theTimer.start(HT_PhaseTimer::DomainUpdate);
+	if (analysis_model->analysisStep(dT) < 0) {
+		opserr << "HT_TransientAnalysis::analyze() - the HT_AnalysisModel failed";
+		opserr << " at time " << the_domain->getCurrentTime() << endln;
+		theTimer.stop(HT_PhaseTimer::DomainUpdate);
+		return -2;
+		}
+	theTimer.stop(HT_PhaseTimer::DomainUpdate);
+
+	// check if domain has undergone change
+	int stamp = the_domain->hasDomainChanged();
+	if (stamp != domainStamp) {
+		domainStamp = stamp;	
+		if (this->domainChanged() < 0) {
+			opserr << "HT_TransientAnalysis::analyze() - domainChanged() failed\n";
+			return -1;
+			}	
+		}
+
+	theTimer.start(HT_PhaseTimer::DomainUpdate);
+	if (transient_integrator->newStep(dT) < 0) {
+		opserr << "HT_TransientAnalysis::analyze() - the HT_TransientIntegrator failed";
+		opserr << " at time " << the_domain->getCurrentTime() << endln;
+		theTimer.stop(HT_PhaseTimer::DomainUpdate);
+		return -2;
+		}
+	theTimer.stop(HT_PhaseTimer::DomainUpdate);
+
+	if (solution_algorithm->solveCurrentStep() < 0) {
+		opserr << "HT_TransientAnalysis::analyze() - the HT_SolutionAlgorithm failed";
+		opserr << " at time " << the_domain->getCurrentTime() << endln;
+		return -3;
+		}    
+
+    return 0;
+}
+
+
+int
+HT_TransientAnalysis::setAdaptive(double minDt, double maxDt, double tol, int numIter)
+{
+    if (minDt <= 0.0) {
+		adaptive = false;
+		return 0;
+		}
+
+    if (maxDt < minDt) {
+		opserr << "HT_TransientAnalysis::setAdaptive() - dtMax " << maxDt 
+			   << " is less than dtMin " << minDt << endln;
+		return -1;
+		}
+
+    adaptive = true;
+    dtMin = minDt;
+    dtMax = maxDt;
+    errorTol = tol;
+    targetIter = numIter;
+    dtNext = 0.0;
+
+    return 0;
+}
+
+
+int
+HT_TransientAnalysis::setNumThreads(int numThreads)
+{
+    if (transient_integrator->setNumThreads(numThreads) < 0)
+		return -1;
+
+    // the integrator falls back to one thread without OpenMP
+    HeatTransferDomain* the_domain = this->getDomainPtr();
+    return the_domain->setNumThreads(transient_integrator->getNumThreads());
+}
+
+
+// the steps between two output times are chosen by the error estimate of
+// the integrator and the number of iterations; the last one is cut to end
+// exactly on the output time, where the recorders are invoked
+int
+HT_TransientAnalysis::analyzeAdaptive(int numSteps, double dT, double& lastTime, double monitortime)
+{
+    int monitor = 0;
+	int laststep = lastTime / dT;
+    HeatTransferDomain* the_domain = this->getDomainPtr();
+    double startTime = the_domain->getCurrentTime();
+    int numTaken = 0;
+    int numRejected = 0;
+
+    if (dtNext <= 0.0)
+		dtNext = (dT < dtMax) ? dT : dtMax;
+    if (dtNext < dtMin)
+		dtNext = dtMin;
+
+    for (int i = laststep; i < numSteps; i++) {
+        opserr << "Current time: " << the_domain->getCurrentTime() << endln;
+
+		double reportTime = startTime + (i - laststep + 1)*dT;
+		bool reported = false;
+
+		// an explicit integrator also bounds the step by its stable step
+		double dtStable = transient_integrator->getStableTimeStep();
+
+		while (reported == false) {
+			double time = the_domain->getCurrentTime();
+			if (dtStable > 0.0 && dtNext > dtStable)
+				dtNext = dtStable;
+			double step = dtNext;
+			bool last = false;
+
+			// avoid leaving a sliver of a step before the output time
+			if (time + 1.01*step >= reportTime) {
+				step = reportTime - time;
+				last = true;
+			} else if (time + 2.0*step > reportTime)
+				step = 0.5*(reportTime - time);
+			bool cut = (step < dtNext);
+
+			the_domain->setRecording(last);
+			int result = this->solveStep(step);
+			if (result == -1) {
+				the_domain->setRecording(true);
+				return -1;
+				}
+
+			double error = (result == 0) ? transient_integrator->getErrorEstimate() : -1.0;
+			int numIter = (result == 0 && convergence_test != 0) ? convergence_test->getNumTests() : 0;
+
+			// first order method: the local error goes with the step squared
+			double factor = 2.0;
+			if (errorTol > 0.0 && error > 0.0)
+				factor = 0.9*sqrt(errorTol/error);
+			if (targetIter > 0 && numIter > targetIter && factor > (double)targetIter/numIter)
+				factor = (double)targetIter/numIter;
+			if (result < 0)
+				factor = 0.25;
+			if (factor > 2.0)
+				factor = 2.0;
+			else if (factor < 0.2)
+				factor = 0.2;
+
+			bool atMin = (step <= dtMin*(1.0 + 1.0e-10));
+			if (result < 0 || (errorTol > 0.0 && error > errorTol && atMin == false)) {
+				// reject the step and try again with a smaller one
+				the_domain->revertToLastCommit();
+				transient_integrator->revertToLastStep();
+				if (result < 0 && atMin == true) {
+					opserr << "HT_TransientAnalysis::analyze() - failed with the minimum step " << dtMin;
+					opserr << " at time " << the_domain->getCurrentTime() << endln;
+					the_domain->setRecording(true);
+					return result;
+					}
+				numRejected++;
+				dtNext = step*factor;
+				if (dtNext < dtMin)
+					dtNext = dtMin;
+				continue;
+				}
+
+			// land exactly on the output time
+			if (last == true)
+				the_domain->setCurrentTime(reportTime);
+
+			result = transient_integrator->commit();
+			if (result < 0) {
+				opserr << "HT_TransientAnalysis::analyze() - ";
+				opserr << "the HT_TransientIntegrator failed to commit";
+				opserr << " at time " << the_domain->getCurrentTime() << endln;
+				the_domain->setRecording(true);
+				the_domain->revertToLastCommit();	    
+				transient_integrator->revertToLastStep();
+				return -4;
+				} 
+			numTaken++;
+			reported = last;
+
+			// a step cut short for the output time says little about a longer one
+			if (cut == false)
+				dtNext = step*factor;
+			else if (factor < 1.0 && step*factor < dtNext)
+				dtNext = step*factor;
+			if (dtNext > dtMax)
+				dtNext = dtMax;
+			else if (dtNext < dtMin)
+				dtNext = dtMin;
+			}
+
+		monitor = i;
+		if (fabs(reportTime - monitortime) < 1.0e-9*dT) {
+			lastTime = monitortime;
+			the_domain->setRecording(true);
+			return monitor;
+			}
+		}
+
+    the_domain->setRecording(true);
+    opserr << "HT_TransientAnalysis::analyze() - " << numTaken << " steps (" << numRejected
+		   << " rejected) for " << numSteps - laststep << " output steps\n";
+
+#ifdef _DEBUG
+	return monitor;
+#else
+	return 0;
+#endif
+}
+
 /*
 int
 HT_TransientAnalysis::continue (int numSteps, double dT, double monitortime)
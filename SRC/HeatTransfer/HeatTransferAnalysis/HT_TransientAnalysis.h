@@ -63,6 +63,16 @@ class HT_TransientAnalysis: public HeatTransferAnalysis
     void clearAll(void);	    
     
     int analyze(int numSteps, double dT,double& lasttime, double monitortime = 0 );
+
+    // adaptive time stepping: the step is chosen between dtMin and dtMax
+    // from the integrator's error estimate (tol) and the number of
+    // iterations (targetIter), steps failing either are repeated with a
+    // smaller step. analyze() then takes dT as the output interval and
+    // only invokes the recorders at multiples of it. dtMin <= 0 switches
+    // adaptive stepping off again.
+    int setAdaptive(double dtMin, double dtMax, double tol, int targetIter = 0);
+    // update the domain and form the elements with numThreads threads
+    int setNumThreads(int numThreads);
     int initialize(void);
     int domainChanged(void);
 
@@ -82,6 +92,9 @@ class HT_TransientAnalysis: public HeatTransferAnalysis
   protected:
     
   private:
+    int solveStep(double dT);
+    int analyzeAdaptive(int numSteps, double dT, double& lastTime, double monitortime);
+
     TemperatureBCHandler*  temp_bc_handler;    
     HT_DOF_Numberer*  dof_numberer;
     HT_AnalysisModel*  analysis_model;
@@ -91,6 +104,13 @@ class HT_TransientAnalysis: public HeatTransferAnalysis
     HT_ConvergenceTest*  convergence_test;
 
     int domainStamp;
+
+    // adaptive time stepping
+    bool adaptive;
+    double dtMin, dtMax;
+    double errorTol;
+    int targetIter;
+    double dtNext;                 // step proposed for the next increment
 };
 
 #endif
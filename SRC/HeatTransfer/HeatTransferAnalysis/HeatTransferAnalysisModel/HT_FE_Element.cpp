@@ -37,6 +37,7 @@
 #include <HT_AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <math.h>
 
 #define MAX_NUM_DOF 64
 
@@ -53,7 +54,7 @@ HT_FE_Element::HT_FE_Element(int tag, HeatTransferElement* ele)
 :TaggedObject(tag),
 myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
 numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-theResidual(0), theTangent(0), theIntegrator(0)
+theResidual(0), theTangent(0), ownStorage(false), theIntegrator(0)
 {
     if (numDOF <= 0) {
 		opserr << "HT_FE_Element::HT_FE_Element(HeatTransferElement* ) ";
@@ -151,7 +152,7 @@ theResidual(0), theTangent(0), theIntegrator(0)
 HT_FE_Element::HT_FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), ownStorage(false), theIntegrator(0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
@@ -184,7 +185,7 @@ HT_FE_Element::~HT_FE_Element()
     numFEs--;
 
     // delete tangent and residual if created specially
-	if (numDOF > MAX_NUM_DOF) {
+	if (numDOF > MAX_NUM_DOF || ownStorage == true) {
 		if (theTangent != 0) delete theTangent;
 		if (theResidual != 0) delete theResidual;
 		}
@@ -261,6 +262,21 @@ HT_FE_Element::setID(void)
 }
 
 
+int
+HT_FE_Element::setOwnStorage(void)
+{
+    // subclasses without an element keep their own storage
+    if (myEle == 0 || numDOF > MAX_NUM_DOF || ownStorage == true)
+		return 0;
+
+    theResidual = new Vector(numDOF);
+    theTangent = new Matrix(numDOF, numDOF);
+    ownStorage = true;
+
+    return 0;
+}
+
+
 const Matrix&
 HT_FE_Element::getTangent(HeatTransferIntegrator* theNewIntegrator)
 {
@@ -334,6 +350,63 @@ HT_FE_Element::addMcToTang(double fact)
 }
   
 
+void  
+HT_FE_Element::addLumpedMcToTang(double fact)
+{
+    if (myEle != 0) {
+		// check for a quick return	
+		if (fact == 0.0) 
+			return;
+
+		const Matrix& Mc = myEle->getCapacityTangent();
+		for (int i = 0; i < numDOF; i++) {
+			double sum = 0.0;
+			for (int j = 0; j < numDOF; j++)
+				sum += Mc(i,j);
+			(*theTangent)(i,i) += fact * sum;
+			}
+		}
+}
+
+
+double
+HT_FE_Element::getCriticalTimeStep(void)
+{
+    if (myEle == 0)
+		return 0.0;
+
+    // the lumped capacity is kept in the residual and the conduction and
+    // boundary terms in the tangent, both are formed again before use
+    const Matrix& Mc = myEle->getCapacityTangent();
+    for (int i = 0; i < numDOF; i++) {
+		double sum = 0.0;
+		for (int j = 0; j < numDOF; j++)
+			sum += Mc(i,j);
+		(*theResidual)(i) = sum;
+		}
+
+    theTangent->Zero();
+    this->addMkAndMqToTang();
+
+    double lambda = 0.0;
+    for (int i = 0; i < numDOF; i++) {
+		if ((*theResidual)(i) <= 0.0)
+			continue;
+		double sum = 0.0;
+		for (int j = 0; j < numDOF; j++)
+			sum += fabs((*theTangent)(i,j));
+		sum /= (*theResidual)(i);
+		if (sum > lambda)
+			lambda = sum;
+		}
+
+    if (lambda <= 0.0)
+		return 0.0;
+
+    return 2.0 / lambda;
+}
+
+
 void  
 HT_FE_Element::zeroResidual(void)
 {
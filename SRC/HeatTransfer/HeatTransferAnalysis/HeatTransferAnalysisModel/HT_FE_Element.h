@@ -56,6 +56,10 @@ class HT_FE_Element: public TaggedObject
     virtual const ID& getID(void) const;
     void setModel(HT_AnalysisModel& theModel);
     virtual int setID(void);
+
+    // give this object a tangent and residual of its own in place of the
+    // class wide ones, so several objects can be formed at the same time
+    int setOwnStorage(void);
     
     // methods to form and obtain the tangent and residual
     virtual const Matrix& getTangent(HeatTransferIntegrator* theIntegrator);
@@ -65,6 +69,13 @@ class HT_FE_Element: public TaggedObject
     virtual void  zeroTangent(void);
     virtual void  addMkAndMqToTang(double fact = 1.0);
 	virtual void  addMcToTang(double fact = 1.0);
+	// the capacity lumped on the diagonal by summing its rows
+	virtual void  addLumpedMcToTang(double fact = 1.0);
+
+	// the largest stable forward Euler step of the element with the lumped
+	// capacity, 2/lambda_max of Mc^-1 (Mk + Mq) with lambda_max bounded by
+	// the row sums; 0 if the element sets no limit
+	virtual double getCriticalTimeStep(void);
     
     // methods to allow integrator to build residual    
     virtual void  zeroResidual(void);    
@@ -85,6 +96,7 @@ class HT_FE_Element: public TaggedObject
     HeatTransferElement* myEle;
     Vector* theResidual;
     Matrix* theTangent;
+    bool ownStorage;
     HeatTransferIntegrator* theIntegrator; // need for Subdomain
     
     // static variables - single copy for all objects of the class	
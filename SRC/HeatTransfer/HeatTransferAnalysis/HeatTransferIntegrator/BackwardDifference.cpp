@@ -33,6 +33,7 @@
 #include <Vector.h>
 #include <HT_DOF_GrpIter.h>
 #include <HT_DOF_Group.h>
+#include <math.h>
 
 
 
@@ -120,6 +121,8 @@ int BackwardDifference::revertToLastStep()
 
 int BackwardDifference::domainChanged()
 {
+    this->HeatTransferIntegrator::domainChanged();
+
     HT_AnalysisModel* myModel = this->getModel();
     LinearSOE* theLinSOE = this->getLinearSOE();
     const Vector& x = theLinSOE->getX();
@@ -198,6 +201,26 @@ int BackwardDifference::domainChanged()
 }
 
 
+// the local error of a backward difference step is estimated from the
+// change in the temperature rate over the step, i.e. the difference between
+// the backward difference and trapezoidal solutions
+double BackwardDifference::getErrorEstimate(void)
+{
+    if (T == 0 || Ttdot == 0)
+		return -1.0;
+
+    double maxChange = 0.0;
+    int size = Tdot->Size();
+    for (int i = 0; i < size; i++)  {
+		double change = fabs((*Tdot)(i) - (*Ttdot)(i));
+		if (change > maxChange)
+			maxChange = change;
+		}
+
+    return 0.5 * alpha * maxChange;
+}
+
+
 int BackwardDifference::update(const Vector& deltaT)
 {
     HT_AnalysisModel* theModel = this->getModel();
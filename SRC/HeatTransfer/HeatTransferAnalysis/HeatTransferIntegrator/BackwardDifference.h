@@ -52,6 +52,7 @@ class BackwardDifference: public HT_TransientIntegrator
 	  int update(const Vector& deltaT);
 	  bool getUpdatingFlag(){return v_form;};
 	  double getAlphaDeltat(){return alpha;};
+	  double getErrorEstimate(void);
    
   protected:
     
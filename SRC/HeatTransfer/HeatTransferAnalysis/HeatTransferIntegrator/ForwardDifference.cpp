@@ -0,0 +1,221 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+#include <ForwardDifference.h>
+#include <HT_FE_Element.h>
+#include <LinearSOE.h>
+#include <HT_AnalysisModel.h>
+#include <Vector.h>
+#include <ID.h>
+#include <HT_FE_EleIter.h>
+#include <HT_DOF_GrpIter.h>
+#include <HT_DOF_Group.h>
+
+
+ForwardDifference::ForwardDifference(double factor)
+:Tt(0), Ttdot(0), T(0), Tdot(0), alpha(0.0),
+ safetyFactor(factor)
+{
+    if (safetyFactor <= 0.0 || safetyFactor > 1.0) {
+		opserr << "WARNING ForwardDifference::ForwardDifference() - safety factor " << factor;
+		opserr << " outside (0, 1], 0.9 used\n";
+		safetyFactor = 0.9;
+		}
+}
+
+
+ForwardDifference::~ForwardDifference()
+{
+    // clean up the memory created 
+    if (Tt != 0)
+		delete Tt;
+    if (Ttdot != 0)
+        delete Ttdot;
+    if (T != 0)
+        delete T;
+    if (Tdot != 0)
+        delete Tdot;
+}
+
+
+int
+ForwardDifference::formEleTangent(HT_FE_Element* theEle)
+{
+    theEle->zeroTangent();
+    theEle->addLumpedMcToTang();
+
+    return 0;
+}
+
+
+int
+ForwardDifference::newStep(double deltaT)
+{
+    HT_AnalysisModel* theModel = this->getModel();
+    alpha = deltaT;
+
+    if (T == 0)  {
+		opserr << "ForwardDifference::newStep() - domainChange() failed or hasn't been called\n";
+		return -3;	
+		}
+
+    // set response at t to be that at t+deltaT of previous step
+    (*Tt) = *T;        
+    (*Ttdot) = *Tdot;  
+
+    // the residual is formed at time t with no transient term
+    (*Tdot).Zero();  
+
+    theModel->setTemp(*T);
+    theModel->setTdot(*Tdot);
+
+    // increment the time to t+deltaT and apply the load
+    double time = theModel->getCurrentDomainTime();
+    time += deltaT;
+    if (theModel->updateDomain(time, deltaT) < 0)  {
+		opserr << "ForwardDifference::newStep() - failed to update the domain\n";
+		return -4;
+		}
+
+    return 0;
+}
+
+
+int
+ForwardDifference::revertToLastStep()
+{
+    // set response at t+deltaT to be that at t .. for next newStep
+    if (T != 0)  {
+		(*T) = *Tt;        
+		(*Tdot) = *Ttdot;  
+		}
+
+    return 0;
+}
+
+
+int
+ForwardDifference::domainChanged()
+{
+    this->HeatTransferIntegrator::domainChanged();
+
+    HT_AnalysisModel* myModel = this->getModel();
+    LinearSOE* theLinSOE = this->getLinearSOE();
+    const Vector& x = theLinSOE->getX();
+    int size = x.Size();
+
+    // create the new Vector objects
+    if (Tt == 0 || Tt->Size() != size)  {
+		if (Tt != 0)
+			delete Tt;
+		if (Ttdot != 0)
+			delete Ttdot;
+		if (T != 0)
+			delete T;
+		if (Tdot != 0)
+			delete Tdot;
+
+		Tt = new Vector(size);
+		Ttdot = new Vector(size);
+		T = new Vector(size);
+		Tdot = new Vector(size);
+		}
+
+    // the HT_DOF_Groups and getting the last committed T&Tdot
+    HT_DOF_GrpIter& theDOFs = myModel->getDOFs();
+    HT_DOF_Group* dofPtr;
+    while ((dofPtr = theDOFs()) != 0)  {
+		const ID& id = dofPtr->getID();
+		int idSize = id.Size();
+
+		const Vector& nodalTemp = dofPtr->getCommittedTemp();	
+		const Vector& nodalTdot = dofPtr->getCommittedTdot();
+		for (int i = 0; i < idSize; i++)  {
+			int loc = id(i);
+			if (loc >= 0)  {
+				(*T)(loc) = nodalTemp(i);
+				(*Tdot)(loc) = nodalTdot(i);
+				}
+			}
+		}    
+
+    return 0;
+}
+
+
+int
+ForwardDifference::update(const Vector& rate)
+{
+    HT_AnalysisModel* theModel = this->getModel();
+    if (theModel == 0)  {
+		opserr << "WARNING ForwardDifference::update() - no HT_AnalysisModel set\n";
+		return -1;
+		}	
+
+    if (Tt == 0)  {
+		opserr << "WARNING ForwardDifference::update() - domainChange() failed or not called\n";
+		return -2;
+		}	
+
+    if (rate.Size() != T->Size())  {
+		opserr << "WARNING ForwardDifference::update() - Vectors of incompatible size ";
+		opserr << " expecting " << T->Size() << " obtained " << rate.Size() << endln;
+		return -3;
+		}
+
+    // the solution of the diagonal system is the rate at time t
+    *Tdot = rate;
+    *T = *Tt;
+    T->addVector(1.0, rate, alpha);
+
+    theModel->setResponse(*T,*Tdot);
+    if (theModel->updateDomain() < 0)  {
+		opserr << "ForwardDifference::update() - failed to update the domain\n";
+		return -4;
+		}
+
+    return 0;
+}
+
+
+// the smallest critical step of the elements at the committed temperatures,
+// which bounds the critical step of the mesh from below
+double
+ForwardDifference::getStableTimeStep(void)
+{
+    HT_AnalysisModel* theModel = this->getModel();
+    if (theModel == 0)
+		return 0.0;
+
+    double dtCrit = 0.0;
+    HT_FE_Element* elePtr;
+    HT_FE_EleIter& theEles = theModel->getFEs();
+    while ((elePtr = theEles()) != 0) {
+		double dt = elePtr->getCriticalTimeStep();
+		if (dt > 0.0 && (dtCrit == 0.0 || dt < dtCrit))
+			dtCrit = dt;
+		}
+
+    return safetyFactor * dtCrit;
+}
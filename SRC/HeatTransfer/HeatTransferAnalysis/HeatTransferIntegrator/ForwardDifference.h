@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+//
+// ForwardDifference is an explicit (forward Euler) integrator for the heat
+// transfer module. The capacity is lumped on the diagonal, so with a
+// DiagonalSOE and the LinearAlgorithm a step is one pass over the elements
+// for the lumped capacity and the residual at time t, and the rates are
+// found node by node:
+//     Tdot = Mc^-1 (Q(T_t) - Mk T_t),  T_{t+dt} = T_t + dt Tdot
+// The step is stable below the critical step of the elements, which is
+// estimated from their lumped capacity and conductance; HT_TransientAnalysis
+// divides the requested step into substeps below safetyFactor times it.
+// Only the diagonal of the tangent is used, so the temperature BCs are
+// imposed by penalty (as by PenaltyBC_Handler) and MP_TemperatureBCs are
+// not supported.
+//
+
+#ifndef ForwardDifference_h
+#define ForwardDifference_h
+
+#include <HT_TransientIntegrator.h>
+
+class HT_FE_Element;
+class Vector;
+
+class ForwardDifference: public HT_TransientIntegrator
+{
+  public:
+	  ForwardDifference(double safetyFactor = 0.9);
+	  ~ForwardDifference();
+
+	  int formEleTangent(HT_FE_Element* theEle);
+
+	  int domainChanged(void);
+	  int newStep(double delta_t);
+	  int revertToLastStep(void);
+	  int update(const Vector& Tdot);
+	  bool getUpdatingFlag(){return true;};
+	  double getAlphaDeltat(){return alpha;};
+	  double getStableTimeStep(void);
+
+  protected:
+
+  private:
+	  Vector *Tt, *Ttdot;  // response quantities at time t
+	  Vector *T, *Tdot;    // response quantities at time t+deltaT
+	  double alpha;
+	  double safetyFactor;
+};
+
+#endif
@@ -49,6 +49,12 @@ class HT_TransientIntegrator: public HeatTransferIntegrator
 	  virtual int initialize(void) {return 0;};
 	  virtual bool getUpdatingFlag() = 0;
 	  virtual double getAlphaDeltat() = 0;
+	  // estimate of the local error in the temperatures of the last step,
+	  // used to adapt the time step; negative if not available
+	  virtual double getErrorEstimate(void) {return -1.0;};
+	  // the largest stable step of an explicit integrator, 0 if the
+	  // integrator is unconditionally stable
+	  virtual double getStableTimeStep(void) {return 0.0;};
 
   protected:
     
@@ -34,9 +34,12 @@
 #include <HT_DOF_Group.h>
 #include <HT_FE_EleIter.h>
 #include <HT_DOF_GrpIter.h>
+#include <Matrix.h>
 
 HeatTransferIntegrator::HeatTransferIntegrator()
-:the_soe(0), the_model(0), the_test(0)
+:the_soe(0), the_model(0), the_test(0),
+ numThreads(1), theFEs(0), theTangents(0), theResiduals(0),
+ numFEs(0), sizeFEs(0), validFEs(false)
 {
 
 }
@@ -44,7 +47,12 @@ HeatTransferIntegrator::HeatTransferIntegrator()
 
 HeatTransferIntegrator::~HeatTransferIntegrator()
 {
-
+    if (theFEs != 0)
+		delete [] theFEs;
+    if (theTangents != 0)
+		delete [] theTangents;
+    if (theResiduals != 0)
+		delete [] theResiduals;
 }
 
 
@@ -62,6 +70,69 @@ HeatTransferIntegrator::setLinks(HT_AnalysisModel& theModel,
 int
 HeatTransferIntegrator::domainChanged()
 {
+    // the FE_Elements may have been replaced
+    validFEs = false;
+    return 0;
+}
+
+
+int
+HeatTransferIntegrator::setNumThreads(int num)
+{
+    if (num < 1)
+		num = 1;
+
+#ifndef _OPENMP
+    if (num > 1) {
+		opserr << "WARNING HeatTransferIntegrator::setNumThreads() - not built with OpenMP,";
+		opserr << " the elements are formed by one thread\n";
+		num = 1;
+		}
+#endif
+
+    numThreads = num;
+    validFEs = false;
+    return 0;
+}
+
+
+int
+HeatTransferIntegrator::setFEs(void)
+{
+    HT_FE_Element* elePtr;
+    int num = 0;
+    HT_FE_EleIter& theEles = the_model->getFEs();
+    while ((elePtr = theEles()) != 0)
+		num++;
+
+    if (num > sizeFEs) {
+		if (theFEs != 0)
+			delete [] theFEs;
+		if (theTangents != 0)
+			delete [] theTangents;
+		if (theResiduals != 0)
+			delete [] theResiduals;
+
+		theFEs = new HT_FE_Element*[num];
+		theTangents = new const Matrix*[num];
+		theResiduals = new const Vector*[num];
+		sizeFEs = num;
+		}
+
+    // the FE_Elements share one tangent and residual by default, each
+    // needs its own when they are formed at the same time
+    numFEs = 0;
+    HT_FE_EleIter& theEles2 = the_model->getFEs();
+    while ((elePtr = theEles2()) != 0) {
+		if (elePtr->setOwnStorage() < 0) {
+			opserr << "WARNING HeatTransferIntegrator::setFEs() -";
+			opserr << " failed to allocate the storage of FE_Element " << numFEs << endln;
+			return -1;
+			}
+		theFEs[numFEs++] = elePtr;
+		}
+
+    validFEs = true;
     return 0;
 }
 
@@ -79,9 +150,30 @@ HeatTransferIntegrator::formTangent()
 
     // zero the A matrix of the linearSOE
     the_soe->zeroA();
+    theTimer.start(HT_PhaseTimer::FormTangent);
     
     // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
+    // efficiency when performing parallel computations
+#ifdef _OPENMP
+    if (numThreads > 1) {
+		if (validFEs == false && this->setFEs() < 0)
+			return -2;
+
+		#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 64)
+		for (int i = 0; i < numFEs; i++)
+			theTangents[i] = &(theFEs[i]->getTangent(this));
+
+		for (int i = 0; i < numFEs; i++)
+			if (the_soe->addA(*theTangents[i], theFEs[i]->getID()) < 0) {
+				opserr << "WARNING HeatTransferIntegrator::formTangent -";
+				opserr << " failed in addA for ID " << theFEs[i]->getID();
+				result = -3;
+				}
+
+		theTimer.stop(HT_PhaseTimer::FormTangent);
+		return result;
+		}
+#endif
 
     // loop through the FE_Elements adding their contributions to the tangent
     HT_FE_Element* elePtr;
@@ -93,6 +185,7 @@ HeatTransferIntegrator::formTangent()
 			result = -3;
 			}
 
+    theTimer.stop(HT_PhaseTimer::FormTangent);
     return result;
 }
 
@@ -107,13 +200,16 @@ HeatTransferIntegrator::formUnbalance(void)
 		}
     
     the_soe->zeroB();
+    theTimer.start(HT_PhaseTimer::FormResidual);
     
     if (this->formElementResidual() < 0) {
 		opserr << "WARNING IncrementalIntegrator::formUnbalance ";
 		opserr << " - this->formElementResidual failed\n";
+		theTimer.stop(HT_PhaseTimer::FormResidual);
 		return -1;
 		}  
 
+    theTimer.stop(HT_PhaseTimer::FormResidual);
     return 0;
 }
     
@@ -178,6 +274,26 @@ HeatTransferIntegrator::formElementResidual(void)
 
     int res = 0;    
 
+#ifdef _OPENMP
+    if (numThreads > 1) {
+		if (validFEs == false && this->setFEs() < 0)
+			return -1;
+
+		#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 64)
+		for (int i = 0; i < numFEs; i++)
+			theResiduals[i] = &(theFEs[i]->getResidual(this));
+
+		for (int i = 0; i < numFEs; i++)
+			if (the_soe->addB(*theResiduals[i], theFEs[i]->getID()) < 0) {
+				opserr << "WARNING HeatTransferIntegrator::formElementResidual -";
+				opserr << " failed in addB for ID " << theFEs[i]->getID();
+				res = -2;
+				}
+
+		return res;
+		}
+#endif
+
     HT_FE_EleIter& theEles = the_model->getFEs();    
     while((elePtr = theEles()) != 0) {
 		if (the_soe->addB(elePtr->getResidual(this),elePtr->getID()) < 0) {
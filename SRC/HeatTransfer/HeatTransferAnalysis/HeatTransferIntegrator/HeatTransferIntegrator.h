@@ -34,7 +34,7 @@
 #ifndef HeatTransferIntegrator_h
 #define HeatTransferIntegrator_h
 
-#include <HeatTransferIntegrator.h>
+#include <HT_PhaseTimer.h>
 
 class LinearSOE;
 class HT_AnalysisModel;
@@ -42,6 +42,7 @@ class HT_ConvergenceTest;
 class HT_FE_Element;
 class HT_DOF_Group;
 class Vector;
+class Matrix;
 
 class HeatTransferIntegrator
 {
@@ -69,6 +70,12 @@ class HeatTransferIntegrator
 		virtual int commit(void);
 		virtual int revertToLastStep(void);
 		virtual int initialize(void);
+
+		// the element tangents and residuals are formed by numThreads threads
+		// when built with OpenMP, and added to the LinearSOE by one thread
+		virtual int setNumThreads(int numThreads);
+		int getNumThreads(void) const {return numThreads;};
+		HT_PhaseTimer& getPhaseTimer(void) {return theTimer;};
      
     protected:
 		LinearSOE* getLinearSOE(void) const;
@@ -82,6 +89,17 @@ class HeatTransferIntegrator
 		LinearSOE* the_soe;
 		HT_AnalysisModel* the_model;
 		HT_ConvergenceTest* the_test;
+
+		int setFEs(void);
+
+		int numThreads;
+		HT_FE_Element** theFEs;        // the FE_Elements of the model, for the parallel loops
+		const Matrix** theTangents;    // and what each of them returned
+		const Vector** theResiduals;
+		int numFEs;
+		int sizeFEs;
+		bool validFEs;
+		HT_PhaseTimer theTimer;
 };
 
 #endif
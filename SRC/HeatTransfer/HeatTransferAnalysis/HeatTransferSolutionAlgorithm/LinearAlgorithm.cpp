@@ -68,6 +68,8 @@ LinearAlgorithm::solveCurrentStep(void)
 	return -5;
 	}
 
+    HT_PhaseTimer& theTimer = theIntegrator->getPhaseTimer();
+
     if (theIntegrator->formTangent() < 0) {
 	opserr << "WARNING LinearAlgorithm::solveCurrentStep() -";
 	opserr << "the Integrator failed in formTangent()\n";
@@ -81,19 +83,23 @@ LinearAlgorithm::solveCurrentStep(void)
 	return -2;
     }
 
+    theTimer.start(HT_PhaseTimer::LinearSolve);
     if (theSOE->solve() < 0) {
 	opserr << "WARNING LinearAlgorithm::solveCurrentStep() -";
 	opserr << "the LinearSOE failed in solve()\n";	
 	return -3;
     }
+    theTimer.stop(HT_PhaseTimer::LinearSolve);
 
     const Vector& deltaT = theSOE->getX();
 
+    theTimer.start(HT_PhaseTimer::DomainUpdate);
     if (theIntegrator->update(deltaT) < 0) {
 	opserr << "WARNING LinearAlgorithm::solveCurrentStep() -";
 	opserr << "the Integrator failed in update()\n";	
 	return -4;
     }
+    theTimer.stop(HT_PhaseTimer::DomainUpdate);
 
     return 0;
 }
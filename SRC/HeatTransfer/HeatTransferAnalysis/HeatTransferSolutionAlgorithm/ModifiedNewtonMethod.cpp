@@ -68,6 +68,8 @@ ModifiedNewtonMethod::solveCurrentStep(void)
 		return -5;
 		}	
 
+    HT_PhaseTimer& theTimer = theIntegrator->getPhaseTimer();
+
     if (theIntegrator->formUnbalance() < 0) {
 		opserr << "WARNING ModifiedNewtonMethod::solveCurrentStep() -";
 		opserr << "the Integrator failed in formUnbalance()\n";	
@@ -94,17 +96,21 @@ ModifiedNewtonMethod::solveCurrentStep(void)
     do {
 		//Timer timer2;
 		//timer2.start();
+		theTimer.start(HT_PhaseTimer::LinearSolve);
 		if (theSOE->solve() < 0) {
 			opserr << "WARNING ModifiedNewtonMethod::solveCurrentStep() -";
 			opserr << "the LinearSOE failed in solve()\n";	
 			return -3;
 			}	    
+		theTimer.stop(HT_PhaseTimer::LinearSolve);
 
+		theTimer.start(HT_PhaseTimer::DomainUpdate);
 		if (theIntegrator->update(theSOE->getX()) < 0) {
 			opserr << "WARNING ModifiedNewtonMethod::solveCurrentStep() -";
 			opserr << "the HeatTransferIntegrator failed in update()\n";	
 			return -4;
 			}	        
+		theTimer.stop(HT_PhaseTimer::DomainUpdate);
 
 		if (theIntegrator->formUnbalance() < 0) {
 			opserr << "WARNING ModifiedNewtonMethod::solveCurrentStep() -";
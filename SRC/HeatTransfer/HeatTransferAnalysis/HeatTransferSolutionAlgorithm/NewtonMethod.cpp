@@ -68,6 +68,8 @@ NewtonMethod::solveCurrentStep(void)
 			return -5;
 		}	
 
+    HT_PhaseTimer& theTimer = theIntegrator->getPhaseTimer();
+
     if (theIntegrator->formUnbalance() < 0) {
 		opserr << "WARNING NewtonMethod::solveCurrentStep() -";
 		opserr << "the Integrator failed in formUnbalance()\n";	
@@ -92,17 +94,21 @@ NewtonMethod::solveCurrentStep(void)
 			return -1;
 			}		    
 
+		theTimer.start(HT_PhaseTimer::LinearSolve);
 		if (theSOE->solve() < 0) {
 			opserr << "WARNING NewtonMethod::solveCurrentStep() -";
 			opserr << "the LinearSOE failed in solve()\n";	
 			return -3;
 			}	    
+		theTimer.stop(HT_PhaseTimer::LinearSolve);
 
+		theTimer.start(HT_PhaseTimer::DomainUpdate);
 		if (theIntegrator->update(theSOE->getX()) < 0) {
 			opserr << "WARNING NewtonMethod::solveCurrentStep() -";
 			opserr << "the HeatTransferIntegrator failed in update()\n";	
 			return -4;
 			}	        
+		theTimer.stop(HT_PhaseTimer::DomainUpdate);
 					//opserr << "x " << theSOE->getX();
 
 		if (theIntegrator->formUnbalance() < 0) {
@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include <ID.h>
 #include <FireModel.h>
+#include <FireExposedFaces.h>
 #include <HeatFluxBC.h>
 //#include <TemperatureBC.h>
 //#include <MapOfTaggedObjects.h>
@@ -40,7 +41,7 @@
 
 
 FireImposedPattern::FireImposedPattern(int tag)
-:BoundaryPattern(tag), the_firemodel(0)
+:BoundaryPattern(tag), the_firemodel(0), theFaces(0), facesChanged(true)
 {
 
 }
@@ -51,7 +52,8 @@ FireImposedPattern::FireImposedPattern(int tag)
 
 FireImposedPattern::~FireImposedPattern()
 {
-    
+    if (theFaces != 0)
+		delete theFaces;
 }
 
 
@@ -67,14 +69,44 @@ FireImposedPattern::setFireModel(FireModel* theFireModel)
 }
 
 
+bool
+FireImposedPattern::addHeatFluxBC(HeatFluxBC* fluxbc)
+{
+    facesChanged = true;
+    return this->BoundaryPattern::addHeatFluxBC(fluxbc);
+}
+
+
+HeatFluxBC*
+FireImposedPattern::removeHeatFluxBC(int tag)
+{
+    facesChanged = true;
+    return this->BoundaryPattern::removeHeatFluxBC(tag);
+}
+
+
 void
-FireImposedPattern::applyBCs(double time)
+FireImposedPattern::clearAll(void)
 {
-    HeatFluxBC* fluxbc;
-    HeatFluxBCIter& fluxIter = this->getHeatFluxBCs();
+    facesChanged = true;
+    this->BoundaryPattern::clearAll();
+}
+
 
-	while ( (fluxbc = fluxIter()) != 0) {
-		the_firemodel->applyFluxBC(fluxbc, time);
-	}
+void
+FireImposedPattern::applyBCs(double time)
+{
+    // the faces are gathered once and the fire model then applies all
+    // the fluxes in one call
+    if (facesChanged) {
+		if (theFaces == 0)
+			theFaces = new FireExposedFaces();
+		if (theFaces->setFluxBCs(this->getHeatFluxBCs(), this->getNumHeatFluxBCs()) < 0) {
+			opserr << "FireImposedPattern::applyBCs() - failed to find the faces of the heat flux BCs\n";
+			exit(-1);
+		}
+		facesChanged = false;
+    }
 
+	the_firemodel->applyFluxBCs(*theFaces, time);
 }
@@ -42,6 +42,7 @@ class TempBCIter;
 class HeatFluxBCIter;
 class HTDomain_Iter;
 class TaggedObjectStorage;
+class FireExposedFaces;
 
 class FireImposedPattern : public BoundaryPattern    
 {
@@ -58,13 +59,13 @@ class FireImposedPattern : public BoundaryPattern
 
     // methods to add loads
     //virtual bool addTemperatureBC(TemperatureBC* );
-    //virtual bool addHeatFluxBC(HeatFluxBC* );
+    virtual bool addHeatFluxBC(HeatFluxBC* );
 /*    virtual HeatFluxBCIter& getHeatFluxBCs(void);    
     virtual TemperatureBCIter& getTemperatureBCs(void);     */   
     
     // methods to remove loads
-    //virtual void clearAll(void);
-    //virtual HeatFluxBC* removeHeatFluxBC(int tag);
+    virtual void clearAll(void);
+    virtual HeatFluxBC* removeHeatFluxBC(int tag);
     //virtual TemperatureBC* removeTemperatureBC(int tag);
 
     // methods to apply loads
@@ -83,6 +84,11 @@ class FireImposedPattern : public BoundaryPattern
     //double factor;     // current load factor
 
     FireModel* the_firemodel; // pointer to associated TimeSeries
+
+    // the fluxes and their faces as handed to the fire model, gathered
+    // again when fluxes are added or removed
+    FireExposedFaces* theFaces;
+    bool facesChanged;
     
     //// storage objects for the fluxes and temperatures
     //TaggedObjectStorage* theHeatFluxBCs;
@@ -56,10 +56,11 @@
 //Domain       *ops_TheActiveDomain = 0;
 
 HeatTransferDomain::HeatTransferDomain()
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), recording(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), 
  currentGeoTag(0), hasDomainChangedFlag(false),
- theBounds(6)
+ theBounds(6), numThreads(1), theElementPtrs(0),
+ numElementPtrs(0), validElementPtrs(false)
 {
     // init the arrays for storing the domain components
     theElements = new MapOfTaggedObjects();
@@ -105,6 +106,9 @@ HeatTransferDomain::~HeatTransferDomain()
   
     if (theElements != 0)
 		delete theElements;    
+
+    if (theElementPtrs != 0)
+		delete [] theElementPtrs;
   
     if (theNodes != 0)
 		delete theNodes;
@@ -468,6 +472,7 @@ HeatTransferDomain::clearAll(void) {
     currentGeoTag = 0;
     // rest the flag to be as initial
     hasDomainChangedFlag = false;
+    validElementPtrs = false;
 }
 
 
@@ -928,7 +933,7 @@ HeatTransferDomain::commit(void)
     dT = 0.0;
 
 	// invoke record on all recorders
-	for (int i=0; i<numRecorders; i++){
+	for (int i=0; i<numRecorders && recording; i++){
 		if (theRecorders[i] != 0)
 			theRecorders[i]->record(currentTime);
 		}
@@ -973,6 +978,35 @@ HeatTransferDomain::update(void)
     int ok = 0;
 
     // invoke update on all the ele's
+#ifdef _OPENMP
+    if (numThreads > 1) {
+		// an element only sets the trial state of its own materials
+		if (validElementPtrs == false) {
+			if (theElementPtrs != 0)
+				delete [] theElementPtrs;
+			numElementPtrs = theElements->getNumComponents();
+			theElementPtrs = new HeatTransferElement*[numElementPtrs];
+
+			HT_ElementIter& theEles = this->getElements();
+			HeatTransferElement* theEle;
+			int i = 0;
+			while ((theEle = theEles()) != 0 && i < numElementPtrs)
+				theElementPtrs[i++] = theEle;
+			numElementPtrs = i;
+			validElementPtrs = true;
+			}
+
+		#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 64) reduction(+:ok)
+		for (int i = 0; i < numElementPtrs; i++)
+			ok += theElementPtrs[i]->update();
+
+		if (ok != 0)
+			opserr << "HeatTransferDomain::update - HeatTransferDomain failed in update\n";
+
+		return ok;
+		}
+#endif
+
     HT_ElementIter& theEles = this->getElements();
     HeatTransferElement* theEle;
 
@@ -1015,6 +1049,26 @@ void
 HeatTransferDomain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    validElementPtrs = false;
+}
+
+
+int
+HeatTransferDomain::setNumThreads(int num)
+{
+    if (num < 1)
+		num = 1;
+
+#ifndef _OPENMP
+    if (num > 1) {
+		opserr << "WARNING HeatTransferDomain::setNumThreads() - not built with OpenMP,";
+		opserr << " the elements are updated by one thread\n";
+		num = 1;
+		}
+#endif
+
+    numThreads = num;
+    return 0;
 }
 
 
@@ -138,6 +138,12 @@ class HeatTransferDomain
 	virtual int  addRecorder(HTRecorder &theRecorder);    	
 	virtual int  removeRecorders(void);
 	virtual int  removeRecorder(int tag);
+	// switch off the recorders for commits between output times
+	virtual void setRecording(bool flag) {recording = flag;};
+
+	// the elements are updated by numThreads threads when built with OpenMP
+	virtual int setNumThreads(int numThreads);
+	int getNumThreads(void) const {return numThreads;};
 
   protected:     
 
@@ -166,6 +172,12 @@ class HeatTransferDomain
 
 	HTRecorder** theRecorders;
 	int numRecorders;    
+	bool recording;
+
+	int numThreads;
+	HeatTransferElement** theElementPtrs;   // the elements, for the parallel update
+	int numElementPtrs;
+	bool validElementPtrs;
 };
 
 #endif
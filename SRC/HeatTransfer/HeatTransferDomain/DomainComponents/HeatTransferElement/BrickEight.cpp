@@ -42,10 +42,10 @@
 const double  BrickEight::root3 = sqrt(3.0) ;
 const double  BrickEight::one_over_root3 = 1.0 / root3 ;
 
-double BrickEight::matrixData[64];
-Matrix BrickEight::K(matrixData, 8, 8);
-Vector BrickEight::Q(8);
-double BrickEight::shp[4][8];
+HT_THREAD_LOCAL double BrickEight::matrixData[64];
+HT_THREAD_LOCAL Matrix BrickEight::K(matrixData, 8, 8);
+HT_THREAD_LOCAL Vector BrickEight::Q(8);
+HT_THREAD_LOCAL double BrickEight::shp[4][8];
 double BrickEight::pts[8][3] = {
 	{-one_over_root3, -one_over_root3, -one_over_root3},
 	{one_over_root3, -one_over_root3, -one_over_root3},
@@ -58,7 +58,7 @@ double BrickEight::pts[8][3] = {
 	};
 const double BrickEight::wts[] = { 1.0, 1.0, 1.0, 1.0, 
                                    1.0, 1.0, 1.0, 1.0};
-double BrickEight::shp2[4];
+HT_THREAD_LOCAL double BrickEight::shp2[4];
 double BrickEight::pts2[4][2] = {
 	{-one_over_root3, -one_over_root3},
 	{one_over_root3, -one_over_root3},
@@ -354,7 +354,7 @@ BrickEight::update()
 	const Vector& Temp7 = theNodes[6]->getTrialTemperature();
 	const Vector& Temp8 = theNodes[7]->getTrialTemperature();
 	
-	static double T[8];
+	double T[8];
 
 	T[0] = Temp1(0);
 	T[1] = Temp2(0);
@@ -365,9 +365,7 @@ BrickEight::update()
 	T[6] = Temp7(0);
 	T[7] = Temp8(0);
 
-	double T_hat;
-
-	int ret = 0;
+	double T_hat[8];
 
 	// Loop over the integration points
 	for (int i = 0; i < 8; i++) {
@@ -377,16 +375,14 @@ BrickEight::update()
 
 		// Interpolate nodal temperatures
 		// T_hat = NT;
-		T_hat = 0;
+		T_hat[i] = 0;
 		for (int beta = 0; beta < 8; beta++) {
-			T_hat += shp[3][beta] * T[beta];
+			T_hat[i] += shp[3][beta] * T[beta];
 			}
-
-		// Set the temperature in material model
-		ret += theMaterial[i]->setTrialTemperature(T_hat);
 		}
 
-	return ret;
+	// Set the temperatures in the material models, all points at once
+	return theMaterial[0]->setTrialTemperatures(theMaterial, T_hat, 8);
 }
 
 
@@ -435,8 +431,8 @@ BrickEight::getCapacityTangent()
 {
 	K.Zero();
 	if (phaseTransformation == true){
-		static double enth[8];
-		static double rc[8]; // rc = rho times specific heat;
+		double enth[8];
+		double rc[8]; // rc = rho times specific heat;
 
 		const Vector& Temp1 = theNodes[0]->getTrialTemperature();
 		const Vector& Temp2 = theNodes[1]->getTrialTemperature();
@@ -447,7 +443,7 @@ BrickEight::getCapacityTangent()
 		const Vector& Temp7 = theNodes[6]->getTrialTemperature();
 		const Vector& Temp8 = theNodes[7]->getTrialTemperature();
 
-		static double T[8];
+		double T[8];
 
 		T[0] = Temp1(0);
 		T[1] = Temp2(0);
@@ -517,8 +513,8 @@ BrickEight::getCapacityTangent()
 				}
 			}
 		} else {
-			static double rhoi[8];
-			static double cpi[8];
+			double rhoi[8];
+			double cpi[8];
 			//opserr << this->getTag() << " capacity tangent\n";
 
 			for (int i = 0; i < 8; i++) {
@@ -679,7 +675,7 @@ BrickEight::get_Q_Transient()
 	const Vector& Tdot7 = theNodes[6]->getTrialTdot();
 	const Vector& Tdot8 = theNodes[7]->getTrialTdot();
 
-	static double Td[8];
+	double Td[8];
 
 	Td[0] = Tdot1(0);
 	Td[1] = Tdot2(0);
@@ -718,7 +714,7 @@ BrickEight::get_Q_Conduction()
 	const Vector& Temp7 = theNodes[6]->getTrialTemperature();
 	const Vector& Temp8 = theNodes[7]->getTrialTemperature();
 
-	static double Ttrial[8];
+	double Ttrial[8];
 
 	Ttrial[0] = Temp1(0);
 	Ttrial[1] = Temp2(0);
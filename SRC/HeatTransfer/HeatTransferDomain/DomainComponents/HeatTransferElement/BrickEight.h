@@ -90,20 +90,20 @@ class BrickEight : public HeatTransferElement
 
     HeatTransferNode* theNodes[8];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;  // Element stiffness matrix
-    static Vector Q;  // Flux vector
+    static HT_THREAD_LOCAL double matrixData[64];  // array data for matrix
+    static HT_THREAD_LOCAL Matrix K;  // Element stiffness matrix
+    static HT_THREAD_LOCAL Vector Q;  // Flux vector
 	Vector Qp;  // Stores the PrecribedSurfFlux
 
 	//quadrature data
     static const double root3 ;
     static const double one_over_root3 ;    
 
-    static double shp[4][8];  // Stores shape functions and derivatives (overwritten)
+    static HT_THREAD_LOCAL double shp[4][8];  // Stores shape functions and derivatives (overwritten)
     static double pts[8][3];  // Stores quadrature points
     static const double wts[];  // Stores quadrature weights
 
-	static double shp2[4];  // Shape function for surface quadrature
+	static HT_THREAD_LOCAL double shp2[4];  // Shape function for surface quadrature
 	static double pts2[4][2];
 	static const double wts2[];
 
@@ -34,11 +34,18 @@
 #ifndef HeatTransferElement_h
 #define HeatTransferElement_h
 #include <list>
+#include <OPS_Globals.h>
 #include <ID.h>
 #include <HeatTransferDomainComponent.h>
 #include <Convection.h>
 #include <Radiation.h>
 
+// The elements keep their shape functions and the matrix and vector they
+// return in class wide storage. When the elements are updated and formed
+// on several threads (see HeatTransferIntegrator::setNumThreads) each
+// thread needs its own copy of it.
+#define HT_THREAD_LOCAL OPS_THREAD_LOCAL
+
 class Matrix;
 class Vector;
 class Information;
@@ -39,13 +39,13 @@
 #include <Convection.h>
 #include <PrescribedSurfFlux.h>
 
-double LineTwo::matrixData[4];
-Matrix LineTwo::K(matrixData, 2, 2);
-Vector LineTwo::Q(2);
-double LineTwo::shp[2];
+HT_THREAD_LOCAL double LineTwo::matrixData[4];
+HT_THREAD_LOCAL Matrix LineTwo::K(matrixData, 2, 2);
+HT_THREAD_LOCAL Vector LineTwo::Q(2);
+HT_THREAD_LOCAL double LineTwo::shp[2];
 double LineTwo::pts[2];
 double LineTwo::wts[2];
-double LineTwo::shpd[2];
+HT_THREAD_LOCAL double LineTwo::shpd[2];
 
 
 
@@ -248,7 +248,7 @@ LineTwo::update()
 	const Vector& Temp2 = theNodes[1]->getTrialTemperature();
 	
 	
-	static double T[2];
+	double T[2];
 
 	T[0] = Temp1(0);
 	T[1] = Temp2(0);
@@ -319,13 +319,13 @@ LineTwo::getCapacityTangent()
 {
 	K.Zero();
 	if (phaseTransformation == true){
-		static double enth[2];
-		static double rc[2]; // rc = rho times specific heat;
+		double enth[2];
+		double rc[2]; // rc = rho times specific heat;
 
 		const Vector& Temp1 = theNodes[0]->getTrialTemperature();
 		const Vector& Temp2 = theNodes[1]->getTrialTemperature();
 
-		static double T[2];
+		double T[2];
 
 		T[0] = Temp1(0);
 		T[1] = Temp2(0);
@@ -383,8 +383,8 @@ LineTwo::getCapacityTangent()
 			}
 		//end of
 		} else {
-			static double rhoi[2];
-			static double cpi[2];
+			double rhoi[2];
+			double cpi[2];
 			//opserr << this->getTag() << " capacity tangent\n";
 
 			for (int i = 0; i < 2; i++) {
@@ -509,7 +509,7 @@ LineTwo::get_Q_Transient()
 	const Vector& Tdot2 = theNodes[1]->getTrialTdot();
 	
 
-	static double Td[4];
+	double Td[4];
 
 	Td[0] = Tdot1(0);
 	Td[1] = Tdot2(0);
@@ -538,7 +538,7 @@ LineTwo::get_Q_Conduction()
 	const Vector& Temp1 = theNodes[0]->getTrialTemperature();
 	const Vector& Temp2 = theNodes[1]->getTrialTemperature();
 	
-	static double Ttrial[2];
+	double Ttrial[2];
 
 	Ttrial[0] = Temp1(0);
 	Ttrial[1] = Temp2(0);
@@ -89,15 +89,15 @@ class LineTwo : public HeatTransferElement
 
     HeatTransferNode* theNodes[2];
 
-    static double matrixData[4];  // array data for matrix
-    static Matrix K;  // Element stiffness matrix
-    static Vector Q;  // Flux vector
+    static HT_THREAD_LOCAL double matrixData[4];  // array data for matrix
+    static HT_THREAD_LOCAL Matrix K;  // Element stiffness matrix
+    static HT_THREAD_LOCAL Vector Q;  // Flux vector
 	Vector Qp;  // Stores the PrecribedSurfFlux
 
-    static double shp[2];  // Stores shape functions 
+    static HT_THREAD_LOCAL double shp[2];  // Stores shape functions 
     static double pts[2];  // Stores quadrature points
     static double wts[2];  // Stores quadrature weights
-	static double shpd[2]; //shape funtion derivatives (overwritten)
+	static HT_THREAD_LOCAL double shpd[2]; //shape funtion derivatives (overwritten)
 
 	//static double shp2[2];  // Shape function and derivatives for line quadrature
 	//static double pts2[2];
@@ -39,13 +39,13 @@
 #include <Convection.h>
 #include <PrescribedSurfFlux.h>
 
-double QuadEight::matrixData[64];
-Matrix QuadEight::K(matrixData, 8, 8);
-Vector QuadEight::Q(8);
-double QuadEight::shp[3][8];
+HT_THREAD_LOCAL double QuadEight::matrixData[64];
+HT_THREAD_LOCAL Matrix QuadEight::K(matrixData, 8, 8);
+HT_THREAD_LOCAL Vector QuadEight::Q(8);
+HT_THREAD_LOCAL double QuadEight::shp[3][8];
 double QuadEight::pts[9][2];
 double QuadEight::wts[9];
-double QuadEight::shp2[3];
+HT_THREAD_LOCAL double QuadEight::shp2[3];
 double QuadEight::pts2[3];
 double QuadEight::wts2[3];
 int    QuadEight::npface[4][3];
@@ -324,7 +324,7 @@ QuadEight::update()
 	const Vector& Temp7 = theNodes[6]->getTrialTemperature();
 	const Vector& Temp8 = theNodes[7]->getTrialTemperature();
 	
-	static double T[8];
+	double T[8];
 
 	T[0] = Temp1(0);
 	T[1] = Temp2(0);
@@ -335,9 +335,7 @@ QuadEight::update()
 	T[6] = Temp7(0);
 	T[7] = Temp8(0);
 
-	double T_hat;
-
-	int ret = 0;
+	double T_hat[9];
 
 	// Loop over the integration points
 	for (int i = 0; i < 9; i++) {
@@ -347,16 +345,14 @@ QuadEight::update()
 
 		// Interpolate nodal temperatures
 		// T_hat = NT;
-		T_hat = 0;
+		T_hat[i] = 0;
 		for (int beta = 0; beta < 8; beta++) {
-			T_hat += shp[2][beta] * T[beta];
+			T_hat[i] += shp[2][beta] * T[beta];
 			}
-
-		// Set the temperature in material model
-		ret += theMaterial[i]->setTrialTemperature(T_hat);
 		}
 
-	return ret;
+	// Set the temperatures in the material models, all points at once
+	return theMaterial[0]->setTrialTemperatures(theMaterial, T_hat, 9);
 }
 
 
@@ -400,8 +396,8 @@ QuadEight::getCapacityTangent()
 {
 	K.Zero();
 	if (phaseTransformation == true){
-		static double enth[8];
-		static double rc[9]; // rc = rho times specific heat;
+		double enth[8];
+		double rc[9]; // rc = rho times specific heat;
 		const Vector& Temp1 = theNodes[0]->getTrialTemperature();
 		const Vector& Temp2 = theNodes[1]->getTrialTemperature();
 		const Vector& Temp3 = theNodes[2]->getTrialTemperature();
@@ -411,7 +407,7 @@ QuadEight::getCapacityTangent()
 		const Vector& Temp7 = theNodes[6]->getTrialTemperature();
 		const Vector& Temp8 = theNodes[7]->getTrialTemperature();
 
-		static double T[8];
+		double T[8];
 
 		T[0] = Temp1(0);
 		T[1] = Temp2(0);
@@ -476,8 +472,8 @@ QuadEight::getCapacityTangent()
 				}
 			}
 		} else {
-			static double rhoi[9];
-			static double cpi[9];
+			double rhoi[9];
+			double cpi[9];
 
 			//for (int i = 0; i < 9; i++) {
 			//	rhoi[i] = theMaterial[i]->getRho(); // enable to account for temperature dependent density
@@ -639,7 +635,7 @@ QuadEight::get_Q_Transient()
 	const Vector& Tdot7 = theNodes[6]->getTrialTdot();
 	const Vector& Tdot8 = theNodes[7]->getTrialTdot();
 
-	static double Td[8];
+	double Td[8];
 
 	Td[0] = Tdot1(0);
 	Td[1] = Tdot2(0);
@@ -678,7 +674,7 @@ QuadEight::get_Q_Conduction()
 	const Vector& Temp7 = theNodes[6]->getTrialTemperature();
 	const Vector& Temp8 = theNodes[7]->getTrialTemperature();
 
-	static double Ttrial[8];
+	double Ttrial[8];
 
 	Ttrial[0] = Temp1(0);
 	Ttrial[1] = Temp2(0);
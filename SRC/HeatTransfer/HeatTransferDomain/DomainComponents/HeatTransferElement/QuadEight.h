@@ -91,16 +91,16 @@ class QuadEight: public HeatTransferElement
 
     HeatTransferNode* theNodes[8];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;  // Element stiffness matrix
-    static Vector Q;  // Flux vector
+    static HT_THREAD_LOCAL double matrixData[64];  // array data for matrix
+    static HT_THREAD_LOCAL Matrix K;  // Element stiffness matrix
+    static HT_THREAD_LOCAL Vector Q;  // Flux vector
 	Vector Qp;  // Stores the PrecribedSurfFlux
 
-    static double shp[3][8];  // Stores shape functions and derivatives (overwritten)
+    static HT_THREAD_LOCAL double shp[3][8];  // Stores shape functions and derivatives (overwritten)
     static double pts[9][2];  // Stores quadrature points
     static double wts[9];  // Stores quadrature weights
 
-	static double shp2[3];  // Shape function and derivatives for line quadrature
+	static HT_THREAD_LOCAL double shp2[3];  // Shape function and derivatives for line quadrature
 	static double pts2[3];
 	static double wts2[3];
 	static int npface[4][3];
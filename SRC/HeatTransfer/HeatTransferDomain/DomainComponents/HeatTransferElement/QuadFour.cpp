@@ -40,13 +40,13 @@
 #include <PrescribedSurfFlux.h>
 #include <Information.h>
 
-double QuadFour::matrixData[16];
-Matrix QuadFour::K(matrixData, 4, 4);
-Vector QuadFour::Q(4);
-double QuadFour::shp[3][4];
+HT_THREAD_LOCAL double QuadFour::matrixData[16];
+HT_THREAD_LOCAL Matrix QuadFour::K(matrixData, 4, 4);
+HT_THREAD_LOCAL Vector QuadFour::Q(4);
+HT_THREAD_LOCAL double QuadFour::shp[3][4];
 double QuadFour::pts[4][2];
 double QuadFour::wts[4];
-double QuadFour::shp2[2];
+HT_THREAD_LOCAL double QuadFour::shp2[2];
 double QuadFour::pts2[2];
 double QuadFour::wts2[2];
 int QuadFour::npface[4][2];
@@ -276,16 +276,14 @@ QuadFour::update()
 	const Vector& Temp3 = theNodes[2]->getTrialTemperature();
 	const Vector& Temp4 = theNodes[3]->getTrialTemperature();
 	
-	static double T[4];
+	double T[4];
 
 	T[0] = Temp1(0);
 	T[1] = Temp2(0);
 	T[2] = Temp3(0);
 	T[3] = Temp4(0);
 
-	double T_hat;
-
-	int ret = 0;
+	double T_hat[4];
 
 	// Loop over the integration points
 	for (int i = 0; i < 4; i++) {
@@ -295,16 +293,14 @@ QuadFour::update()
 
 		// Interpolate nodal temperatures
 		// T_hat = NT;
-		T_hat = 0;
+		T_hat[i] = 0;
 		for (int beta = 0; beta < 4; beta++) {
-			T_hat += shp[2][beta] * T[beta];
+			T_hat[i] += shp[2][beta] * T[beta];
 			}
-
-		// Set the temperature in material model
-		ret += theMaterial[i]->setTrialTemperature(T_hat);
 		}
 
-	return ret;
+	// Set the temperatures in the material models, all points at once
+	return theMaterial[0]->setTrialTemperatures(theMaterial, T_hat, 4);
 }
 
 
@@ -357,7 +353,7 @@ QuadFour::getCapacityTangent()
 		const Vector& Temp3 = theNodes[2]->getTrialTemperature();
 		const Vector& Temp4 = theNodes[3]->getTrialTemperature();
 
-		static double T[4];
+		double T[4];
 
 		T[0] = Temp1(0);
 		T[1] = Temp2(0);
@@ -576,7 +572,7 @@ QuadFour::get_Q_Transient()
 	const Vector& Tdot3 = theNodes[2]->getTrialTdot();
 	const Vector& Tdot4 = theNodes[3]->getTrialTdot();
 
-	static double Td[4];
+	double Td[4];
 
 	Td[0] = Tdot1(0);
 	Td[1] = Tdot2(0);
@@ -640,7 +636,7 @@ QuadFour::get_Q_Conduction()
 	const Vector& Temp3 = theNodes[2]->getTrialTemperature();
 	const Vector& Temp4 = theNodes[3]->getTrialTemperature();
 
-	static double Ttrial[4];
+	double Ttrial[4];
 
 	Ttrial[0] = Temp1(0);
 	Ttrial[1] = Temp2(0);
@@ -859,7 +855,7 @@ QuadFour::getInterpolatedTemp(int tag)
 
 	const Vector& Temp1 = theNodes[node1]->getTrialTemperature();
 	const Vector& Temp2 = theNodes[node2]->getTrialTemperature();
-	static double T[2];
+	double T[2];
 	T[0] = Temp1(0);
 	T[1] = Temp2(0);
 
@@ -92,16 +92,16 @@ class QuadFour : public HeatTransferElement
 
     HeatTransferNode* theNodes[4];
 
-    static double matrixData[16];  // array data for matrix
-    static Matrix K;  // Element stiffness matrix
-    static Vector Q;  // Flux vector
+    static HT_THREAD_LOCAL double matrixData[16];  // array data for matrix
+    static HT_THREAD_LOCAL Matrix K;  // Element stiffness matrix
+    static HT_THREAD_LOCAL Vector Q;  // Flux vector
 	Vector Qp;  // Stores the PrecribedSurfFlux
 
-    static double shp[3][4];  // Stores shape functions and derivatives (overwritten)
+    static HT_THREAD_LOCAL double shp[3][4];  // Stores shape functions and derivatives (overwritten)
     static double pts[4][2];  // Stores quadrature points
     static double wts[4];  // Stores quadrature weights
 
-	static double shp2[2];  // Shape function and derivatives for line quadrature
+	static HT_THREAD_LOCAL double shp2[2];  // Shape function and derivatives for line quadrature
 	static double pts2[2];
 	static double wts2[2];
 	static int npface[4][2];
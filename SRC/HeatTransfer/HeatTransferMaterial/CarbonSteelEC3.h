@@ -46,6 +46,7 @@ class CarbonSteelEC3: public HeatTransferMaterial
 		// used for returning nodal enthalpy values
 		double getEnthalpy(double NodalTemp);  
 		HeatTransferMaterial* getCopy();
+		bool isTabulatable() {return true;};
 
 		int commitState();
 		int revertToLastCommit();
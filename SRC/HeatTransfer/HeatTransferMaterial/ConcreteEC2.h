@@ -47,6 +47,7 @@ class ConcreteEC2: public HeatTransferMaterial
 		// used for returning nodal enthalpy values
 		double getEnthalpy(double nodalTemp);  
 		HeatTransferMaterial* getCopy();
+		bool isTabulatable() {return true;};
 
 		int commitState();
 		int revertToLastCommit();
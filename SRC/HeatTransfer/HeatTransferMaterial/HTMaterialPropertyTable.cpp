@@ -0,0 +1,158 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+#include <HTMaterialPropertyTable.h>
+#include <HeatTransferMaterial.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+#include <cmath>
+
+
+// sample the properties of theMaterial at temperature T
+static void
+sampleMaterial(HeatTransferMaterial& theMaterial, double T, double* row)
+{
+	theMaterial.setTrialTemperature(T);
+	row[0] = (theMaterial.getConductivity())(0,0);
+	row[1] = theMaterial.getSpecificHeat();
+	row[2] = theMaterial.getRho();
+}
+
+
+// position of T in the table: row i with fraction f in [0,1] for k, c and rho,
+// and the unclamped fraction fH with which H is extended outside the table.
+// The clamps are plain min/max selections, so there is no branch to mispredict.
+static inline void
+locate(double T, double Tmin, double invdT, double xMax, int iMax, int& i, double& f, double& fH)
+{
+	double x = (T - Tmin) * invdT;
+	double xc = x > 0.0 ? x : 0.0;
+	xc = xc < xMax ? xc : xMax;
+	i = (int)xc;
+	i = i < iMax ? i : iMax;
+	f = xc - i;
+	fH = x - i;
+}
+
+
+HTMaterialPropertyTable::HTMaterialPropertyTable(HeatTransferMaterial& theMaterial,
+												 double tmin, double tmax, double dt)
+:Tmin(tmin), Tmax(tmax), dT(dt), invdT(0.0), numPoints(0), numRefs(0), data(0)
+{
+	if (dT <= 0.0) {
+		opserr << "WARNING HTMaterialPropertyTable - invalid temperature interval " << dT
+			<< ", 1.0 is used\n";
+		dT = 1.0;
+	}
+	if (Tmax < Tmin + dT)
+		Tmax = Tmin + dT;
+
+	// adjust dT so that the grid ends on Tmax
+	numPoints = (int)ceil((Tmax - Tmin) / dT - 1.0e-9) + 1;
+	dT = (Tmax - Tmin) / (numPoints - 1);
+	invdT = 1.0 / dT;
+
+	data = new double[4 * numPoints];
+
+	// H is integrated with Simpson's rule over each interval; several of the
+	// Eurocode curves end with a strict inequality, so the last point is
+	// sampled just inside Tmax
+	double mid[4];
+	sampleMaterial(theMaterial, Tmin, data);
+	data[3] = 0.0;
+	for (int i = 1; i < numPoints; i++) {
+		double* row = data + 4 * i;
+		double T = (i == numPoints - 1) ? Tmax - 1.0e-6 * dT : Tmin + i * dT;
+		sampleMaterial(theMaterial, Tmin + (i - 0.5) * dT, mid);
+		sampleMaterial(theMaterial, T, row);
+		row[3] = row[-1] + dT / 6.0 * (row[-3] * row[-2] + 4.0 * mid[1] * mid[2] + row[1] * row[2]);
+	}
+}
+
+
+HTMaterialPropertyTable::~HTMaterialPropertyTable()
+{
+	if (data != 0)
+		delete [] data;
+}
+
+
+void
+HTMaterialPropertyTable::detach(void)
+{
+	numRefs--;
+	if (numRefs <= 0)
+		delete this;
+}
+
+
+void
+HTMaterialPropertyTable::getProperties(double T, double& kc, double& cp, double& rho, double& H)
+{
+	int i;
+	double f, fH;
+	locate(T, Tmin, invdT, numPoints - 1, numPoints - 2, i, f, fH);
+
+	const double* p = data + 4 * i;
+	kc = p[0] + f * (p[4] - p[0]);
+	cp = p[1] + f * (p[5] - p[1]);
+	rho = p[2] + f * (p[6] - p[2]);
+	H = p[3] + fH * (p[7] - p[3]);
+}
+
+
+double
+HTMaterialPropertyTable::getEnthalpy(double T)
+{
+	int i;
+	double f, fH;
+	locate(T, Tmin, invdT, numPoints - 1, numPoints - 2, i, f, fH);
+
+	const double* p = data + 4 * i;
+	return p[3] + fH * (p[7] - p[3]);
+}
+
+
+void
+HTMaterialPropertyTable::getProperties(const double* T, int numT, double* kc, double* cp,
+									   double* rho, double* H)
+{
+	const double xMax = numPoints - 1;
+	const int iMax = numPoints - 2;
+	const double* theData = data;
+
+	// the loop body has no branches and the iterations are independent,
+	// so the compiler is free to vectorise it
+	for (int j = 0; j < numT; j++) {
+		int i;
+		double f, fH;
+		locate(T[j], Tmin, invdT, xMax, iMax, i, f, fH);
+
+		const double* p = theData + 4 * i;
+		kc[j] = p[0] + f * (p[4] - p[0]);
+		cp[j] = p[1] + f * (p[5] - p[1]);
+		rho[j] = p[2] + f * (p[6] - p[2]);
+		H[j] = p[3] + fH * (p[7] - p[3]);
+	}
+}
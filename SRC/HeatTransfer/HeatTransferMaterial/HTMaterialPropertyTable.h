@@ -0,0 +1,77 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+//
+// HTMaterialPropertyTable holds the conductivity k(T), specific heat c(T),
+// density rho(T) and enthalpy H(T) of an isotropic HeatTransferMaterial
+// sampled on a uniform temperature grid. Lookups are linear interpolations
+// on the grid without any branching, so the properties of all the
+// integration points of an element can be evaluated in a single loop.
+// H is the integral of rho*c over T (zero at the lower bound of the table),
+// so it is consistent with the heat capacity the elements use.
+// Outside the table k, c and rho are held constant and H is extended linearly.
+//
+
+#ifndef HTMaterialPropertyTable_h
+#define HTMaterialPropertyTable_h
+
+class HeatTransferMaterial;
+
+class HTMaterialPropertyTable
+{
+    public:
+		// samples theMaterial, whose trial state is changed, on [Tmin, Tmax]
+		// (temperatures in K as passed to setTrialTemperature) at interval dT
+		HTMaterialPropertyTable(HeatTransferMaterial& theMaterial, double Tmin, double Tmax, double dT);
+		~HTMaterialPropertyTable();
+
+		int getNumPoints(void) {return numPoints;};
+		double getTmin(void) {return Tmin;};
+		double getTmax(void) {return Tmax;};
+
+		// properties at a single temperature
+		void getProperties(double T, double& kc, double& cp, double& rho, double& H);
+		double getEnthalpy(double T);
+
+		// properties at numT temperatures, written to the arrays kc, cp, rho and H
+		void getProperties(const double* T, int numT, double* kc, double* cp, double* rho, double* H);
+
+		// the material copies using a table share it; the last one to
+		// detach deletes it
+		void attach(void) {numRefs++;};
+		void detach(void);
+
+    protected:
+
+    private:
+		double Tmin, Tmax, dT, invdT;
+		int numPoints;
+		int numRefs;
+
+		// numPoints rows of (k, c, rho, H)
+		double* data;
+};
+
+
+#endif
@@ -48,6 +48,17 @@ HeatTransferMaterial::~HeatTransferMaterial()
 }
 
 
+int
+HeatTransferMaterial::setTrialTemperatures(HeatTransferMaterial** theMaterials, const double* T, int numPoints)
+{
+    int ret = 0;
+    for (int i = 0; i < numPoints; i++)
+        ret += theMaterials[i]->setTrialTemperature(T[i]);
+
+    return ret;
+}
+
+
 const Vector&
 HeatTransferMaterial::getPars() {
     opserr << "HeatTransferMaterial::getPars should not be called";
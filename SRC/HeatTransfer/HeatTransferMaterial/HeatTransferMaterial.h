@@ -35,6 +35,7 @@ class OPS_Stream;
 class Matrix;
 class Information;
 class Response;
+class HTMaterialPropertyTable;
 
 class HeatTransferMaterial: public TaggedObject
 {
@@ -44,6 +45,9 @@ class HeatTransferMaterial: public TaggedObject
 
 		// method for this material to update itself according to its new parameters
 		virtual int setTrialTemperature(double T, int par=0 ) = 0;
+		// sets the trial temperatures of the materials at all the integration
+		// points of an element, this being theMaterials[0]
+		virtual int setTrialTemperatures(HeatTransferMaterial** theMaterials, const double* T, int numPoints);
 		virtual const Matrix& getConductivity() = 0;
 		virtual double getRho() = 0;
 		virtual double getSpecificHeat() = 0;
@@ -64,6 +68,12 @@ class HeatTransferMaterial: public TaggedObject
 		virtual int getResponse(int responseID, Information& matInformation);
 
 		virtual const Vector&  getPars();
+		// true if the properties are isotropic and depend on the temperature
+		// alone, so that they can be served from an HTMaterialPropertyTable;
+		// not so for materials with a history or phase state (TimberHTMaterial)
+		virtual bool isTabulatable() {return false;};
+		// the property table serving this material, 0 if it is not tabulated
+		virtual HTMaterialPropertyTable* getPropertyTable() {return 0;};
 
     protected:
 		Matrix* k;
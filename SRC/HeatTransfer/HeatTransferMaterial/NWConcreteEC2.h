@@ -48,6 +48,7 @@ class NWConcreteEC2: public HeatTransferMaterial
 		// used for returning nodal enthalpy values
 		double getEnthalpy(double nodalTemp);  
 		HeatTransferMaterial* getCopy();
+		bool isTabulatable() {return true;};
 
 		int commitState();
 		int revertToLastCommit();
@@ -47,6 +47,7 @@ class SimpleMaterial: public HeatTransferMaterial
 		double getEnthalpy();
 		double getEnthalpy(double temp);
 		HeatTransferMaterial* getCopy();
+		bool isTabulatable() {return true;};
 
 		void update();
 		int commitState();
@@ -47,6 +47,7 @@ class StainlessSteelEC: public HeatTransferMaterial
 		// used for returning nodal enthalpy values
 		double getEnthalpy(double NodalTemp);  
 		HeatTransferMaterial* getCopy();
+		bool isTabulatable() {return true;};
 
 		int commitState();
 		int revertToLastCommit();
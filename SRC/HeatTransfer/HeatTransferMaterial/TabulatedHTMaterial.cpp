@@ -0,0 +1,192 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+#include <TabulatedHTMaterial.h>
+#include <HTMaterialPropertyTable.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+
+#define TABULATEDHT_BATCH 32
+
+
+TabulatedHTMaterial::TabulatedHTMaterial(int tag, HeatTransferMaterial& theMaterial,
+										 double dT, double Tmin, double Tmax)
+:HeatTransferMaterial(tag), theTable(0), trial_temp(0.0),
+ kc(0.0), cp(0.0), rho(0.0), enthalpy(0.0)
+{
+	k = new Matrix(3,3);
+
+	// sample a copy so the trial state of theMaterial is left alone
+	HeatTransferMaterial* theCopy = theMaterial.getCopy();
+	theTable = new HTMaterialPropertyTable(*theCopy, Tmin, Tmax, dT);
+	delete theCopy;
+
+	theTable->attach();
+	this->setTrialTemperature(Tmin);
+}
+
+
+TabulatedHTMaterial::TabulatedHTMaterial(int tag, HTMaterialPropertyTable* table)
+:HeatTransferMaterial(tag), theTable(table), trial_temp(0.0),
+ kc(0.0), cp(0.0), rho(0.0), enthalpy(0.0)
+{
+	k = new Matrix(3,3);
+	theTable->attach();
+}
+
+
+TabulatedHTMaterial::~TabulatedHTMaterial()
+{
+	if (k != 0)
+		delete k;
+	if (theTable != 0)
+		theTable->detach();
+}
+
+
+int
+TabulatedHTMaterial::setTrialTemperature(double temp, int par)
+{
+	trial_temp = temp;
+	theTable->getProperties(temp, kc, cp, rho, enthalpy);
+	return 0;
+}
+
+
+int
+TabulatedHTMaterial::setTrialTemperatures(HeatTransferMaterial** theMaterials, const double* T,
+										  int numPoints)
+{
+	// the batched lookup is only valid if all the points share this table
+	for (int i = 0; i < numPoints; i++) {
+		if (theMaterials[i]->getPropertyTable() != theTable)
+			return this->HeatTransferMaterial::setTrialTemperatures(theMaterials, T, numPoints);
+	}
+
+	double kcs[TABULATEDHT_BATCH], cps[TABULATEDHT_BATCH];
+	double rhos[TABULATEDHT_BATCH], enthalpies[TABULATEDHT_BATCH];
+
+	for (int start = 0; start < numPoints; start += TABULATEDHT_BATCH) {
+		int num = numPoints - start;
+		if (num > TABULATEDHT_BATCH)
+			num = TABULATEDHT_BATCH;
+
+		theTable->getProperties(&T[start], num, kcs, cps, rhos, enthalpies);
+
+		for (int i = 0; i < num; i++) {
+			TabulatedHTMaterial* theMaterial = (TabulatedHTMaterial*)theMaterials[start + i];
+			theMaterial->trial_temp = T[start + i];
+			theMaterial->kc = kcs[i];
+			theMaterial->cp = cps[i];
+			theMaterial->rho = rhos[i];
+			theMaterial->enthalpy = enthalpies[i];
+		}
+	}
+
+	return 0;
+}
+
+
+const Matrix&
+TabulatedHTMaterial::getConductivity(void)
+{
+	(*k)(0,0) = kc;
+	(*k)(1,1) = kc;
+	(*k)(2,2) = kc;
+
+	return *k;
+}
+
+
+double
+TabulatedHTMaterial::getRho(void)
+{
+	return rho;
+}
+
+
+double
+TabulatedHTMaterial::getSpecificHeat(void)
+{
+	return cp;
+}
+
+
+double
+TabulatedHTMaterial::getEnthalpy()
+{
+	return enthalpy;
+}
+
+
+double
+TabulatedHTMaterial::getEnthalpy(double temp)
+{
+	return theTable->getEnthalpy(temp);
+}
+
+
+HeatTransferMaterial*
+TabulatedHTMaterial::getCopy(void)
+{
+	TabulatedHTMaterial* theCopy = new TabulatedHTMaterial(this->getTag(), theTable);
+	theCopy->setTrialTemperature(trial_temp);
+	return theCopy;
+}
+
+
+void
+TabulatedHTMaterial::update()
+{
+	return;
+}
+
+
+int
+TabulatedHTMaterial::commitState(void)
+{
+	return 0;
+}
+
+
+int
+TabulatedHTMaterial::revertToLastCommit(void)
+{
+	return 0;
+}
+
+
+int
+TabulatedHTMaterial::revertToStart(void)
+{
+	return 0;
+}
+
+
+void
+TabulatedHTMaterial::Print(OPS_Stream& s, int flag)
+{
+	s << "TabulatedHTMaterial, tag: " << this->getTag() << ", " << theTable->getNumPoints()
+	  << " points on [" << theTable->getTmin() << ", " << theTable->getTmax() << "] K\n";
+}
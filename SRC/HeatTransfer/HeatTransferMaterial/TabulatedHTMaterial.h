@@ -0,0 +1,78 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+//
+// TabulatedHTMaterial serves the properties of an isotropic, stateless
+// HeatTransferMaterial (CarbonSteelEC3, ConcreteEC2, StainlessSteelEC,
+// SFRMCoating, ...) from an HTMaterialPropertyTable sampled once when the
+// material is created, instead of evaluating the piecewise curves at every
+// integration point and iteration. All copies given to the elements share
+// the one table.
+//
+
+#ifndef TabulatedHTMaterial_h
+#define TabulatedHTMaterial_h
+
+#include <HeatTransferMaterial.h>
+
+class HTMaterialPropertyTable;
+
+class TabulatedHTMaterial: public HeatTransferMaterial
+{
+    public:
+		// the table covers [Tmin, Tmax] in K, by default 0 to 1200 degree C
+		TabulatedHTMaterial(int tag, HeatTransferMaterial& theMaterial, double dT = 1.0,
+							double Tmin = 273.15, double Tmax = 1473.15);
+		virtual ~TabulatedHTMaterial();
+
+		int setTrialTemperature(double T, int par = 0);
+		int setTrialTemperatures(HeatTransferMaterial** theMaterials, const double* T, int numPoints);
+		const Matrix& getConductivity();
+		double getRho();
+		double getSpecificHeat();
+		double getEnthalpy();
+		// used for returning nodal enthalpy values
+		double getEnthalpy(double NodalTemp);
+		HeatTransferMaterial* getCopy();
+		bool isTabulatable() {return true;};
+		HTMaterialPropertyTable* getPropertyTable() {return theTable;};
+
+		int commitState();
+		int revertToLastCommit();
+		int revertToStart();
+		void update();
+		void  Print(OPS_Stream&, int = 0);
+
+    protected:
+
+    private:
+		TabulatedHTMaterial(int tag, HTMaterialPropertyTable* theTable);
+
+		HTMaterialPropertyTable* theTable;
+		double trial_temp;
+		double kc, cp, rho, enthalpy;
+};
+
+
+#endif
@@ -0,0 +1,185 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file is a driver to compare the properties served by a
+// TabulatedHTMaterial with those of the analytic CarbonSteelEC3, ConcreteEC2,
+// StainlessSteelEC and SFRMCoating materials, to check that the tabulated
+// enthalpy is the integral of rho*c, and to compare the time taken to
+// evaluate the properties of all the integration points of a QuadFour
+// element (4 points) along both paths.
+//
+// usage: testHTMaterialPropertyTable <dT?> <numElements?>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include <Matrix.h>
+#include <CarbonSteelEC3.h>
+#include <ConcreteEC2.h>
+#include <StainlessSteelEC.h>
+#include <SFRMCoating.h>
+#include <TabulatedHTMaterial.h>
+#include <StandardStream.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+#define NUM_POINTS 4
+
+static double
+elapsedTime(clock_t start)
+{
+  return (double)(clock() - start)/CLOCKS_PER_SEC;
+}
+
+static double
+relativeError(double a, double b)
+{
+  double scale = fabs(b) > 1.0e-12 ? fabs(b) : 1.0;
+  return fabs(a - b)/scale;
+}
+
+// temperatures (K) of the integration points of numElements elements in
+// [20, 1190] degree C
+static void
+fillTemperatures(double *T, int num)
+{
+  srand(12345);
+  for (int i=0; i<num; i++)
+    T[i] = 293.15 + 1170.0*rand()/(double)RAND_MAX;
+}
+
+static void
+compare(const char *name, HeatTransferMaterial &theMaterial, double dT, int numElements)
+{
+  TabulatedHTMaterial theTable(1, theMaterial, dT);
+
+  // accuracy on a grid which does not coincide with the table points; the
+  // number of points off by more than 0.1% is reported as well, since the
+  // curves have jumps and spikes a linear interpolation misses within one interval
+  int numCheck = 11700;
+  double maxErr[3] = {0.0, 0.0, 0.0};
+  int numAbove[3] = {0, 0, 0};
+  double maxErrH = 0.0;
+  for (int i=0; i<numCheck; i++) {
+    double T = 293.15 + 0.1*i + 0.037;
+    theMaterial.setTrialTemperature(T);
+    theTable.setTrialTemperature(T);
+    double e[3];
+    e[0] = relativeError(theTable.getConductivity()(0,0), theMaterial.getConductivity()(0,0));
+    e[1] = relativeError(theTable.getSpecificHeat(), theMaterial.getSpecificHeat());
+    e[2] = relativeError(theTable.getRho(), theMaterial.getRho());
+    for (int j=0; j<3; j++) {
+      if (e[j] > maxErr[j]) maxErr[j] = e[j];
+      if (e[j] > 1.0e-3) numAbove[j]++;
+    }
+
+    // dH/dT against rho*c, central difference over a small step
+    double h = 1.0e-3;
+    double dHdT = (theTable.getEnthalpy(T+h) - theTable.getEnthalpy(T-h))/(2*h);
+    double rc = theMaterial.getRho()*theMaterial.getSpecificHeat();
+    double eH = relativeError(dHdT, rc);
+    if (eH > maxErrH && eH < 0.5)   // skip the intervals holding a jump
+      maxErrH = eH;
+  }
+
+  // timing, the analytic path as the elements call it
+  int num = numElements*NUM_POINTS;
+  double *T = new double[num];
+  fillTemperatures(T, num);
+
+  HeatTransferMaterial *analytic[NUM_POINTS];
+  HeatTransferMaterial *tabulated[NUM_POINTS];
+  for (int i=0; i<NUM_POINTS; i++) {
+    analytic[i] = theMaterial.getCopy();
+    tabulated[i] = theTable.getCopy();
+  }
+
+  double sum1 = 0.0;
+  clock_t start = clock();
+  for (int e=0; e<numElements; e++) {
+    for (int i=0; i<NUM_POINTS; i++) {
+      analytic[i]->setTrialTemperature(T[e*NUM_POINTS+i]);
+      sum1 += analytic[i]->getConductivity()(0,0) + analytic[i]->getRho()*analytic[i]->getSpecificHeat();
+    }
+  }
+  double time1 = elapsedTime(start);
+
+  double sum2 = 0.0;
+  start = clock();
+  for (int e=0; e<numElements; e++) {
+    tabulated[0]->setTrialTemperatures(tabulated, &T[e*NUM_POINTS], NUM_POINTS);
+    for (int i=0; i<NUM_POINTS; i++)
+      sum2 += tabulated[i]->getConductivity()(0,0) + tabulated[i]->getRho()*tabulated[i]->getSpecificHeat();
+  }
+  double time2 = elapsedTime(start);
+
+  printf("%-22s max rel err k %.1e c %.1e rho %.1e (points > 1e-3: %d %d %d)  dH/dT %.1e  "
+	 "analytic %.3f s  table %.3f s  speedup %.1f  (sums %.6e %.6e)\n",
+	 name, maxErr[0], maxErr[1], maxErr[2], numAbove[0], numAbove[1], numAbove[2], maxErrH,
+	 time1, time2, time2 > 0.0 ? time1/time2 : 0.0, sum1, sum2);
+
+  for (int i=0; i<NUM_POINTS; i++) {
+    delete analytic[i];
+    delete tabulated[i];
+  }
+  delete [] T;
+}
+
+int
+main(int argc, char **argv)
+{
+  double dT = 1.0;
+  int numElements = 1000000;
+
+  if (argc > 1)
+    dT = atof(argv[1]);
+  if (argc > 2)
+    numElements = atoi(argv[2]);
+
+  printf("table interval %g K, %d elements of %d points\n", dT, numElements, NUM_POINTS);
+
+  CarbonSteelEC3 steel(1);
+  compare("CarbonSteelEC3", steel, dT, numElements);
+
+  ConcreteEC2 concrete0(1, 0.0, false);
+  compare("ConcreteEC2 0.0", concrete0, dT, numElements);
+
+  ConcreteEC2 concrete3(1, 0.03, true);
+  compare("ConcreteEC2 0.03 lower", concrete3, dT, numElements);
+
+  StainlessSteelEC stainless(1);
+  compare("StainlessSteelEC", stainless, dT, numElements);
+
+  for (int type=1; type<=5; type++) {
+    char name[32];
+    sprintf(name, "SFRMCoating %d", type);
+    SFRMCoating sfrm(1, type);
+    compare(name, sfrm, dT, numElements);
+  }
+
+  return 0;
+}
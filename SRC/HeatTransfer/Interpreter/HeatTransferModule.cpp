@@ -65,11 +65,13 @@ using std::setiosflags;
 #include <ConcreteEC2.h>
 #include <SimpleMaterial.h>
 #include <SFRMCoating.h>
+#include <TabulatedHTMaterial.h>
 #include <TimberHTMaterial.h>
 
 // includes for the analysis classes
 #include <HT_TransientAnalysis.h>
 #include <BackwardDifference.h>
+#include <ForwardDifference.h>
 #include <HT_AnalysisModel.h> 
 #include <HT_SolutionAlgorithm.h>
 #include <LinearAlgorithm.h>
@@ -85,6 +87,12 @@ using std::setiosflags;
 #include <UmfpackGenLinSolver.h>
 #include <SuperLU.h>
 #include <SparseGenColLinSOE.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+#include <DiagonalSOE.h>
+#include <DiagonalDirectSolver.h>
 
 //include fire models
 #include <ParametricFireEC1.h>
@@ -102,6 +110,7 @@ using std::setiosflags;
 //include recorders
 #include <HTNodeRecorder.h>
 #include <HTRecorderToStru.h>
+#include <TemperatureStore.h>
 
 #include <elementAPI.h>
 #include <HeatTransferModule.h>
@@ -615,6 +624,56 @@ int OPS_addHTMaterial()
 		theHTMaterial = new SimpleMaterial(HTMaterialTag, density, cp, conduct);
 
 	}
+	else if (strcmp(HTmatType, "Tabulated") == 0 || strcmp(HTmatType, "tabulated") == 0) {
+
+		int baseTag = 0;
+		double dT = 1.0;
+		double Tmin = 273.15;
+		double Tmax = 1473.15;
+
+		if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&numdata, &baseTag) < 0) {
+			opserr << "WARNING:: HTMaterial Tabulated requires the tag of the material to tabulate" << endln;
+			return -1;
+		}
+
+		HeatTransferMaterial* theBaseMaterial = theHTModule->getHTMaterial(baseTag);
+		if (theBaseMaterial == 0) {
+			opserr << "WARNING:: HTMaterial Tabulated could not find material " << baseTag << endln;
+			return -1;
+		}
+		if (!theBaseMaterial->isTabulatable()) {
+			opserr << "WARNING:: HTMaterial Tabulated - material " << baseTag
+				<< " is anisotropic or history dependent and can not be tabulated" << endln;
+			return -1;
+		}
+
+		while (OPS_GetNumRemainingInputArgs() > 0) {
+			const char* option = OPS_GetString();
+			if (strcmp(option, "-dT") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+				if (OPS_GetDoubleInput(&numdata, &dT) < 0 || dT <= 0.0) {
+					opserr << "WARNING invalid temperature interval for HeatTransfer material: " << HTMaterialTag << endln;
+					return -1;
+				}
+			}
+			else if (strcmp(option, "-range") == 0 && OPS_GetNumRemainingInputArgs() > 1) {
+				if (OPS_GetDoubleInput(&numdata, &Tmin) < 0 || OPS_GetDoubleInput(&numdata, &Tmax) < 0 || Tmax <= Tmin) {
+					opserr << "WARNING invalid temperature range for HeatTransfer material: " << HTMaterialTag << endln;
+					return -1;
+				}
+			}
+			else {
+				opserr << "WARNING:: HTMaterial Tabulated received unknown option " << option << endln;
+				return -1;
+			}
+		}
+
+		// the properties are held at the end values outside the table
+		if (Tmin > 273.15 || Tmax < 1473.15)
+			opserr << "WARNING:: HTMaterial Tabulated " << HTMaterialTag << " - properties are clamped to their values at "
+				<< Tmin << " and " << Tmax << " K outside that range" << endln;
+
+		theHTMaterial = new TabulatedHTMaterial(HTMaterialTag, *theBaseMaterial, dT, Tmin, Tmax);
+	}
 
 	if (theHTMaterial != 0) {
 		theHTModule->addHTMaterial(*theHTMaterial);
@@ -2698,6 +2757,60 @@ OPS_HTAnalysis()
 
 		}
 
+		// the tangent of the heat transfer elements is symmetric, so the
+		// symmetric profile and sparse solvers can be used in place of BandGeneral
+		int numThreads = 1;
+		int numData = 1;
+		while (OPS_GetNumRemainingInputArgs() > 0) {
+			const char* option = OPS_GetString();
+			if (strcmp(option, "-system") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+				const char* type = OPS_GetString();
+				if (strcmp(type, "BandGeneral") == 0 || strcmp(type, "BandGen") == 0) {
+					BandGenLinLapackSolver* theSolver = new BandGenLinLapackSolver();
+					theSOE = new BandGenLinSOE(*theSolver);
+				}
+				else if (strcmp(type, "ProfileSPD") == 0) {
+					ProfileSPDLinDirectSolver* theSolver = new ProfileSPDLinDirectSolver();
+					theSOE = new ProfileSPDLinSOE(*theSolver);
+				}
+				else if (strcmp(type, "SparseSPD") == 0 || strcmp(type, "SparseSYM") == 0) {
+					SymSparseLinSolver* theSolver = new SymSparseLinSolver();
+					theSOE = new SymSparseLinSOE(*theSolver, 1);
+				}
+				else {
+					opserr << "WARNING HTAnalysis - unknown system " << type;
+					opserr << ", BandGeneral, ProfileSPD or SparseSPD\n";
+					return -1;
+				}
+				opserr << "Using the " << type << " linear system.\n";
+			}
+			else if (strcmp(option, "-numThreads") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+				if (OPS_GetIntInput(&numData, &numThreads) < 0) {
+					opserr << "WARNING HTAnalysis - numThreads must be an integer.\n";
+					return -1;
+				}
+			}
+			// explicit integration with the lumped capacity, the linear system
+			// is then diagonal and solved once per step
+			else if (strcmp(option, "-explicit") == 0) {
+				double safetyFactor = 0.9;
+				if (OPS_GetNumRemainingInputArgs() > 0) {
+					if (OPS_GetDoubleInput(&numData, &safetyFactor) < 0) {
+						safetyFactor = 0.9;
+						OPS_ResetCurrentInputArg(-1);
+					}
+				}
+				theTransientIntegrator = new ForwardDifference(safetyFactor);
+				theAlgorithm = new LinearAlgorithm();
+				DiagonalDirectSolver* theSolver = new DiagonalDirectSolver();
+				theSOE = new DiagonalSOE(*theSolver);
+				opserr << "Using the ForwardDifference integrator with safety factor " << safetyFactor << ".\n";
+			}
+			else {
+				opserr << "WARNING HTAnalysis - unknown option " << option << endln;
+				return -1;
+			}
+		}
 		if (theAlgorithm == 0) {
 			opserr << "WARNING analysis Transient - no Algorithm yet specified, \n";
 			opserr << " NewtonMethod default will be used\n";
@@ -2736,6 +2849,7 @@ OPS_HTAnalysis()
 			*theSOE,
 			*theTransientIntegrator,
 			theTest);
+		theHTAnalysis->setNumThreads(numThreads);
 
 	}
 	return 0;
@@ -2749,6 +2863,7 @@ int OPS_HTAnalyze()
 	int numData = 1;
 	double monitortime = 0;
 	double Ltime = lasttime;
+	bool timing = false;
 
 	if (theHTAnalysis != 0) {
 
@@ -2770,7 +2885,7 @@ int OPS_HTAnalyze()
 			return -1;
 		}
 
-		if (OPS_GetNumRemainingInputArgs() > 0) {
+		while (OPS_GetNumRemainingInputArgs() > 0) {
 
 			const char* option = OPS_GetString();
 			if (strcmp(option, "-monitor") == 0) {
@@ -2779,15 +2894,43 @@ int OPS_HTAnalyze()
 					return -1;
 				}
 			}
+			//adaptive stepping, deltaT is then the output interval
+			else if (strcmp(option, "-adaptive") == 0) {
+				double adaptData[3];
+				int numAdaptData = 3;
+				if (OPS_GetNumRemainingInputArgs() < 3 || OPS_GetDoubleInput(&numAdaptData, adaptData) < 0) {
+					opserr << "WARNING heat transfer analysis: -adaptive dtMin? dtMax? tol? <targetIter?>\n";
+					return -1;
+				}
+				int targetIter = 0;
+				if (OPS_GetNumRemainingInputArgs() > 0) {
+					if (OPS_GetIntInput(&numData, &targetIter) < 0) {
+						targetIter = 0;
+						OPS_ResetCurrentInputArg(-1);
+					}
+				}
+				if (theHTAnalysis->setAdaptive(adaptData[0], adaptData[1], adaptData[2], targetIter) < 0)
+					return -1;
+			}
+			// report the time spent in each phase of the analysis
+			else if (strcmp(option, "-timing") == 0) {
+				timing = true;
+			}
 
 		}
 
+		HT_PhaseTimer& theTimer = theHTAnalysis->getIntegrator()->getPhaseTimer();
+		if (timing)
+			theTimer.zero();
 
 		result = theHTAnalysis->analyze(numIncr, dT,Ltime, monitortime);
 		lasttime = Ltime;
 		if (result < 0)
 			opserr << "OpenSees > analyze failed, returned: " << result << " error flag\n";
 
+		if (timing)
+			theTimer.Print(opserr);
+
 
 	}
 	//Output for the final result of heat transfer analysis;
@@ -2820,6 +2963,8 @@ OPS_HTRecorder()
 	ID* theNodes = 0;
 	HTRecorder* theHTRecorder = 0;
 	double xloc = 0;
+	const char* storeName = 0;
+	const char* storeFileName = 0;
 
 	//if file tag is detected
 	const char* option = OPS_GetString();
@@ -2830,16 +2975,33 @@ OPS_HTRecorder()
 		//simulationInfo.addOutputFile(fileName, pwd);
 		
 	}
+	//if store tag is detected, the temperatures are kept in memory for the structural model
+	else if (strcmp(option, "-store") == 0 || strcmp(option, "-Store") == 0)
+	{
+		storeName = OPS_GetString();
+		if (OPS_GetNumRemainingInputArgs() > 1) {
+			option = OPS_GetString();
+			if (strcmp(option, "-storeFile") == 0)
+				storeFileName = OPS_GetString();
+			else
+				OPS_ResetCurrentInputArg(-1);
+		}
+	}
 	else {
 		opserr << "WARNING::HTRecorder has not specified a file name" << endln;
 		//OPS_GetNumRemainingInputArgs(-1);
 		return - 1;
 	}
 	
-	theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0);  //The last argument is to determine CSV for using space 
+	if (fileName != 0)
+		theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0);  //The last argument is to determine CSV for using space 
 
 	//if xloc tag is detected
 	option = OPS_GetString();
+	if (storeName != 0 && strcmp(option, "-xloc") != 0 && strcmp(option, "xLoc") != 0 && strcmp(option, "-xLoc") != 0) {
+		opserr << "WARNING::HTRecorder -store is only available with -xloc -yloc" << endln;
+		return -1;
+	}
 	if (strcmp(option, "-xloc") == 0 || strcmp(option, "xLoc") == 0 || strcmp(option, "-xLoc") == 0)
 	{
 	
@@ -2892,6 +3054,20 @@ OPS_HTRecorder()
 		opserr << "TclHeatTransferModule::HTRecorder, theRecMatrix " << *theRecVec << endln;
 #endif
 		HTReorderTag++;
+		if (storeName != 0) {
+			if (OPS_getTemperatureStore(storeName) != 0) {
+				opserr << "WARNING HTRecorder - a temperature store named " << storeName << " already exists" << endln;
+				return -1;
+			}
+			TemperatureStore* theStore = 0;
+			if (storeFileName != 0)
+				theStore = new TemperatureStore(storeName, theRecVec->Size() - 1, storeFileName);
+			else
+				theStore = new TemperatureStore(storeName, theRecVec->Size() - 1);
+			OPS_addTemperatureStore(theStore);
+			theHTRecorder = new HTRecorderToStru(HTReorderTag, *theRecVec, *theHTDomain, *theStore);
+		}
+		else
 		theHTRecorder = new HTRecorderToStru(HTReorderTag, *theRecVec, *theHTDomain, *theOutputStream);
 	}
 	//end of if xloc is found;
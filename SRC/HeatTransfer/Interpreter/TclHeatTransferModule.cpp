@@ -66,10 +66,12 @@ using std::setiosflags;
 #include <SimpleMaterial.h>
 #include <SFRMCoating.h>
 #include <TimberHTMaterial.h>
+#include <TabulatedHTMaterial.h>
 
 // includes for the analysis classes
 #include <HT_TransientAnalysis.h>
 #include <BackwardDifference.h>
+#include <ForwardDifference.h>
 #include <HT_AnalysisModel.h> 
 #include <HT_SolutionAlgorithm.h>
 #include <LinearAlgorithm.h>
@@ -86,6 +88,12 @@ using std::setiosflags;
 #include <UmfpackGenLinSolver.h>
 #include <SuperLU.h>
 #include <SparseGenColLinSOE.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+#include <DiagonalSOE.h>
+#include <DiagonalDirectSolver.h>
 
 //include fire models
 #include <ParametricFireEC1.h>
@@ -102,6 +110,7 @@ using std::setiosflags;
 //include recorders
 #include <HTNodeRecorder.h>
 #include <HTRecorderToStru.h>
+#include <TemperatureStore.h>
 #include <HTElementRecorder.h>
 
 #include <elementAPI.h>
@@ -818,6 +827,61 @@ TclHeatTransferCommand_addHTMaterial(ClientData clientData, Tcl_Interp *interp,
 		theHTMaterial = new SimpleMaterial(HTMaterialTag, density,cp,conduct);
 
 	}
+	//Tabulating the properties of a defined material
+	//HTMaterial Tabulated tag baseTag <-dT dT> <-range Tmin Tmax>
+	else if (strcmp(argv[1], "Tabulated") == 0 || strcmp(argv[1], "tabulated") == 0) {
+
+		int baseTag = 0;
+		double dT = 1.0;
+		double Tmin = 273.15;
+		double Tmax = 1473.15;
+
+		if (argc < 4 || Tcl_GetInt(interp, argv[3], &baseTag) != TCL_OK) {
+			opserr << "WARNING:: HTMaterial Tabulated requires the tag of the material to tabulate" << endln;
+			return TCL_ERROR;
+		}
+
+		HeatTransferMaterial* theBaseMaterial = theTclHTModule->getHTMaterial(baseTag);
+		if (theBaseMaterial == 0) {
+			opserr << "WARNING:: HTMaterial Tabulated could not find material " << baseTag << endln;
+			return TCL_ERROR;
+		}
+		if (!theBaseMaterial->isTabulatable()) {
+			opserr << "WARNING:: HTMaterial Tabulated - material " << baseTag
+				<< " is anisotropic or history dependent and can not be tabulated" << endln;
+			return TCL_ERROR;
+		}
+
+		int count = 4;
+		while (count < argc) {
+			if (strcmp(argv[count], "-dT") == 0 && count + 1 < argc) {
+				if (Tcl_GetDouble(interp, argv[count+1], &dT) != TCL_OK || dT <= 0.0) {
+					opserr << "WARNING invalid temperature interval for HeatTransfer material: " << argv[1] << endln;
+					return TCL_ERROR;
+				}
+				count += 2;
+			}
+			else if (strcmp(argv[count], "-range") == 0 && count + 2 < argc) {
+				if (Tcl_GetDouble(interp, argv[count+1], &Tmin) != TCL_OK ||
+					Tcl_GetDouble(interp, argv[count+2], &Tmax) != TCL_OK || Tmax <= Tmin) {
+					opserr << "WARNING invalid temperature range for HeatTransfer material: " << argv[1] << endln;
+					return TCL_ERROR;
+				}
+				count += 3;
+			}
+			else {
+				opserr << "WARNING:: HTMaterial Tabulated received unknown option " << argv[count] << endln;
+				return TCL_ERROR;
+			}
+		}
+
+		// the properties are held at the end values outside the table
+		if (Tmin > 273.15 || Tmax < 1473.15)
+			opserr << "WARNING:: HTMaterial Tabulated " << HTMaterialTag << " - properties are clamped to their values at "
+				<< Tmin << " and " << Tmax << " K outside that range" << endln;
+
+		theHTMaterial = new TabulatedHTMaterial(HTMaterialTag, *theBaseMaterial, dT, Tmin, Tmax);
+	}
 
 	if(theHTMaterial!=0){
 		theTclHTModule->addHTMaterial(*theHTMaterial);
@@ -3388,6 +3452,56 @@ int TclHeatTransferCommand_HTAnalysis(ClientData clientData, Tcl_Interp *interp,
         theAlgorithm = new ModifiedNewtonMethod(*theTest);
         opserr << "Using the ModifiedNewtonMethod algorithm.\n";
     }
+	// the tangent of the heat transfer elements is symmetric, so the
+	// symmetric profile and sparse solvers can be used in place of BandGeneral
+	int numThreads = 1;
+	while (count < argc) {
+	    if (strcmp(argv[count], "-system") == 0 && count+1 < argc) {
+	        count++;
+	        if (strcmp(argv[count], "BandGeneral") == 0 || strcmp(argv[count], "BandGen") == 0) {
+	            BandGenLinLapackSolver *theSolver = new BandGenLinLapackSolver();
+	            theSOE = new BandGenLinSOE(*theSolver);
+	        }
+	        else if (strcmp(argv[count], "ProfileSPD") == 0) {
+	            ProfileSPDLinDirectSolver *theSolver = new ProfileSPDLinDirectSolver();
+	            theSOE = new ProfileSPDLinSOE(*theSolver);
+	        }
+	        else if (strcmp(argv[count], "SparseSPD") == 0 || strcmp(argv[count], "SparseSYM") == 0) {
+	            SymSparseLinSolver *theSolver = new SymSparseLinSolver();
+	            theSOE = new SymSparseLinSOE(*theSolver, 1);
+	        }
+	        else {
+	            opserr << "WARNING HTAnalysis - unknown system " << argv[count];
+	            opserr << ", BandGeneral, ProfileSPD or SparseSPD\n";
+	            return TCL_ERROR;
+	        }
+	        opserr << "Using the " << argv[count] << " linear system.\n";
+	    }
+	    else if (strcmp(argv[count], "-numThreads") == 0 && count+1 < argc) {
+	        count++;
+	        if (Tcl_GetInt(interp, argv[count], &numThreads) != TCL_OK) {
+	            opserr << "WARNING HTAnalysis - numThreads must be an integer.\n";
+	            return TCL_ERROR;
+	        }
+	    }
+	    // explicit integration with the lumped capacity, the linear system
+	    // is then diagonal and solved once per step
+	    else if (strcmp(argv[count], "-explicit") == 0) {
+	        double safetyFactor = 0.9;
+	        if (count+1 < argc && Tcl_GetDouble(interp, argv[count+1], &safetyFactor) == TCL_OK)
+	            count++;
+	        theTransientIntegrator = new ForwardDifference(safetyFactor);
+	        theAlgorithm = new LinearAlgorithm();
+	        DiagonalDirectSolver *theSolver = new DiagonalDirectSolver();
+	        theSOE = new DiagonalSOE(*theSolver);
+	        opserr << "Using the ForwardDifference integrator with safety factor " << safetyFactor << ".\n";
+	    }
+	    else {
+	        opserr << "WARNING HTAnalysis - unknown option " << argv[count] << endln;
+	        return TCL_ERROR;
+	    }
+	    count++;
+	}
 	if (theAlgorithm == 0) {
 	    opserr << "WARNING analysis Transient - no Algorithm yet specified, \n";
 	    opserr << " NewtonMethod default will be used\n";	    
@@ -3430,6 +3544,7 @@ int TclHeatTransferCommand_HTAnalysis(ClientData clientData, Tcl_Interp *interp,
 							     *theSOE,
 							     *theTransientIntegrator,
 							     theTest);
+	theHTAnalysis->setNumThreads(numThreads);
 
 	}
 	return TCL_OK;
@@ -3455,11 +3570,43 @@ int TclHeatTransferCommand_HTAnalyze(ClientData clientData, Tcl_Interp *interp,
 	if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)	
       return TCL_ERROR;
 
+	// report the time spent in each phase of the analysis
+	bool timing = false;
+	if (argc > 3 && strcmp(argv[argc-1], "-timing") == 0) {
+		timing = true;
+		argc--;
+	}
+
+	//adaptive stepping, deltaT is then the output interval
+	if (argc > 3 && strcmp(argv[3], "-adaptive") == 0) {
+		double dtMin, dtMax, tol;
+		int targetIter = 0;
+		if (argc < 7) {
+			opserr << "WARNING heat transfer analysis: analysis numIncr? deltaT? -adaptive dtMin? dtMax? tol? <targetIter?>\n";
+			return TCL_ERROR;
+		}
+		if (Tcl_GetDouble(interp, argv[4], &dtMin) != TCL_OK ||
+			Tcl_GetDouble(interp, argv[5], &dtMax) != TCL_OK ||
+			Tcl_GetDouble(interp, argv[6], &tol) != TCL_OK)
+			return TCL_ERROR;
+		if (argc > 7 && Tcl_GetInt(interp, argv[7], &targetIter) != TCL_OK)
+			return TCL_ERROR;
+		if (theHTAnalysis->setAdaptive(dtMin, dtMax, tol, targetIter) < 0)
+			return TCL_ERROR;
+	}
+
+	HT_PhaseTimer& theTimer = theHTAnalysis->getIntegrator()->getPhaseTimer();
+	if (timing)
+		theTimer.zero();
+
 	double time = 0;
     result = theHTAnalysis->analyze(numIncr, dT,time);
 
 	if (result < 0) 
     opserr << "OpenSees > analyze failed, returned: " << result << " error flag\n";
+
+	if (timing)
+		theTimer.Print(opserr);
 	
 	}
 	//Output for the final result of heat transfer analysis;
@@ -3486,23 +3633,70 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
 	HTRecorder* theHTRecorder =0;
 	int count=1;
 	double xloc = 0;
+	TCL_Char *storeName = 0;
+	TCL_Char *storeFileName = 0;
   
+  if (argc < 2) {
+	opserr << "WARNING HTRecorder <-file fileName|-store name <-storeFile fileName>> type args" << endln;
+	return TCL_ERROR;
+  }
+
   //if file tag is detected
   if(strcmp(argv[count],"-file") == 0||strcmp(argv[count],"file") == 0||strcmp(argv[count],"-File") == 0)
 	{
     
+    if (count+1 >= argc) {
+		opserr << "WARNING HTRecorder -file needs a file name" << endln;
+		return TCL_ERROR;
+	}
     fileName = argv[count+1];
 	const char *pwd = getInterpPWD(interp);
 	simulationInfo.addOutputFile(fileName, pwd);
 	theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0 );  //The last argument is to determine CSV for using space or 
 	count += 2;
 	}
+  //if store tag is detected, the temperatures are kept in memory for the
+  //structural model, which refers to storeName in place of a data file
+  else if(strcmp(argv[count],"-store") == 0||strcmp(argv[count],"-Store") == 0)
+	{
+	if (count+1 >= argc) {
+		opserr << "WARNING HTRecorder -store needs a name" << endln;
+		return TCL_ERROR;
+	}
+    storeName = argv[count+1];
+	count += 2;
+	//optional binary file for a structural analysis run in another process
+	if(count+1 < argc && strcmp(argv[count],"-storeFile") == 0)
+	{
+		storeFileName = argv[count+1];
+		const char *pwd = getInterpPWD(interp);
+		simulationInfo.addOutputFile(storeFileName, pwd);
+		count += 2;
+	}
+	}
+
+  if (count >= argc) {
+	opserr << "WARNING HTRecorder - no recorder type given" << endln;
+	return TCL_ERROR;
+  }
+
+  bool toStru = strcmp(argv[count],"-xloc") == 0||strcmp(argv[count],"xLoc") == 0||strcmp(argv[count],"-xLoc") == 0;
+
+  //only the recorder to the structural member writes to a store
+  if (storeName != 0 && !toStru) {
+	opserr << "WARNING HTRecorder -store " << storeName << " is only allowed with -xloc" << endln;
+	return TCL_ERROR;
+  }
+  if (storeName == 0 && theOutputStream == 0) {
+	opserr << "WARNING HTRecorder needs -file fileName or, with -xloc, -store name" << endln;
+	return TCL_ERROR;
+  }
   
   ///////-----------------------HTRecorderToStructural member-----------------------------------//
-  if(strcmp(argv[count],"-xloc") == 0||strcmp(argv[count],"xLoc") == 0||strcmp(argv[count],"-xLoc") == 0)
+  if(toStru)
   {
 	 count++;
-	 if (Tcl_GetDouble (interp, argv[count], &xloc) != TCL_OK) {
+	 if (count >= argc || Tcl_GetDouble (interp, argv[count], &xloc) != TCL_OK) {
 			opserr << "WARNING invalid xloc" << endln;
 			opserr << " for HeatTransfer recorder: " << endln;	    
 			return TCL_ERROR;
@@ -3510,7 +3704,7 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
 	 count++;
     //ending of xloc;
   
-	if(strcmp(argv[count],"-yloc") == 0||strcmp(argv[count],"yLoc") == 0||strcmp(argv[count],"-yLoc") == 0)
+	if(count < argc && (strcmp(argv[count],"-yloc") == 0||strcmp(argv[count],"yLoc") == 0||strcmp(argv[count],"-yLoc") == 0))
     {
 	 count++;
 	 Vector yloc(argc-count);
@@ -3544,10 +3738,28 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
         }
       }
    }
+   if (theRecVec == 0) {
+	 opserr << "WARNING HTRecorder -xloc needs -yloc followed by the y locations" << endln;
+	 return TCL_ERROR;
+   }
 #ifdef _DEBUG
    opserr<< "TclHeatTransferModule::HTRecorder, theRecMatrix "<<*theRecVec<<endln;
 #endif
 	HTReorderTag++; 
+   if (storeName != 0) {
+	 if (OPS_getTemperatureStore(storeName) != 0) {
+	   opserr << "WARNING HTRecorder - a temperature store named " << storeName << " already exists" << endln;
+	   return TCL_ERROR;
+	 }
+	 TemperatureStore *theStore = 0;
+	 if (storeFileName != 0)
+	   theStore = new TemperatureStore(storeName, theRecVec->Size()-1, storeFileName);
+	 else
+	   theStore = new TemperatureStore(storeName, theRecVec->Size()-1);
+	 OPS_addTemperatureStore(theStore);
+	 theHTRecorder = new HTRecorderToStru(HTReorderTag,*theRecVec,*theHTDomain,*theStore);
+   }
+   else
    theHTRecorder = new HTRecorderToStru(HTReorderTag,*theRecVec,*theHTDomain,*theOutputStream);
    }
 
@@ -3556,7 +3768,7 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
   {
     count++;
 	int NodeSetID =0;
-	if (Tcl_GetInt(interp, argv[count], &NodeSetID) != TCL_OK) {
+	if (count >= argc || Tcl_GetInt(interp, argv[count], &NodeSetID) != TCL_OK) {
       opserr << "WARNING:: invalid nodeSet tag for defining HTNodeRecorder : " << "\n";
       return TCL_ERROR;
     }
@@ -3604,7 +3816,7 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
   {
     count++;
 	int EntityID =0; int DimTag = 0;
-	if (Tcl_GetInt(interp, argv[count], &EntityID) != TCL_OK) {
+	if (count >= argc || Tcl_GetInt(interp, argv[count], &EntityID) != TCL_OK) {
       opserr << "WARNING:: invalid Entity tag for defining HTNodeRecorder : " << "\n";
       return TCL_ERROR;
     }
@@ -3615,7 +3827,7 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
 			count++;
 		}
 
-		if (Tcl_GetInt(interp, argv[count], &DimTag) != TCL_OK) {
+		if (count >= argc || Tcl_GetInt(interp, argv[count], &DimTag) != TCL_OK) {
 			opserr << "WARNING:: invalid Entity tag for defining HTNodeRecorder : " << "\n";
 			return TCL_ERROR;
 		}
@@ -3644,7 +3856,7 @@ int TclHeatTransferCommand_HTRecorder(ClientData clientData, Tcl_Interp *interp,
   {
      count++;
      int EleSetID = 0;
-    if (Tcl_GetInt(interp, argv[count], &EleSetID) != TCL_OK) {
+    if (count >= argc || Tcl_GetInt(interp, argv[count], &EleSetID) != TCL_OK) {
       opserr << "WARNING:: invalid nodeSet tag for defining HTNodeRecorder : " << "\n";
       return TCL_ERROR;
     }
@@ -51,7 +51,7 @@ KDTree::~KDTree()
   }
 	if(pntsInRange) delete[] pntsInRange;
 	if(nodeMem && nodeMemAlloc) delete[] nodeMem;
-	if(PTSInRange) delete [] PTSInRange;
+	if(PTSInRange) delete PTSInRange;
   return;
 }				// end of destructor
 
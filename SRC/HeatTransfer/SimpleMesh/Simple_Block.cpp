@@ -247,7 +247,7 @@ int Simple_Block::GenerateNodes(HeatTransferDomain* theHTDomain, int nDoF, const
 		}
 	}
 
-
+	return 0;
 }
 
 
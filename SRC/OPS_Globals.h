@@ -45,6 +45,15 @@ extern OPS_Stream *opserrPtr;
 #define opserr (*opserrPtr)
 #define endln "\n"
 
+// class wide and function local scratch (static Matrix, Vector, double[])
+// used during the state determination of elements and materials; with
+// OpenMP each thread gets its own copy, otherwise it is a plain static
+#ifdef _OPENMP
+#define OPS_THREAD_LOCAL thread_local
+#else
+#define OPS_THREAD_LOCAL
+#endif
+
 #include <string.h>
 #include <stdlib.h>
 
@@ -125,6 +125,7 @@
 #include <MembranePlateFiberSectionThermal.h>
 #include <SuperLU.h>
 #include <SparseGenColLinSOE.h>
+#include <SIFHTcache.h>
 
 static AnalysisModel *theAnalysisModel =0;
 static EquiSolnAlgo *theAlgorithm =0;
@@ -186,6 +187,8 @@ SIFBuilderDomain::SIFBuilderDomain()
 
   InterpPWD = 0;
   theHTdir = 0;
+  numHTjobs = 1;
+  theHTcache = 0;
   SIFBuilderInfo = 0;
   offset =0;
 
@@ -201,6 +204,8 @@ SIFBuilderDomain::SIFBuilderDomain()
 SIFBuilderDomain::~SIFBuilderDomain()
 {
   this->clearAll();
+  if (theHTcache != 0)
+	  delete theHTcache;
   if(theSIFMaterials != 0)
 	  delete theSIFMaterials;
 
@@ -295,6 +300,33 @@ SIFBuilderDomain::getHTdir()
 	return theHTdir;
 }
 
+void 
+SIFBuilderDomain::setHTjobs(int numJobs)
+{
+	numHTjobs = (numJobs > 0) ? numJobs : 1;
+}
+
+int 
+SIFBuilderDomain::getHTjobs()
+{
+	return numHTjobs;
+}
+
+int 
+SIFBuilderDomain::setHTcache(const char* cacheDir)
+{
+	if (theHTcache != 0)
+		delete theHTcache;
+	theHTcache = new SIFHTcache(cacheDir);
+	return 0;
+}
+
+SIFHTcache* 
+SIFBuilderDomain::getHTcache()
+{
+	return theHTcache;
+}
+
 int 
 SIFBuilderDomain::setSIFBuilderInfo(const ID& theBuilderInfo)
 {
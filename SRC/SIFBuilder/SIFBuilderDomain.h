@@ -94,6 +94,8 @@ class SIFSecXBeamIter;
 class SIFfireActionIter;
 //class SIFfireAction;
 
+class SIFHTcache;
+
 class SIFBuilderDomain 
 {
   public:
@@ -169,6 +171,12 @@ class SIFBuilderDomain
 	void setHTdir(const char* HTdir);
 	const char* getHTdir();
 
+	void setHTjobs(int numJobs);
+	int getHTjobs();
+
+	int setHTcache(const char* cacheDir = 0);
+	SIFHTcache* getHTcache();
+
 	int setSIFBuilderInfo(const ID& theBuilderInfo);
 	const ID& getSIFBuilderInfo();
 
@@ -218,6 +226,8 @@ class SIFBuilderDomain
 	int theEleTag;
 	const char *InterpPWD;
 	const char *theHTdir;
+	int numHTjobs;                      // member heat transfer analyses run at once
+	SIFHTcache* theHTcache;             // results of member heat transfer analyses, 0 if not reused
 	ID SIFBuilderInfo;
 	double offset;
 	Vector fireFloorTag;
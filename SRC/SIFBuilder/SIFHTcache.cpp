@@ -0,0 +1,169 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                   
+/**********************************************************************
+** This project is aiming to provide a Tcl interface to define models  **
+** for simulating structural behaviours under fire action.           **
+** Developed by:                  `                                   **
+**   Liming Jiang (liming.jiang@ed.ac.uk)                            **
+**   Praven Kamath(Praveen.Kamath@ed.ac.uk)                          **
+**   Xu Dai(X.Dai@ed.ac.uk)                                          **
+**   Asif Usmani(asif.usmani@ed.ac.uk)                               **
+**********************************************************************/
+// $Revision: 2.4.0.1 $
+// This file constructs the class SIFHTcache which stores the results of member
+// heat transfer analyses for reuse by members with identical inputs.
+
+#include <SIFHTcache.h>
+#include <OPS_Globals.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define SIFHT_CACHE_MAGIC "SIFHT001"
+
+SIFHTcache::SIFHTcache(const char* cacheDir)
+  :theDir(), numHits(0), numMisses(0)
+{
+  if (cacheDir != 0)
+    theDir = cacheDir;
+}
+
+
+SIFHTcache::~SIFHTcache()
+{
+
+}
+
+
+int
+SIFHTcache::getResults(const std::string& key, std::vector<double>& data)
+{
+  std::map<std::string, std::vector<double> >::iterator theResult = theResults.find(key);
+  if (theResult != theResults.end()) {
+    data = theResult->second;
+    numHits++;
+    return 0;
+  }
+
+  if (!theDir.empty() && this->readFile(key, data) == 0) {
+    theResults[key] = data;
+    numHits++;
+    return 0;
+  }
+
+  numMisses++;
+  return -1;
+}
+
+
+int
+SIFHTcache::addResults(const std::string& key, const std::vector<double>& data)
+{
+  theResults[key] = data;
+
+  if (!theDir.empty())
+    return this->writeFile(key, data);
+
+  return 0;
+}
+
+
+//file name from a 64 bit FNV-1a hash of the key
+std::string
+SIFHTcache::getFileName(const std::string& key)
+{
+  unsigned long long hash = 14695981039346656037ULL;
+  for (size_t i=0; i<key.size(); i++) {
+    hash ^= (unsigned char)key[i];
+    hash *= 1099511628211ULL;
+  }
+
+  char name[32];
+  sprintf(name, "%016llx.ht", hash);
+
+  return theDir + "/" + name;
+}
+
+
+//file: magic, key size, key, number of values, values
+int
+SIFHTcache::readFile(const std::string& key, std::vector<double>& data)
+{
+  std::string fileName = this->getFileName(key);
+  FILE* theFile = fopen(fileName.c_str(), "rb");
+  if (theFile == 0)
+    return -1;
+
+  int res = -1;
+  char magic[8];
+  long long keySize = 0;
+  long long numValues = 0;
+  if (fread(magic, 1, 8, theFile) == 8 && memcmp(magic, SIFHT_CACHE_MAGIC, 8) == 0 &&
+      fread(&keySize, sizeof(long long), 1, theFile) == 1 && keySize == (long long)key.size()) {
+    std::string theKey(keySize, ' ');
+    if ((keySize == 0 || fread(&theKey[0], 1, keySize, theFile) == (size_t)keySize) && theKey == key &&
+	fread(&numValues, sizeof(long long), 1, theFile) == 1 && numValues >= 0) {
+      data.resize(numValues);
+      if (numValues == 0 || fread(&data[0], sizeof(double), numValues, theFile) == (size_t)numValues)
+	res = 0;
+    }
+  }
+
+  fclose(theFile);
+  return res;
+}
+
+
+int
+SIFHTcache::writeFile(const std::string& key, const std::vector<double>& data)
+{
+  std::string fileName = this->getFileName(key);
+  std::string tmpName = fileName + ".tmp";
+  FILE* theFile = fopen(tmpName.c_str(), "wb");
+  if (theFile == 0) {
+    opserr<<"WARNING::SIFHTcache failed to open "<<tmpName.c_str()<<endln;
+    return -1;
+  }
+
+  long long keySize = key.size();
+  long long numValues = data.size();
+  bool ok = fwrite(SIFHT_CACHE_MAGIC, 1, 8, theFile) == 8 &&
+    fwrite(&keySize, sizeof(long long), 1, theFile) == 1 &&
+    (keySize == 0 || fwrite(key.c_str(), 1, keySize, theFile) == (size_t)keySize) &&
+    fwrite(&numValues, sizeof(long long), 1, theFile) == 1 &&
+    (numValues == 0 || fwrite(&data[0], sizeof(double), numValues, theFile) == (size_t)numValues);
+
+  if (fclose(theFile) != 0)
+    ok = false;
+
+  //rename so an interrupted run never leaves a partial file under the real name
+#ifdef _WIN32
+  if (ok)
+    remove(fileName.c_str());
+#endif
+  if (!ok || rename(tmpName.c_str(), fileName.c_str()) != 0) {
+    opserr<<"WARNING::SIFHTcache failed to write "<<fileName.c_str()<<endln;
+    remove(tmpName.c_str());
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,39 @@
+#ifndef SIFHTcache_h
+#define SIFHTcache_h
+
+// SIFHTcache stores the results of member heat transfer analyses, keyed on a
+// text description of everything the analysis depends on (section, materials,
+// exposure, fire model, time step, ...) so that members sharing the same
+// description reuse one solution. Results are kept in memory and, if a
+// directory is given, in one file per key named after a hash of the key, so
+// they can be reused by later runs. The full key is stored in the file and
+// compared when it is read back.
+
+#include <map>
+#include <string>
+#include <vector>
+
+class SIFHTcache
+{
+public:
+	SIFHTcache(const char* cacheDir = 0);
+	~SIFHTcache();
+
+	int getResults(const std::string& key, std::vector<double>& data);
+	int addResults(const std::string& key, const std::vector<double>& data);
+
+	int getNumHits(void) {return numHits;};
+	int getNumMisses(void) {return numMisses;};
+
+private:
+	std::string getFileName(const std::string& key);
+	int readFile(const std::string& key, std::vector<double>& data);
+	int writeFile(const std::string& key, const std::vector<double>& data);
+
+	std::string theDir;
+	std::map<std::string, std::vector<double> > theResults;
+	int numHits;
+	int numMisses;
+};
+
+#endif
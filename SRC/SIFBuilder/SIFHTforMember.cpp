@@ -1161,4 +1161,71 @@ const Vector&
 SIFHTforMember::getRecLocations()
 {
   return RecLocations;
+}
+
+
+int
+SIFHTforMember::setRecLocations(const Vector& recLocations)
+{
+  RecLocations = recLocations;
+  return 0;
+}
+
+
+//the mesh, record locations and boundary conditions of BuildHTModel2D/1D all follow
+//from the data written here; bump the version if the way they are built changes
+int
+SIFHTforMember::getHTkey(std::string& key)
+{
+  std::ostringstream theKey;
+  theKey<<setprecision(17);
+  theKey<<"SIFHTforMember 1"<<"\n";
+  theKey<<"member "<<theMember->getTypeTag()<<" "<<theMember->getMemberTypeTag()<<"\n";
+
+  Vector damageVec = 0;
+  if (theMember->getPartialDamage(damageVec) > 0) {
+    theKey<<"damage";
+    for (int i=0; i<damageVec.Size(); i++)
+      theKey<<" "<<damageVec(i);
+    theKey<<"\n";
+  }
+
+  SIFSection* theSections[2] = {theSection, theSection1};
+  for (int k=0; k<2; k++) {
+    if (theSections[k] == 0)
+      continue;
+    const Vector& SectionPars = theSections[k]->getSectionPars();
+    theKey<<"section "<<k<<" "<<theSections[k]->getSectionTypeTag();
+    for (int i=0; i<SectionPars.Size(); i++)
+      theKey<<" "<<SectionPars(i);
+    theKey<<"\n";
+
+    SIFMaterial* theMaterial = theSections[k]->getSIFMaterialPtr();
+    if (theMaterial != 0) {
+      const Vector& MaterialPars = theMaterial->getMaterialPars();
+      theKey<<"material "<<k<<" "<<theMaterial->getMaterialTypeTag();
+      for (int i=0; i<MaterialPars.Size(); i++)
+	theKey<<" "<<MaterialPars(i);
+      theKey<<"\n";
+    }
+  }
+
+  for (int k=0; k<FireActionIndex; k++) {
+    theKey<<"fire "<<k;
+    if (theFireExpFacesID[k] != 0)
+      for (int i=0; i<theFireExpFacesID[k]->Size(); i++)
+	theKey<<" "<<(*theFireExpFacesID[k])(i);
+    theKey<<"\n";
+  }
+
+  theKey<<"ambient";
+  if (theAmbExpFacesID != 0)
+    for (int i=0; i<theAmbExpFacesID->Size(); i++)
+      theKey<<" "<<(*theAmbExpFacesID)(i);
+  theKey<<"\n";
+
+  theKey<<"time "<<FireDuration<<" "<<TimeStep<<"\n";
+
+  key += theKey.str();
+  return 0;
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include <TaggedObject.h>
 #include <SIFMaterial.h>
 #include <Simple_Mesh.h>
+#include <string>
 
 
 
@@ -57,6 +58,11 @@ public:
 	PathTimeSeriesThermal* getHTResults(void);
     
 	const Vector& getRecLocations();
+	int setRecLocations(const Vector& recLocations);
+
+	// appends the member, section, material and exposure data the heat
+	// transfer analysis depends on to key, used to reuse the results
+	int getHTkey(std::string& key);
 
 	virtual void  Print(OPS_Stream&, int = 0) {return;};
 
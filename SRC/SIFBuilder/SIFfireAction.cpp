@@ -57,7 +57,21 @@
 #include <NodalThermalAction.h>
 #include <ShellThermalAction.h>
 #include <Matrix.h>
+#include <Timer.h>
+#include <SIFJoint.h>
+#include <SIFHTcache.h>
 #include <math.h>
+#include <stdio.h>
+#include <sstream>
+#include <iomanip>
+#include <string.h>
+#include <errno.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
 
 
 //extern int theEleLoadTag;
@@ -65,7 +79,8 @@
 static int thePathSeriesTag =0;
 SIFfireAction::SIFfireAction(int tag, int fireModelType, int compartmentID):TaggedObject(tag),
 FireModelType(fireModelType), FireHRR(0), FireDia(0),StartTime(0),
-theFireModel(0),FireDuration(0), TimeStep(0),FireOrigin(0),theHTDomain(0),theSIFDomain(0)
+FireDuration(0), TimeStep(0),FireOrigin(0),FirePath(0),theFireModel(0),theSIFDomain(0),theHTDomain(0),
+numHTjobs(1)
 {
 	
 	if(compartmentID!=0){
@@ -294,8 +309,8 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
 //This function is to apply fire action which is associated with the department
 //Looped operation will be carried out over the members within the comparment
 
-  Domain* theDomain = theSIFDomain->getStructureDomain();
   int thePatternTag = LoadPatternTag;
+  int result = 0;
   
   //check the fireDuration is not 0;
   if (fireDuration!=0) {
@@ -316,6 +331,8 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
   }
   
   
+  numHTjobs = theSIFDomain->getHTjobs();
+
   SIFCompartment* theCompartment = theSIFDomain->getSIFCompartment(CompartmentID);
   if (theCompartment==0) {
     opserr<<"WARNING::SIFfireAction failed to allocate the pointer to the compartment "<<CompartmentID<< endln;
@@ -343,7 +360,8 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
     theMemberID = SecXBeams(i);
     SIFXBeamSec* theMember =  theSIFDomain->getSIFXBeamSec(theMemberID);
     opserr<<" "<<theMember->getTag();
-    this->RunHTforMember(theMember, thePatternTag);
+    if (this->RunHTforMember(theMember, thePatternTag) != 0)
+      result = -1;
   }
 
   //Then loop over all the XBeams in the compartment
@@ -359,7 +377,8 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
     theMemberID = XBeams(i);
     SIFXBeam* theMember =  theSIFDomain->getSIFXBeam(theMemberID);
     opserr<<" "<<theMember->getTag();
-    this->RunHTforMember(theMember, thePatternTag);
+    if (this->RunHTforMember(theMember, thePatternTag) != 0)
+      result = -1;
   }
   //end of loop over the XBeams
   
@@ -374,7 +393,8 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
     theMemberID = YBeams(i);
     SIFYBeam* theMember =  theSIFDomain->getSIFYBeam(theMemberID);
 	opserr<<" "<<theMember->getTag();
-    this->RunHTforMember(theMember, thePatternTag);
+    if (this->RunHTforMember(theMember, thePatternTag) != 0)
+      result = -1;
   }
   //end of loop over the YBeams
   
@@ -390,7 +410,8 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
     SIFColumn* theMember =  theSIFDomain->getSIFColumn(theMemberID);
 	opserr<<" "<<theMember->getTag();
 	    if(theMember->getTag()==3301)
-		this->RunHTforMember(theMember, thePatternTag);
+		if (this->RunHTforMember(theMember, thePatternTag) != 0)
+			result = -1;
   }
   //end of loop over the Columns
   
@@ -404,12 +425,19 @@ SIFfireAction::Apply(int LoadPatternTag, double timeStep, double fireDuration )
     theMemberID = Slabs(i);
     SIFSlab* theMember =  theSIFDomain->getSIFSlab(theMemberID);
 	opserr<<" "<<theMember->getTag();
-   this->RunHTforMember(theMember, thePatternTag);
+   if (this->RunHTforMember(theMember, thePatternTag) != 0)
+     result = -1;
   }
   //end of loop over the Slabs
+
+  //wait for the heat transfer analyses still running
+  while (!theHTtasks.empty()) {
+    if (this->FinishHTtask() != 0)
+      result = -1;
+  }
  
 	//Finnaly all the members will have thermalActions defined directly with pathtimeseriesThermal.
-	return 0;
+	return result;
 }
 	
 
@@ -426,7 +454,6 @@ SIFfireAction::RunHTforMember(SIFMember* theMember,int LoadPatternTag)
 	if(appliedFireActions==0)
 		return 0;
 
-	Domain* theDomain = theSIFDomain->getStructureDomain();
 	Vector damageVec = 0;
 	
     //Create a SIFHTforMember;
@@ -727,8 +754,92 @@ SIFfireAction::RunHTforMember(SIFMember* theMember,int LoadPatternTag)
     
 	//---------------********-------------------Key executing------------*******-------------------- 
 	Matrix* CrdMat = new Matrix(NumofSeries,4);
-	theHTforMember->applyFire(*FireOrigin, CrdMat);
+
+	SIFHTtask theTask;
+	theTask.theMember = theMember;
+	theTask.theHTforMember = theHTforMember;
+	theTask.thePathTimeSeries = thePathTimeSeries;
+	theTask.CrdMat = CrdMat;
+	theTask.NumofSeries = NumofSeries;
+	theTask.LoadPatternTag = LoadPatternTag;
+	theTask.pid = -1;
+	theTask.fd = -1;
+
+	int result = 0;
+
+	//reuse the results of an analysis with the same inputs
+	SIFHTcache* theHTcache = theSIFDomain->getHTcache();
+	if (theHTcache != 0) {
+		this->getHTkey(theTask, theTask.key);
+
+		//an identical analysis still running is finished first
+		bool isRunning = true;
+		while (isRunning) {
+			isRunning = false;
+			for (size_t i=0; i<theHTtasks.size(); i++)
+				if (theHTtasks[i].key == theTask.key)
+					isRunning = true;
+			if (isRunning && this->FinishHTtask() != 0)
+				result = -1;
+		}
+
+		std::vector<double> data;
+		double elapsed;
+		if (theHTcache->getResults(theTask.key, data) == 0 &&
+			this->unpackHTresults(theTask, data, elapsed) == 0) {
+			opserr<<"(reused)";
+			if (this->ApplyHTresults(theTask) != 0)
+				result = -1;
+			return result;
+		}
+	}
+
+	if (numHTjobs > 1) {
+		if (this->StartHTtask(theTask) != 0)
+			result = -1;
+		return result;
+	}
+
+	Timer theTimer;
+	theTimer.start();
+	int res = theHTforMember->applyFire(*FireOrigin, CrdMat);
+	theTimer.pause();
+	opserr<<"("<<theTimer.getReal()<<"s)";
+
+	if (res != 0) {
+		opserr<<"WARNING::SIFfireAction heat transfer analysis failed for member "<<theMember->getTag()<<endln;
+		this->DiscardHTtask(theTask);
+		return -1;
+	}
+
+	if (theHTcache != 0) {
+		std::vector<double> data;
+		this->packHTresults(theTask, res, theTimer.getReal(), data);
+		theHTcache->addResults(theTask.key, data);
+	}
 	//---------------********-------------------Key executing------------*******-------------------- 
+
+	if (this->ApplyHTresults(theTask) != 0)
+		result = -1;
+	return result;
+}
+
+
+//apply the thermal actions obtained from a member heat transfer analysis to the structure
+int 
+SIFfireAction::ApplyHTresults(SIFHTtask& theTask)
+{
+	SIFMember* theMember = theTask.theMember;
+	SIFHTforMember* theHTforMember = theTask.theHTforMember;
+	PathTimeSeriesThermal** thePathTimeSeries = theTask.thePathTimeSeries;
+	Matrix* CrdMat = theTask.CrdMat;
+	int NumofSeries = theTask.NumofSeries;
+	int LoadPatternTag = theTask.LoadPatternTag;
+
+	int MemberTypeTag = theMember->getMemberTypeTag();
+	Domain* theDomain = theSIFDomain->getStructureDomain();
+	Vector damageVec = 0;
+
 	Vector locs= Vector();
 	locs =   theHTforMember->getRecLocations();
 #ifdef _DEBUG
@@ -891,5 +1002,316 @@ SIFfireAction::RunHTforMember(SIFMember* theMember,int LoadPatternTag)
 }
 
 
+//////////////////////////----------------Concurrent heat transfer analyses-------------------//////////
 
+//start the heat transfer analysis of a member in a child process; once numHTjobs
+//analyses are running the oldest one is finished first, so the results are applied
+//to the structure (and load tags assigned) in the same order as a serial run
+int
+SIFfireAction::StartHTtask(SIFHTtask& theTask)
+{
+  int result = 0;
 
+#ifndef _WIN32
+  while ((int)theHTtasks.size() >= numHTjobs) {
+    if (this->FinishHTtask() != 0)
+      result = -1;
+  }
+
+  int fds[2];
+  pid_t pid = -1;
+  if (pipe(fds) == 0) {
+    fflush(0);
+    pid = fork();
+    if (pid < 0) {
+      close(fds[0]);
+      close(fds[1]);
+    }
+  }
+
+  if (pid == 0) {
+    //child: run the analysis and send back the results, i.e. the record locations,
+    //section coordinates and for each series the times and temperatures
+    close(fds[0]);
+
+    Timer theTimer;
+    theTimer.start();
+    int res = theTask.theHTforMember->applyFire(*FireOrigin, theTask.CrdMat);
+    theTimer.pause();
+
+    std::vector<double> data;
+    this->packHTresults(theTask, res, theTimer.getReal(), data);
+
+    const char* buffer = (const char*)&data[0];
+    size_t numBytes = data.size()*sizeof(double);
+    while (numBytes > 0) {
+      ssize_t nwrite = write(fds[1], buffer, numBytes);
+      if (nwrite < 0) {
+	if (errno == EINTR)
+	  continue;
+	_exit(1);
+      }
+      buffer += nwrite;
+      numBytes -= nwrite;
+    }
+    close(fds[1]);
+    _exit(0);
+  }
+
+  if (pid > 0) {
+    close(fds[1]);
+    theTask.pid = pid;
+    theTask.fd = fds[0];
+    theHTtasks.push_back(theTask);
+    return result;
+  }
+
+  opserr<<"WARNING::SIFfireAction failed to start a process for the heat transfer analysis of member "
+	<<theTask.theMember->getTag()<<", running it here"<<endln;
+#endif
+
+  //no processes available, run the analysis here
+  if (theTask.theHTforMember->applyFire(*FireOrigin, theTask.CrdMat) != 0) {
+    opserr<<"WARNING::SIFfireAction heat transfer analysis failed for member "<<theTask.theMember->getTag()<<endln;
+    this->DiscardHTtask(theTask);
+    return -1;
+  }
+  if (this->ApplyHTresults(theTask) != 0)
+    result = -1;
+
+  return result;
+}
+
+
+//collect the results of the oldest analysis started and apply them to the structure
+int
+SIFfireAction::FinishHTtask(void)
+{
+  if (theHTtasks.empty())
+    return 0;
+
+  SIFHTtask theTask = theHTtasks.front();
+  theHTtasks.erase(theHTtasks.begin());
+
+#ifndef _WIN32
+  std::vector<double> data;
+  std::vector<char> bytes;
+  char buffer[65536];
+  while (true) {
+    ssize_t nread = read(theTask.fd, buffer, sizeof(buffer));
+    if (nread < 0 && errno == EINTR)
+      continue;
+    if (nread <= 0)
+      break;
+    bytes.insert(bytes.end(), buffer, buffer+nread);
+  }
+  close(theTask.fd);
+  theTask.fd = -1;
+
+  int status = 0;
+  waitpid(theTask.pid, &status, 0);
+
+  int memberTag = theTask.theMember->getTag();
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || bytes.size() % sizeof(double) != 0) {
+    opserr<<"WARNING::SIFfireAction heat transfer analysis failed for member "<<memberTag<<endln;
+    this->DiscardHTtask(theTask);
+    return -1;
+  }
+  data.resize(bytes.size()/sizeof(double));
+  if (!data.empty())
+    memcpy(&data[0], &bytes[0], bytes.size());
+
+  //the analysis ran but failed, its results are neither cached nor applied
+  if (!data.empty() && data[0] != 0) {
+    opserr<<"WARNING::SIFfireAction heat transfer analysis failed for member "<<memberTag
+	  <<" (status "<<(int)data[0]<<")"<<endln;
+    this->DiscardHTtask(theTask);
+    return -1;
+  }
+
+  double elapsed = 0;
+  if (this->unpackHTresults(theTask, data, elapsed) != 0) {
+    opserr<<"WARNING::SIFfireAction received incomplete heat transfer results for member "<<memberTag<<endln;
+    this->DiscardHTtask(theTask);
+    return -1;
+  }
+
+  SIFHTcache* theHTcache = theSIFDomain->getHTcache();
+  if (theHTcache != 0 && !theTask.key.empty())
+    theHTcache->addResults(theTask.key, data);
+
+  opserr<<endln<<"SIFfireAction::heat transfer analysis for member "<<memberTag<<" finished in "<<elapsed<<"s";
+#endif
+
+  return this->ApplyHTresults(theTask);
+}
+
+
+//free what was set up for a member whose heat transfer results are not applied
+void
+SIFfireAction::DiscardHTtask(SIFHTtask& theTask)
+{
+  if (theTask.fd >= 0) {
+#ifndef _WIN32
+    close(theTask.fd);
+#endif
+    theTask.fd = -1;
+  }
+
+  if (theTask.thePathTimeSeries != 0) {
+    for (int k=0; k<theTask.NumofSeries; k++)
+      if (theTask.thePathTimeSeries[k] != 0)
+	delete theTask.thePathTimeSeries[k];
+    delete [] theTask.thePathTimeSeries;
+    theTask.thePathTimeSeries = 0;
+  }
+
+  if (theTask.CrdMat != 0) {
+    delete theTask.CrdMat;
+    theTask.CrdMat = 0;
+  }
+}
+
+
+//////////////////////////----------------Heat transfer results-------------------//////////
+
+//text describing everything the heat transfer analysis of a member depends on
+int
+SIFfireAction::getHTkey(SIFHTtask& theTask, std::string& key)
+{
+  std::ostringstream theKey;
+  theKey<<std::setprecision(17);
+  theKey<<"SIFfireAction 1"<<"\n";
+  theKey<<"fire "<<FireModelType<<" "<<StartTime<<"\n";
+
+  if (FireModelType == 3) {
+    theKey<<"localised "<<(*FireOrigin)(0)<<" "<<(*FireOrigin)(1)<<" "<<(*FireOrigin)(2)
+	  <<" "<<FireDia<<" "<<FireHRR<<"\n";
+
+    //storey height used by UpdateFireModel
+    SIFCompartment* theComp = theSIFDomain->getSIFCompartment(CompartmentID);
+    if (theComp != 0 && theComp->getConnectedColumns().Size() > 0) {
+      SIFColumn* theColumn = theSIFDomain->getSIFColumn(theComp->getConnectedColumns()(0));
+      const ID& joints = theColumn->getConnectedJoints();
+      theKey<<"storey";
+      for (int i=0; i<joints.Size(); i++)
+	theKey<<" "<<theSIFDomain->getSIFJoint(joints(i))->getCrds()(1);
+      if (theComp->getConnectedSlabs().Size() > 0) {
+	SIFSlab* theSlab = theSIFDomain->getSIFSlab(theComp->getConnectedSlabs()(0));
+	theKey<<" "<<(theSlab->getSIFSectionPtr())->getSectionPars()(0);
+      }
+      theKey<<"\n";
+    }
+  }
+
+  //the section locations depend on the member position for more than one series
+  if (theTask.NumofSeries > 1) {
+    const ID& joints = theTask.theMember->getConnectedJoints();
+    theKey<<"joints";
+    for (int i=0; i<joints.Size(); i++) {
+      const Vector& crds = theSIFDomain->getSIFJoint(joints(i))->getCrds();
+      for (int j=0; j<crds.Size(); j++)
+	theKey<<" "<<crds(j);
+    }
+    theKey<<"\n";
+  }
+
+  theKey<<"series "<<theTask.NumofSeries;
+  for (int k=0; k<theTask.NumofSeries; k++)
+    theKey<<" "<<theTask.thePathTimeSeries[k]->getPath()->noCols();
+  theKey<<"\n";
+
+  key = theKey.str();
+  return theTask.theHTforMember->getHTkey(key);
+}
+
+
+//results of a member heat transfer analysis as an array of doubles: status, time
+//taken, record locations, section coordinates and for each series the times and
+//temperatures
+int
+SIFfireAction::packHTresults(SIFHTtask& theTask, int res, double elapsed, std::vector<double>& data)
+{
+  data.clear();
+  data.push_back(res);
+  data.push_back(elapsed);
+
+  const Vector& locs = theTask.theHTforMember->getRecLocations();
+  data.push_back(locs.Size());
+  for (int i=0; i<locs.Size(); i++)
+    data.push_back(locs(i));
+
+  Matrix& CrdMat = *(theTask.CrdMat);
+  for (int i=0; i<CrdMat.noRows(); i++)
+    for (int j=0; j<CrdMat.noCols(); j++)
+      data.push_back(CrdMat(i,j));
+
+  for (int k=0; k<theTask.NumofSeries; k++) {
+    const Vector* times = theTask.thePathTimeSeries[k]->getTimes();
+    const Matrix* path = theTask.thePathTimeSeries[k]->getPath();
+    int numRows = (times != 0 && path != 0) ? times->Size() : 0;
+    data.push_back(numRows);
+    for (int i=0; i<numRows; i++)
+      data.push_back((*times)(i));
+    for (int i=0; i<numRows; i++)
+      for (int j=0; j<path->noCols(); j++)
+	data.push_back((*path)(i,j));
+  }
+
+  return 0;
+}
+
+
+int
+SIFfireAction::unpackHTresults(SIFHTtask& theTask, const std::vector<double>& data, double& elapsed)
+{
+  size_t loc = 0;
+  size_t size = data.size();
+  if (size < 3)
+    return -1;
+
+  //results of a failed analysis are not used
+  if (data[0] != 0)
+    return -1;
+
+  elapsed = data[1];
+  int numLocs = (int)data[2];
+  loc = 3;
+  if (numLocs < 0 || loc + numLocs > size)
+    return -1;
+
+  Vector locs(numLocs);
+  for (int i=0; i<numLocs; i++)
+    locs(i) = data[loc++];
+
+  Matrix& CrdMat = *(theTask.CrdMat);
+  if (loc + CrdMat.noRows()*CrdMat.noCols() > size)
+    return -1;
+  for (int i=0; i<CrdMat.noRows(); i++)
+    for (int j=0; j<CrdMat.noCols(); j++)
+      CrdMat(i,j) = data[loc++];
+
+  for (int k=0; k<theTask.NumofSeries; k++) {
+    if (loc >= size)
+      return -1;
+    int numRows = (int)data[loc++];
+    if (numRows == 0)
+      continue;
+    int numCols = theTask.thePathTimeSeries[k]->getPath()->noCols();
+    if (numRows < 0 || loc + numRows*(1+numCols) > size)
+      return -1;
+    Vector times(numRows);
+    Matrix path(numRows, numCols);
+    for (int i=0; i<numRows; i++)
+      times(i) = data[loc++];
+    for (int i=0; i<numRows; i++)
+      for (int j=0; j<numCols; j++)
+	path(i,j) = data[loc++];
+    if (theTask.thePathTimeSeries[k]->setResults(times, path) != 0)
+      return -1;
+  }
+
+  theTask.theHTforMember->setRecLocations(locs);
+
+  return 0;
+}
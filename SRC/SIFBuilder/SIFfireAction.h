@@ -11,6 +11,8 @@
 #include <HeatTransferDomain.h>
 #include <SIFMember.h>
 #include <SIFHTforMember.h>
+#include <vector>
+#include <string>
 
 class ID;
 class Vector;
@@ -20,6 +22,24 @@ class FireModel;
 class HeatTransferDomain;
 class TaggedObjectStorage;
 class TaggedObjectIter;
+class PathTimeSeriesThermal;
+class SIFMember;
+class SIFHTforMember;
+
+// the heat transfer analysis of one member and what is needed to apply its
+// results to the structure; with more than one job the analysis runs in a
+// child process (pid) which sends the results back through a pipe (fd)
+struct SIFHTtask {
+  SIFMember* theMember;
+  SIFHTforMember* theHTforMember;
+  PathTimeSeriesThermal** thePathTimeSeries;
+  Matrix* CrdMat;
+  int NumofSeries;
+  int LoadPatternTag;
+  int pid;
+  int fd;
+  std::string key;    // describes the analysis inputs if results are reused
+};
 
 class SIFfireAction: public TaggedObject
 {
@@ -45,6 +65,7 @@ public:
 	
 	int Apply( int LoadPatternTag, double timeStep=30,double fireDuration=0);
 	int RunHTforMember(SIFMember* theMember,int LoadPatternTag);
+	int ApplyHTresults(SIFHTtask& theTask);
 	
 	virtual void  Print(OPS_Stream&, int = 0) {return;};
    
@@ -61,6 +82,17 @@ private:
 	FireModel* theFireModel;
 	SIFBuilderDomain* theSIFDomain;
     HeatTransferDomain* theHTDomain;
+
+  // concurrent heat transfer analyses, started in member order and
+  // finished (results applied to the structure) in the same order
+  int StartHTtask(SIFHTtask& theTask);
+  int FinishHTtask(void);
+  void DiscardHTtask(SIFHTtask& theTask);
+  int getHTkey(SIFHTtask& theTask, std::string& key);
+  int packHTresults(SIFHTtask& theTask, int res, double elapsed, std::vector<double>& data);
+  int unpackHTresults(SIFHTtask& theTask, const std::vector<double>& data, double& elapsed);
+  int numHTjobs;
+  std::vector<SIFHTtask> theHTtasks;
 		
 };
 #endif
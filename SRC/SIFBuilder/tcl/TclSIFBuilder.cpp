@@ -2868,6 +2868,33 @@ TclSIFBuilderCommand_applyAndanalyze(ClientData clientData, Tcl_Interp *interp,
 			}
 
 		}
+
+		while(argc-count>0){
+			//number of member heat transfer analyses run at once
+			if ((strcmp(argv[count],"-jobs") == 0 ||strcmp(argv[count],"jobs") == 0) && argc-count>1) {
+			count++;
+			int numJobs = 1;
+			if (Tcl_GetInt (interp, argv[count], &numJobs) != TCL_OK) {
+			opserr << "WARNING invalid number of jobs" << endln;
+			opserr << " for applying fire action in SIFBuilder: " << endln;
+			return TCL_ERROR;
+			}
+			theSIFDomain->setHTjobs(numJobs);
+			count++;
+			}
+			//reuse heat transfer results of identical members, optionally kept in a directory
+			else if (strcmp(argv[count],"-cache") == 0 ||strcmp(argv[count],"cache") == 0) {
+			count++;
+			const char* cacheDir = 0;
+			if (argc-count>0 && argv[count][0] != '-') {
+				cacheDir = argv[count];
+				count++;
+			}
+			theSIFDomain->setHTcache(cacheDir);
+			}
+			else
+				break;
+		}
 		
 		
 		theSIFDomain->applyFireAction(thePatternTag,dt, duration);
@@ -39,6 +39,12 @@
 #include <MovableObject.h>
 #include <SocketAddress.h>
 
+#ifndef _WIN32
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <errno.h>
+#endif
+
 static int GetHostAddr(char *host, char *IntAddr);
 static void inttoa(unsigned int no, char *string, int *cnt);
 
@@ -855,6 +861,92 @@ TCP_Socket::getBytesAvailable()
 }
 
 
+int
+TCP_Socket::setBlocking(bool blocking)
+{
+#ifdef _WIN32
+    u_long mode = (blocking == true) ? 0 : 1;
+    if (ioctlsocket(sockfd, FIONBIO, &mode) != 0)
+        return -1;
+#else
+    int flags = fcntl(sockfd, F_GETFL, 0);
+    if (flags < 0)
+        return -1;
+    if (blocking == true)
+        flags &= ~O_NONBLOCK;
+    else
+        flags |= O_NONBLOCK;
+    if (fcntl(sockfd, F_SETFL, flags) < 0)
+        return -1;
+#endif
+
+    return 0;
+}
+
+
+int
+TCP_Socket::sendBuffers(const char **buffers, const int *sizes, int numBuffers)
+{
+    int numWritten = 0;
+
+#ifdef _WIN32
+    for (int i=0; i<numBuffers; i++) {
+        int nleft = sizes[i];
+        const char *gMsg = buffers[i];
+        while (nleft > 0) {
+            int nwrite = send(sockfd, gMsg, nleft, 0);
+            if (nwrite == SOCKET_ERROR) {
+                if (WSAGetLastError() == WSAEWOULDBLOCK)
+                    return numWritten;
+                return -1;
+            }
+            nleft -= nwrite;
+            gMsg += nwrite;
+            numWritten += nwrite;
+        }
+    }
+#else
+    struct iovec theBuffers[8];
+    if (numBuffers > 8) {
+        opserr << "TCP_Socket::sendBuffers() - at most 8 buffers can be sent at once\n";
+        return -1;
+    }
+
+    for (int i=0; i<numBuffers; i++) {
+        theBuffers[i].iov_base = (void *)buffers[i];
+        theBuffers[i].iov_len = sizes[i];
+    }
+
+    // a consumer that has gone away gives EPIPE, and an error return,
+    // rather than a SIGPIPE that would terminate the program
+    int nwrite;
+#ifdef MSG_NOSIGNAL
+    struct msghdr theMsg;
+    memset(&theMsg, 0, sizeof(theMsg));
+    theMsg.msg_iov = theBuffers;
+    theMsg.msg_iovlen = numBuffers;
+    nwrite = sendmsg(sockfd, &theMsg, MSG_NOSIGNAL);
+#else
+#ifdef SO_NOSIGPIPE
+    int noSigPipe = 1;
+    setsockopt(sockfd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+    nwrite = writev(sockfd, theBuffers, numBuffers);
+#endif
+    if (nwrite < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return 0;
+        if (errno == EPIPE)
+            opserr << "TCP_Socket::sendBuffers() - connection closed by the other end\n";
+        return -1;
+    }
+    numWritten = nwrite;
+#endif
+
+    return numWritten;
+}
+
+
 char *
 TCP_Socket::addToProgram()
 {
@@ -93,6 +93,13 @@ class TCP_Socket : public Channel
     int recvID(int dbTag, int commitTag, 
 	       ID &theID, 
 	       ChannelAddress *theAddress =0);    
+
+    // raw gather write used by streams that frame their own data; when the
+    // socket is non-blocking sendBuffers() returns the number of bytes written,
+    // which is 0 if the socket would block, or -1 on an error (also when the
+    // other end has closed the connection, no SIGPIPE is raised)
+    int setBlocking(bool blocking);
+    int sendBuffers(const char **buffers, const int *sizes, int numBuffers);
     
   protected:
     unsigned int getPortNumber() const;
@@ -43,6 +43,7 @@
 #include <ConstraintHandler.h>
 #include <ConvergenceTest.h>
 #include <TransientIntegrator.h>
+#include <PFEMIntegrator.h>
 #include <Domain.h>
 #include <Node.h>
 #include <SP_Constraint.h>
@@ -52,6 +53,7 @@
 #include <Pressure_ConstraintIter.h>
 #include <ElementIter.h>
 #include <map>
+#include <chrono>
 
 #ifdef _PARALLEL_INTERPRETERS
 #include <mpi.h>
@@ -69,7 +71,7 @@ PFEMAnalysis::PFEMAnalysis(Domain& theDomain,
     :DirectIntegrationAnalysis(theDomain,theHandler,theNumberer,theModel,theSolnAlgo,
                                theSOE,theIntegrator,theTest),
      dtmax(max), dtmin(min), gravity(g), ratio(r),
-     dt(max), next(max), newstep(true)
+     dt(max), next(max), newstep(true), timing(false)
 {
     
 }
@@ -87,14 +89,23 @@ PFEMAnalysis::analyze()
         next = current + dtmax;
     }
     bool instep = false;
+
+    // the time of the step spent in identify(), in the assembly by a
+    // PFEMIntegrator, and in the rest of the analysis, mostly the solution
+    PFEMIntegrator* thePFEMIntegrator = dynamic_cast<PFEMIntegrator*>(this->getIntegrator());
+    double assembly = (thePFEMIntegrator != 0) ? thePFEMIntegrator->getAssemblyTime() : 0.0;
+    std::chrono::duration<double> identifyTime(0.0), stepTime(0.0);
 	
     while(true) {
 
 	// identify domain
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 	if (this->identify() < 0) {
 	    opserr<<"WARNING: failed to identify domain -- PFEMAnalysis\n";
 	    return -1;
 	}
+	std::chrono::steady_clock::time_point identified = std::chrono::steady_clock::now();
+	identifyTime += identified - start;
 
         // analyze
 #ifdef _PARALLEL_INTERPRETERS
@@ -109,6 +120,7 @@ PFEMAnalysis::analyze()
 
 	// analysis
         int converged  = DirectIntegrationAnalysis::analyze(1, dt);
+	stepTime += std::chrono::steady_clock::now() - identified;
 
         // if failed
         if(converged < 0) {
@@ -133,6 +145,18 @@ PFEMAnalysis::analyze()
 	break;
     }
 
+    if (thePFEMIntegrator != 0) {
+	assembly = thePFEMIntegrator->getAssemblyTime() - assembly;
+    }
+    int myid = 0;
+#ifdef _PARALLEL_INTERPRETERS
+    MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+#endif
+    if(timing && myid == 0) {
+	opserr<<"identify "<<identifyTime.count()<<" s, assembly "<<assembly;
+	opserr<<" s, solution "<<stepTime.count()-assembly<<" s\n";
+    }
+
     return 0;
 }
 
@@ -54,6 +54,9 @@ public:
 
     int analyze();
 
+    // print the identify, assembly and solution time of each step
+    void setTiming(bool flag) {timing = flag;}
+
     virtual ~PFEMAnalysis();
 
 private:
@@ -68,6 +71,7 @@ private:
     double next;
     int curr;
     bool newstep;
+    bool timing;
 };
 
 #endif
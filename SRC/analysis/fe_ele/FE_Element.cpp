@@ -58,7 +58,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0),
+   theConstant(0), constantTag(0), constantKt(0.0)
 {
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
@@ -167,7 +168,8 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0),
+   theConstant(0), constantTag(0), constantKt(0.0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
@@ -209,6 +211,9 @@ FE_Element::~FE_Element()
 	if (theResidual != 0) delete theResidual;
     }
 
+    if (theConstant != 0)
+	delete theConstant;
+
     // if this is the last FE_Element, clean up the
     // storage for the matrix and vector objects
     if (numFEs == 0) {
@@ -416,6 +421,57 @@ FE_Element::addKiToTang(double fact)
   }	
 }
 
+double
+FE_Element::addConstantToTang(double factKi, double factC, double factM, int stepTag)
+{
+  if (myEle == 0)
+    return 0.0;
+
+  if (myEle->isSubdomain() == true) {
+    opserr << "WARNING FE_Element::addConstantToTang() - ";
+    opserr << "- this should not be called on a Subdomain!\n";
+    return 0.0;
+  }
+
+  if (stepTag == 0 || myEle->hasConstantMassAndDamp() == false) {
+    this->addKiToTang(factKi);
+    this->addCtoTang(factC);
+    this->addMtoTang(factM);
+    return 0.0;
+  }
+
+  // form the parts again for a new step, or if the integrator has changed
+  // the factors within the step
+  if (theConstant == 0 || stepTag != constantTag ||
+      factKi != constantFactors[0] || factC != constantFactors[1] ||
+      factM != constantFactors[2]) {
+
+    if (theConstant == 0) {
+      theConstant = new Matrix(numDOF, numDOF);
+      if (theConstant == 0 || theConstant->noRows() != numDOF) {
+	opserr << "FE_Element::addConstantToTang() ";
+	opserr << " ran out of memory for Matrix of size :";
+	opserr << numDOF << endln;
+	exit(-1);
+      }
+    }
+
+    theConstant->Zero();
+    if (factKi != 0.0)
+      theConstant->addMatrix(1.0, myEle->getInitialStiff(), factKi);
+    constantKt = myEle->addConstantDampAndMass(*theConstant, factC, factM);
+
+    constantTag = stepTag;
+    constantFactors[0] = factKi;
+    constantFactors[1] = factC;
+    constantFactors[2] = factM;
+  }
+
+  theTangent->addMatrix(1.0, *theConstant, 1.0);
+
+  return constantKt;
+}
+
 void
 FE_Element::addKgToTang(double fact)
 {
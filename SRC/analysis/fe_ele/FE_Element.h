@@ -70,6 +70,13 @@ class FE_Element: public TaggedObject
     virtual void  addMtoTang(double fact = 1.0);    
     virtual void  addKpToTang(double fact = 1.0, int numP = 0);
     virtual int   storePreviousK(int numP);
+
+    // add factKi*Ki + factC*C + factM*M to the tangent; if the element
+    // hasConstantMassAndDamp() the sum, less the part factC*betaK*Kt of the
+    // Rayleigh damping, is formed only when stepTag or the factors differ
+    // from those of the last call and kept, and the factor of Kt left out
+    // is returned for the integrator to add with addKtToTang(), else 0
+    virtual double addConstantToTang(double factKi, double factC, double factM, int stepTag);
     
     // methods to allow integrator to build residual    
     virtual void  zeroResidual(void);    
@@ -122,6 +129,12 @@ class FE_Element: public TaggedObject
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
 
+    // the parts of the tangent kept for a step by addConstantToTang()
+    Matrix *theConstant;
+    int constantTag;
+    double constantFactors[3];
+    double constantKt;
+
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <string.h>
 #define OPS_Export
 
 
@@ -50,24 +51,38 @@ OPS_HHT(void)
     TransientIntegrator *theIntegrator = 0;
     
     int argc = OPS_GetNumRemainingInputArgs();
-    if (argc != 1 && argc != 3) {
-        opserr << "WARNING - incorrect number of args want HHT $alpha <$gamma $beta>\n";
+    if (argc != 1 && argc != 2 && argc != 3 && argc != 4) {
+        opserr << "WARNING - incorrect number of args want HHT $alpha <$gamma $beta> <-keepConstant>\n";
         return 0;
     }
     
+    // the option is the last argument
+    int numData = (argc == 2 || argc == 4) ? argc-1 : argc;
     double dData[3];
-    if (OPS_GetDouble(&argc, dData) != 0) {
-        opserr << "WARNING - invalid args want HHT $alpha <$gamma $beta>\n";
+    if (OPS_GetDouble(&numData, dData) != 0) {
+        opserr << "WARNING - invalid args want HHT $alpha <$gamma $beta> <-keepConstant>\n";
         return 0;
     }
     
-    if (argc == 1)
+    bool keepConstant = false;
+    if (numData < argc) {
+        const char *nextString = OPS_GetString();
+        if (strcmp(nextString, "-keepConstant") != 0) {
+            opserr << "WARNING - unknown option " << nextString << " want HHT $alpha <$gamma $beta> <-keepConstant>\n";
+            return 0;
+        }
+        keepConstant = true;
+    }
+    
+    if (numData == 1)
         theIntegrator = new HHT(dData[0]);
     else
         theIntegrator = new HHT(dData[0], dData[1], dData[2]);
     
     if (theIntegrator == 0)
         opserr << "WARNING - out of memory creating HHT integrator\n";
+    else
+        theIntegrator->setKeepConstant(keepConstant);
     
     return theIntegrator;
 }
@@ -153,6 +168,7 @@ int HHT::newStep(double _deltaT)
     c1 = 1.0;
     c2 = gamma/(beta*deltaT);
     c3 = 1.0/(beta*deltaT*deltaT);
+    this->newConstantTag();
     
     if (U == 0)  {
         opserr << "HHT::newStep() - domainChange() failed or hasn't been called\n";
@@ -209,6 +225,25 @@ int HHT::revertToLastStep()
 int HHT::formEleTangent(FE_Element *theEle)
 {
     theEle->zeroTangent();
+
+    // the parts of the tangent that do not change in the step are kept by
+    // the FE_Element, only the current tangent is formed at each call
+    if (constantTag != 0)  {
+        if (statusFlag == CURRENT_TANGENT)  {
+            double factKt = theEle->addConstantToTang(0.0, alpha*c2, c3, constantTag);
+            theEle->addKtToTang(alpha*c1 + factKt);
+        } else if (statusFlag == INITIAL_TANGENT)  {
+            double factKt = theEle->addConstantToTang(alpha*c1, alpha*c2, c3, constantTag);
+            theEle->addKtToTang(factKt);
+        } else if (statusFlag == HALL_TANGENT)  {
+            double factKt = theEle->addConstantToTang(alpha*c1*iFactor, alpha*c2, c3, constantTag);
+            theEle->addKtToTang(alpha*c1*cFactor + factKt);
+        } else {
+            opserr << "HHT::formEleTangent - unknown FLAG\n";
+        }
+        return 0;
+    }
+
     if (statusFlag == CURRENT_TANGENT)  {
         theEle->addKtToTang(alpha*c1);
         theEle->addCtoTang(alpha*c2);
@@ -432,10 +467,11 @@ HHT::getVel()
 
 int HHT::sendSelf(int cTag, Channel &theChannel)
 {
-    Vector data(3);
+    Vector data(4);
     data(0) = alpha;
     data(1) = beta;
     data(2) = gamma;
+    data(3) = this->getKeepConstant() ? 1.0 : 0.0;
     
     if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0)  {
         opserr << "WARNING HHT::sendSelf() - could not send data\n";
@@ -448,7 +484,7 @@ int HHT::sendSelf(int cTag, Channel &theChannel)
 
 int HHT::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    Vector data(3);
+    Vector data(4);
     if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0)  {
         opserr << "WARNING HHT::recvSelf() - could not receive data\n";
         return -1;
@@ -457,6 +493,7 @@ int HHT::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
     alpha  = data(0);
     beta   = data(1);
     gamma  = data(2);
+    this->setKeepConstant(data(3) != 0.0);
     
     return 0;
 }
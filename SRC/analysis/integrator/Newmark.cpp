@@ -63,27 +63,23 @@ OPS_Newmark(void)
   TransientIntegrator *theIntegrator = 0;
 
   int argc = OPS_GetNumRemainingInputArgs();
-  if (argc != 2 && argc != 4) {
-    opserr << "WARNING - incorrect number of args want Newmark $gamma $beta <-form $typeUnknown>\n";
+  if (argc < 2 || argc > 5) {
+    opserr << "WARNING - incorrect number of args want Newmark $gamma $beta <-form $typeUnknown> <-keepConstant>\n";
     return 0;
   }
 
   int dispFlag = 1;
+  bool keepConstant = false;
   double dData[2];
   int numData = 2;
   if (OPS_GetDouble(&numData, dData) != 0) {
-    opserr << "WARNING - invalid args want Newmark $gamma $beta <-form $typeUnknown>\n";
+    opserr << "WARNING - invalid args want Newmark $gamma $beta <-form $typeUnknown> <-keepConstant>\n";
     return 0;
   }
   
-  if (argc == 2)
-    theIntegrator = new Newmark(dData[0], dData[1]);
-  else {
-    //    char nextString[10];
+  while (OPS_GetNumRemainingInputArgs() > 0) {
     const char *nextString = OPS_GetString();
-    //    OPS_GetString(nextString, 10);
-    if (strcmp(nextString,"-form") == 0) {
-      //      OPS_GetString(nextString, 10);
+    if (strcmp(nextString,"-form") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
       nextString = OPS_GetString();
       if ((nextString[0] == 'D') || (nextString[0] == 'd')) 
 	dispFlag = 1;
@@ -91,12 +87,16 @@ OPS_Newmark(void)
 	dispFlag = 3;      
       else if ((nextString[0] == 'V') || (nextString[0] == 'v')) 
 	dispFlag = 2;      
-    }    
-    theIntegrator = new Newmark(dData[0], dData[1], dispFlag);
+    } else if (strcmp(nextString,"-keepConstant") == 0)
+      keepConstant = true;
   }
 
+  theIntegrator = new Newmark(dData[0], dData[1], dispFlag);
+
   if (theIntegrator == 0)
     opserr << "WARNING - out of memory creating Newmark integrator\n";
+  else
+    theIntegrator->setKeepConstant(keepConstant);
 
   return theIntegrator;
 }
@@ -185,6 +185,7 @@ int Newmark::newStep(double deltaT)
         c2 = gamma*deltaT;
         c3 = 1.0;
     }
+    this->newConstantTag();
     
     if (U == 0)  {
         opserr << "Newmark::newStep() - domainChange() failed or hasn't been called\n";
@@ -276,6 +277,24 @@ int Newmark::formEleTangent(FE_Element *theEle)
 
     theEle->zeroTangent();
     
+    // the parts of the tangent that do not change in the step are kept by
+    // the FE_Element, only the current tangent is formed at each call
+    if (constantTag != 0)  {
+        if (statusFlag == CURRENT_TANGENT)  {
+            double factKt = theEle->addConstantToTang(0.0, c2, c3, constantTag);
+            theEle->addKtToTang(c1 + factKt);
+        } else if (statusFlag == INITIAL_TANGENT)  {
+            double factKt = theEle->addConstantToTang(c1, c2, c3, constantTag);
+            theEle->addKtToTang(factKt);
+        } else if (statusFlag == HALL_TANGENT)  {
+            double factKt = theEle->addConstantToTang(c1*iFactor, c2, c3, constantTag);
+            theEle->addKtToTang(c1*cFactor + factKt);
+        } else {
+            opserr << "Newmark::formEleTangent - unknown FLAG\n";
+        }
+        return 0;
+    }
+
     if (statusFlag == CURRENT_TANGENT)  {
         theEle->addKtToTang(c1);
         theEle->addCtoTang(c2);
@@ -493,10 +512,11 @@ int Newmark::update(const Vector &deltaU)
 
 int Newmark::sendSelf(int cTag, Channel &theChannel)
 {
-    Vector data(3);
+    Vector data(4);
     data(0) = gamma;
     data(1) = beta;
     data(2) = displ;
+    data(3) = this->getKeepConstant() ? 1.0 : 0.0;
 
     
     if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0)  {
@@ -510,7 +530,7 @@ int Newmark::sendSelf(int cTag, Channel &theChannel)
 
 int Newmark::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    Vector data(3);
+    Vector data(4);
     if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0)  {
         opserr << "WARNING Newmark::recvSelf() - could not receive data\n";
         gamma = 0.5; beta = 0.25; 
@@ -520,6 +540,7 @@ int Newmark::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker
     gamma  = data(0);
     beta   = data(1);
     displ  = data(2);
+    this->setKeepConstant(data(3) != 0.0);
 
     return 0;
 }
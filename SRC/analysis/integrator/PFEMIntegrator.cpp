@@ -52,6 +52,7 @@
 #include <LoadPattern.h>
 #include <FE_EleIter.h>
 #include <elementAPI.h>
+#include <chrono>
 
 void* OPS_PFEMIntegrator()
 {
@@ -62,7 +63,7 @@ PFEMIntegrator::PFEMIntegrator()
     : TransientIntegrator(INTEGRATOR_TAGS_PFEMIntegrator),
       c1(0.0), c2(0.0), c3(0.0), 
       Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-      determiningMass(false), sensitivityFlag(0),gradNumber(0),
+      determiningMass(false), assemblyTime(0.0), sensitivityFlag(0),gradNumber(0),
       dVn(), dUn()
 {
     
@@ -87,6 +88,28 @@ PFEMIntegrator::~PFEMIntegrator()
 }
 
 
+int PFEMIntegrator::formTangent(int statFlag)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int res = TransientIntegrator::formTangent(statFlag);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    assemblyTime += elapsed.count();
+
+    return res;
+}
+
+
+int PFEMIntegrator::formUnbalance(void)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int res = TransientIntegrator::formUnbalance();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    assemblyTime += elapsed.count();
+
+    return res;
+}
+
+
 int PFEMIntegrator::newStep(double deltaT)
 {
 
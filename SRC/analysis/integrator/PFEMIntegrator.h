@@ -57,6 +57,11 @@ public:
     int formNodTangent(DOF_Group *theDof);    
     int formEleResidual(FE_Element *theEle);
     int formNodUnbalance(DOF_Group *theDof);
+
+    // timed for the steps of PFEMAnalysis
+    int formTangent(int statFlag);
+    int formUnbalance(void);
+    double getAssemblyTime(void) const {return assemblyTime;}
     
     int domainChanged(void);    
     int newStep(double deltaT);    
@@ -87,6 +92,7 @@ protected:
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
     Vector *U, *Udot, *Udotdot;     // response quantities at time t+deltaT
     bool determiningMass;           // flag to check if just want the mass contribution
+    double assemblyTime;            // wall time of formTangent() and formUnbalance()
 
     // Adding sensitivity
     int sensitivityFlag;
@@ -45,8 +45,13 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 
+// the tags of the steps, different for all the steps of all the
+// integrators so an FE_Element never takes the parts kept for one step
+// for those of another
+int TransientIntegrator::numConstantTags(0);
+
 TransientIntegrator::TransientIntegrator(int clasTag)
-:IncrementalIntegrator(clasTag)
+:IncrementalIntegrator(clasTag), constantTag(0), keepConstant(false)
 {
 
 }
@@ -56,6 +61,28 @@ TransientIntegrator::~TransientIntegrator()
 
 }
 
+void
+TransientIntegrator::setKeepConstant(bool keep)
+{
+    keepConstant = keep;
+    if (keepConstant == false)
+      constantTag = 0;
+}
+
+void
+TransientIntegrator::newConstantTag(void)
+{
+    if (keepConstant == false) {
+      constantTag = 0;
+      return;
+    }
+
+    numConstantTags++;
+    if (numConstantTags <= 0)
+      numConstantTags = 1;
+    constantTag = numConstantTags;
+}
+
 int 
 TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 {
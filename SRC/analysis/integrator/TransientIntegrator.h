@@ -66,9 +66,21 @@ class TransientIntegrator : public IncrementalIntegrator
     
     virtual int initialize(void) {return 0;};
 
+    // keep in the FE_Elements the parts of their tangent that do not
+    // change within a step, formed once per step by the integrators that
+    // support it, see FE_Element::addConstantToTang()
+    void setKeepConstant(bool keep);
+    bool getKeepConstant(void) const {return keepConstant;}
+
   protected:
+    // to be called by newStep(); gives constantTag a new value if the
+    // parts are kept
+    void newConstantTag(void);
+    int constantTag;   // 0 if the parts are not kept, else a tag of the step
     
   private:
+    bool keepConstant;
+    static int numConstantTags;
 };
 
 #endif
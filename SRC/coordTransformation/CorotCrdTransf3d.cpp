@@ -43,19 +43,12 @@
 #include <CorotCrdTransf3d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3); 
-Matrix CorotCrdTransf3d::RJ(3,3); 
-Matrix CorotCrdTransf3d::Rbar(3,3); 
-Matrix CorotCrdTransf3d::e(3,3); 
 Matrix CorotCrdTransf3d::Tp(6,7); 
 Matrix CorotCrdTransf3d::T(7,12);
 Matrix CorotCrdTransf3d::Tlg(12,12);
 Matrix CorotCrdTransf3d::TlgInv(12, 12);
 Matrix CorotCrdTransf3d::Tbl(6,12);
 Matrix CorotCrdTransf3d::kg(12,12);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::A(3,3);
 
 void* OPS_CorotCrdTransf3d()
 {
@@ -345,658 +338,890 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 }
 
 
-int  
-CorotCrdTransf3d::update(void)
-{       
-    int i, j, k;
-    
-    /********* OLD REMO - REPLACED BELOW TO FIX BUG ***************
-    // determine global displacement increments from last iteration
-    const Vector &dispIncrI = nodeIPtr->getIncrDeltaDisp();
-    const Vector &dispIncrJ = nodeJPtr->getIncrDeltaDisp();
-    
-     // get the iterative spins dAlphaI and dAlphaJ 
-     // (rotational displacement increments at both nodes)
-     
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
-      
-       
-        for (k = 0; k < 3; k++)
-        {
-        dAlphaI(k) = dispIncrI(k+3);
-        dAlphaJ(k) = dispIncrJ(k+3);
-        }   
-    **************************************************************/
-    
-    // determine global displacement increments from last iteration
-    static Vector dispI(6);
-    static Vector dispJ(6);
-    dispI = nodeIPtr->getTrialDisp();
-    dispJ = nodeJPtr->getTrialDisp();
-    
-    if (nodeIInitialDisp != 0) {
-        for (int j=0; j<6; j++)
-            dispI(j) -= nodeIInitialDisp[j];
+// The state determination is done on blocks of W transformations at a
+// time, W being 1 for the per element methods and corotBlockSize for the
+// batched ones, a last block with fewer transformations being padded with
+// copies of its last one. Every per element quantity of a block is held by
+// component, with the values of the transformations of the block one after
+// the other, so the kernels below are loops of fixed length over the block
+// on contiguous data. The matrices are stored by columns as in a Matrix,
+// and the operations are done as in the Matrix and Vector methods the per
+// element code used, in the same order, so the results are the same.
+
+const int corotBlockSize = 8;
+
+template <int W> struct CorotCrdTransf3dBlock
+{
+    double RI[9][W];             // nodal triad for node I
+    double RJ[9][W];             // nodal triad for node J
+    double Rbar[9][W];           // mean nodal triad
+    double e[9][W];              // base vectors
+    double ul[7][W];             // local displacements
+    double Ln[W];                // deformed element length
+    double A[9][W];              // auxiliary matrices
+    double Lr2[36][W];
+    double Lr3[36][W];
+    double T[84][W];             // transformation matrix from basic to global system
+};
+
+// block of the last transformation updated by update(void)
+static CorotCrdTransf3dBlock<1> elementBlock;
+
+// block used by the batched methods
+static CorotCrdTransf3dBlock<corotBlockSize> batchBlock;
+
+
+template <int W> static void
+blockZero(double (*X)[W], int size)
+{
+    for (int i = 0; i < size; i++)
+        for (int n = 0; n < W; n++)
+            X[i][n] = 0.0;
+}
+
+
+template <int W> static inline double
+blockDot(const double (*a)[W], const double (*b)[W], int n)
+{
+    return 0.0 + a[0][n]*b[0][n] + a[1][n]*b[1][n] + a[2][n]*b[2][n];
+}
+
+
+// S = skew symmetric matrix of theta
+template <int W> static void
+blockSkew(double (*S)[W], const double (*theta)[W])
+{
+    for (int n = 0; n < W; n++) {
+        S[0][n] =  0.0;
+        S[1][n] =  theta[2][n];
+        S[2][n] = -theta[1][n];
+        S[3][n] = -theta[2][n];
+        S[4][n] =  0.0;
+        S[5][n] =  theta[0][n];
+        S[6][n] =  theta[1][n];
+        S[7][n] = -theta[0][n];
+        S[8][n] =  0.0;
     }
-    
-    if (nodeJInitialDisp != 0) {
-        for (int j=0; j<6; j++)
-            dispJ(j) -= nodeJInitialDisp[j];
+}
+
+
+// X = B*fact, or X += B*fact if add, as Matrix::addMatrix()
+template <int W> static void
+blockAddMatrix(double (*X)[W], int size, bool add, const double (*B)[W], double fact)
+{
+    if (add) {
+        if (fact == 0.0)
+            return;
+        for (int i = 0; i < size; i++)
+            for (int n = 0; n < W; n++)
+                X[i][n] += B[i][n]*fact;
+    } else {
+        for (int i = 0; i < size; i++)
+            for (int n = 0; n < W; n++)
+                X[i][n] = B[i][n]*fact;
     }
-    
-    // get the iterative spins dAlphaI and dAlphaJ 
-    // (rotational displacement increments at both nodes)
-    
-    static Vector dAlphaI(3);
-    static Vector dAlphaJ(3);
-    
-    for (k = 0; k < 3; k++) {
-        dAlphaI(k) = dispI(k+3) - alphaI(k);
-        dAlphaJ(k) = dispJ(k+3) - alphaJ(k);
-        alphaI(k) =  dispI(k+3);
-        alphaJ(k) =  dispJ(k+3);
-    }   
-    
-    /************** END OF REPLACEMENT **************************/
-    
-    // update the nodal triads TI and RJ using quaternions
-    static Vector dAlphaIq(4);
-    static Vector dAlphaJq(4);
+}
 
-    dAlphaIq = this->getQuaternionFromPseudoRotVector (dAlphaI);
-    dAlphaJq = this->getQuaternionFromPseudoRotVector (dAlphaJ);
 
-    alphaIq = this->quaternionProduct (alphaIq, dAlphaIq);
-    alphaJq = this->quaternionProduct (alphaJq, dAlphaJq);
+// as above with a factor for each transformation
+template <int W> static void
+blockAddMatrix(double (*X)[W], int size, bool add, const double (*B)[W], const double (&fact)[W])
+{
+    if (add) {
+        for (int i = 0; i < size; i++)
+            for (int n = 0; n < W; n++)
+                X[i][n] = (fact[n] == 0.0) ? X[i][n] : X[i][n] + B[i][n]*fact[n];
+    } else {
+        for (int i = 0; i < size; i++)
+            for (int n = 0; n < W; n++)
+                X[i][n] = B[i][n]*fact[n];
+    }
+}
 
-    RI = this->getRotationMatrixFromQuaternion (alphaIq);
-    RJ = this->getRotationMatrixFromQuaternion (alphaJq);
 
-    // compute the mean nodal triad
-    static Matrix dRgamma(3,3); 
-    static Vector gammaq(4);
-    static Vector gammaw(3);
-    
-    dRgamma.Zero();
-    
-    //dRgamma = RJ * RIt;
-    for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-            for (k = 0; k < 3; k++) 
-                dRgamma(i,j) += RJ(i,k) * RI(j,k);
-            
-            gammaq = this->getQuaternionFromRotMatrix(dRgamma);    // pseudo-vector for node J
-            gammaw = this->getTangScaledPseudoVectorFromQuaternion(gammaq);
-            
-            // opserr << "dRgamma: " << dRgamma;
-            // opserr << "gammaq: " << gammaq << endln;
-            // opserr << "gammaw: " << gammaw << endln;
-            
-            dRgamma = this->getRotMatrixFromTangScaledPseudoVector(gammaw/2);
-            
-            Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
-            
-            // compute the base vectors e1, e2, e3
-            static Vector e1(3);
-            static Vector e2(3);
-            static Vector e3(3);
-            
-            // relative translation displacements
-            static Vector dJI(3);    
-            for (int kk = 0; kk < 3; kk++)
-                dJI(kk) = dispJ(kk) - dispI(kk);
-            
-            // element projection
-            static Vector xJI(3);
-            xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
-            
-            if (nodeIInitialDisp != 0) {
-                xJI(0) -= nodeIInitialDisp[0];
-                xJI(1) -= nodeIInitialDisp[1];
-                xJI(2) -= nodeIInitialDisp[2];
+// X = B*C*fact, or X += B*C*fact if add, as Matrix::addMatrixProduct()
+template <int W> static void
+blockAddMatrixProduct(double (*X)[W], int rows, int cols, int inner, bool add,
+                      const double (*B)[W], const double (*C)[W], double fact)
+{
+    if (add && fact == 0.0)
+        return;
+    if (!add)
+        blockZero(X, rows*cols);
+
+    for (int j = 0; j < cols; j++)
+        for (int k = 0; k < inner; k++) {
+            const double *ckj = C[j*inner + k];
+            for (int i = 0; i < rows; i++) {
+                double *xij = X[j*rows + i];
+                const double *bik = B[k*rows + i];
+                for (int n = 0; n < W; n++)
+                    xij[n] += bik[n]*(ckj[n]*fact);
             }
-            
-            if (nodeJInitialDisp != 0) {
-                xJI(0) += nodeJInitialDisp[0];
-                xJI(1) += nodeJInitialDisp[1];
-                xJI(2) += nodeJInitialDisp[2];
+        }
+}
+
+
+// as above with a factor for each transformation
+template <int W> static void
+blockAddMatrixProduct(double (*X)[W], int rows, int cols, int inner, bool add,
+                      const double (*B)[W], const double (*C)[W], const double (&fact)[W])
+{
+    if (!add)
+        blockZero(X, rows*cols);
+
+    for (int j = 0; j < cols; j++)
+        for (int k = 0; k < inner; k++) {
+            const double *ckj = C[j*inner + k];
+            for (int i = 0; i < rows; i++) {
+                double *xij = X[j*rows + i];
+                const double *bik = B[k*rows + i];
+                if (add) {
+                    for (int n = 0; n < W; n++)
+                        xij[n] = (fact[n] == 0.0) ? xij[n] : xij[n] + bik[n]*(ckj[n]*fact[n]);
+                } else {
+                    for (int n = 0; n < W; n++)
+                        xij[n] += bik[n]*(ckj[n]*fact[n]);
+                }
             }
-            
-            static Vector dx(3);
-            // dx = xJI + dJI;  
-            dx = xJI;
-            dx.addVector (1.0, dJI, 1.0);
-            
-            // calculate the deformed element length
-            Ln = dx.Norm();
-            
-            
-            if (Ln == 0.0) 
-            {
-                opserr << "\nCorotCrdTransf3d::update: 0 deformed length\n";
-                return -2;  
+        }
+}
+
+
+// x = M*v*fact, or x += M*v*fact if add, as Vector::addMatrixVector()
+template <int W> static void
+blockAddMatrixVector(double (*x)[W], int rows, int cols, bool add,
+                     const double (*M)[W], const double (*v)[W], double fact)
+{
+    if (!add)
+        blockZero(x, rows);
+
+    for (int i = 0; i < cols; i++)
+        for (int j = 0; j < rows; j++) {
+            const double *mji = M[i*rows + j];
+            for (int n = 0; n < W; n++)
+                x[j][n] += mji[n]*(v[i][n]*fact);
+        }
+}
+
+
+// X = T'*B*T*fact, T being dimB x dimX, as Matrix::addMatrixTripleProduct()
+template <int W> static void
+blockTripleProduct(double (*X)[W], int dimX, const double (*T)[W], const double (*B)[W], int dimB,
+                   double fact)
+{
+    double work[84][W];
+    blockZero(work, dimB*dimX);
+
+    for (int j = 0; j < dimX; j++)
+        for (int k = 0; k < dimB; k++) {
+            const double *tkj = T[j*dimB + k];
+            for (int i = 0; i < dimB; i++) {
+                double *wij = work[j*dimB + i];
+                const double *bik = B[k*dimB + i];
+                for (int n = 0; n < W; n++)
+                    wij[n] += bik[n]*(tkj[n]*fact);
             }
-            
-            // compute the base vector e1
-            e1 = dx/Ln;
-            
-            // 'rotate' the mean rotation matrix Rbar on to e1 to 
-            // obtain e2 and e3 (using the 'mid-point' procedure)
-            static Vector r1(3);
-            static Vector r2(3);
-            static Vector r3(3);
-            
-            for (k = 0; k < 3; k ++)
-            {
-                r1(k) = Rbar(k,0);
-                r2(k) = Rbar(k,1);
-                r3(k) = Rbar(k,2);
+        }
+
+    for (int j = 0; j < dimX; j++)
+        for (int i = 0; i < dimX; i++) {
+            double *xij = X[j*dimX + i];
+            for (int n = 0; n < W; n++)
+                xij[n] = 0.0;
+            for (int k = 0; k < dimB; k++) {
+                const double *tki = T[i*dimB + k];
+                const double *wkj = work[j*dimB + k];
+                for (int n = 0; n < W; n++)
+                    xij[n] += tki[n]*wkj[n];
             }
-            
-            //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
-            // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
-            
-            static Vector tmp(3);
-            tmp = e1;
-            tmp += r1;
-            
-            e2=tmp;
-            e3=tmp;
-            
-            e2 *= (r2^e1)*0.5;
-            e2.addVector(-1.0,  r2, 1.0);
-            
-            // e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
-            
-            e3 *= (r3^e1)*0.5;
-            e3.addVector(-1.0,  r3, 1.0);
-            
-            // compute the basic rotations
-            static Vector rI1(3), rI2(3), rI3(3);
-            static Vector rJ1(3), rJ2(3), rJ3(3);
-            
-            for (k = 0; k < 3; k ++)
-            {
-                e(k,0) = e1(k);
-                e(k,1) = e2(k);
-                e(k,2) = e3(k);
-                
-                rI1(k) = RI(k,0);
-                rI2(k) = RI(k,1);
-                rI3(k) = RI(k,2);
-                
-                rJ1(k) = RJ(k,0);
-                rJ2(k) = RJ(k,1);
-                rJ3(k) = RJ(k,2);
+        }
+}
+
+
+// as above with the same T for all the transformations
+template <int W> static void
+blockTripleProduct(double (*X)[W], int dimX, const Matrix &T, const double (*B)[W], int dimB)
+{
+    double work[84][W];
+    blockZero(work, dimB*dimX);
+
+    for (int j = 0; j < dimX; j++)
+        for (int k = 0; k < dimB; k++) {
+            double tkj = T(k,j);
+            for (int i = 0; i < dimB; i++) {
+                double *wij = work[j*dimB + i];
+                const double *bik = B[k*dimB + i];
+                for (int n = 0; n < W; n++)
+                    wij[n] += bik[n]*tkj;
             }
-            
-            // compute the basic displacements
-            ulpr = ul;
-            ul(0) = asin (((rI2^ e3) - (rI3^ e2))*0.5);
-            ul(1) = asin (((rI1^ e2) - (rI2^ e1))*0.5);
-            ul(2) = asin (((rI1^ e3) - (rI3^ e1))*0.5);
-            ul(3) = asin (((rJ2^ e3) - (rJ3^ e2))*0.5);
-            ul(4) = asin (((rJ1^ e2) - (rJ2^ e1))*0.5);
-            ul(5) = asin (((rJ1^ e3) - (rJ3^ e1))*0.5);		   
-            
-            // ul = Ln - L;
-            // ul(6) = 2 * ((xJI + dJI/2)^ dJI) / (Ln + L);  //mid-point formula   
-            xJI.addVector(1.0, dJI, 0.5);
-            ul(6) = 2 * (xJI ^ dJI) / (Ln + L);  //mid-point formula   
-            
-            // compute the transformation matrix
-            this->compTransfMatrixBasicGlobal();
-            
-            return 0;
+        }
+
+    for (int j = 0; j < dimX; j++)
+        for (int i = 0; i < dimX; i++) {
+            double *xij = X[j*dimX + i];
+            for (int n = 0; n < W; n++)
+                xij[n] = 0.0;
+            for (int k = 0; k < dimB; k++) {
+                double tki = T(k,i);
+                const double *wkj = work[j*dimB + k];
+                for (int n = 0; n < W; n++)
+                    xij[n] += tki*wkj[n];
+            }
+        }
 }
 
 
-void
-CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
+// X(row+i,col+j) += V(i,j)*fact, as Matrix::Assemble(), or
+// X(row+j,col+i) += V(i,j)*fact if transpose, as Matrix::AssembleTranspose()
+template <int W> static void
+blockAssemble(double (*X)[W], int rowsX, const double (*V)[W], int rowsV, int colsV,
+              int row, int col, double fact, bool transpose = false)
+{
+    for (int j = 0; j < colsV; j++)
+        for (int i = 0; i < rowsV; i++) {
+            double *xij = transpose ? X[(col+i)*rowsX + row+j] : X[(col+j)*rowsX + row+i];
+            const double *vij = V[j*rowsV + i];
+            for (int n = 0; n < W; n++)
+                xij[n] += vij[n]*fact;
+        }
+}
+
+
+// as Matrix::Assemble() with a factor for each transformation
+template <int W> static void
+blockAssemble(double (*X)[W], int rowsX, const double (*V)[W], int rowsV, int colsV,
+              int row, int col, const double (&fact)[W])
+{
+    for (int j = 0; j < colsV; j++)
+        for (int i = 0; i < rowsV; i++) {
+            double *xij = X[(col+j)*rowsX + row+i];
+            const double *vij = V[j*rowsV + i];
+            for (int n = 0; n < W; n++)
+                xij[n] += vij[n]*fact[n];
+        }
+}
+
+
+// the normalised quaternion q of the rotation matrix R
+static void
+quaternionFromRotMatrix(const double *R, double *q)
 {
-    // extract columns of rotation matrices
     int i, j, k;
-    
-    //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
-    
-    for (k = 0; k < 3; k ++)
-    {
-        r1(k) = Rbar(k,0);
-        r2(k) = Rbar(k,1);
-        r3(k) = Rbar(k,2);
-        
-        e1(k) = e(k,0);
-        e2(k) = e(k,1);
-        e3(k) = e(k,2);
-        
-        rI1(k) = RI(k,0);
-        rI2(k) = RI(k,1);
-        rI3(k) = RI(k,2);
-        
-        rJ1(k) = RJ(k,0);
-        rJ2(k) = RJ(k,1);
-        rJ3(k) = RJ(k,2);
-    }
-    
-    // compute the transformation matrix from the basic to the
-    // global system
-    static Matrix I(3,3);
-    
-    //   A = (1/Ln)*(I - e1*e1');
-    for (i = 0; i < 3; i++)
-        I(i,i) = 1;
-    
+    double trR;              // trace of R
+    double a;
+
+    trR = R[0] + R[4] + R[8];
+
+    // a = max ([trR R(0,0) R(1,1) R(2,2)]);
+    a = trR;
     for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-            A(i,j) = (I(i,j) - e1(i)*e1(j))/Ln;
-        
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
-        
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
-        
-        //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-        //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        //  
-        //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-        //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-        //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        
-        T.Zero();
-        
-        Sr1 = this->getSkewSymMatrix(rI1);
-        Sr2 = this->getSkewSymMatrix(rI2);
-        Sr3 = this->getSkewSymMatrix(rI3);
-        
-        //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-        
-        Se.addMatrixVector(0.0, Sr3, e2, -1.0);     // (-S(rI3)*e2 + S(rI2)*e3)
-        Se.addMatrixVector(1.0, Sr2, e3,  1.0);    
-        
-        for (i = 0; i < 3; i++)
-            T(0,i+3) =  Se(i);
-        
-        //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        
-        At.addMatrixVector(0.0, A, rI2, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rI2)*e1 + S(rI1)*e2)'
-        Se.addMatrixVector(1.0, Sr1, e2,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(1,i  ) =  At(i);  
-            T(1,i+3) =  Se(i);
-            T(1,i+6) = -At(i);
+        if (R[i*4] > a)
+            a = R[i*4];
+
+    if (a == trR) {
+        q[3] = sqrt(1+a)*0.5;
+
+        for (i = 0; i < 3; i++) {
+            j = (i+1)%3;
+            k = (i+2)%3;
+            q[i] = (R[j*3+k] - R[k*3+j])/(4*q[3]);
         }
-        
-        //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        
-        At.addMatrixVector(0.0, A, rI3, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rI3)*e1 + S(rI1)*e3)
-        Se.addMatrixVector(1.0, Sr1, e3,  1.0);
-        
+    } else {
         for (i = 0; i < 3; i++)
-        {
-            T(2,i  ) =  At(i);  
-            T(2,i+3) =  Se(i);
-            T(2,i+6) = -At(i);
+            if (a == R[i*4]) {
+                j = (i+1)%3;
+                k = (i+2)%3;
+
+                q[i] = sqrt(a*0.5 + (1 - trR)/4.0);
+                q[3] = (R[j*3+k] - R[k*3+j])/(4*q[i]);
+                q[j] = (R[i*3+j] + R[j*3+i])/(4*q[i]);
+                q[k] = (R[i*3+k] + R[k*3+i])/(4*q[i]);
+            }
+    }
+}
+
+
+// q = q*dq, dq being the quaternion of the pseudo rotation vector theta
+template <int W> static void
+blockQuaternionProduct(double (*q)[W], const double (*theta)[W])
+{
+    for (int n = 0; n < W; n++) {
+        // quaternion of theta
+        double t = sqrt(0.0 + theta[0][n]*theta[0][n] + theta[1][n]*theta[1][n] + theta[2][n]*theta[2][n]);
+        double factor = (t == 0) ? 0.0 : sin(t*0.5)/t;
+        double dq0 = (t == 0) ? 0.0 : theta[0][n]*factor;
+        double dq1 = (t == 0) ? 0.0 : theta[1][n]*factor;
+        double dq2 = (t == 0) ? 0.0 : theta[2][n]*factor;
+        double dq3 = cos(t*0.5);
+
+        double q0 = q[0][n];
+        double q1 = q[1][n];
+        double q2 = q[2][n];
+        double q3 = q[3][n];
+
+        // dot and cross products of the vector parts
+        double qTdq = 0.0 + q0*dq0 + q1*dq1 + q2*dq2;
+        double qxdq0 = q1*dq2 - q2*dq1;
+        double qxdq1 = q2*dq0 - q0*dq2;
+        double qxdq2 = q0*dq1 - q1*dq0;
+
+        q[0][n] = q3*dq0 + dq3*q0 - qxdq0;
+        q[1][n] = q3*dq1 + dq3*q1 - qxdq1;
+        q[2][n] = q3*dq2 + dq3*q2 - qxdq2;
+        q[3][n] = q3*dq3 - qTdq;
+    }
+}
+
+
+// R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q), q0 being q(3)
+template <int W> static void
+blockRotationMatrix(double (*R)[W], const double (*q)[W])
+{
+    for (int n = 0; n < W; n++) {
+        double q0 = q[0][n];
+        double q1 = q[1][n];
+        double q2 = q[2][n];
+        double q3 = q[3][n];
+        double factor = q3*q3 - (q0*q0 + q1*q1 + q2*q2);
+        double s = 2.0*q3;
+
+        R[0][n] = (factor + q0*q0*2.0) + 0.0*s;
+        R[1][n] = (0.0 + q1*q0*2.0) + q2*s;
+        R[2][n] = (0.0 + q2*q0*2.0) - q1*s;
+        R[3][n] = (0.0 + q0*q1*2.0) - q2*s;
+        R[4][n] = (factor + q1*q1*2.0) + 0.0*s;
+        R[5][n] = (0.0 + q2*q1*2.0) + q0*s;
+        R[6][n] = (0.0 + q0*q2*2.0) + q1*s;
+        R[7][n] = (0.0 + q1*q2*2.0) - q0*s;
+        R[8][n] = (factor + q2*q2*2.0) + 0.0*s;
+    }
+}
+
+
+// L = [L1; L2; -L1; L2] of the vector ri, with
+//   L1 = ri'*e1 * A/2 + A*ri*(e1 + r1)'/2;
+//   L2 = Sri/2 - ri'*e1*S(r1)/4 - Sri*e1*(e1 + r1)'/4;
+template <int W> static void
+blockLMatrix(double (*L)[W], const double (*ri)[W], const CorotCrdTransf3dBlock<W> &theBlock)
+{
+    const double (*e1)[W] = &theBlock.e[0];
+    const double (*r1)[W] = &theBlock.Rbar[0];
+    const double (*A)[W] = theBlock.A;
+
+    double rie1[W], fact[W];
+    double rie1r1[9][W], e1e1r1[9][W];
+    double L1[9][W], L2[9][W], Sri[9][W], Sr1[9][W];
+
+    for (int n = 0; n < W; n++)
+        rie1[n] = blockDot(ri, e1, n);
+
+    for (int k = 0; k < 3; k++)
+        for (int j = 0; j < 3; j++)
+            for (int n = 0; n < W; n++) {
+                double e1r1k = e1[k][n] + r1[k][n];
+                rie1r1[k*3+j][n] = ri[j][n]*e1r1k;
+                e1e1r1[k*3+j][n] = e1[j][n]*e1r1k;
+            }
+
+    for (int n = 0; n < W; n++)
+        fact[n] = rie1[n]*0.5;
+    blockAddMatrix(L1, 9, false, A, fact);
+    blockAddMatrixProduct(L1, 3, 3, 3, true, A, rie1r1, 0.5);
+
+    blockSkew(Sri, ri);
+    blockSkew(Sr1, r1);
+
+    blockAddMatrix(L2, 9, false, Sri, 0.5);
+    for (int n = 0; n < W; n++)
+        fact[n] = -rie1[n]/4.0;
+    blockAddMatrix(L2, 9, true, Sr1, fact);
+    blockAddMatrixProduct(L2, 3, 3, 3, true, Sri, e1e1r1, -0.25);
+
+    blockZero(L, 36);
+    blockAssemble(L, 12, L1, 3, 3, 0, 0,  1.0);
+    blockAssemble(L, 12, L2, 3, 3, 3, 0,  1.0);
+    blockAssemble(L, 12, L1, 3, 3, 6, 0, -1.0);
+    blockAssemble(L, 12, L2, 3, 3, 9, 0,  1.0);
+}
+
+
+// kg += m*Ksigma2(ri, z), with
+//  Ksigma2 = [ K11   K12 -K11   K12;
+//              K12t  K22 -K12t  K22;
+//             -K11  -K12  K11  -K12;
+//              K12t  K22 -K12t  K22];
+template <int W> static void
+blockAddKs2Matrix(double (*kg)[W], const double (*ri)[W], const double (*z)[W], const double (&m)[W],
+                  const CorotCrdTransf3dBlock<W> &theBlock)
+{
+    const double (*e1)[W] = &theBlock.e[0];
+    const double (*r1)[W] = &theBlock.Rbar[0];
+    const double (*A)[W] = theBlock.A;
+    const double (&Ln)[W] = theBlock.Ln;
+
+    double rite1[W], zte1[W], ztr1[W], fact[W];
+    double zrit[9][W], rizt[9][W], ze1t[9][W], e1zt[9][W], rie1t[9][W];
+    double U[9][W], ks[9][W], m1[9][W], ks2[144][W];
+    double Sri[9][W], Sr1[9][W], Sz[9][W], Se1[9][W];
+
+    for (int n = 0; n < W; n++) {
+        rite1[n] = blockDot(ri, e1, n);
+        zte1[n] = blockDot(z, e1, n);
+        ztr1[n] = blockDot(z, r1, n);
+    }
+
+    for (int j = 0; j < 3; j++)
+        for (int i = 0; i < 3; i++)
+            for (int n = 0; n < W; n++) {
+                zrit[j*3+i][n] = z[i][n]*ri[j][n];
+                rizt[j*3+i][n] = ri[i][n]*z[j][n];
+                ze1t[j*3+i][n] = z[i][n]*e1[j][n];
+                e1zt[j*3+i][n] = e1[i][n]*z[j][n];
+                rie1t[j*3+i][n] = ri[i][n]*e1[j][n];
+            }
+
+    // U = (-1/2)*A*z*ri'*A + ri'*e1*A*z*e1'/(2*Ln)+...
+    //      z'*(e1+r1)*A*ri*e1'/(2*Ln);
+    blockTripleProduct(U, 3, A, zrit, 3, -0.5);
+    for (int n = 0; n < W; n++)
+        fact[n] = rite1[n]/(2*Ln[n]);
+    blockAddMatrixProduct(U, 3, 3, 3, true, A, ze1t, fact);
+    for (int n = 0; n < W; n++)
+        fact[n] = (zte1[n] + ztr1[n])/(2*Ln[n]);
+    blockAddMatrixProduct(U, 3, 3, 3, true, A, rie1t, fact);
+
+    //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
+    blockAddMatrix(ks, 9, false, U, 1.0);
+    for (int j = 0; j < 3; j++)
+        for (int i = 0; i < 3; i++)
+            for (int n = 0; n < W; n++)
+                ks[j*3+i][n] += U[i*3+j][n];
+    for (int n = 0; n < W; n++)
+        fact[n] = rite1[n]*(2*zte1[n] + ztr1[n])/(2*Ln[n]);
+    blockAddMatrix(ks, 9, true, A, fact);
+
+    blockZero(ks2, 144);
+    blockAssemble(ks2, 12, ks, 3, 3, 0, 0,  1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 0, 6, -1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 6, 0, -1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 6, 6,  1.0);
+
+    blockSkew(Sri, ri);
+    blockSkew(Sr1, r1);
+    blockSkew(Sz, z);
+    blockSkew(Se1, e1);
+
+    //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
+    blockAddMatrixProduct(m1, 3, 3, 3, false, A, ze1t, -1.0);
+    blockAddMatrixProduct(ks, 3, 3, 3, false, m1, Sri, 0.25);
+    blockAddMatrixProduct(m1, 3, 3, 3, false, A, rizt, -1.0);
+    blockAddMatrixProduct(ks, 3, 3, 3, true, m1, Sr1, 0.25);
+    for (int n = 0; n < W; n++)
+        fact[n] = -0.25*(zte1[n] + ztr1[n]);
+    blockAddMatrixProduct(ks, 3, 3, 3, true, A, Sri, fact);
+
+    blockAssemble(ks2, 12, ks, 3, 3, 0, 3,  1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 0, 9,  1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 6, 3, -1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 6, 9, -1.0);
+
+    blockAssemble(ks2, 12, ks, 3, 3, 3, 0,  1.0, true);
+    blockAssemble(ks2, 12, ks, 3, 3, 3, 6, -1.0, true);
+    blockAssemble(ks2, 12, ks, 3, 3, 9, 0,  1.0, true);
+    blockAssemble(ks2, 12, ks, 3, 3, 9, 6, -1.0, true);
+
+    //K22 = (1/8)*((-ri'*e1)*Sz*Sr1 + Sr1*z*e1'*Sri + ...
+    //      Sri*e1*z'*Sr1 - (e1+r1)'*z*S(e1)*Sri + 2*Sz*Sri);
+    for (int n = 0; n < W; n++)
+        fact[n] = -0.125*(rite1[n]);
+    blockAddMatrixProduct(ks, 3, 3, 3, false, Sz, Sr1, fact);
+    blockAddMatrixProduct(m1, 3, 3, 3, false, Sr1, ze1t, 1.0);
+    blockAddMatrixProduct(ks, 3, 3, 3, true, m1, Sri, 0.125);
+    blockAddMatrixProduct(m1, 3, 3, 3, false, Sri, e1zt, 1.0);
+    blockAddMatrixProduct(ks, 3, 3, 3, true, m1, Sr1, 0.125);
+    for (int n = 0; n < W; n++)
+        fact[n] = -0.125*(zte1[n] + ztr1[n]);
+    blockAddMatrixProduct(ks, 3, 3, 3, true, Se1, Sri, fact);
+    blockAddMatrixProduct(ks, 3, 3, 3, true, Sz, Sri, 0.25);
+
+    blockAssemble(ks2, 12, ks, 3, 3, 3, 3, 1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 3, 9, 1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 9, 3, 1.0);
+    blockAssemble(ks2, 12, ks, 3, 3, 9, 9, 1.0);
+
+    blockAddMatrix(kg, 144, true, ks2, m);
+}
+
+
+// update the transformations of a block; the node states are gathered into
+// the block, and the new triads, base vectors, local displacements and the
+// transformation matrix of each are left there
+template <int W> int
+CorotCrdTransf3d::updateBlock(CorotCrdTransf3d **theTransfs, int nb,
+                              CorotCrdTransf3dBlock<W> &theBlock)
+{
+    int i, j, k, n;
+
+    double dispI[6][W], dispJ[6][W];
+    double dAlphaI[3][W], dAlphaJ[3][W];
+    double alphaIq[4][W], alphaJq[4][W];
+    double xJI[3][W], dJI[3][W];
+    double L[W];
+
+    for (n = 0; n < W; n++) {
+        CorotCrdTransf3d *theTransf = theTransfs[(n < nb) ? n : nb-1];
+        const double *nodeIInitialDisp = theTransf->nodeIInitialDisp;
+        const double *nodeJInitialDisp = theTransf->nodeJInitialDisp;
+
+        // determine global displacement increments from last iteration
+        const Vector &trialDispI = theTransf->nodeIPtr->getTrialDisp();
+        const Vector &trialDispJ = theTransf->nodeJPtr->getTrialDisp();
+
+        for (j = 0; j < 6; j++) {
+            dispI[j][n] = trialDispI(j);
+            dispJ[j][n] = trialDispJ(j);
         }
-        
-        Sr1 = this->getSkewSymMatrix(rJ1);
-        Sr2 = this->getSkewSymMatrix(rJ2);
-        Sr3 = this->getSkewSymMatrix(rJ3);
-        
-        //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-        
-        Se.addMatrixVector(0.0, Sr3, e2, -1.0);    // -S(rJ3)*e2 + S(rJ2)*e3
-        Se.addMatrixVector(1.0, Sr2, e3,  1.0);    
-        
-        for (i = 0; i < 3; i++)
-            T(3,i+9) =  Se(i);
-        
-        //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-        
-        At.addMatrixVector(0.0, A, rJ2, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rJ2)*e1 + S(rJ1)*e2)
-        Se.addMatrixVector(1.0, Sr1, e2,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(4,i  ) =  At(i);  
-            T(4,i+6) = -At(i);
-            T(4,i+9) =  Se(i);
+
+        if (nodeIInitialDisp != 0) {
+            for (j = 0; j < 6; j++)
+                dispI[j][n] -= nodeIInitialDisp[j];
         }
-        
-        //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        
-        At.addMatrixVector(0.0, A, rJ3, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rJ3)*e1 + S(rJ1)*e3)
-        Se.addMatrixVector(1.0, Sr1, e3,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(5,i  ) =  At(i);  
-            T(5,i+6) = -At(i);
-            T(5,i+9) =  Se(i);
+
+        if (nodeJInitialDisp != 0) {
+            for (j = 0; j < 6; j++)
+                dispJ[j][n] -= nodeJInitialDisp[j];
         }
-        
-        // setup tranformation matrix
-        static Vector Lr(12);
-        
-        // T(:,1) += Lr3*rI2 - Lr2*rI3;
-        // T(:,2) +=           Lr2*rI1;
-        // T(:,3) += Lr3*rI1          ;
-        
-        // T(:,4) += Lr3*rJ2 - Lr2*rJ3;
-        // T(:,5) += Lr2*rJ1          ;      // ?????? check sign
-        // T(:,6) += Lr3*rJ1          ;      // ?????? check sign
-        
-        Lr.addMatrixVector(0.0, Lr3, rI2,  1.0);  //  T(:,1) += Lr3*rI2 - Lr2*rI3 
-        Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
-        
-        for (i = 0; i < 12; i++)
-            T(0,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr2, rI1,  1.0);  //  T(:,2) +=           Lr2*rI1
-        
-        for (i = 0; i < 12; i++)
-            T(1,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr3, rI1,  1.0);  //  T(:,3) += Lr3*rI1 
-        
-        for (i = 0; i < 12; i++)
-            T(2,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr3, rJ2,  1.0);  //  T(:,4) += Lr3*rJ2 - Lr2*rJ3;
-        Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
-        
-        for (i = 0; i < 12; i++)
-            T(3,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr2, rJ1,  1.0);  //  T(:,5) += Lr2*rJ1   
-        
-        for (i = 0; i < 12; i++)
-            T(4,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr3, rJ1,  1.0);  //   T(:,6) += Lr3*rJ1
-        
-        for (i = 0; i < 12; i++)
-            T(5,i) += Lr(i);
-        
-        double c;
-        for (j = 0; j < 6; j++)
-        {
-            c = 2 * cos(ul(j));
-            
-            for (i = 0; i < 12; i++) 
-                T(j,i) /= c;
+
+        // get the iterative spins dAlphaI and dAlphaJ
+        // (rotational displacement increments at both nodes)
+        for (k = 0; k < 3; k++) {
+            dAlphaI[k][n] = dispI[k+3][n] - theTransf->alphaI(k);
+            dAlphaJ[k][n] = dispJ[k+3][n] - theTransf->alphaJ(k);
+        }
+
+        for (k = 0; k < 4; k++) {
+            alphaIq[k][n] = theTransf->alphaIq(k);
+            alphaJq[k][n] = theTransf->alphaJq(k);
         }
-        
-        // T(:,7) = [-e1' O' e1' O']';
+
+        // element projection
+        const Vector &crdsI = theTransf->nodeIPtr->getCrds();
+        const Vector &crdsJ = theTransf->nodeJPtr->getCrds();
+
+        for (k = 0; k < 3; k++)
+            xJI[k][n] = crdsJ(k) - crdsI(k);
+
+        if (nodeIInitialDisp != 0) {
+            for (k = 0; k < 3; k++)
+                xJI[k][n] -= nodeIInitialDisp[k];
+        }
+
+        if (nodeJInitialDisp != 0) {
+            for (k = 0; k < 3; k++)
+                xJI[k][n] += nodeJInitialDisp[k];
+        }
+
+        L[n] = theTransf->L;
+    }
+
+    // update the nodal triads RI and RJ using quaternions
+    blockQuaternionProduct(alphaIq, dAlphaI);
+    blockQuaternionProduct(alphaJq, dAlphaJ);
+
+    blockRotationMatrix(theBlock.RI, alphaIq);
+    blockRotationMatrix(theBlock.RJ, alphaJq);
+
+    const double (*RI)[W] = theBlock.RI;
+    const double (*RJ)[W] = theBlock.RJ;
+
+    // compute the mean nodal triad
+    double dRgamma[9][W], S[9][W], S2[9][W], w[3][W], fact[W];
+
+    //dRgamma = RJ * RIt;
+    for (j = 0; j < 3; j++)
         for (i = 0; i < 3; i++)
-        {
-            T(6,i  ) = -e1(i);
-            T(6,i+6) =  e1(i);
-        }      
-}
+            for (n = 0; n < W; n++)
+                dRgamma[j*3+i][n] = 0.0 + RJ[i][n]*RI[j][n] + RJ[3+i][n]*RI[3+j][n] + RJ[6+i][n]*RI[6+j][n];
+
+    // half the tangent scaled pseudo-vector of its quaternion
+    for (n = 0; n < W; n++) {
+        double R[9], gammaq[4];
+        for (i = 0; i < 9; i++)
+            R[i] = dRgamma[i][n];
+        quaternionFromRotMatrix(R, gammaq);
+        for (i = 0; i < 3; i++)
+            w[i][n] = 2.0*gammaq[i]/gammaq[3]/2;
+    }
 
+    // and its rotation matrix, dRgamma = I + (S + S*S/2)/(1 + w' * w / 4);
+    blockSkew(S, w);
+    blockAddMatrix(S2, 9, false, S, 1.0);
+    blockAddMatrixProduct(S2, 3, 3, 3, true, S, S, 0.5);
 
-void
-CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
-{
-    // extract columns of rotation matrices
-    int i, j, k;
-    
-    //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
-    
-    for (k = 0; k < 3; k ++)
-    {
-        r1(k) = Rbar(k,0);
-        r2(k) = Rbar(k,1);
-        r3(k) = Rbar(k,2);
-        
-        e1(k) = e(k,0);
-        e2(k) = e(k,1);
-        e3(k) = e(k,2);
-        
-        rI1(k) = RI(k,0);
-        rI2(k) = RI(k,1);
-        rI3(k) = RI(k,2);
-        
-        rJ1(k) = RJ(k,0);
-        rJ2(k) = RJ(k,1);
-        rJ3(k) = RJ(k,2);
+    for (n = 0; n < W; n++)
+        fact[n] = 1.0/(1 + blockDot(w, w, n)/4.0);
+
+    for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
+            for (n = 0; n < W; n++)
+                dRgamma[j*3+i][n] = ((i == j) ? 1.0 : 0.0) + S2[j*3+i][n]*fact[n];
+
+    blockAddMatrixProduct(theBlock.Rbar, 3, 3, 3, false, dRgamma, RI, 1.0);
+
+    // compute the base vectors e1, e2, e3
+    double (*e)[W] = theBlock.e;
+    double (*ul)[W] = theBlock.ul;
+    double (&Ln)[W] = theBlock.Ln;
+
+    const double (*r1)[W] = &theBlock.Rbar[0];
+    const double (*r2)[W] = &theBlock.Rbar[3];
+    const double (*r3)[W] = &theBlock.Rbar[6];
+    const double (*e1)[W] = &e[0];
+    const double (*e2)[W] = &e[3];
+    const double (*e3)[W] = &e[6];
+    const double (*rI1)[W] = &RI[0];
+    const double (*rI2)[W] = &RI[3];
+    const double (*rI3)[W] = &RI[6];
+    const double (*rJ1)[W] = &RJ[0];
+    const double (*rJ2)[W] = &RJ[3];
+    const double (*rJ3)[W] = &RJ[6];
+
+    for (n = 0; n < W; n++) {
+        // relative translation displacements
+        for (k = 0; k < 3; k++)
+            dJI[k][n] = dispJ[k][n] - dispI[k][n];
+
+        // dx = xJI + dJI;
+        double dx0 = xJI[0][n] + dJI[0][n];
+        double dx1 = xJI[1][n] + dJI[1][n];
+        double dx2 = xJI[2][n] + dJI[2][n];
+
+        // calculate the deformed element length
+        Ln[n] = sqrt(0.0 + dx0*dx0 + dx1*dx1 + dx2*dx2);
+
+        // compute the base vector e1
+        e[0][n] = dx0/Ln[n];
+        e[1][n] = dx1/Ln[n];
+        e[2][n] = dx2/Ln[n];
     }
-    
+
+    // 'rotate' the mean rotation matrix Rbar on to e1 to
+    // obtain e2 and e3 (using the 'mid-point' procedure)
+    //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
+    //    e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
+    for (n = 0; n < W; n++) {
+        double r2e1 = blockDot(r2, e1, n)*0.5;
+        double r3e1 = blockDot(r3, e1, n)*0.5;
+        for (k = 0; k < 3; k++) {
+            double tmp = e[k][n] + r1[k][n];
+            e[3+k][n] = tmp*r2e1*-1.0 + r2[k][n];
+            e[6+k][n] = tmp*r3e1*-1.0 + r3[k][n];
+        }
+    }
+
+    // compute the basic displacements
+    for (n = 0; n < W; n++) {
+        ul[0][n] = asin((blockDot(rI2, e3, n) - blockDot(rI3, e2, n))*0.5);
+        ul[1][n] = asin((blockDot(rI1, e2, n) - blockDot(rI2, e1, n))*0.5);
+        ul[2][n] = asin((blockDot(rI1, e3, n) - blockDot(rI3, e1, n))*0.5);
+        ul[3][n] = asin((blockDot(rJ2, e3, n) - blockDot(rJ3, e2, n))*0.5);
+        ul[4][n] = asin((blockDot(rJ1, e2, n) - blockDot(rJ2, e1, n))*0.5);
+        ul[5][n] = asin((blockDot(rJ1, e3, n) - blockDot(rJ3, e1, n))*0.5);
+
+        // ul(6) = 2 * ((xJI + dJI/2)^ dJI) / (Ln + L);  //mid-point formula
+        for (k = 0; k < 3; k++)
+            xJI[k][n] += dJI[k][n]*0.5;
+        ul[6][n] = 2*blockDot(xJI, dJI, n)/(Ln[n] + L[n]);
+    }
+
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
-    
+    double (*A)[W] = theBlock.A;
+    double (*T)[W] = theBlock.T;
+
     //   A = (1/Ln)*(I - e1*e1');
+    for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
+            for (n = 0; n < W; n++)
+                A[j*3+i][n] = (((i == j) ? 1.0 : 0.0) - e1[i][n]*e1[j][n])/Ln[n];
+
+    blockLMatrix(theBlock.Lr2, r2, theBlock);
+    blockLMatrix(theBlock.Lr3, r3, theBlock);
+
+    //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
+    //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
+    //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
+    //
+    //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
+    //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
+    //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
+
+    double Sr1[9][W], Sr2[9][W], Sr3[9][W];
+    double Se[3][W], At[3][W], Lr[12][W];
+
+    blockZero(T, 84);
+
+    blockSkew(Sr1, rI1);
+    blockSkew(Sr2, rI2);
+    blockSkew(Sr3, rI3);
+
+    blockAddMatrixVector(Se, 3, 3, false, Sr3, e2, -1.0);
+    blockAddMatrixVector(Se, 3, 3, true, Sr2, e3, 1.0);
     for (i = 0; i < 3; i++)
-        I(i,i) = 1;
-    
+        for (n = 0; n < W; n++)
+            T[(i+3)*7][n] = Se[i][n];
+
+    blockAddMatrixVector(At, 3, 3, false, A, rI2, 1.0);
+    blockAddMatrixVector(Se, 3, 3, false, Sr2, e1, -1.0);
+    blockAddMatrixVector(Se, 3, 3, true, Sr1, e2, 1.0);
     for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-            A(i,j) = (I(i,j) - e1(i)*e1(j))/Ln;
-        
-        
-            /*
-            opserr << "r1: " << r1;
-            opserr << "r2: " << r2;
-            opserr << "r3: " << r3;
-            opserr << "e1: " << e1;
-            opserr << "e2: " << e2;
-            opserr << "e3: " << e3;
-            opserr << "rI1: " << rI1;
-            opserr << "rI2: " << rI2;
-            opserr << "rI3: " << rI3;
-            opserr << "rJ1: " << rJ1;
-            opserr << "rJ2: " << rJ2;
-            opserr << "rJ3: " << rJ3;
-            opserr << "A: " << A;
-        */
-        
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
-        
-        // opserr << "Lr2: " << Lr2;
-        // opserr << "Lr3: " << Lr3;
-        
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
-        
-        
-        // O = zeros(3,1);
-        // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-        // hI2 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        // hI3 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        // hJ1 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-        // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-        
-        static Vector hI1(12);
-        static Vector hI2(12);
-        static Vector hI3(12);
-        static Vector hJ1(12);
-        static Vector hJ2(12);
-        static Vector hJ3(12);
-        
-        Sr1 = this->getSkewSymMatrix(rI1);
-        Sr2 = this->getSkewSymMatrix(rI2);
-        Sr3 = this->getSkewSymMatrix(rI3);
-        
-        // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-        Se.addMatrixVector(0.0, Sr3, e2, -1.0);     // (-S(rI3)*e2 + S(rI2)*e3)
-        Se.addMatrixVector(1.0, Sr2, e3,  1.0);    
-        for (i=0; i<3; i++)
-            hI1(i+3) = Se(i);
-        
-        // hI2 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        At.addMatrixVector(0.0, A, rI3, 1.0);   
-        Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rI3)*e1 + S(rI1)*e3)
-        Se.addMatrixVector(1.0, Sr1, e3,  1.0);
-        
-        for (i = 0; i < 3; i++) {
-            hI2(i  ) =  At(i);  
-            hI2(i+3) =  Se(i);
-            hI2(i+6) = -At(i);
+        for (n = 0; n < W; n++) {
+            T[i*7+1][n] =  At[i][n];
+            T[(i+3)*7+1][n] =  Se[i][n];
+            T[(i+6)*7+1][n] = -At[i][n];
         }
-        
-        // hI3 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        At.addMatrixVector(0.0, A, rI2, 1.0);   
-        Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rI2)*e1 + S(rI1)*e2)'
-        Se.addMatrixVector(1.0, Sr1, e2,  1.0);
-        
-        for (i = 0; i < 3; i++) {
-            hI3(i  ) =  At(i);  
-            hI3(i+3) =  Se(i);
-            hI3(i+6) = -At(i);
+
+    blockAddMatrixVector(At, 3, 3, false, A, rI3, 1.0);
+    blockAddMatrixVector(Se, 3, 3, false, Sr3, e1, -1.0);
+    blockAddMatrixVector(Se, 3, 3, true, Sr1, e3, 1.0);
+    for (i = 0; i < 3; i++)
+        for (n = 0; n < W; n++) {
+            T[i*7+2][n] =  At[i][n];
+            T[(i+3)*7+2][n] =  Se[i][n];
+            T[(i+6)*7+2][n] = -At[i][n];
         }
-        
-        Sr1 = this->getSkewSymMatrix(rJ1);
-        Sr2 = this->getSkewSymMatrix(rJ2);
-        Sr3 = this->getSkewSymMatrix(rJ3);
-        
-        // hJ1 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';  
-        Se.addMatrixVector(0.0, Sr3, e2, -1.0);    // -S(rJ3)*e2 + S(rJ2)*e3
-        Se.addMatrixVector(1.0, Sr2, e3,  1.0);    
-        for (i = 0; i < 3; i++)
-            hJ1(i+9) =  Se(i);
-        
-        
-        // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        At.addMatrixVector(0.0, A, rJ3, 1.0);   
-        Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rJ3)*e1 + S(rJ1)*e3)
-        Se.addMatrixVector(1.0, Sr1, e3,  1.0);
-        
-        for (i = 0; i < 3; i++) {
-            hJ2(i  ) =  At(i);  
-            hJ2(i+6) = -At(i);
-            hJ2(i+9) =  Se(i);
+
+    blockSkew(Sr1, rJ1);
+    blockSkew(Sr2, rJ2);
+    blockSkew(Sr3, rJ3);
+
+    blockAddMatrixVector(Se, 3, 3, false, Sr3, e2, -1.0);
+    blockAddMatrixVector(Se, 3, 3, true, Sr2, e3, 1.0);
+    for (i = 0; i < 3; i++)
+        for (n = 0; n < W; n++)
+            T[(i+9)*7+3][n] = Se[i][n];
+
+    blockAddMatrixVector(At, 3, 3, false, A, rJ2, 1.0);
+    blockAddMatrixVector(Se, 3, 3, false, Sr2, e1, -1.0);
+    blockAddMatrixVector(Se, 3, 3, true, Sr1, e2, 1.0);
+    for (i = 0; i < 3; i++)
+        for (n = 0; n < W; n++) {
+            T[i*7+4][n] =  At[i][n];
+            T[(i+6)*7+4][n] = -At[i][n];
+            T[(i+9)*7+4][n] =  Se[i][n];
         }
-        
-        // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';   
-        At.addMatrixVector(0.0, A, rJ2, 1.0);   
-        Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rJ2)*e1 + S(rJ1)*e2)
-        Se.addMatrixVector(1.0, Sr1, e2,  1.0);
-        
-        for (i = 0; i < 3; i++) {
-            hJ3(i  ) =  At(i);  
-            hJ3(i+6) = -At(i);
-            hJ3(i+9) =  Se(i);
+
+    blockAddMatrixVector(At, 3, 3, false, A, rJ3, 1.0);
+    blockAddMatrixVector(Se, 3, 3, false, Sr3, e1, -1.0);
+    blockAddMatrixVector(Se, 3, 3, true, Sr1, e3, 1.0);
+    for (i = 0; i < 3; i++)
+        for (n = 0; n < W; n++) {
+            T[i*7+5][n] =  At[i][n];
+            T[(i+6)*7+5][n] = -At[i][n];
+            T[(i+9)*7+5][n] =  Se[i][n];
         }
-        
-        /*
-        opserr << "hI1: " << hI1;
-        opserr << "hI2: " << hI2;
-        opserr << "hI3: " << hI3;
-        opserr << "hj1: " << hJ1;
-        opserr << "hj2: " << hJ2;
-        opserr << "hj3: " << hJ3;
-        */
-        
-        // f1 =  [-e1' O' e1' O'];
-        // f2  = ( Lr2*rI1 + hI3)'./(2*(cos(thetalI(3))));
-        // f3  = ( Lr2*rJ1 + hJ3)'./(2*(cos(thetalJ(3))));
-        // f4  = (-Lr3*rI1 - hI2)'./(2*(cos(thetalI(2))));
-        // f5  = (-Lr3*rJ1 - hJ2)'./(2*(cos(thetalJ(2))));
-        // f6I = ( Lr3*rI2 - Lr2*rI3 + hI1)'./(2*(cos(thetalI(1))));
-        // f6J = ( Lr3*rJ2 - Lr2*rJ3 + hJ1)'./(2*(cos(thetalJ(1))));
-        
-        // F = [f1;
-        //     f2;
-        //     f3;
-        //     f4;
-        //     f5;
-        //     f6J-f6I];      
-        
-        // T = F'
-        T.Zero();
-        static Vector Lr(12);
-        
-        // f1 =  [-e1' O' e1' O'];
-        for (i=0; i<3; i++) {
-            T(i  ,0) = -e1(i);
-            T(i+3,0) = e1(i);
+
+    // T(:,1) += Lr3*rI2 - Lr2*rI3;
+    // T(:,2) +=           Lr2*rI1;
+    // T(:,3) += Lr3*rI1          ;
+    // T(:,4) += Lr3*rJ2 - Lr2*rJ3;
+    // T(:,5) += Lr2*rJ1          ;
+    // T(:,6) += Lr3*rJ1          ;
+    const double (*Lr2)[W] = theBlock.Lr2;
+    const double (*Lr3)[W] = theBlock.Lr3;
+
+    for (k = 0; k < 6; k++) {
+        switch (k) {
+        case 0:
+            blockAddMatrixVector(Lr, 12, 3, false, Lr3, rI2, 1.0);
+            blockAddMatrixVector(Lr, 12, 3, true, Lr2, rI3, -1.0);
+            break;
+        case 1:
+            blockAddMatrixVector(Lr, 12, 3, false, Lr2, rI1, 1.0);
+            break;
+        case 2:
+            blockAddMatrixVector(Lr, 12, 3, false, Lr3, rI1, 1.0);
+            break;
+        case 3:
+            blockAddMatrixVector(Lr, 12, 3, false, Lr3, rJ2, 1.0);
+            blockAddMatrixVector(Lr, 12, 3, true, Lr2, rJ3, -1.0);
+            break;
+        case 4:
+            blockAddMatrixVector(Lr, 12, 3, false, Lr2, rJ1, 1.0);
+            break;
+        case 5:
+            blockAddMatrixVector(Lr, 12, 3, false, Lr3, rJ1, 1.0);
+            break;
         }
-        
-        static Vector thetaI(3);
-        static Vector thetaJ(3);
-        
-        
-        thetaI(0) = ul(0);
-        thetaI(1) = -ul(2);
-        thetaI(2) = ul(1);
-        
-        thetaJ(0) = ul(3);
-        thetaJ(1) = -ul(5);
-        thetaJ(2) = ul(4);
-        
-        
-        opserr << "thetaI: " << thetaI;
-        opserr << "thetaJ: " << thetaJ;
-        
-        double c;
-        
-        // f2  = ( Lr2*rI1 + hI3)'./(2*(cos(thetalI(3))));
-        Lr.addMatrixVector(0.0, Lr2, rI1,  1.0);  
-        Lr += hI3;
-        c = 1.0/(2.0*cos(thetaI(2)));
-        for (i=0; i<12; i++)
-            T(1,i) = Lr(i)*c;
-        
-        // f3  = ( Lr2*rJ1 + hJ3)'./(2*(cos(thetalJ(3))));
-        Lr.addMatrixVector(0.0, Lr2, rJ1,  1.0);  
-        Lr += hJ3;
-        c = 1.0/(2.0*cos(thetaJ(2)));   
-        for (i=0; i<12; i++)
-            T(2,i) = Lr(i)*c;
-        
-        // f4  = (-Lr3*rI1 - hI2)'./(2*(cos(thetalI(2))));
-        Lr.addMatrixVector(0.0, Lr3, rI1,  -1.0);  
-        Lr -= hI2;
-        c = 1.0/(2.0*cos(thetaI(1)));   
-        for (i=0; i<12; i++)
-            T(3,i) = Lr(i)*c;
-        
-        // f5  = (-Lr3*rJ1 - hJ2)'./(2*(cos(thetalJ(2))));
-        Lr.addMatrixVector(0.0, Lr3, rJ1,  -1.0);  
-        Lr -= hJ2;
-        c = 1.0/(2.0*cos(thetaJ(1)));   
-        for (i=0; i<12; i++)
-            T(4,i) = Lr(i)*c;
-        
-        // f6I = ( Lr3*rI2 - Lr2*rI3 + hI1)'./(2*(cos(thetalI(1))));
-        Lr.addMatrixVector(0.0, Lr3, rI2,  1.0);
-        Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
-        Lr += hI1;
-        c = 1.0/(2.0*cos(thetaI(0)));   
-        for (i=0; i<12; i++)
-            T(5,i) = Lr(i)*c;
-        
-        // f6J = ( Lr3*rJ2 - Lr2*rJ3 + hJ1)'./(2*(cos(thetalJ(1))));
-        Lr.addMatrixVector(0.0, Lr3, rJ2,  1.0);
-        Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
-        Lr += hJ1;
-        c = 1.0/(2.0*cos(thetaI(0)));   
-        for (i=0; i<12; i++)
-            T(6,i) -= Lr(i)*c;
+
+        for (i = 0; i < 12; i++)
+            for (n = 0; n < W; n++)
+                T[i*7+k][n] += Lr[i][n];
+    }
+
+    for (j = 0; j < 6; j++)
+        for (n = 0; n < W; n++) {
+            double c = 2 * cos(ul[j][n]);
+            for (i = 0; i < 12; i++)
+                T[i*7+j][n] /= c;
+        }
+
+    // T(:,7) = [-e1' O' e1' O']';
+    for (i = 0; i < 3; i++)
+        for (n = 0; n < W; n++) {
+            T[i*7+6][n] = -e1[i][n];
+            T[(i+6)*7+6][n] =  e1[i][n];
+        }
+
+    // save the new state in the transformations
+    int res = 0;
+    for (n = 0; n < nb; n++) {
+        CorotCrdTransf3d *theTransf = theTransfs[n];
+
+        for (k = 0; k < 3; k++) {
+            theTransf->alphaI(k) = dispI[k+3][n];
+            theTransf->alphaJ(k) = dispJ[k+3][n];
+        }
+
+        for (k = 0; k < 4; k++) {
+            theTransf->alphaIq(k) = alphaIq[k][n];
+            theTransf->alphaJq(k) = alphaJq[k][n];
+        }
+
+        theTransf->Ln = Ln[n];
+
+        if (Ln[n] == 0.0) {
+            opserr << "\nCorotCrdTransf3d::update: 0 deformed length\n";
+            for (k = 0; k < 7; k++)
+                ul[k][n] = theTransf->ul(k);
+            res = -2;
+        } else {
+            theTransf->ulpr = theTransf->ul;
+            for (k = 0; k < 7; k++)
+                theTransf->ul(k) = ul[k][n];
+        }
+    }
+
+    return res;
+}
+
+
+int  
+CorotCrdTransf3d::update(void)
+{
+    CorotCrdTransf3d *theTransf = this;
+
+    int res = updateBlock(&theTransf, 1, elementBlock);
+
+    // keep the transformation matrix for the methods using it
+    if (res == 0) {
+        for (int j = 0; j < 12; j++)
+            for (int i = 0; i < 7; i++)
+                T(i,j) = elementBlock.T[j*7+i][0];
+    }
+
+    return res;
 }
 
 
@@ -1175,276 +1400,327 @@ const Matrix &
 CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
     this->update();
-    
-    int i, j, k;   
+
+    double kbData[36], pbData[6], kgData[144];
+
+    for (int j = 0; j < 6; j++) {
+        for (int i = 0; i < 6; i++)
+            kbData[j*6+i] = kb(i,j);
+        pbData[j] = pb(j);
+    }
+
+    formBlockStiff(elementBlock, 1, kbData, pbData, kgData, 1);
+
+    for (int j = 0; j < 12; j++)
+        for (int i = 0; i < 12; i++)
+            kg(i,j) = kgData[j*12+i];
+
+    return kg;
+}
+
+
+// form the tangent stiffness matrices in global coordinates of the
+// transformations of a block updated by updateBlock(); kb, pb and kg hold
+// entry k of transformation n at [k*stride+n]
+template <int W> void
+CorotCrdTransf3d::formBlockStiff(const CorotCrdTransf3dBlock<W> &theBlock, int nb,
+                                 const double *kb, const double *pb, double *kg, int stride)
+{
+    int i, j, k, n;
+
+    double kbl[36][W], kl[49][W], pl[7][W];
+
+    for (i = 0; i < 36; i++)
+        for (n = 0; n < W; n++)
+            kbl[i][n] = kb[i*stride + ((n < nb) ? n : nb-1)];
+
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
-    kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
+    blockTripleProduct(kl, 7, Tp, kbl, 6);      // kl = Tp ^ kb * Tp;
 
-    //    opserr << "kb: " << kb;
-    //    opserr << "Tp: " << Tp;
-    
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
-    pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
-    
-    // transform tangent  stiffness matrix from local to global coordinates
-    //static Matrix kg(12,12);
-    
+    for (i = 0; i < 7; i++) {                     // pl = Tp ^ pb;
+        for (n = 0; n < W; n++)
+            pl[i][n] = 0.0;
+        for (j = 0; j < 6; j++) {
+            double tpji = Tp(j,i);
+            for (n = 0; n < W; n++)
+                pl[i][n] += tpji*pb[j*stride + ((n < nb) ? n : nb-1)];
+        }
+    }
+
     // compute the tangent stiffness matrix in global coordinates
-    kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
-    
-    static Vector m(6);
+    double K[144][W];
+    blockTripleProduct(K, 12, theBlock.T, kl, 7, 1.0);
+
+    const double (*ul)[W] = theBlock.ul;
+    const double (*A)[W] = theBlock.A;
+    const double (*T)[W] = theBlock.T;
+
+    double m[6][W], mneg[6][W], fact[W];
     for (i = 0; i < 6; i++)
-        m(i) = pl(i)/(2*cos(ul(i)));
-    
-    // compute the basic rotations
-    
-    static Vector e1(3), e2(3), e3(3);
-    static Vector r1(3), r2(3), r3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
-    
-    for (k = 0; k < 3; k ++)
-    {
-        e1(k) = e(k,0);
-        e2(k) = e(k,1);
-        e3(k) = e(k,2);
-        
-        r1(k) = Rbar(k,0);
-        r2(k) = Rbar(k,1);
-        r3(k) = Rbar(k,2);
-        
-        rI1(k) = RI(k,0);
-        rI2(k) = RI(k,1);
-        rI3(k) = RI(k,2);
-        
-        rJ1(k) = RJ(k,0);
-        rJ2(k) = RJ(k,1);
-        rJ3(k) = RJ(k,2);
-    }
-    
+        for (n = 0; n < W; n++) {
+            m[i][n] = pl[i][n]/(2*cos(ul[i][n]));
+            mneg[i][n] = -m[i][n];
+        }
+
+    const double (*e1)[W] = &theBlock.e[0];
+    const double (*e2)[W] = &theBlock.e[3];
+    const double (*e3)[W] = &theBlock.e[6];
+    const double (*r2)[W] = &theBlock.Rbar[3];
+    const double (*r3)[W] = &theBlock.Rbar[6];
+    const double (*rI1)[W] = &theBlock.RI[0];
+    const double (*rI2)[W] = &theBlock.RI[3];
+    const double (*rI3)[W] = &theBlock.RI[6];
+    const double (*rJ1)[W] = &theBlock.RJ[0];
+    const double (*rJ2)[W] = &theBlock.RJ[3];
+    const double (*rJ3)[W] = &theBlock.RJ[6];
+
     //   ks = t'*kl*t + ks1 + t * diag (m .* tan(thetal))*t' + ...
     //        m(4)*(ks2r2t3_u3 + ks2r3u2_t2) + ...
     //        m(2)*ks2r2t1 + m(3)*ks2r3t1 + ...
-    //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
-    //        ks3 + ks3' + ks4 + ks5;
-    
-    static Matrix Se1(3,3), Se2(3,3), Se3(3,3);
-    static Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
-    static Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
-    
-    Se1 = this->getSkewSymMatrix(e1);
-    Se2 = this->getSkewSymMatrix(e2);
-    Se3 = this->getSkewSymMatrix(e3);
-    
-    SrJ1 = this->getSkewSymMatrix(rJ1);
-    SrJ2 = this->getSkewSymMatrix(rJ2);
-    SrJ3 = this->getSkewSymMatrix(rJ3);
-    
-    SrI1 = this->getSkewSymMatrix(rI1);
-    SrI2 = this->getSkewSymMatrix(rI2);
-    SrI3 = this->getSkewSymMatrix(rI3);
-    
-    
+    //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
+    //        ks3 + ks3' + ks4 + ks5;
+    double Se1[9][W], Se2[9][W], Se3[9][W];
+    double SrI1[9][W], SrI2[9][W], SrI3[9][W];
+    double SrJ1[9][W], SrJ2[9][W], SrJ3[9][W];
+
+    blockSkew(Se1, e1);
+    blockSkew(Se2, e2);
+    blockSkew(Se3, e3);
+    blockSkew(SrJ1, rJ1);
+    blockSkew(SrJ2, rJ2);
+    blockSkew(SrJ3, rJ3);
+    blockSkew(SrI1, rI1);
+    blockSkew(SrI2, rI2);
+    blockSkew(SrI3, rI3);
+
     // ksigma1 -------------------------------
     //   ks1_11 =  a*pl(6);
     //   ks1 = [ ks1_11  o  -ks1_11  o;
     //             o     o      o    o;
     //          -ks1_11  o   ks1_11  o;
     //             o     o      o    o];
-    
-    double factor;
-    
-    kg.Assemble(A, 0, 0,  pl(6));
-    kg.Assemble(A, 0, 6, -pl(6));
-    kg.Assemble(A, 6, 0, -pl(6));
-    kg.Assemble(A, 6, 6,  pl(6));
-    
-    //opserr << "kg += ksigma1: " << kg;
-    
+    for (n = 0; n < W; n++)
+        fact[n] = -pl[6][n];
+    blockAssemble(K, 12, A, 3, 3, 0, 0, pl[6]);
+    blockAssemble(K, 12, A, 3, 3, 0, 6, fact);
+    blockAssemble(K, 12, A, 3, 3, 6, 0, fact);
+    blockAssemble(K, 12, A, 3, 3, 6, 6, pl[6]);
+
     // ksigma3 -------------------------------
     //  kbar2 = -Lr2*(m(3)*S(rI3) + m(1)*S(rI1)) + ...
     //           Lr3*(m(3)*S(rI2) - m(2)*S(rI1)) ;
-    
     //  kbar4 =  Lr2*(m(3)*S(rJ3) - m(4)*S(rJ1)) - ...
     //           Lr3*(m(3)*S(rJ2) + m(5)*S(rJ1));
-    
     //     ks3 = [o kbar2 o kbar4];
-    
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
-    
-    Sm.addMatrix(0.0, SrI3,  m(3));
-    Sm.addMatrix(1.0, SrI1,  m(1));
-    
-    kbar.addMatrixProduct(0.0, Lr2, Sm, -1.0);
-    
-    Sm.addMatrix(0.0, SrI2,  m(3));
-    Sm.addMatrix(1.0, SrI1, -m(2));
-    
-    kbar.addMatrixProduct(1.0, Lr3, Sm,  1.0);
-    
-    kg.Assemble(kbar, 0, 3, 1.0);
-    kg.AssembleTranspose(kbar, 3, 0, 1.0);
-    
-    Sm.addMatrix(0.0, SrJ3,  m(3));
-    Sm.addMatrix(1.0, SrJ1, -m(4));
-    
-    kbar.addMatrixProduct(0.0, Lr2, Sm, 1.0);
-    
-    Sm.addMatrix(0.0, SrJ2, m(3));
-    Sm.addMatrix(1.0, SrJ1, m(5));
-    
-    kbar.addMatrixProduct(1.0, Lr3, Sm,  -1.0);
-    
-    kg.Assemble(kbar, 0, 9, 1.0);
-    kg.AssembleTranspose(kbar, 9, 0, 1.0);
-    
-    //opserr << "kg += ksigma3: " << kg;
-    
+    double Sm[9][W], kbar[36][W];
+
+    blockAddMatrix(Sm, 9, false, SrI3, m[3]);
+    blockAddMatrix(Sm, 9, true, SrI1, m[1]);
+    blockAddMatrixProduct(kbar, 12, 3, 3, false, theBlock.Lr2, Sm, -1.0);
+    blockAddMatrix(Sm, 9, false, SrI2, m[3]);
+    blockAddMatrix(Sm, 9, true, SrI1, mneg[2]);
+    blockAddMatrixProduct(kbar, 12, 3, 3, true, theBlock.Lr3, Sm, 1.0);
+
+    blockAssemble(K, 12, kbar, 12, 3, 0, 3, 1.0);
+    blockAssemble(K, 12, kbar, 12, 3, 3, 0, 1.0, true);
+
+    blockAddMatrix(Sm, 9, false, SrJ3, m[3]);
+    blockAddMatrix(Sm, 9, true, SrJ1, mneg[4]);
+    blockAddMatrixProduct(kbar, 12, 3, 3, false, theBlock.Lr2, Sm, 1.0);
+    blockAddMatrix(Sm, 9, false, SrJ2, m[3]);
+    blockAddMatrix(Sm, 9, true, SrJ1, m[5]);
+    blockAddMatrixProduct(kbar, 12, 3, 3, true, theBlock.Lr3, Sm, -1.0);
+
+    blockAssemble(K, 12, kbar, 12, 3, 0, 9, 1.0);
+    blockAssemble(K, 12, kbar, 12, 3, 9, 0, 1.0, true);
+
     // Ksigma4 -------------------------------
     // Ks4_22 =  m(3)*( S(e2)*S(rI3) - S(e3)*S(rI2)) + ...
     //           m(1)*(-S(e1)*S(rI2) + S(e2)*S(rI1)) + ...
     //           m(2)*(-S(e1)*S(rI3) + S(e3)*S(rI1));
-    
     // Ks4_44 = -m(3)*( S(e2)*S(rJ3) - S(e3)*S(rJ2)) + ...
     //           m(4)*(-S(e1)*S(rJ2) + S(e2)*S(rJ1)) + ...
     //           m(5)*(-S(e1)*S(rJ3) + S(e3)*S(rJ1));
-    
-    // Ks4 = [   O    O     O    O;
-    //           O  Ks4_22  O    O;
-    //           O    O     O    O;
-    //           O    O     O  Ks4_44];
-    
-    static Matrix ks33(3,3);
-    
-    ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
-    ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
-    
-    ks33.addMatrixProduct(1.0, Se2, SrI1,  m(1));
-    ks33.addMatrixProduct(1.0, Se1, SrI2, -m(1));
-    
-    ks33.addMatrixProduct(1.0, Se3, SrI1,  m(2));
-    ks33.addMatrixProduct(1.0, Se1, SrI3, -m(2));
-    
-    kg.Assemble(ks33, 3, 3, 1.0);
-    
-    ks33.addMatrixProduct(0.0, Se2, SrJ3, -m(3));
-    ks33.addMatrixProduct(1.0, Se3, SrJ2,  m(3));
-    
-    ks33.addMatrixProduct(1.0, Se2, SrJ1,  m(4));
-    ks33.addMatrixProduct(1.0, Se1, SrJ2, -m(4));
-    
-    ks33.addMatrixProduct(1.0, Se3, SrJ1,  m(5));
-    ks33.addMatrixProduct(1.0, Se1, SrJ3, -m(5));
-    
-    kg.Assemble(ks33, 9, 9, 1.0);
-    
-    //opserr << "kg += ksigma4: " << kg;
-    
+    double ks33[9][W];
+
+    blockAddMatrixProduct(ks33, 3, 3, 3, false, Se2, SrI3, m[3]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se3, SrI2, mneg[3]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se2, SrI1, m[1]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se1, SrI2, mneg[1]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se3, SrI1, m[2]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se1, SrI3, mneg[2]);
+    blockAssemble(K, 12, ks33, 3, 3, 3, 3, 1.0);
+
+    blockAddMatrixProduct(ks33, 3, 3, 3, false, Se2, SrJ3, mneg[3]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se3, SrJ2, m[3]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se2, SrJ1, m[4]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se1, SrJ2, mneg[4]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se3, SrJ1, m[5]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, Se1, SrJ3, mneg[5]);
+    blockAssemble(K, 12, ks33, 3, 3, 9, 9, 1.0);
+
     // Ksigma5 -------------------------------
     //
     //  Ks5 = [ Ks5_11   Ks5_12 -Ks5_11   Ks5_14;
     //          Ks5_12t    O    -Ks5_12t   O;
     //         -Ks5_11  -Ks5_12  Ks5_11  -Ks5_14;
     //          Ks5_14t     O   -Ks5_14t   O];
-    
+
     // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-    static Vector v(3);
-    v.addVector (0.0, rI2, m(1));
-    v.addVector (1.0, rI3, m(2));
-    v.addVector (1.0, rJ2, m(4));
-    v.addVector (1.0, rJ3, m(5));
-    
-    v /= Ln;
-    
+    double v[3][W], m33[9][W];
+
+    blockAddMatrix(v, 3, false, rI2, m[1]);
+    blockAddMatrix(v, 3, true, rI3, m[2]);
+    blockAddMatrix(v, 3, true, rJ2, m[4]);
+    blockAddMatrix(v, 3, true, rJ3, m[5]);
+    for (i = 0; i < 3; i++)
+        for (n = 0; n < W; n++)
+            v[i][n] /= theBlock.Ln[n];
+
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
-    double  e1tv = 0;   // dot product e1. v
-    
+    for (n = 0; n < W; n++)
+        fact[n] = blockDot(e1, v, n);
+    blockAddMatrix(ks33, 9, false, A, fact);
+
+    for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
+            for (n = 0; n < W; n++)
+                m33[j*3+i][n] = v[i][n]*e1[j][n];
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, A, m33, 1.0);
+
+    for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
+            for (n = 0; n < W; n++)
+                m33[j*3+i][n] = e1[i][n]*v[j][n];
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, m33, A, 1.0);
+
+    blockAssemble(K, 12, ks33, 3, 3, 0, 0,  1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 0, 6, -1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 6, 0, -1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 6, 6,  1.0);
+
+    //Ks5_12 = -(m(2)*A*S(rI2) + m(3)*A*S(rI3));
+    blockAddMatrixProduct(ks33, 3, 3, 3, false, A, SrI2, mneg[1]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, A, SrI3, mneg[2]);
+
+    blockAssemble(K, 12, ks33, 3, 3, 0, 3,  1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 6, 3, -1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 3, 0,  1.0, true);
+    blockAssemble(K, 12, ks33, 3, 3, 3, 6, -1.0, true);
+
+    //  Ks5_14 = -(m(5)*A*S(rJ2) + m(6)*A*S(rJ3));
+    blockAddMatrixProduct(ks33, 3, 3, 3, false, A, SrJ2, mneg[4]);
+    blockAddMatrixProduct(ks33, 3, 3, 3, true, A, SrJ3, mneg[5]);
+
+    blockAssemble(K, 12, ks33, 3, 3, 0, 9,  1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 6, 9, -1.0);
+    blockAssemble(K, 12, ks33, 3, 3, 9, 0,  1.0, true);
+    blockAssemble(K, 12, ks33, 3, 3, 9, 6, -1.0, true);
+
+    // Ksigma -------------------------------
+    double rm[3][W];
+
     for (i = 0; i < 3; i++)
-        e1tv += e1(i) * v(i);
-    
-    ks33.addMatrix (0.0, A, e1tv);
-    
+        for (n = 0; n < W; n++)
+            rm[i][n] = rI3[i][n] - rJ3[i][n];
+    blockAddKs2Matrix(K, r2, rm, m[3], theBlock);
+
     for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-            m33(i,j) = v(i)*e1(j);
-        
-        ks33.addMatrixProduct (1.0, A, m33, 1.0);
-        
-        for (i = 0; i < 3; i++)
-            for (j = 0; j < 3; j++)
-                m33(i,j) = e1(i)*v(j);
-            
-            ks33.addMatrixProduct (1.0, m33, A, 1.0);
-            
-            kg.Assemble(ks33, 0, 0,  1.0);
-            kg.Assemble(ks33, 0, 6, -1.0);
-            kg.Assemble(ks33, 6, 0, -1.0);
-            kg.Assemble(ks33, 6, 6,  1.0);
-            
-            //Ks5_12 = -(m(2)*A*S(rI2) + m(3)*A*S(rI3));
-            
-            ks33.addMatrixProduct(0.0, A, SrI2, -m(1));
-            ks33.addMatrixProduct(1.0, A, SrI3, -m(2));
-            
-            kg.Assemble(ks33, 0, 3,  1.0);
-            kg.Assemble(ks33, 6, 3, -1.0);
-            
-            kg.AssembleTranspose(ks33, 3, 0,  1.0);
-            kg.AssembleTranspose(ks33, 3, 6, -1.0);
-            
-            //  Ks5_14 = -(m(5)*A*S(rJ2) + m(6)*A*S(rJ3));
-            
-            ks33.addMatrixProduct(0.0, A, SrJ2, -m(4));
-            ks33.addMatrixProduct(1.0, A, SrJ3, -m(5));
-            
-            kg.Assemble(ks33, 0, 9,  1.0);
-            kg.Assemble(ks33, 6, 9, -1.0);
-            
-            kg.AssembleTranspose(ks33, 9, 0,  1.0);
-            kg.AssembleTranspose(ks33, 9, 6, -1.0);
-            
-            //opserr << "kg += ksigma5: " << kg;
-            
-            // Ksigma -------------------------------
-            static Vector rm(3);
-            
-            rm = rI3;
-            rm.addVector (1.0, rJ3, -1.0); 
-            //opserr << "ks2(r2,rI3-rJ3):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rm), m(3));
-            
-            rm = rJ2;
-            rm.addVector (1.0, rI2, -1.0); 
-            //opserr << "ks2(r3,rJ2-rI2):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rm), m(3));
-            //opserr << "ks2(r2,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rI1), m(1));
-            //opserr << "ks2(r3,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rI1), m(2));
-            //opserr << "ks2(r2,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rJ1), m(4));
-            //opserr << "ks2(r3,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rJ1), m(5));
-            
-            //opserr << "kg += ksigma2: " << kg;
-            
-            //  T * diag (M .* tan(thetal))*T' 
-            
-            for (k = 0; k < 6; k++)
-            {
-                factor = pl(k) * tan(ul(k));
-                for (i = 0; i < 12; i++)
-                    for (j = 0; j < 12; j++)
-                        kg(i,j) += T(k,i) * factor * T(k,j);
+        for (n = 0; n < W; n++)
+            rm[i][n] = rJ2[i][n] - rI2[i][n];
+    blockAddKs2Matrix(K, r3, rm, m[3], theBlock);
+
+    blockAddKs2Matrix(K, r2, rI1, m[1], theBlock);
+    blockAddKs2Matrix(K, r3, rI1, m[2], theBlock);
+    blockAddKs2Matrix(K, r2, rJ1, m[4], theBlock);
+    blockAddKs2Matrix(K, r3, rJ1, m[5], theBlock);
+
+    //  T * diag (M .* tan(thetal))*T'
+    for (k = 0; k < 6; k++) {
+        for (n = 0; n < W; n++)
+            fact[n] = pl[k][n] * tan(ul[k][n]);
+        for (j = 0; j < 12; j++) {
+            const double *tkj = T[j*7+k];
+            for (i = 0; i < 12; i++) {
+                const double *tki = T[i*7+k];
+                double *kij = K[j*12+i];
+                for (n = 0; n < W; n++)
+                    kij[n] += tki[n] * fact[n] * tkj[n];
             }
-            
-	    //            opserr << "COROATIONAL 3d: kg final: " << kg;
-            
-            return kg;
+        }
+    }
+
+    for (i = 0; i < 144; i++)
+        for (n = 0; n < nb; n++)
+            kg[i*stride + n] = K[i][n];
+}
+
+
+int
+CorotCrdTransf3d::getBasicTrialDisps(CrdTransf **theTransfs, int numTransfs, double *ub)
+{
+    for (int n = 0; n < numTransfs; n++)
+        if (theTransfs[n]->getClassTag() != CRDTR_TAG_CorotCrdTransf3d)
+            return this->CrdTransf::getBasicTrialDisps(theTransfs, numTransfs, ub);
+
+    CorotCrdTransf3d *blockTransfs[corotBlockSize];
+    int res = 0;
+
+    for (int n0 = 0; n0 < numTransfs; n0 += corotBlockSize) {
+        int nb = numTransfs - n0;
+        if (nb > corotBlockSize)
+            nb = corotBlockSize;
+
+        for (int n = 0; n < nb; n++)
+            blockTransfs[n] = (CorotCrdTransf3d *)theTransfs[n0+n];
+
+        if (updateBlock(blockTransfs, nb, batchBlock) != 0)
+            res = -2;
+
+        // use transformation matrix to renumber the degrees of freedom
+        for (int j = 0; j < 6; j++) {
+            double *ubj = &ub[j*numTransfs + n0];
+            for (int n = 0; n < nb; n++)
+                ubj[n] = 0.0;
+            for (int i = 0; i < 7; i++) {
+                double tpji = Tp(j,i);
+                for (int n = 0; n < nb; n++)
+                    ubj[n] += tpji*batchBlock.ul[i][n];
+            }
+        }
+    }
+
+    return res;
+}
+
+
+int
+CorotCrdTransf3d::getGlobalStiffMatrices(CrdTransf **theTransfs, int numTransfs,
+                                         const double *kb, const double *pb, double *kg)
+{
+    for (int n = 0; n < numTransfs; n++)
+        if (theTransfs[n]->getClassTag() != CRDTR_TAG_CorotCrdTransf3d)
+            return this->CrdTransf::getGlobalStiffMatrices(theTransfs, numTransfs, kb, pb, kg);
+
+    CorotCrdTransf3d *blockTransfs[corotBlockSize];
+    int res = 0;
+
+    for (int n0 = 0; n0 < numTransfs; n0 += corotBlockSize) {
+        int nb = numTransfs - n0;
+        if (nb > corotBlockSize)
+            nb = corotBlockSize;
+
+        for (int n = 0; n < nb; n++)
+            blockTransfs[n] = (CorotCrdTransf3d *)theTransfs[n0+n];
+
+        if (updateBlock(blockTransfs, nb, batchBlock) != 0)
+            res = -2;
+
+        formBlockStiff(batchBlock, nb, kb + n0, pb + n0, kg + n0, numTransfs);
+    }
+
+    return res;
 }
 
 
@@ -1555,426 +1831,20 @@ const Vector &
 CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
 {
     // obtains the normalised quaternion from the rotation matrix
-    int i, j, k;
-    double trR;              // trace of R
-    double a    ;
-    static Vector q(4);      // normalized quaternion
-    
-    trR = R(0,0) + R(1,1) + R(2,2);    
-    
-    // a = max ([trR R(0,0) R(1,1) R(2,2)]);
-    a = trR;
-    for (i = 0; i < 3; i++)
-        if (R(i,i) > a)
-            a = R(i,i);
-        
-        if (a == trR)
-        {
-            q(3) = sqrt(1+a)*0.5;
-            
-            for (i = 0; i < 3; i++)
-            {
-                j = (i+1)%3;
-                k = (i+2)%3;
-                q(i) = (R(k,j) - R(j,k))/(4*q(3));
-            }
-        }  
-        else
-        {
-            for (i = 0; i < 3; i++)
-                if (a == R(i,i))
-                {
-                    j = (i+1)%3;
-                    k = (i+2)%3;
-                    
-                    q(i) = sqrt(a*0.5 + (1 - trR)/4.0);
-                    q(3)   = (R(k,j) - R(j,k))/(4*q(i));
-                    q(j) = (R(j,i) + R(i,j))/(4*q(i));
-                    q(k) = (R(k,i) + R(i,k))/(4*q(i));
-                }
-        }
-        
-        return q;
-}
+    double Rdata[9];
+    static double qdata[4];
+    static Vector q(qdata, 4);      // normalized quaternion
 
-
-const Vector &
-CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
-{
-    double t;                // norm of the pseudo rotation vector
-    double factor;
-    static Vector q(4);      // normalized quaternion
-    
-    t = theta.Norm();
-    
-    if (t == 0)
-        q.Zero();
-    else
-    {
-        factor = sin(t*0.5)/ t;
+    for (int j = 0; j < 3; j++)
         for (int i = 0; i < 3; i++)
-            q(i) = theta(i) * factor;
-    }
-    
-    q(3) = cos(t*0.5);
-    
-    return q;
-}
-
-
-const Vector &
-CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
-{
-    
-    static Vector q12(4);
-    int i;
-    double q1Tq2= 0;  // dot product
-    static Vector q1xq2(3);     // cross product
-    
-    // calculate the dot product q1.q2
-    for (i = 0; i < 3; i++)       // NOTE i <3, not i<4
-        q1Tq2 += q1(i)* q2(i);
-    
-    // calculate the cross-product q1 x q2
-    q1xq2(0) = q1(1)*q2(2) - q1(2)*q2(1);
-    q1xq2(1) = q1(2)*q2(0) - q1(0)*q2(2);
-    q1xq2(2) = q1(0)*q2(1) - q1(1)*q2(0);
-    
-    // calculate the quaternion product
-    for (i = 0; i < 3; i++)
-        q12(i) = q1(3)*q2(i) + q2(3)*q1(i) - q1xq2(i);  
-    
-    q12(3) = q1(3)*q2(3) - q1Tq2;
-    
-    return q12;
-}
-
-
-const Matrix &
-CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
-{ 
-    int i, j;
-    double factor;
-    static Matrix I(3,3); // identity matrix
-    static Matrix qqT(3,3); 
-    static Matrix S(3,3);
-    static Matrix R(3,3);
-    
-    // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
-    
-    factor = q(3)*q(3) - (q(0)*q(0) + q(1)*q(1) + q(2)*q(2));
-    
-    
-    for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-            qqT(i,j) = q(i) * q(j);
-        
-        // get skew symmetric matrix	     
-        S = this->getSkewSymMatrix (q);
-        
-        R.Zero();
-        
-        for (i = 0; i < 3; i++)
-            R(i,i) = factor;
-        
-        R.addMatrix (1.0, qqT, 2.0);
-        R.addMatrix (1.0, S, 2.0*q(3));
-        
-        return R;
-}
-
-
-const Vector &
-CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
-{ 
-    static Vector w(3);
-    
-    for (int i = 0; i < 3; i++)
-        w(i) = 2.0 * q(i)/q(3);
-    
-    return w;
-}
-
-
-const Matrix &
-CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
-{ 
-    // Rotation matrix in terms of the tangent-scaled pseudo-vector
-    static Matrix S(3,3);
-    static Matrix S2(3,3);
-    static Matrix R(3,3);
-    double normw2;
-    
-    S = this->getSkewSymMatrix(w);
-    
-    // R = I + (S + S*S/2)/(1 + w' * w / 4);
-    
-    R.Zero();
-    
-    for (int i = 0; i < 3; i++)
-        R(i,i) = 1;
-    
-    S2 = S;
-    S2.addMatrixProduct(1.0, S, S, 0.5);
-    
-    normw2 = w^ w;
-    
-    R.addMatrix(1.0, S2, 1.0/(1 + normw2/4.0));
-    
-    return R;
-}
+            Rdata[j*3+i] = R(i,j);
 
+    quaternionFromRotMatrix(Rdata, qdata);
 
-const Matrix &
-CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
-{
-    static Matrix S(3,3);
-    
-    //  St = [   0       -theta(2)  theta(1);
-    //         theta(2)     0      -theta(0);
-    //        -theta(1)   theta(0)      0   ];
-    
-    S(0,0) =  0.0;
-    S(0,1) = -theta(2);
-    S(0,2) =  theta(1);
-    
-    S(1,0) =  theta(2);
-    S(1,1) =  0.0;
-    S(1,2) = -theta(0);
-    
-    S(2,0) = -theta(1);
-    S(2,1) =  theta(0);
-    S(2,2) =  0.0;
-    
-    //opserr << "getSkew  theta: " << theta;
-    //opserr << "getSkew  S: " << S;
-    
-    return S;
-}   
-
-
-const Matrix &
-CorotCrdTransf3d::getLMatrix(const Vector &ri) const
-{
-    static Matrix L1(3,3), L2(3,3);
-    static Vector r1(3), e1(3);
-    double rie1, e1r1k;
-    static Matrix rie1r1(3,3);
-    static Matrix e1e1r1(3,3);
-    static Matrix Sri(3,3);
-    static Matrix Sr1(3,3);
-    static Matrix L(12,3);
-    
-    int j, k;
-    
-    for (j = 0; j < 3; j++)
-    {
-        e1(j) =    e(j,0);
-        r1(j) = Rbar(j,0);
-    }  
-    
-    rie1 = ri^ e1;
-    
-    //opserr << "rie1: " << rie1 << endln;
-    
-    for (k = 0; k < 3; k++)
-    {
-        e1r1k = (e1(k) + r1(k));
-        for (j = 0; j < 3; j++)
-        {
-            rie1r1(j,k) = ri(j)*e1r1k;
-            e1e1r1(j,k) = e1(j)*e1r1k;
-        }
-    }
-    
-    //opserr << "rie1r1: " << rie1r1;
-    
-    //opserr << "e1e1r1: " << e1e1r1;
-    
-    //L1  = ri'*e1 * A/2 + A*ri*(e1 + r1)'/2;
-    
-    L1.addMatrix (0.0, A, rie1*0.5);
-    L1.addMatrixProduct (1.0, A, rie1r1, 0.5);
-    
-    //opserr << "L1: " << L1;
-    
-    Sri = this->getSkewSymMatrix(ri);       // Change ??????????????????????
-    Sr1 = this->getSkewSymMatrix(r1);       // Change ??????????????????????
-    
-    // L2  = Sri/2 - ri'*e1*S(r1)/4 - Sri*e1*(e1 + r1)'/4;
-    L2.addMatrix (0.0, Sri, 0.5);
-    L2.addMatrix (1.0, Sr1, -rie1/4.0);
-    L2.addMatrixProduct (1.0, Sri, e1e1r1, -0.25);
-    
-    //opserr << "L2: " << L2;
-    
-    // L = [L1
-    //      L2 
-    //     -L1 
-    //      L2 ;
-    
-    L.Zero();
-    L.Assemble(L1, 0, 0,  1.0);
-    L.Assemble(L2, 3, 0,  1.0);
-    L.Assemble(L1, 6, 0, -1.0);
-    L.Assemble(L2, 9, 0,  1.0);
-    
-    //opserr << "L: " << L;
-    
-    return L;
+    return q;
 }
 
 
-const Matrix &
-CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
-{
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
-    
-    //opserr << "\ngetKs2Matrix:\n";
-    //opserr << "ri: " << ri;
-    
-    //opserr << "z: " << z;
-    
-    //  Ksigma2 = [ K11   K12 -K11   K12;
-    //              K12t  K22 -K12t  K22;
-    //             -K11  -K12  K11  -K12;
-    //              K12t  K22 -K12t  K22];
-    
-    // U = (-1/2)*A*z*ri'*A + ri'*e1*A*z*e1'/(2*Ln)+...
-    //      z'*(e1+r1)*A*ri*e1'/(2*Ln);
-    
-    int i, j;
-    double rite1 = 0;   // dot product ri . e1
-    double zte1  = 0;   // dot product z  . e1
-    double ztr1  = 0;   // dot product z  . r1
-    
-    for (i = 0; i < 3; i++)
-    {
-        e1(i) = e(i,0);
-        r1(i) = Rbar(i,0);
-        rite1 += ri(i)*e1(i);
-        zte1  += z(i)*e1(i);
-        ztr1  += z(i)*r1(i);
-    }
-    
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
-    
-    for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-        {
-            zrit(i,j) = z(i)*ri(j);
-            rizt(i,j) = ri(i)*z(j);
-            ze1t(i,j) = z(i)*e1(j);
-            e1zt(i,j) = e1(i)*z(j);
-            r1e1t(i,j) = r1(i)*e1(j);
-            rie1t(i,j) = ri(i)*e1(j);
-        }
-        
-        static Matrix U(3,3);
-        //opserr << " rite1: "<< rite1;
-        //opserr << " zte1: "<< zte1;
-        //opserr << " ztr1: "<< ztr1;
-        
-        //opserr << " A: "<< A;
-        //opserr << " zrit: "<< zrit;
-        //opserr << " ze1t: "<< ze1t;
-        //opserr << " rie1t: "<< rie1t;
-        
-        //opserr << " Ln: "<< Ln;
-        
-        U.addMatrixTripleProduct(0.0, A, zrit, -0.5);
-        
-        //opserr << "U: A*zrit*zrit " << U;
-        U.addMatrixProduct (1.0, A, ze1t,   rite1/(2*Ln));
-        //opserr << "U: A*ze1t*rite1/(2*Ln) " << U;
-        U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
-        
-        //opserr << "U: " << U;
-        static Matrix ks(3,3);
-        
-        //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
-        
-        ks.addMatrix (0.0, U, 1.0);
-        
-        // add matrix U transpose
-        for (i = 0; i < 3; i++)
-            for (j = 0; j < 3; j++)
-                ks(i,j) += U(j,i);
-            
-            ks.addMatrix(1.0, A, rite1*(2*zte1 + ztr1)/(2*Ln));
-            
-            //opserr << "Ks211: " << ks;
-            
-            ks2.Zero();
-            
-            ks2.Assemble(ks, 0, 0,  1.0);
-            ks2.Assemble(ks, 0, 6, -1.0);
-            ks2.Assemble(ks, 6, 0, -1.0);
-            ks2.Assemble(ks, 6, 6,  1.0);
-            
-            static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
-            
-            Sri = this->getSkewSymMatrix(ri);  
-            Sr1 = this->getSkewSymMatrix(r1);
-            Sz  = this->getSkewSymMatrix(z); 
-            Se1 = this->getSkewSymMatrix(e1); 
-            
-            //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
-            
-            static Matrix m1(3,3);
-            
-            m1.addMatrixProduct(0.0, A, ze1t, -1.0);
-            ks.addMatrixProduct(0.0, m1, Sri, 0.25);
-            
-            m1.addMatrixProduct(0.0, A, rizt, -1.0);
-            ks.addMatrixProduct(1.0, m1, Sr1, 0.25);
-            
-            ks.addMatrixProduct(1.0, A, Sri, -0.25*(zte1+ztr1));
-            
-            //opserr << "Ks2_12: " << ks;
-            
-            ks2.Assemble(ks, 0, 3,  1.0);
-            ks2.Assemble(ks, 0, 9,  1.0);
-            ks2.Assemble(ks, 6, 3, -1.0);
-            ks2.Assemble(ks, 6, 9, -1.0);
-            
-            ks2.AssembleTranspose(ks, 3, 0,  1.0);
-            ks2.AssembleTranspose(ks, 3, 6, -1.0);
-            ks2.AssembleTranspose(ks, 9, 0,  1.0);
-            ks2.AssembleTranspose(ks, 9, 6, -1.0);
-            
-            //K22 = (1/8)*((-ri'*e1)*Sz*Sr1 + Sr1*z*e1'*Sri + ...
-            //      Sri*e1*z'*Sr1 - (e1+r1)'*z*S(e1)*Sri + 2*Sz*Sri);
-            
-            ks.addMatrixProduct (0.0, Sz, Sr1, -0.125*(rite1));
-            
-            m1.addMatrixProduct (0.0, Sr1, ze1t, 1.0);
-            ks.addMatrixProduct (1.0, m1, Sri, 0.125);
-            
-            m1.addMatrixProduct (0.0, Sri, e1zt, 1.0);
-            ks.addMatrixProduct (1.0, m1, Sr1, 0.125);
-            
-            ks.addMatrixProduct (1.0, Se1, Sri, -0.125*(zte1 + ztr1));
-            ks.addMatrixProduct (1.0, Sz, Sri, 0.25);
-            
-            //opserr << "Ks2_22: " << ks;
-            
-            //  Ksigma2 = [ K11   K12 -K11   K12;
-            //              K12t  K22 -K12t  K22;
-            //             -K11  -K12  K11  -K12;
-            //              K12t  K22 -K12t  K22];
-            
-            ks2.Assemble(ks, 3, 3, 1.0);
-            ks2.Assemble(ks, 3, 9, 1.0);
-            ks2.Assemble(ks, 9, 3, 1.0);
-            ks2.Assemble(ks, 9, 9, 1.0);
-            
-            return ks2;
-}
-
 
 CrdTransf *
 CorotCrdTransf3d::getCopy3d(void)
@@ -40,6 +40,8 @@
 #include <Vector.h>
 #include <Matrix.h>
 
+template <int W> struct CorotCrdTransf3dBlock;
+
 class CorotCrdTransf3d: public CrdTransf
 {
 public:
@@ -69,6 +71,10 @@ public:
     const Vector &getGlobalResistingForce(const Vector &basicForce, const Vector &p0);
     const Matrix &getGlobalStiffMatrix(const Matrix &basicStiff, const Vector &basicForce);
     const Matrix &getInitialGlobalStiffMatrix(const Matrix &basicStiff);
+
+    int getBasicTrialDisps(CrdTransf **theTransfs, int numTransfs, double *ub);
+    int getGlobalStiffMatrices(CrdTransf **theTransfs, int numTransfs,
+                               const double *kb, const double *pb, double *kg);
     
     CrdTransf *getCopy3d(void);
     
@@ -87,19 +93,19 @@ public:
     int  getLocalAxes(Vector &xAxis, Vector &yAxis, Vector &zAxis);
     
 private:
-    void compTransfMatrixBasicGlobal(void);
-    void compTransfMatrixBasicGlobalNew(void);
     void compTransfMatrixLocalGlobal(Matrix &Tlg);
     void compTransfMatrixBasicLocal(Matrix &Tbl);
     const Vector &getQuaternionFromRotMatrix(const Matrix &RotMatrix) const;
-    const Vector &getQuaternionFromPseudoRotVector(const Vector &theta) const;
-    const Vector &getTangScaledPseudoVectorFromQuaternion(const Vector &theta) const;
-    const Vector &quaternionProduct(const Vector &q1, const Vector &q2) const;
-    const Matrix &getRotationMatrixFromQuaternion(const Vector &q) const;
-    const Matrix &getRotMatrixFromTangScaledPseudoVector(const Vector &w) const;
-    const Matrix &getSkewSymMatrix(const Vector &theta) const;
-    const Matrix &getLMatrix(const Vector &ri) const;
-    const Matrix &getKs2Matrix(const Vector &ri, const Vector &z) const;
+
+    // state determination of a block of transformations, see
+    // CorotCrdTransf3d.cpp; update(void) and getGlobalStiffMatrix() work on
+    // a block of one
+    template <int W>
+    static int updateBlock(CorotCrdTransf3d **theTransfs, int numTransfs,
+                           CorotCrdTransf3dBlock<W> &theBlock);
+    template <int W>
+    static void formBlockStiff(const CorotCrdTransf3dBlock<W> &theBlock, int numTransfs,
+                               const double *kb, const double *pb, double *kg, int stride);
     
     // internal data
     Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
@@ -125,17 +131,12 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
     static Matrix Tp;           // transformation matrix to renumber dofs
     static Matrix T;            // transformation matrix from basic to global system
     static Matrix Tlg;          // transformation matrix from global to local system
     static Matrix TlgInv;       // inverse of transformation matrix from global to local system
     static Matrix Tbl;          // transformation matrix from local to basic system
     static Matrix kg;           // global stiffness matrix
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
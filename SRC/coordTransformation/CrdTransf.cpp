@@ -33,6 +33,7 @@
 
 #include <CrdTransf.h>
 #include <Vector.h>
+#include <Matrix.h>
 
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
@@ -103,6 +104,44 @@ CrdTransf::~CrdTransf()
 {
 }
 
+int
+CrdTransf::getBasicTrialDisps(CrdTransf **theTransfs, int numTransfs, double *ub)
+{
+    int res = 0;
+    for (int n = 0; n < numTransfs; n++) {
+        res += theTransfs[n]->update();
+        const Vector &ubn = theTransfs[n]->getBasicTrialDisp();
+        for (int k = 0; k < ubn.Size(); k++)
+            ub[k*numTransfs + n] = ubn(k);
+    }
+
+    return res;
+}
+
+int
+CrdTransf::getGlobalStiffMatrices(CrdTransf **theTransfs, int numTransfs,
+                                  const double *kb, const double *pb, double *kg)
+{
+    for (int n = 0; n < numTransfs; n++) {
+        int numBasic = theTransfs[n]->getBasicTrialDisp().Size();
+        Matrix kbn(numBasic, numBasic);
+        Vector pbn(numBasic);
+        for (int j = 0; j < numBasic; j++) {
+            pbn(j) = pb[j*numTransfs + n];
+            for (int i = 0; i < numBasic; i++)
+                kbn(i,j) = kb[(j*numBasic + i)*numTransfs + n];
+        }
+
+        const Matrix &kgn = theTransfs[n]->getGlobalStiffMatrix(kbn, pbn);
+        int numGlobal = kgn.noRows();
+        for (int j = 0; j < numGlobal; j++)
+            for (int i = 0; i < numGlobal; i++)
+                kg[(j*numGlobal + i)*numTransfs + n] = kgn(i,j);
+    }
+
+    return 0;
+}
+
 const Vector &
 CrdTransf::getBasicDisplSensitivity(int gradNumber)
 {
@@ -94,6 +94,22 @@ public:
     // methods used in post-processing only
     virtual const Vector &getPointGlobalCoordFromLocal(const Vector &localCoords) = 0;
     virtual const Vector &getPointGlobalDisplFromBasic(double xi, const Vector &basicDisps) = 0;
+
+    // true if update() and the transformations of different objects can be
+    // done on different threads at the same time
+    virtual bool isThreadSafe(void) {return false;}
+
+    // state determination of many transformations at once, this being
+    // theTransfs[0]. The arrays are in structure of arrays layout, entry k
+    // of transformation n being at [k*numTransfs + n], the matrices stored
+    // by columns as in a Matrix. getBasicTrialDisps() updates the
+    // transformations and puts their basic trial displacements in ub, and
+    // getGlobalStiffMatrices() puts in kg the global stiffness of the basic
+    // stiffness kb and basic force pb of each. By default they loop over
+    // update(), getBasicTrialDisp() and getGlobalStiffMatrix()
+    virtual int getBasicTrialDisps(CrdTransf **theTransfs, int numTransfs, double *ub);
+    virtual int getGlobalStiffMatrices(CrdTransf **theTransfs, int numTransfs,
+                                       const double *kb, const double *pb, double *kg);
     
 protected:
     
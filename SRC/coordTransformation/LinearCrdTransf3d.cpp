@@ -44,8 +44,8 @@
 #include <LinearCrdTransf3d.h>
 
 // initialize static variables
-Matrix LinearCrdTransf3d::Tlg(12,12);
-Matrix LinearCrdTransf3d::kg(12,12);
+OPS_THREAD_LOCAL Matrix LinearCrdTransf3d::Tlg(12,12);
+OPS_THREAD_LOCAL Matrix LinearCrdTransf3d::kg(12,12);
 
 void* OPS_LinearCrdTransf3d()
 {
@@ -233,9 +233,9 @@ LinearCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     if ((error = this->computeElemtLengthAndOrient()))
         return error;
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    static OPS_THREAD_LOCAL Vector XAxis(3);
+    static OPS_THREAD_LOCAL Vector YAxis(3);
+    static OPS_THREAD_LOCAL Vector ZAxis(3);
     
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -256,7 +256,7 @@ int
 LinearCrdTransf3d::computeElemtLengthAndOrient()
 {
     // element projection
-    static Vector dx(3);
+    static OPS_THREAD_LOCAL Vector dx(3);
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -330,14 +330,14 @@ LinearCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
     // Compute y = v cross x
     // Note: v(i) is stored in R[2][i]
-    static Vector vAxis(3);
+    static OPS_THREAD_LOCAL Vector vAxis(3);
     vAxis(0) = R[2][0];	vAxis(1) = R[2][1];	vAxis(2) = R[2][2];
     
-    static Vector xAxis(3);
+    static OPS_THREAD_LOCAL Vector xAxis(3);
     xAxis(0) = R[0][0];	xAxis(1) = R[0][1];	xAxis(2) = R[0][2];
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
     
-    static Vector yAxis(3);
+    static OPS_THREAD_LOCAL Vector yAxis(3);
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
     yAxis(2) = vAxis(0)*xAxis(1) - vAxis(1)*xAxis(0);
@@ -355,7 +355,7 @@ LinearCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     YAxis(0) = yAxis(0);    YAxis(1) = yAxis(1);    YAxis(2) = yAxis(2);
     
     // Compute z = x cross y
-    static Vector zAxis(3);
+    static OPS_THREAD_LOCAL Vector zAxis(3);
     
     zAxis(0) = xAxis(1)*yAxis(2) - xAxis(2)*yAxis(1);
     zAxis(1) = xAxis(2)*yAxis(0) - xAxis(0)*yAxis(2);
@@ -396,7 +396,7 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    static OPS_THREAD_LOCAL double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -414,9 +414,9 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    static OPS_THREAD_LOCAL Vector ub(6);
     
-    static double ul[12];
+    static OPS_THREAD_LOCAL double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -434,7 +434,7 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    static OPS_THREAD_LOCAL double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -476,7 +476,7 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double ug[12];
+    static OPS_THREAD_LOCAL double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -484,9 +484,9 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    static OPS_THREAD_LOCAL Vector ub(6);
     
-    static double ul[12];
+    static OPS_THREAD_LOCAL double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -504,7 +504,7 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    static OPS_THREAD_LOCAL double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -546,7 +546,7 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double ug[12];
+    static OPS_THREAD_LOCAL double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -554,9 +554,9 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    static OPS_THREAD_LOCAL Vector ub(6);
     
-    static double ul[12];
+    static OPS_THREAD_LOCAL double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -574,7 +574,7 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    static OPS_THREAD_LOCAL double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -616,7 +616,7 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[12];
+	static OPS_THREAD_LOCAL double vg[12];
 	for (int i = 0; i < 6; i++) {
 		vg[i]   = vel1(i);
 		vg[i+6] = vel2(i);
@@ -624,9 +624,9 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 	
 	double oneOverL = 1.0/L;
 	
-	static Vector vb(6);
+	static OPS_THREAD_LOCAL Vector vb(6);
 	
-	static double vl[12];
+	static OPS_THREAD_LOCAL double vl[12];
 	
 	vl[0]  = R[0][0]*vg[0] + R[0][1]*vg[1] + R[0][2]*vg[2];
 	vl[1]  = R[1][0]*vg[0] + R[1][1]*vg[1] + R[1][2]*vg[2];
@@ -644,7 +644,7 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 	vl[10] = R[1][0]*vg[9] + R[1][1]*vg[10] + R[1][2]*vg[11];
 	vl[11] = R[2][0]*vg[9] + R[2][1]*vg[10] + R[2][2]*vg[11];
 	
-	static double Wu[3];
+	static OPS_THREAD_LOCAL double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*vg[4] - nodeIOffset[1]*vg[5];
 		Wu[1] = -nodeIOffset[2]*vg[3] + nodeIOffset[0]*vg[5];
@@ -686,7 +686,7 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[12];
+	static OPS_THREAD_LOCAL double ag[12];
 	for (int i = 0; i < 6; i++) {
 		ag[i]   = accel1(i);
 		ag[i+6] = accel2(i);
@@ -694,9 +694,9 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 	
 	double oneOverL = 1.0/L;
 	
-	static Vector ab(6);
+	static OPS_THREAD_LOCAL Vector ab(6);
 	
-	static double al[12];
+	static OPS_THREAD_LOCAL double al[12];
 	
 	al[0]  = R[0][0]*ag[0] + R[0][1]*ag[1] + R[0][2]*ag[2];
 	al[1]  = R[1][0]*ag[0] + R[1][1]*ag[1] + R[1][2]*ag[2];
@@ -714,7 +714,7 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 	al[10] = R[1][0]*ag[9] + R[1][1]*ag[10] + R[1][2]*ag[11];
 	al[11] = R[2][0]*ag[9] + R[2][1]*ag[10] + R[2][2]*ag[11];
 	
-	static double Wu[3];
+	static OPS_THREAD_LOCAL double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*ag[4] - nodeIOffset[1]*ag[5];
 		Wu[1] = -nodeIOffset[2]*ag[3] + nodeIOffset[0]*ag[5];
@@ -753,7 +753,7 @@ const Vector &
 LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[12];
+    static OPS_THREAD_LOCAL double pl[12];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -784,7 +784,7 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[8] += p0(4);
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    static OPS_THREAD_LOCAL Vector pg(12);
     
     pg(0)  = R[0][0]*pl[0] + R[1][0]*pl[1] + R[2][0]*pl[2];
     pg(1)  = R[0][1]*pl[0] + R[1][1]*pl[1] + R[2][1]*pl[2];
@@ -821,9 +821,9 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
+    static OPS_THREAD_LOCAL double kb[6][6];		// Basic stiffness
+    static OPS_THREAD_LOCAL double kl[12][12];	// Local stiffness
+    static OPS_THREAD_LOCAL double tmp[12][12];	// Temporary storage
     double oneOverL = 1.0/L;
     
     int i,j;
@@ -864,7 +864,7 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
             kl[11][i] =  tmp[2][i];
         }
         
-        static double RWI[3][3];
+        static OPS_THREAD_LOCAL double RWI[3][3];
         
         if (nodeIOffset) {
             // Compute RWI
@@ -881,7 +881,7 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
             RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
         }
         
-        static double RWJ[3][3];
+        static OPS_THREAD_LOCAL double RWJ[3][3];
         
         if (nodeJOffset) {
             // Compute RWJ
@@ -967,12 +967,66 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 }
 
 
+// The transformation has no state to update and its per element
+// operations are already a few dozen flops on plain arrays, which a
+// structure of arrays version spread over a block of transformations does
+// not beat, so the batched methods run them for one transformation after
+// the other, skipping the virtual calls, the Matrix and Vector the
+// default ones allocate for each, and the update().
+
+int
+LinearCrdTransf3d::getBasicTrialDisps(CrdTransf **theTransfs, int numTransfs, double *ub)
+{
+    for (int n = 0; n < numTransfs; n++)
+        if (theTransfs[n]->getClassTag() != CRDTR_TAG_LinearCrdTransf3d)
+            return this->CrdTransf::getBasicTrialDisps(theTransfs, numTransfs, ub);
+
+    for (int n = 0; n < numTransfs; n++) {
+        LinearCrdTransf3d *theTransf = (LinearCrdTransf3d *)theTransfs[n];
+        const Vector &ubn = theTransf->LinearCrdTransf3d::getBasicTrialDisp();
+        for (int k = 0; k < 6; k++)
+            ub[k*numTransfs + n] = ubn(k);
+    }
+
+    return 0;
+}
+
+
+int
+LinearCrdTransf3d::getGlobalStiffMatrices(CrdTransf **theTransfs, int numTransfs,
+                                          const double *kb, const double *pb, double *kg)
+{
+    for (int n = 0; n < numTransfs; n++)
+        if (theTransfs[n]->getClassTag() != CRDTR_TAG_LinearCrdTransf3d)
+            return this->CrdTransf::getGlobalStiffMatrices(theTransfs, numTransfs, kb, pb, kg);
+
+    double kbData[36], pbData[6];
+    Matrix kbn(kbData, 6, 6);
+    Vector pbn(pbData, 6);
+
+    for (int n = 0; n < numTransfs; n++) {
+        for (int i = 0; i < 36; i++)
+            kbData[i] = kb[i*numTransfs + n];
+        for (int i = 0; i < 6; i++)
+            pbData[i] = pb[i*numTransfs + n];
+
+        LinearCrdTransf3d *theTransf = (LinearCrdTransf3d *)theTransfs[n];
+        const Matrix &kgn = theTransf->LinearCrdTransf3d::getGlobalStiffMatrix(kbn, pbn);
+        for (int j = 0; j < 12; j++)
+            for (int i = 0; i < 12; i++)
+                kg[(j*12 + i)*numTransfs + n] = kgn(i,j);
+    }
+
+    return 0;
+}
+
+
 const Matrix &
 LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
+    static OPS_THREAD_LOCAL double kb[6][6];		// Basic stiffness
+    static OPS_THREAD_LOCAL double kl[12][12];	// Local stiffness
+    static OPS_THREAD_LOCAL double tmp[12][12];	// Temporary storage
     double oneOverL = 1.0/L;
     
     int i,j;
@@ -1013,7 +1067,7 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
             kl[11][i] =  tmp[2][i];
         }
         
-        static double RWI[3][3];
+        static OPS_THREAD_LOCAL double RWI[3][3];
         
         if (nodeIOffset) {
             // Compute RWI
@@ -1030,7 +1084,7 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
             RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
         }
         
-        static double RWJ[3][3];
+        static OPS_THREAD_LOCAL double RWJ[3][3];
         
         if (nodeJOffset) {
             // Compute RWJ
@@ -1123,7 +1177,7 @@ LinearCrdTransf3d::getCopy3d(void)
     
     LinearCrdTransf3d *theCopy;
     
-    static Vector xz(3);
+    static OPS_THREAD_LOCAL Vector xz(3);
     xz(0) = R[2][0];
     xz(1) = R[2][1];
     xz(2) = R[2][2];
@@ -1161,7 +1215,7 @@ LinearCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
     
-    static Vector data(23);
+    static OPS_THREAD_LOCAL Vector data(23);
     data(0) = this->getTag();
     data(1) = L;
     
@@ -1237,7 +1291,7 @@ LinearCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
 {
     int res = 0;
     
-    static Vector data(23);
+    static OPS_THREAD_LOCAL Vector data(23);
     
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -1322,7 +1376,7 @@ LinearCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 LinearCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    static OPS_THREAD_LOCAL Vector xg(3);
     
     //xg = nodeIPtr->getCrds() + nodeIOffset;
     xg = nodeIPtr->getCrds();
@@ -1357,7 +1411,7 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    static OPS_THREAD_LOCAL double ug[12];
     for (int i = 0; i < 6; i++)
     {
         ug[i]   = disp1(i);
@@ -1378,7 +1432,7 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     
     // transform global end displacements to local coordinates
     //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-    static double ul[12];
+    static OPS_THREAD_LOCAL double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -1387,7 +1441,7 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     ul[7]  = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
     ul[8]  = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
     
-    static double Wu[3];
+    static OPS_THREAD_LOCAL double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -1408,8 +1462,8 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // compute displacements at point xi, in local coordinates
-    static double uxl[3];
-    static Vector uxg(3);
+    static OPS_THREAD_LOCAL double uxl[3];
+    static OPS_THREAD_LOCAL Vector uxg(3);
     
     uxl[0] = uxb(0) +        ul[0];
     uxl[1] = uxb(1) + (1-xi)*ul[1] + xi*ul[7];
@@ -1454,7 +1508,7 @@ const Vector &
 LinearCrdTransf3d::getBasicDisplSensitivity(int gradNumber)
 {
   
-  static double ug[12];
+  static OPS_THREAD_LOCAL double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]   = nodeIPtr->getDispSensitivity((i+1),gradNumber);
     ug[i+6] = nodeJPtr->getDispSensitivity((i+1),gradNumber);
@@ -1462,9 +1516,9 @@ LinearCrdTransf3d::getBasicDisplSensitivity(int gradNumber)
 
 	double oneOverL = 1.0/L;
 
-	static Vector ub(6);
+	static OPS_THREAD_LOCAL Vector ub(6);
 
-	static double ul[12];
+	static OPS_THREAD_LOCAL double ul[12];
 
 	ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
 	ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -1482,7 +1536,7 @@ LinearCrdTransf3d::getBasicDisplSensitivity(int gradNumber)
 	ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
 	ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
 
-	static double Wu[3];
+	static OPS_THREAD_LOCAL double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
 		Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
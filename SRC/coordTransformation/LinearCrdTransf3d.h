@@ -61,6 +61,8 @@ public:
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+
+    bool isThreadSafe(void) {return true;}
     
     const Vector &getBasicTrialDisp(void);
     const Vector &getBasicIncrDisp(void);
@@ -71,6 +73,10 @@ public:
     const Vector &getGlobalResistingForce(const Vector &basicForce, const Vector &p0);
     const Matrix &getGlobalStiffMatrix(const Matrix &basicStiff, const Vector &basicForce);
     const Matrix &getInitialGlobalStiffMatrix(const Matrix &basicStiff);
+
+    int getBasicTrialDisps(CrdTransf **theTransfs, int numTransfs, double *ub);
+    int getGlobalStiffMatrices(CrdTransf **theTransfs, int numTransfs,
+                               const double *kb, const double *pb, double *kg);
     
     CrdTransf *getCopy3d(void);
     
@@ -103,8 +109,8 @@ private:
     double R[3][3];	 // rotation matrix
     double L;        // undeformed element length
 
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
+    static OPS_THREAD_LOCAL Matrix Tlg;  // matrix that transforms from global to local coordinates
+    static OPS_THREAD_LOCAL Matrix kg;   // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
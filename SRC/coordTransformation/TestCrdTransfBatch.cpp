@@ -0,0 +1,323 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file is a driver to time and check the batched state
+// determination of the 3d coordinate transformations. A model of
+// independent beams, each with its own two nodes, a random orientation
+// and a random symmetric basic stiffness, is taken through steps of
+// random nodal displacements of growing amplitude. At each step the basic
+// displacements and the global stiffness of all the beams are found once
+// transformation by transformation (update(), getBasicTrialDisp() and
+// getGlobalStiffMatrix()), as the elements do, and once for all of them
+// with getBasicTrialDisps() and getGlobalStiffMatrices(), on a second
+// set of transformations; the two are timed and compared, bit for bit
+// unless a relative tolerance is given. For the linear transformation
+// every third beam has rigid joint offsets.
+//
+// With -record the results of the transformation by transformation
+// calls are written to a file, with -check they are compared against
+// such a file, so the results of a change to a transformation can be
+// checked against those of the code before it.
+//
+// usage: testCrdTransfBatch transformation <-beams n> <-steps n>
+//          <-record file> <-check file> <-tol tol>
+//   transformation: Corotational or Linear
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Node.h>
+
+#include <CorotCrdTransf3d.h>
+#include <LinearCrdTransf3d.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+// a portable random number in [-1,1), so the model is the same everywhere
+static unsigned long long seed = 12345;
+
+static double
+random11(void)
+{
+  seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+  return (seed >> 11)*(2.0/9007199254740992.0) - 1.0;
+}
+
+// the values compared for each beam: 6 basic displacements and the
+// 12x12 global stiffness
+const int numValues = 6 + 144;
+
+static bool
+differ(double a, double b, double tol)
+{
+  double scale = (fabs(b) > 1.0) ? fabs(b) : 1.0;
+  return memcmp(&a, &b, sizeof(double)) != 0 && fabs(a - b) > tol*scale;
+}
+
+int
+main(int argc, char **argv)
+{
+  if (argc < 2) {
+    fprintf(stderr, "usage: testCrdTransfBatch transformation <-beams n> <-steps n>\n"
+	    "         <-record file> <-check file> <-tol tol>\n"
+	    "  transformation: Corotational or Linear\n");
+    return -1;
+  }
+
+  const char *transfName = argv[1];
+  int numBeams = 100000;
+  int numSteps = 5;
+  const char *recordFile = 0;
+  const char *checkFile = 0;
+  double tol = 0.0;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "-beams") == 0 && i+1 < argc)
+      numBeams = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-steps") == 0 && i+1 < argc)
+      numSteps = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-record") == 0 && i+1 < argc)
+      recordFile = argv[++i];
+    else if (strcmp(argv[i], "-check") == 0 && i+1 < argc)
+      checkFile = argv[++i];
+    else if (strcmp(argv[i], "-tol") == 0 && i+1 < argc)
+      tol = atof(argv[++i]);
+    else {
+      fprintf(stderr, "testCrdTransfBatch - unknown option %s\n", argv[i]);
+      return -1;
+    }
+  }
+
+  bool corot;
+  if (strcmp(transfName, "Corotational") == 0)
+    corot = true;
+  else if (strcmp(transfName, "Linear") == 0)
+    corot = false;
+  else {
+    fprintf(stderr, "testCrdTransfBatch - unknown transformation %s\n", transfName);
+    return -1;
+  }
+  if (numBeams <= 0 || numSteps <= 0)
+    return -1;
+
+  // the model
+  Node **theNodes = new Node *[2*numBeams];
+  CrdTransf **theTransfs = new CrdTransf *[numBeams];
+  CrdTransf **theBatch = new CrdTransf *[numBeams];
+  double *kbs = new double[36*numBeams];
+
+  Vector vecxz(3), offsetI(3), offsetJ(3);
+  for (int e = 0; e < numBeams; e++) {
+    double x = e, y = 0.3*random11(), z = 0.2*random11();
+    theNodes[2*e] = new Node(2*e+1, 6, x, y, z);
+    theNodes[2*e+1] = new Node(2*e+2, 6, x + 1.0 + 0.3*random11(),
+			       y + 0.5*random11(), z + 0.5*random11());
+    vecxz(0) = 0.1*random11();
+    vecxz(1) = 0.1*random11();
+    vecxz(2) = 1.0;
+    bool offsets = !corot && (e % 3 == 1);
+    for (int i = 0; i < 3; i++) {
+      offsetI(i) = 0.1*random11();
+      offsetJ(i) = 0.1*random11();
+    }
+
+    for (int c = 0; c < 2; c++) {
+      CrdTransf *theTransf;
+      if (corot)
+	theTransf = new CorotCrdTransf3d(e+1, vecxz, Vector(3), Vector(3));
+      else if (offsets)
+	theTransf = new LinearCrdTransf3d(e+1, vecxz, offsetI, offsetJ);
+      else
+	theTransf = new LinearCrdTransf3d(e+1, vecxz);
+      theTransf->initialize(theNodes[2*e], theNodes[2*e+1]);
+      if (c == 0)
+	theTransfs[e] = theTransf;
+      else
+	theBatch[e] = theTransf;
+    }
+
+    for (int j = 0; j < 6; j++)
+      for (int i = 0; i <= j; i++) {
+	double value = random11() + ((i == j) ? 10.0 : 0.0);
+	kbs[36*e + j*6+i] = value;
+	kbs[36*e + i*6+j] = value;
+      }
+  }
+
+  // the basic stiffness and force in the batched layout
+  double *kbBatch = new double[36*numBeams];
+  double *pbBatch = new double[6*numBeams];
+  double *ubBatch = new double[6*numBeams];
+  double *kgBatch = new double[144*numBeams];
+  for (int e = 0; e < numBeams; e++)
+    for (int i = 0; i < 36; i++)
+      kbBatch[i*numBeams + e] = kbs[36*e + i];
+
+  double *results = new double[numValues*numBeams];
+
+  FILE *record = 0;
+  if (recordFile != 0) {
+    record = fopen(recordFile, "w");
+    if (record == 0)
+      fprintf(stderr, "testCrdTransfBatch - could not open %s\n", recordFile);
+  }
+  FILE *check = 0;
+  if (checkFile != 0) {
+    check = fopen(checkFile, "r");
+    if (check == 0)
+      fprintf(stderr, "testCrdTransfBatch - could not open %s\n", checkFile);
+  }
+
+  Matrix kb(6,6);
+  Vector pb(6);
+  Vector disp(6);
+  double timeElement = 0.0;
+  double timeBatch = 0.0;
+  int numDiff = 0;
+  int numCheckDiff = 0;
+  int numChecked = 0;
+  int res = 0;
+
+  for (int s = 0; s < numSteps; s++) {
+    double amp = 0.02*(s+1);
+    for (int n = 0; n < 2*numBeams; n++) {
+      for (int i = 0; i < 6; i++)
+	disp(i) = amp*random11();
+      theNodes[n]->setTrialDisp(disp);
+    }
+    for (int i = 0; i < 6*numBeams; i++)
+      pbBatch[i] = 5.0*random11();
+
+    // transformation by transformation
+    clock_t start = clock();
+    for (int e = 0; e < numBeams; e++) {
+      for (int j = 0; j < 6; j++) {
+	pb(j) = pbBatch[j*numBeams + e];
+	for (int i = 0; i < 6; i++)
+	  kb(i,j) = kbs[36*e + j*6+i];
+      }
+      CrdTransf *theTransf = theTransfs[e];
+      theTransf->update();
+      const Vector &ub = theTransf->getBasicTrialDisp();
+      const Matrix &kg = theTransf->getGlobalStiffMatrix(kb, pb);
+
+      double *result = &results[numValues*e];
+      for (int i = 0; i < 6; i++)
+	result[i] = ub(i);
+      for (int j = 0; j < 12; j++)
+	for (int i = 0; i < 12; i++)
+	  result[6 + j*12+i] = kg(i,j);
+    }
+    timeElement += (double)(clock() - start)/CLOCKS_PER_SEC;
+
+    // all at once
+    start = clock();
+    if (theBatch[0]->getBasicTrialDisps(theBatch, numBeams, ubBatch) != 0)
+      res = -1;
+    theBatch[0]->getGlobalStiffMatrices(theBatch, numBeams, kbBatch, pbBatch, kgBatch);
+    timeBatch += (double)(clock() - start)/CLOCKS_PER_SEC;
+
+    for (int e = 0; e < numBeams; e++) {
+      double *result = &results[numValues*e];
+      for (int i = 0; i < 6; i++)
+	if (differ(ubBatch[i*numBeams + e], result[i], tol))
+	  numDiff++;
+      for (int i = 0; i < 144; i++)
+	if (differ(kgBatch[i*numBeams + e], result[6+i], tol))
+	  numDiff++;
+    }
+
+    if (record != 0)
+      for (int i = 0; i < numValues*numBeams; i++)
+	fprintf(record, "%.17g\n", results[i]);
+
+    if (check != 0) {
+      double value;
+      for (int i = 0; i < numValues*numBeams && fscanf(check, "%lf", &value) == 1; i++) {
+	numChecked++;
+	if (differ(results[i], value, tol))
+	  numCheckDiff++;
+      }
+    }
+
+    for (int n = 0; n < 2*numBeams; n++)
+      theNodes[n]->commitState();
+    for (int e = 0; e < numBeams; e++) {
+      theTransfs[e]->commitState();
+      theBatch[e]->commitState();
+    }
+  }
+
+  int size = numValues*numBeams*numSteps;
+  printf("%s: %d beams, %d steps, per element %.3f s, batched %.3f s, speedup %.2f\n",
+	 transfName, numBeams, numSteps, timeElement, timeBatch,
+	 (timeBatch > 0.0) ? timeElement/timeBatch : 0.0);
+  if (numDiff > 0) {
+    printf("%s: %d of %d batched values differ  FAILED\n", transfName, numDiff, size);
+    res = -1;
+  } else
+    printf("%s: %d batched values match  PASSED\n", transfName, size);
+
+  if (record != 0)
+    fclose(record);
+  else if (recordFile != 0)
+    res = -1;
+
+  if (check != 0) {
+    fclose(check);
+    if (numChecked < size) {
+      printf("%s: %s has %d values, %d expected  FAILED\n", transfName, checkFile, numChecked, size);
+      res = -1;
+    } else if (numCheckDiff > 0) {
+      printf("%s: %d of %d values differ from %s  FAILED\n", transfName, numCheckDiff, size, checkFile);
+      res = -1;
+    } else
+      printf("%s: %d values match %s  PASSED\n", transfName, size, checkFile);
+  } else if (checkFile != 0)
+    res = -1;
+
+  for (int e = 0; e < numBeams; e++) {
+    delete theTransfs[e];
+    delete theBatch[e];
+  }
+  for (int n = 0; n < 2*numBeams; n++)
+    delete theNodes[n];
+  delete [] theNodes;
+  delete [] theTransfs;
+  delete [] theBatch;
+  delete [] kbs;
+  delete [] kbBatch;
+  delete [] pbBatch;
+  delete [] ubBatch;
+  delete [] kgBatch;
+  delete [] results;
+
+  return res;
+}
@@ -0,0 +1,537 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// BinaryFileDatastore. Every checkpoint is a single file laid out as
+//
+//   header : char magic[8], int version, int commitTag, long long numBytes
+//   records: int type, int dbTag, int commitTag, int size, int numBytes, int pad
+//            followed by numBytes of data padded to a multiple of 8 bytes
+//
+// The in-memory image has exactly the same layout so it can be written with
+// a single fwrite() and a memory mapped file can be used as the image directly.
+//
+// What: "@(#) BinaryFileDatastore.C, revA"
+
+#include "BinaryFileDatastore.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <FEM_ObjectBroker.h>
+#include <Domain.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+#define BINARY_DATASTORE_ID      0
+#define BINARY_DATASTORE_VECTOR  1
+#define BINARY_DATASTORE_MATRIX  2
+
+#define BINARY_DATASTORE_VERSION 1
+
+static const char binaryDatastoreMagic[8] = {'O','P','S','C','K','P','T','\0'};
+
+typedef struct binaryFileDatastoreHeader {
+  char magic[8];
+  int version;
+  int commitTag;
+  long long numBytes;
+} BinaryFileDatastoreHeader;
+
+typedef struct binaryFileDatastoreRecord {
+  int type;
+  int dbTag;
+  int commitTag;
+  int size;
+  int numBytes;
+  int pad;
+} BinaryFileDatastoreRecord;
+
+// records are padded so that the data of every record is 8 byte aligned
+static inline long
+paddedSize(long numBytes)
+{
+  return (numBytes + 7) & ~7L;
+}
+
+
+BinaryFileDatastore::BinaryFileDatastore(const char *dataBaseName,
+					 Domain &theDomain,
+					 FEM_ObjectBroker &theObjBroker,
+					 bool useMMap)
+  :FE_Datastore(theDomain, theObjBroker),
+   useMemoryMap(useMMap), image(0), sizeImage(0), capacityImage(0),
+   mapped(false)
+{
+  dataBase = new char [strlen(dataBaseName)+1];
+  strcpy(dataBase, dataBaseName);
+
+#ifdef _WIN32
+  // memory mapping only provided on posix systems, fall back to a single read
+  useMemoryMap = false;
+#endif
+}
+
+BinaryFileDatastore::~BinaryFileDatastore()
+{
+  this->releaseImage();
+
+  if (dataBase != 0)
+    delete [] dataBase;
+}
+
+
+int
+BinaryFileDatastore::commitState(int commitTag)
+{
+  // the image is kept between commits; objects overwrite their records in
+  // place, records only sent when the domain changes are carried over
+  int result = FE_Datastore::commitState(commitTag);
+
+  if (result == commitTag) {
+    if (this->writeImage(commitTag) < 0) {
+      opserr << "BinaryFileDatastore::commitState() - failed to write checkpoint " << commitTag << endln;
+      result = -1;
+    }
+  }
+
+  return result;
+}
+
+
+int
+BinaryFileDatastore::restoreState(int commitTag)
+{
+  if (this->readImage(commitTag) < 0) {
+    opserr << "BinaryFileDatastore::restoreState() - failed to read checkpoint " << commitTag << endln;
+    return -1;
+  }
+
+  return FE_Datastore::restoreState(commitTag);
+}
+
+
+int
+BinaryFileDatastore::sendMsg(int dataTag, int commitTag,
+			     const Message &,
+			     ChannelAddress *theAddress)
+{
+  opserr << "BinaryFileDatastore::sendMsg() - not yet implemented\n";
+  return -1;
+}
+
+int
+BinaryFileDatastore::recvMsg(int dataTag, int commitTag,
+			     Message &,
+			     ChannelAddress *theAddress)
+{
+  opserr << "BinaryFileDatastore::recvMsg() - not yet implemented\n";
+  return -1;
+}
+
+int
+BinaryFileDatastore::recvMsgUnknownSize(int dataTag, int commitTag,
+					Message &,
+					ChannelAddress *theAddress)
+{
+  opserr << "BinaryFileDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}
+
+
+int
+BinaryFileDatastore::sendMatrix(int dataTag, int commitTag,
+				const Matrix &theMatrix,
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.numRows * theMatrix.numCols;
+  return this->sendData(BINARY_DATASTORE_MATRIX, dataTag, commitTag,
+			(const char *)theMatrix.data, size, size*sizeof(double));
+}
+
+int
+BinaryFileDatastore::recvMatrix(int dataTag, int commitTag,
+				Matrix &theMatrix,
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.numRows * theMatrix.numCols;
+  return this->recvData(BINARY_DATASTORE_MATRIX, dataTag, commitTag,
+			(char *)theMatrix.data, size, size*sizeof(double));
+}
+
+
+int
+BinaryFileDatastore::sendVector(int dataTag, int commitTag,
+				const Vector &theVector,
+				ChannelAddress *theAddress)
+{
+  return this->sendData(BINARY_DATASTORE_VECTOR, dataTag, commitTag,
+			(const char *)theVector.theData, theVector.sz, theVector.sz*sizeof(double));
+}
+
+int
+BinaryFileDatastore::recvVector(int dataTag, int commitTag,
+				Vector &theVector,
+				ChannelAddress *theAddress)
+{
+  return this->recvData(BINARY_DATASTORE_VECTOR, dataTag, commitTag,
+			(char *)theVector.theData, theVector.sz, theVector.sz*sizeof(double));
+}
+
+
+int
+BinaryFileDatastore::sendID(int dataTag, int commitTag,
+			    const ID &theID,
+			    ChannelAddress *theAddress)
+{
+  return this->sendData(BINARY_DATASTORE_ID, dataTag, commitTag,
+			(const char *)theID.data, theID.sz, theID.sz*sizeof(int));
+}
+
+int
+BinaryFileDatastore::recvID(int dataTag, int commitTag,
+			    ID &theID,
+			    ChannelAddress *theAddress)
+{
+  return this->recvData(BINARY_DATASTORE_ID, dataTag, commitTag,
+			(char *)theID.data, theID.sz, theID.sz*sizeof(int));
+}
+
+
+int
+BinaryFileDatastore::sendData(int type, int dbTag, int commitTag,
+			      const char *theData, int size, int numBytes)
+{
+  BinaryFileDatastoreKey key;
+  key.type = type;
+  key.dbTag = dbTag;
+  key.size = size;
+
+  BinaryFileDatastoreRecord header;
+  header.type = type;
+  header.dbTag = dbTag;
+  header.commitTag = commitTag;
+  header.size = size;
+  header.numBytes = numBytes;
+  header.pad = 0;
+
+  // if the object has been sent before, overwrite its record in place
+  MAP_RECORDS_ITERATOR theRecord = theRecords.find(key);
+  if (theRecord != theRecords.end()) {
+    long pos = theRecord->second;
+    BinaryFileDatastoreRecord oldHeader;
+    memcpy(&oldHeader, &image[pos], sizeof(BinaryFileDatastoreRecord));
+    if (oldHeader.numBytes != numBytes) {
+      opserr << "BinaryFileDatastore::sendData() - size mismatch for dbTag " << dbTag << endln;
+      return -1;
+    }
+    memcpy(&image[pos], &header, sizeof(BinaryFileDatastoreRecord));
+    if (numBytes != 0)
+      memcpy(&image[pos + sizeof(BinaryFileDatastoreRecord)], theData, numBytes);
+    return 0;
+  }
+
+  if (image == 0)
+    sizeImage = sizeof(BinaryFileDatastoreHeader);
+
+  long pos = sizeImage;
+  long recordSize = sizeof(BinaryFileDatastoreRecord) + paddedSize(numBytes);
+  if (pos + recordSize > capacityImage || mapped == true) {
+    if (this->resizeImage(pos + recordSize) < 0) {
+      opserr << "BinaryFileDatastore::sendData() - out of memory\n";
+      return -1;
+    }
+  }
+
+  memcpy(&image[pos], &header, sizeof(BinaryFileDatastoreRecord));
+  if (numBytes != 0)
+    memcpy(&image[pos + sizeof(BinaryFileDatastoreRecord)], theData, numBytes);
+
+  sizeImage += recordSize;
+  theRecords.insert(MAP_RECORDS_TYPE(key, pos));
+
+  return 0;
+}
+
+
+int
+BinaryFileDatastore::recvData(int type, int dbTag, int commitTag,
+			      char *theData, int size, int numBytes)
+{
+  BinaryFileDatastoreKey key;
+  key.type = type;
+  key.dbTag = dbTag;
+  key.size = size;
+
+  MAP_RECORDS_ITERATOR theRecord = theRecords.find(key);
+  if (theRecord == theRecords.end()) {
+    opserr << "BinaryFileDatastore::recvData() - no data with dbTag " << dbTag;
+    opserr << " and size " << size << endln;
+    return -1;
+  }
+
+  BinaryFileDatastoreRecord header;
+  memcpy(&header, &image[theRecord->second], sizeof(BinaryFileDatastoreRecord));
+  if (header.commitTag != commitTag) {
+    opserr << "BinaryFileDatastore::recvData() - no data with dbTag " << dbTag;
+    opserr << " for commitTag " << commitTag << endln;
+    return -1;
+  }
+  if (header.numBytes != numBytes) {
+    opserr << "BinaryFileDatastore::recvData() - size mismatch for dbTag " << dbTag << endln;
+    return -1;
+  }
+
+  if (numBytes != 0)
+    memcpy(theData, &image[theRecord->second + sizeof(BinaryFileDatastoreRecord)], numBytes);
+
+  return 0;
+}
+
+
+int
+BinaryFileDatastore::resizeImage(long newSize)
+{
+  long newCapacity = (capacityImage > 0) ? capacityImage : 1048576;
+  while (newCapacity < newSize)
+    newCapacity *= 2;
+
+  char *newImage = 0;
+  if (mapped == true) {
+    // a mapped checkpoint is copied into memory we own before it can grow
+    newImage = (char *)malloc(newCapacity);
+    if (newImage == 0)
+      return -1;
+    memcpy(newImage, image, sizeImage);
+#ifndef _WIN32
+    munmap(image, capacityImage);
+#endif
+    mapped = false;
+  } else {
+    newImage = (char *)realloc(image, newCapacity);
+    if (newImage == 0)
+      return -1;
+  }
+
+  image = newImage;
+  capacityImage = newCapacity;
+
+  return 0;
+}
+
+
+void
+BinaryFileDatastore::releaseImage(void)
+{
+  if (image != 0) {
+#ifndef _WIN32
+    if (mapped == true)
+      munmap(image, capacityImage);
+    else
+#endif
+      free(image);
+  }
+
+  image = 0;
+  sizeImage = 0;
+  capacityImage = 0;
+  mapped = false;
+  theRecords.clear();
+}
+
+
+char *
+BinaryFileDatastore::getFileName(int commitTag)
+{
+  char *fileName = new char[strlen(dataBase)+32];
+  sprintf(fileName, "%s.%d.bin", dataBase, commitTag);
+  return fileName;
+}
+
+
+int
+BinaryFileDatastore::writeImage(int commitTag)
+{
+  if (image == 0)
+    return 0;
+
+  char *fileName = this->getFileName(commitTag);
+  char *tmpName = new char[strlen(fileName)+5];
+  strcpy(tmpName, fileName);
+  strcat(tmpName, ".tmp");
+
+  BinaryFileDatastoreHeader header;
+  memcpy(header.magic, binaryDatastoreMagic, 8);
+  header.version = BINARY_DATASTORE_VERSION;
+  header.commitTag = commitTag;
+  header.numBytes = sizeImage - sizeof(BinaryFileDatastoreHeader);
+  memcpy(image, &header, sizeof(BinaryFileDatastoreHeader));
+
+  int res = 0;
+  FILE *theFile = fopen(tmpName, "wb");
+  if (theFile == 0) {
+    opserr << "BinaryFileDatastore::writeImage() - could not open file " << tmpName << endln;
+    res = -1;
+  } else {
+    if (fwrite(image, sizeImage, 1, theFile) != 1)
+      res = -1;
+    if (fflush(theFile) != 0)
+      res = -1;
+#ifndef _WIN32
+    if (res == 0)
+      fsync(fileno(theFile));
+#endif
+    fclose(theFile);
+
+    if (res != 0)
+      opserr << "BinaryFileDatastore::writeImage() - error writing to file " << tmpName << endln;
+  }
+
+  // only replace the previous checkpoint once the new one is complete
+  if (res == 0) {
+    remove(fileName);
+    if (rename(tmpName, fileName) != 0) {
+      opserr << "BinaryFileDatastore::writeImage() - could not rename " << tmpName << endln;
+      res = -1;
+    }
+  }
+
+  delete [] tmpName;
+  delete [] fileName;
+
+  return res;
+}
+
+
+int
+BinaryFileDatastore::readImage(int commitTag)
+{
+  this->releaseImage();
+
+  char *fileName = this->getFileName(commitTag);
+
+#ifndef _WIN32
+  if (useMemoryMap == true) {
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) {
+      opserr << "BinaryFileDatastore::readImage() - could not open file " << fileName << endln;
+      delete [] fileName;
+      return -1;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < (off_t)sizeof(BinaryFileDatastoreHeader)) {
+      opserr << "BinaryFileDatastore::readImage() - file too small " << fileName << endln;
+      close(fd);
+      delete [] fileName;
+      return -1;
+    }
+    // private writable mapping; records overwritten by later commits are copy on write
+    void *theMap = mmap(0, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (theMap == MAP_FAILED) {
+      opserr << "BinaryFileDatastore::readImage() - could not map file " << fileName << endln;
+      delete [] fileName;
+      return -1;
+    }
+    image = (char *)theMap;
+    mapped = true;
+    sizeImage = fileStat.st_size;
+    capacityImage = fileStat.st_size;
+  } else
+#endif
+  {
+    FILE *theFile = fopen(fileName, "rb");
+    if (theFile == 0) {
+      opserr << "BinaryFileDatastore::readImage() - could not open file " << fileName << endln;
+      delete [] fileName;
+      return -1;
+    }
+    BinaryFileDatastoreHeader header;
+    if (fread(&header, sizeof(BinaryFileDatastoreHeader), 1, theFile) != 1 || header.numBytes < 0) {
+      opserr << "BinaryFileDatastore::readImage() - could not read header " << fileName << endln;
+      fclose(theFile);
+      delete [] fileName;
+      return -1;
+    }
+    long fileSize = sizeof(BinaryFileDatastoreHeader) + (long)header.numBytes;
+    if (this->resizeImage(fileSize) < 0) {
+      opserr << "BinaryFileDatastore::readImage() - out of memory\n";
+      fclose(theFile);
+      delete [] fileName;
+      return -1;
+    }
+    memcpy(image, &header, sizeof(BinaryFileDatastoreHeader));
+    if (header.numBytes > 0 &&
+	fread(&image[sizeof(BinaryFileDatastoreHeader)], (size_t)header.numBytes, 1, theFile) != 1) {
+      opserr << "BinaryFileDatastore::readImage() - truncated file " << fileName << endln;
+      fclose(theFile);
+      delete [] fileName;
+      this->releaseImage();
+      return -1;
+    }
+    fclose(theFile);
+    sizeImage = fileSize;
+  }
+
+  delete [] fileName;
+
+  BinaryFileDatastoreHeader header;
+  memcpy(&header, image, sizeof(BinaryFileDatastoreHeader));
+  if (memcmp(header.magic, binaryDatastoreMagic, 8) != 0 ||
+      header.version != BINARY_DATASTORE_VERSION ||
+      header.commitTag != commitTag ||
+      (long)header.numBytes != sizeImage - (long)sizeof(BinaryFileDatastoreHeader)) {
+    opserr << "BinaryFileDatastore::readImage() - invalid checkpoint file for commitTag " << commitTag << endln;
+    this->releaseImage();
+    return -1;
+  }
+
+  // build the index
+  long offset = sizeof(BinaryFileDatastoreHeader);
+  while (offset + (long)sizeof(BinaryFileDatastoreRecord) <= sizeImage) {
+    BinaryFileDatastoreRecord record;
+    memcpy(&record, &image[offset], sizeof(BinaryFileDatastoreRecord));
+
+    BinaryFileDatastoreKey key;
+    key.type = record.type;
+    key.dbTag = record.dbTag;
+    key.size = record.size;
+    theRecords.insert(MAP_RECORDS_TYPE(key, offset));
+
+    offset += sizeof(BinaryFileDatastoreRecord) + paddedSize(record.numBytes);
+  }
+
+  if (offset != sizeImage) {
+    opserr << "BinaryFileDatastore::readImage() - corrupt checkpoint file for commitTag " << commitTag << endln;
+    this->releaseImage();
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef BinaryFileDatastore_h
+#define BinaryFileDatastore_h
+
+// Description: This file contains the class definition for BinaryFileDatastore.
+// BinaryFileDatastore is a concrete subclass of FE_Datastore intended for
+// periodic checkpoints of long running analyses. Unlike FileDatastore, which
+// keeps one fstream per data type and size and searches it for every record,
+// all the ID, Vector and Matrix records are kept in a single memory image,
+// indexed on type, dbTag and size, which is written to one binary file
+// (dataBase.commitTag.bin) in a single write. Records are overwritten in place
+// on later commits so the model data the Domain only sends when its geometry
+// changes stays in every checkpoint. The file is first written to a temporary
+// name and then renamed, so an interrupted checkpoint never overwrites the
+// last good one. On restoreState() the file is read (or memory mapped) in one go.
+//
+// What: "@(#) BinaryFileDatastore.h, revA"
+
+#include <FE_Datastore.h>
+#include <map>
+
+class FEM_ObjectBroker;
+
+// key identifying a record in a checkpoint image; the commitTag is
+// stored with the record and checked on a recv
+typedef struct binaryFileDatastoreKey {
+  int type;       // 0 = ID, 1 = Vector, 2 = Matrix
+  int dbTag;
+  int size;
+  bool operator<(const struct binaryFileDatastoreKey &other) const {
+    if (type != other.type) return type < other.type;
+    if (dbTag != other.dbTag) return dbTag < other.dbTag;
+    return size < other.size;
+  }
+} BinaryFileDatastoreKey;
+
+typedef std::map<BinaryFileDatastoreKey, long>   MAP_RECORDS;
+typedef MAP_RECORDS::value_type                  MAP_RECORDS_TYPE;
+typedef MAP_RECORDS::iterator                    MAP_RECORDS_ITERATOR;
+
+class BinaryFileDatastore: public FE_Datastore
+{
+  public:
+    BinaryFileDatastore(const char *dataBase,
+			Domain &theDomain,
+			FEM_ObjectBroker &theBroker,
+			bool useMemoryMap = false);
+
+    ~BinaryFileDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag,
+		const Message &,
+		ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+		Message &,
+		ChannelAddress *theAddress =0);
+    int recvMsgUnknownSize(int dbTag, int commitTag,
+		Message &,
+		ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+		   const Matrix &theMatrix,
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+		   Matrix &theMatrix,
+		   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+		   Vector &theVector,
+		   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    // the commitState and restoreState methods
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
+  protected:
+
+  private:
+    // Private methods
+    int sendData(int type, int dbTag, int commitTag, const char *theData, int size, int numBytes);
+    int recvData(int type, int dbTag, int commitTag, char *theData, int size, int numBytes);
+    int resizeImage(long newSize);
+    int writeImage(int commitTag);
+    int readImage(int commitTag);
+    void releaseImage(void);
+    char *getFileName(int commitTag);
+
+    // private attributes
+    char *dataBase;
+    bool useMemoryMap;
+
+    char *image;           // the checkpoint image (file header + records)
+    long sizeImage;        // number of bytes in use in image
+    long capacityImage;    // number of bytes allocated or mapped for image
+    bool mapped;           // true if image is a memory mapped file
+
+    MAP_RECORDS theRecords;
+};
+
+
+#endif
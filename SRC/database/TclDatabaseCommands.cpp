@@ -46,6 +46,7 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <BinaryFileDatastore.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -96,7 +97,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
 
   // make sure at least one other argument to contain integrator
   if (argc < 2) {
-    opserr << "WARNING need to specify a Database type; valid type File, MySQL, BerkeleyDB \n";
+    opserr << "WARNING need to specify a Database type; valid type File, BinaryFile, MySQL, BerkeleyDB \n";
     return TCL_ERROR;
   }    
 
@@ -123,6 +124,28 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
       return TCL_ERROR;
     } 
     
+    return TCL_OK;
+  } else if (strcmp(argv[1],"BinaryFile") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING database BinaryFile fileName? <-mmap>";
+      return TCL_ERROR;
+    }    
+
+    bool useMemoryMap = false;
+    if (argc > 3 && strcmp(argv[3],"-mmap") == 0)
+      useMemoryMap = true;
+
+    // delete the old database
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    theDatabase = new BinaryFileDatastore(argv[2], theDomain, theBroker, useMemoryMap);
+    // check we instantiated a database .. if not ran out of memory
+    if (theDatabase == 0) {
+      opserr << "WARNING ran out of memory - database BinaryFile " << argv[2] << endln;
+      return TCL_ERROR;
+    } 
+    
     return TCL_OK;
   } else {
 
@@ -33,6 +33,7 @@
  //Modified by Liming Jiang [http://openseesforfire.github.io]
 
 #include <PathTimeSeriesThermal.h>
+#include <TemperatureStore.h>
 #include <Vector.h>
 #include <Matrix.h>
 #include <Channel.h>
@@ -47,7 +48,8 @@ using std::ios;
 PathTimeSeriesThermal::PathTimeSeriesThermal()	
   :TimeSeries(TSERIES_TAG_PathTimeSeriesThermal),CurrentFactors(0),
    thePath(0), time(0), currentTimeLoc(0),numCols(0),numRows(0), 
-   cFactor(0.0), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), TempOut(true)
+   cFactor(0.0), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), TempOut(true),
+   theStore(0), maxWait(0.0)
 {
   // does nothing
 }
@@ -59,13 +61,33 @@ PathTimeSeriesThermal::PathTimeSeriesThermal(int tag,
 			       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeriesThermal),CurrentFactors(0),
    thePath(0), time(0), currentTimeLoc(0), numCols(DataNum),numRows(0), 
-   cFactor(theFactor), dbTag1(0), dbTag2(0), lastChannel(0), TempOut(tempOut)
+   cFactor(theFactor), dbTag1(0), dbTag2(0), lastChannel(0), TempOut(tempOut),
+   theStore(0), maxWait(0.0)
 {
+  // the data may come directly from a heat transfer recorder, through a store
+  // registered under fileName or a store file written by another process
+  theStore = OPS_getTemperatureStore(fileName);
+  if (theStore == 0) {
+    theStore = TemperatureStore::openFile(fileName);
+    if (theStore != 0) {
+      OPS_addTemperatureStore(theStore);
+      maxWait = 60.0;
+    }
+  }
 
+  if (theStore != 0) {
+    theStore->attach();
+    if (theStore->getNumCols() != numCols) {
+      opserr << "WARNING - PathTimeSeriesThermal::PathTimeSeriesThermal()";
+      opserr << " - " << fileName << " holds " << theStore->getNumCols() << " columns, " << numCols << " expected\n";
+    }
+    CurrentFactors = new Vector(numCols);
+    this->updateFromStore(0.0);
+    return;
+  }
 
   // determine the number of data points
   int numDataPoints = 0;
-  int numRows = 0;
   double dataPoint;
 
   
@@ -153,7 +175,8 @@ PathTimeSeriesThermal::PathTimeSeriesThermal(int tag,
                                              double theFactor)
 :TimeSeries(tag, TSERIES_TAG_PathTimeSeriesThermal),CurrentFactors(0),
 thePath(0), time(0), currentTimeLoc(0),
-cFactor(theFactor), dbTag1(0), dbTag2(0), lastChannel(0), TempOut(tempOut)
+cFactor(theFactor), dbTag1(0), dbTag2(0), lastChannel(0), TempOut(tempOut),
+theStore(0), maxWait(0.0)
 {
   
   numRows = 1;
@@ -202,22 +225,92 @@ PathTimeSeriesThermal::~PathTimeSeriesThermal()
     delete thePath;
   if (time != 0)
     delete time;
+  if (CurrentFactors != 0)
+    delete CurrentFactors;
+  if (theStore != 0)
+    theStore->detach();
 }
 
 
+// make room for rows data points; thePath and time are grown geometrically
+// and only their first numRows rows are in use
 int
-PathTimeSeriesThermal::WriteResults(double currentTime, const Vector& newData)
+PathTimeSeriesThermal::growPath(int rows)
 {
-  numRows++;
- 
-  Vector BuffTime = *time;
-  time->resize(numRows);
-  for(int i=0;i<numRows;i++){
-	  if(i<numRows-1)
-		  (*time)(i)=BuffTime(i);
-	  else
-		  (*time)(i)= currentTime;
+  if (thePath != 0 && time != 0 && time->Size() >= rows)
+    return 0;
+
+  int capacity = (time != 0) ? 2*time->Size() : 16;
+  if (capacity < rows)
+    capacity = rows;
+
+  Matrix *newPath = new Matrix(capacity, numCols);
+  Vector *newTime = new Vector(capacity);
+  if (newPath == 0 || newPath->noRows() == 0 || newTime == 0 || newTime->Size() == 0) {
+    opserr << "WARNING PathTimeSeriesThermal::growPath() - out of memory\n";
+    return -1;
   }
+
+  for (int i=0; i<numRows; i++) {
+    (*newTime)(i) = (*time)(i);
+    for (int j=0; j<numCols; j++)
+      (*newPath)(i,j) = (*thePath)(i,j);
+  }
+
+  if (thePath != 0)
+    delete thePath;
+  if (time != 0)
+    delete time;
+  thePath = newPath;
+  time = newTime;
+
+  return 0;
+}
+
+
+// copy the rows the store has received since the last call; when the store
+// is a file still being written and pseudoTime is past its last row, wait
+// for the producer first
+int
+PathTimeSeriesThermal::updateFromStore(double pseudoTime)
+{
+  int storeRows = theStore->getNumRows();
+  if (theStore->isReader() == true && maxWait > 0.0 && theStore->isFinished() == false &&
+      (storeRows == 0 || pseudoTime > theStore->getTime(storeRows-1))) {
+    storeRows = theStore->waitForTime(pseudoTime, maxWait);
+    if (theStore->isFinished() == false &&
+	(storeRows == 0 || pseudoTime > theStore->getTime(storeRows-1))) {
+      opserr << "WARNING PathTimeSeriesThermal::getFactors() - no data from " << theStore->getName()
+	     << " for time " << pseudoTime << ", no longer waiting for it\n";
+      maxWait = 0.0;
+    }
+  } else
+    storeRows = theStore->refresh();
+
+  if (storeRows <= numRows)
+    return 0;
+
+  if (this->growPath(storeRows) < 0)
+    return -1;
+
+  int storeCols = theStore->getNumCols();
+  for (int i=numRows; i<storeRows; i++) {
+    const double *row = theStore->getRow(i);
+    (*time)(i) = theStore->getTime(i);
+    for (int j=0; j<numCols; j++) {
+      double value = (j < storeCols) ? row[j] : 0.0;
+      (*thePath)(i,j) = TempOut ? value-20 : value;
+    }
+  }
+  numRows = storeRows;
+
+  return 0;
+}
+
+
+int
+PathTimeSeriesThermal::WriteResults(double currentTime, const Vector& newData)
+{
 #ifdef _DEBUG
  // opserr<<"PathTimeSeries   "<<newData<<endln;
 #endif
@@ -225,18 +318,64 @@ PathTimeSeriesThermal::WriteResults(double currentTime, const Vector& newData)
     opserr<<"WARNING::PathTimeSeriesThermal recieved incompatible data when attempring to write the results"<<endln;
     return -1;
   }
+
+  if (this->growPath(numRows+1) < 0)
+    return -1;
+
+  (*time)(numRows) = currentTime;
+  for (int i =0; i<numCols; i++)
+    (*thePath)(numRows, i) = newData(i);
+  numRows++;
   
-  Matrix BuffPath = (*thePath);
-  thePath->resize(numRows,numCols);
-  for(int j=0; j<numRows;j++){
-	for (int i =0; i<numCols; i++) {
-		if(j<numRows-1)
-			(*thePath)(j, i) = BuffPath(j,i);
-		else 
-			(*thePath)(j, i) = newData(i);
-	}
+  return 0;
+}
+
+
+const Vector *
+PathTimeSeriesThermal::getTimes(void)
+{
+  // drop the unused capacity before handing the data out
+  if (time != 0 && time->Size() != numRows && numRows > 0) {
+    Vector *newTime = new Vector(numRows);
+    for (int i=0; i<numRows; i++)
+      (*newTime)(i) = (*time)(i);
+    delete time;
+    time = newTime;
   }
-  
+
+  return time;
+}
+
+
+const Matrix *
+PathTimeSeriesThermal::getPath(void)
+{
+  if (thePath != 0 && thePath->noRows() != numRows && numRows > 0) {
+    Matrix *newPath = new Matrix(numRows, numCols);
+    for (int i=0; i<numRows; i++)
+      for (int j=0; j<numCols; j++)
+	(*newPath)(i,j) = (*thePath)(i,j);
+    delete thePath;
+    thePath = newPath;
+  }
+
+  return thePath;
+}
+
+
+int
+PathTimeSeriesThermal::setResults(const Vector& times, const Matrix& path)
+{
+  if (path.noCols() != numCols || path.noRows() != times.Size() || times.Size() == 0) {
+    opserr<<"WARNING::PathTimeSeriesThermal::setResults recieved incompatible data"<<endln;
+    return -1;
+  }
+
+  numRows = times.Size();
+  *time = times;
+  *thePath = path;
+  currentTimeLoc = 0;
+
   return 0;
 }
 
@@ -258,9 +397,16 @@ PathTimeSeriesThermal::getTimeIncr (double pseudoTime)
 const Vector&
 PathTimeSeriesThermal::getFactors(double pseudoTime)
 {
+  if (theStore != 0)
+    this->updateFromStore(pseudoTime);
+
   // check for a quick return
-  if (thePath == 0)
-    return 0.0;
+  if (thePath == 0 || numRows == 0) {
+    if (CurrentFactors == 0)
+      CurrentFactors = new Vector(numCols);
+    CurrentFactors->Zero();
+    return *CurrentFactors;
+  }
 
   //opserr<<"PathTimeSeries Tag"<<this->getTag()<<endln;
   // determine indexes into the data array whose boundary holds the time
@@ -273,7 +419,7 @@ PathTimeSeriesThermal::getFactors(double pseudoTime)
 	  return *CurrentFactors;
   }
 
-  int size = time->Size();
+  int size = numRows;
   int sizem1 = size - 1;
   int sizem2 = size - 2;
   
@@ -341,7 +487,13 @@ PathTimeSeriesThermal::getDuration()
 	return 0.0;
   }
 
-  int lastIndex = time->Size(); // index to last entry in time vector
+  if (theStore != 0)
+    this->updateFromStore(0.0);
+
+  if (numRows == 0)
+    return 0.0;
+
+  int lastIndex = numRows; // index to last entry in time vector
   return ((*time)[lastIndex-1]);
 }
 
@@ -367,7 +519,7 @@ PathTimeSeriesThermal::sendSelf(int commitTag, Channel &theChannel)
   data(1) = -1;
   
   if (thePath != 0) {
-	  int size = thePath->noRows();
+	  int size = numRows;
     data(1) = size;
     if (dbTag1 == 0) {
       dbTag1 = theChannel.getDbTag();
@@ -481,7 +633,7 @@ PathTimeSeriesThermal::Print(OPS_Stream &s, int flag)
 {
     s << "Path Time Series: constant factor: " << cFactor;
     if (flag == 1 && thePath != 0) {
-      s << " specified path: " << *thePath;
-      s << " specified time: " << *time;
+      s << " specified path: " << *this->getPath();
+      s << " specified time: " << *this->getTimes();
     }
 }
@@ -38,10 +38,15 @@
 //
 // What: "@(#) PathTimeSeriesThermal.h, revA"
 //Modified by Liming for multi-column path timeseiries input.
+// The data may also be taken from a TemperatureStore, either one registered
+// under the name given in place of fileName or a binary store file; the rows
+// the store receives while the series is in use are picked up.
 
 #include <TimeSeries.h>
 
 class Vector;
+class Matrix;
+class TemperatureStore;
 
 class PathTimeSeriesThermal : public TimeSeries
 {
@@ -64,6 +69,12 @@ class PathTimeSeriesThermal : public TimeSeries
   
    int WriteResults(double currentTime, const Vector& newData);
 
+   // all the data points at once, e.g. to move results obtained in
+   // another process into this series
+   const Vector *getTimes(void);
+   const Matrix *getPath(void);
+   int setResults(const Vector& times, const Matrix& path);
+
     // method to get factor
     const Vector& getFactors(double pseudoTime);
 	  double getFactor(double pseudoTime) {return 0;};
@@ -81,6 +92,9 @@ class PathTimeSeriesThermal : public TimeSeries
   protected:
     
   private:
+    int growPath(int rows);
+    int updateFromStore(double pseudoTime);
+
 	int numCols;
 	int numRows;
     Matrix *thePath;      // vector containg the data points
@@ -92,6 +106,9 @@ class PathTimeSeriesThermal : public TimeSeries
     int lastSendCommitTag;
 	int TempOut;
 
+    TemperatureStore *theStore;  // store the data is taken from, or 0
+    double maxWait;              // time to wait for a store file to catch up
+
     Channel *lastChannel;
 };
 
@@ -0,0 +1,422 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for TemperatureStore.
+//
+// The file written for a store is a 32 byte header followed by the rows:
+//   char magic[8] "OPSTEMP1", int numCols, int finished, long long numRows,
+//   8 bytes unused, then numRows*(numCols+1) doubles.
+// The rows are written before the row count in the header is updated, so a
+// reader never sees a row which is not completely in the file.
+//
+// What: "@(#) TemperatureStore.cpp, revA"
+
+#include <TemperatureStore.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define TEMPERATURESTORE_HEADER_SIZE 32
+
+static const char temperatureStoreMagic[8] = {'O','P','S','T','E','M','P','1'};
+
+typedef struct temperatureStoreHeader {
+  char magic[8];
+  int numCols;
+  int finished;
+  long long numRows;
+  long long unused;
+} TemperatureStoreHeader;
+
+static std::map<std::string, TemperatureStore *> theTemperatureStores;
+
+int
+OPS_addTemperatureStore(TemperatureStore *theStore)
+{
+  if (theStore == 0)
+    return -1;
+
+  std::string key(theStore->getName());
+  if (theTemperatureStores.find(key) != theTemperatureStores.end()) {
+    opserr << "WARNING OPS_addTemperatureStore() - a store named " << theStore->getName() << " already exists\n";
+    return -1;
+  }
+
+  theStore->attach();
+  theTemperatureStores[key] = theStore;
+  return 0;
+}
+
+TemperatureStore *
+OPS_getTemperatureStore(const char *name)
+{
+  if (name == 0)
+    return 0;
+
+  std::map<std::string, TemperatureStore *>::iterator it = theTemperatureStores.find(std::string(name));
+  if (it == theTemperatureStores.end())
+    return 0;
+
+  return it->second;
+}
+
+int
+OPS_removeTemperatureStore(const char *name)
+{
+  if (name == 0)
+    return -1;
+
+  std::map<std::string, TemperatureStore *>::iterator it = theTemperatureStores.find(std::string(name));
+  if (it == theTemperatureStores.end())
+    return -1;
+
+  TemperatureStore *theStore = it->second;
+  theTemperatureStores.erase(it);
+  theStore->detach();
+  return 0;
+}
+
+void
+OPS_clearAllTemperatureStores(void)
+{
+  std::map<std::string, TemperatureStore *> theStores;
+  theStores.swap(theTemperatureStores);
+
+  std::map<std::string, TemperatureStore *>::iterator it;
+  for (it = theStores.begin(); it != theStores.end(); ++it)
+    it->second->detach();
+}
+
+
+TemperatureStore::TemperatureStore(const char *theName, int nCols, const char *theFileName)
+  :name(0), numCols(nCols), numRows(0), finished(false), reader(false), numRefs(0),
+   data(0), fileName(0), theFile(0), fd(-1), theMap(0), sizeMap(0)
+{
+  name = new char[strlen(theName)+1];
+  strcpy(name, theName);
+
+  if (numCols < 1) {
+    opserr << "WARNING TemperatureStore::TemperatureStore() - " << name << " has no columns\n";
+    numCols = 1;
+  }
+
+  if (theFileName != 0) {
+    fileName = new char[strlen(theFileName)+1];
+    strcpy(fileName, theFileName);
+
+    theFile = fopen(fileName, "wb");
+    if (theFile == 0) {
+      opserr << "WARNING TemperatureStore::TemperatureStore() - could not open file " << fileName << endln;
+    } else if (this->writeHeader() != 0) {
+      fclose(theFile);
+      theFile = 0;
+    }
+  }
+}
+
+
+TemperatureStore::TemperatureStore(const char *theName, int nCols, bool isReader)
+  :name(0), numCols(nCols), numRows(0), finished(false), reader(isReader), numRefs(0),
+   data(0), fileName(0), theFile(0), fd(-1), theMap(0), sizeMap(0)
+{
+  name = new char[strlen(theName)+1];
+  strcpy(name, theName);
+  fileName = new char[strlen(theName)+1];
+  strcpy(fileName, theName);
+}
+
+
+TemperatureStore::~TemperatureStore()
+{
+  if (reader == false)
+    this->finish();
+
+  this->releaseFile();
+
+  if (theFile != 0)
+    fclose(theFile);
+
+  if (name != 0)
+    delete [] name;
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+
+TemperatureStore *
+TemperatureStore::openFile(const char *theFileName)
+{
+  FILE *theInput = fopen(theFileName, "rb");
+  if (theInput == 0)
+    return 0;
+
+  TemperatureStoreHeader header;
+  size_t numRead = fread(&header, TEMPERATURESTORE_HEADER_SIZE, 1, theInput);
+  fclose(theInput);
+
+  if (numRead != 1 || memcmp(header.magic, temperatureStoreMagic, 8) != 0 || header.numCols < 1)
+    return 0;
+
+  TemperatureStore *theStore = new TemperatureStore(theFileName, header.numCols, true);
+  if (theStore->mapFile() < 0) {
+    delete theStore;
+    return 0;
+  }
+
+  return theStore;
+}
+
+
+void
+TemperatureStore::detach(void)
+{
+  numRefs--;
+  if (numRefs <= 0)
+    delete this;
+}
+
+
+int
+TemperatureStore::addRow(double time, const double *values)
+{
+  if (reader == true || finished == true) {
+    opserr << "WARNING TemperatureStore::addRow() - " << name << " is not open for writing\n";
+    return -1;
+  }
+
+  theRows.push_back(time);
+  for (int i=0; i<numCols; i++)
+    theRows.push_back(values[i]);
+
+  return this->rowAdded();
+}
+
+
+int
+TemperatureStore::addRow(const Vector &timeAndValues)
+{
+  if (reader == true || finished == true) {
+    opserr << "WARNING TemperatureStore::addRow() - " << name << " is not open for writing\n";
+    return -1;
+  }
+
+  if (timeAndValues.Size() != numCols+1) {
+    opserr << "WARNING TemperatureStore::addRow() - " << name << " expects " << numCols
+	   << " values, got " << timeAndValues.Size()-1 << endln;
+    return -1;
+  }
+
+  for (int i=0; i<=numCols; i++)
+    theRows.push_back(timeAndValues(i));
+
+  return this->rowAdded();
+}
+
+
+// the last row has been appended to theRows; append it to the file
+int
+TemperatureStore::rowAdded(void)
+{
+  numRows++;
+  data = &theRows[0];
+
+  if (theFile != 0) {
+    long offset = TEMPERATURESTORE_HEADER_SIZE + (long)(numRows-1)*(numCols+1)*sizeof(double);
+    if (fseek(theFile, offset, SEEK_SET) != 0 ||
+	fwrite(&theRows[(numRows-1)*(numCols+1)], sizeof(double), numCols+1, theFile) != (size_t)(numCols+1) ||
+	fflush(theFile) != 0 ||
+	this->writeHeader() != 0) {
+      opserr << "WARNING TemperatureStore::addRow() - failed to write to file " << fileName << endln;
+      fclose(theFile);
+      theFile = 0;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+int
+TemperatureStore::finish(void)
+{
+  if (reader == true || finished == true)
+    return 0;
+
+  finished = true;
+  if (theFile != 0)
+    return this->writeHeader();
+
+  return 0;
+}
+
+
+int
+TemperatureStore::refresh(void)
+{
+  if (reader == false || finished == true)
+    return numRows;
+
+  if (this->mapFile() < 0)
+    opserr << "WARNING TemperatureStore::refresh() - failed to read file " << fileName << endln;
+
+  return numRows;
+}
+
+
+int
+TemperatureStore::waitForTime(double time, double maxWait)
+{
+  this->refresh();
+
+  double waited = 0.0;
+  while (reader == true && finished == false && waited < maxWait &&
+	 (numRows == 0 || this->getTime(numRows-1) < time)) {
+#ifdef _WIN32
+    Sleep(10);
+#else
+    usleep(10000);
+#endif
+    waited += 0.01;
+    this->refresh();
+  }
+
+  return numRows;
+}
+
+
+int
+TemperatureStore::writeHeader(void)
+{
+  TemperatureStoreHeader header;
+  memset(&header, 0, sizeof(TemperatureStoreHeader));
+  memcpy(header.magic, temperatureStoreMagic, 8);
+  header.numCols = numCols;
+  header.finished = (finished == true) ? 1 : 0;
+  header.numRows = numRows;
+
+  if (fseek(theFile, 0, SEEK_SET) != 0 ||
+      fwrite(&header, TEMPERATURESTORE_HEADER_SIZE, 1, theFile) != 1 ||
+      fflush(theFile) != 0)
+    return -1;
+
+  return 0;
+}
+
+
+// (re)map the file of a reader so the rows written since the last call
+// are seen; on Windows the new rows are read into memory instead
+int
+TemperatureStore::mapFile(void)
+{
+  TemperatureStoreHeader header;
+  int rowSize = (numCols+1)*sizeof(double);
+
+#ifdef _WIN32
+  FILE *theInput = fopen(fileName, "rb");
+  if (theInput == 0)
+    return -1;
+
+  if (fread(&header, TEMPERATURESTORE_HEADER_SIZE, 1, theInput) != 1) {
+    fclose(theInput);
+    return -1;
+  }
+
+  if (header.numRows > numRows) {
+    theRows.resize((size_t)header.numRows*(numCols+1));
+    fseek(theInput, TEMPERATURESTORE_HEADER_SIZE + (long)numRows*rowSize, SEEK_SET);
+    size_t numRead = fread(&theRows[(size_t)numRows*(numCols+1)], rowSize,
+			   (size_t)(header.numRows-numRows), theInput);
+    numRows += (int)numRead;
+    theRows.resize((size_t)numRows*(numCols+1));
+    if (numRows > 0)
+      data = &theRows[0];
+  }
+  finished = (header.finished != 0);
+  fclose(theInput);
+
+#else
+  if (fd < 0) {
+    fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+      return -1;
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size < TEMPERATURESTORE_HEADER_SIZE)
+    return -1;
+
+  // the header is read with pread, the rows through the map
+  if (pread(fd, &header, TEMPERATURESTORE_HEADER_SIZE, 0) != TEMPERATURESTORE_HEADER_SIZE)
+    return -1;
+
+  long long numAvailable = (fileStat.st_size - TEMPERATURESTORE_HEADER_SIZE)/rowSize;
+  if (header.numRows < numAvailable)
+    numAvailable = header.numRows;
+
+  long sizeNeeded = TEMPERATURESTORE_HEADER_SIZE + (long)numAvailable*rowSize;
+  if (sizeNeeded > sizeMap) {
+    if (theMap != 0)
+      munmap(theMap, sizeMap);
+    theMap = 0;
+    sizeMap = 0;
+
+    void *newMap = mmap(0, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (newMap == MAP_FAILED)
+      return -1;
+
+    theMap = (char *)newMap;
+    sizeMap = fileStat.st_size;
+  }
+
+  numRows = (int)numAvailable;
+  if (theMap != 0)
+    data = (const double *)(theMap + TEMPERATURESTORE_HEADER_SIZE);
+  finished = (header.finished != 0 && header.numRows == numAvailable);
+#endif
+
+  return 0;
+}
+
+
+void
+TemperatureStore::releaseFile(void)
+{
+#ifndef _WIN32
+  if (theMap != 0)
+    munmap(theMap, sizeMap);
+  if (fd >= 0)
+    close(fd);
+#endif
+  theMap = 0;
+  sizeMap = 0;
+  fd = -1;
+}
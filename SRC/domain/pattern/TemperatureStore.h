@@ -0,0 +1,119 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef TemperatureStore_h
+#define TemperatureStore_h
+
+// Description: This file contains the class definition for TemperatureStore.
+// A TemperatureStore holds the time history of the temperatures at a fixed
+// number of locations, one row (time, T1 ... Tn) per recorded step. It lets a
+// heat transfer recorder (HTRecorderToStru) hand its results straight to the
+// PathTimeSeriesThermal objects of the structural model, instead of writing a
+// text file which each thermal load then parses again.
+//
+// Stores are registered by name; the name is what the structural model gives
+// in place of the temperature data file. A store may also be written to a
+// binary file (header + rows of doubles) as the rows are added. Such a file
+// can be opened in another process, where it is memory mapped and rows
+// appearing while the heat transfer analysis is still running are picked up,
+// so that the two analyses can run as producer and consumer.
+//
+// What: "@(#) TemperatureStore.h, revA"
+
+#include <vector>
+#include <stdio.h>
+
+class Vector;
+
+class TemperatureStore
+{
+  public:
+    // a store filled in this process, optionally written to fileName
+    TemperatureStore(const char *name, int numCols, const char *fileName = 0);
+    ~TemperatureStore();
+
+    // a store written by another process to fileName, 0 if it is not
+    // a temperature store file
+    static TemperatureStore *openFile(const char *fileName);
+
+    const char *getName(void) {return name;};
+    int getNumCols(void) {return numCols;};
+
+    // methods for the producer
+    int addRow(double time, const double *values);
+    int addRow(const Vector &timeAndValues);
+    int finish(void);
+
+    // methods for the consumer; refresh() picks up the rows added to a
+    // file store since the last call and returns the number of rows
+    int refresh(void);
+    int getNumRows(void) {return numRows;};
+    double getTime(int row) {return data[row*(numCols+1)];};
+    const double *getRow(int row) {return &data[row*(numCols+1)+1];};
+    bool isFinished(void) {return finished;};
+    bool isReader(void) {return reader;};
+
+    // wait, polling the file, until a row at or past time has been added
+    // or the producer has finished; returns the number of rows
+    int waitForTime(double time, double maxWait);
+
+    // the objects using a store share it, the registry holding one
+    // reference while the store is registered; the last one to detach
+    // deletes it
+    void attach(void) {numRefs++;};
+    void detach(void);
+
+  protected:
+
+  private:
+    TemperatureStore(const char *name, int numCols, bool reader);
+    int rowAdded(void);
+    int writeHeader(void);
+    int mapFile(void);
+    void releaseFile(void);
+
+    char *name;
+    int numCols;
+    int numRows;
+    bool finished;
+    bool reader;
+    int numRefs;
+
+    // rows of (time, T1 ... Tn); for a mapped file data points into the map
+    const double *data;
+    std::vector<double> theRows;
+
+    // file persistence
+    char *fileName;
+    FILE *theFile;
+    int fd;
+    char *theMap;
+    long sizeMap;
+};
+
+// registry of the stores by name; a store stays available to the
+// structural model, also once its recorder is gone, until it is removed
+// or the model is wiped
+int OPS_addTemperatureStore(TemperatureStore *theStore);
+TemperatureStore *OPS_getTemperatureStore(const char *name);
+int OPS_removeTemperatureStore(const char *name);
+void OPS_clearAllTemperatureStores(void);
+
+#endif
@@ -224,6 +224,27 @@ Element::getDamp(void)
 
 
 
+double
+Element::addConstantDampAndMass(Matrix &K, double factC, double factM)
+{
+  if (index  == -1) {
+    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+  }
+
+  double factMass = factM + factC*alphaM;
+  if (factMass != 0.0)
+    K.addMatrix(1.0, this->getMass(), factMass);
+  if (factC == 0.0)
+    return 0.0;
+
+  if (betaK0 != 0.0)
+    K.addMatrix(1.0, this->getInitialStiff(), factC*betaK0);
+  if (betaKc != 0.0)
+    K.addMatrix(1.0, *Kc, factC*betaKc);
+
+  return factC*betaK;
+}
+
 const Matrix &
 Element::getMass(void)
 {
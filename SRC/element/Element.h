@@ -66,6 +66,18 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+
+    // true if update(), getTangentStiff(), getInitialStiff() and
+    // getResistingForce() of different elements can be called on different
+    // threads at the same time; the element and all the materials, sections
+    // and transformations it holds only write to OPS_THREAD_LOCAL scratch
+    virtual bool isThreadSafe(void) {return false;}
+
+    // true if getMass() does not depend on the trial state and getDamp() is
+    // the Rayleigh damping of Element, so that all of factC*C + factM*M but
+    // factC*betaK*Kt only changes from step to step and a transient
+    // integrator may form it once per step, see addConstantDampAndMass()
+    virtual bool hasConstantMassAndDamp(void) {return false;}
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -75,6 +87,12 @@ class Element : public DomainComponent
     virtual const Matrix &getMass(void);
     virtual const Matrix &getGeometricTangentStiff();
 
+    // add to K factC times the part of the Rayleigh damping that only
+    // changes on commitState(), alphaM*M + betaK0*K0 + betaKc*Kc, and factM
+    // times the mass; returns factC*betaK, the factor of getTangentStiff()
+    // left out
+    double addConstantDampAndMass(Matrix &K, double factC, double factM);
+
     // methods for applying loads
     virtual void zeroLoad(void);	
     virtual int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// ElementGeometryCache.
+//
+// What: "@(#) ElementGeometryCache.cpp, revA"
+
+#include <ElementGeometryCache.h>
+#include <new>
+
+double ElementGeometryCache::maxMemory = 0.0;
+double ElementGeometryCache::memory = 0.0;
+int ElementGeometryCache::numCached = 0;
+
+void
+ElementGeometryCache::setMaxMemory(double bytes)
+{
+  maxMemory = bytes;
+}
+
+double
+ElementGeometryCache::getMaxMemory(void)
+{
+  return maxMemory;
+}
+
+double
+ElementGeometryCache::getMemory(void)
+{
+  return memory;
+}
+
+int
+ElementGeometryCache::getNumCached(void)
+{
+  return numCached;
+}
+
+double *
+ElementGeometryCache::allocate(int n)
+{
+  double bytes = n*sizeof(double);
+  if (n <= 0 || maxMemory == 0.0 || (maxMemory > 0.0 && memory + bytes > maxMemory))
+    return 0;
+
+  double *data = new (std::nothrow) double[n];
+  if (data == 0)
+    return 0;
+
+  memory += bytes;
+  numCached++;
+
+  return data;
+}
+
+void
+ElementGeometryCache::release(double *data, int n)
+{
+  if (data == 0)
+    return;
+
+  delete [] data;
+  memory -= n*sizeof(double);
+  numCached--;
+}
@@ -0,0 +1,60 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for
+// ElementGeometryCache. Elements whose geometry does not change during the
+// analysis (small displacement shells and solids) can keep the shape
+// functions, volume elements and B matrices of their gauss points, found
+// once in setDomain(), instead of recomputing them on every state
+// determination. The arrays they keep them in come from here, which holds
+// the total to a memory limit set for the whole model, so that a huge mesh
+// can run with caching turned off or with only as many elements cached as
+// the memory allows. Caching is off until a limit is set; the elements
+// which do not get an array recompute their geometry as before.
+//
+// What: "@(#) ElementGeometryCache.h, revA"
+
+#ifndef ElementGeometryCache_h
+#define ElementGeometryCache_h
+
+class ElementGeometryCache
+{
+  public:
+    // set the most memory (bytes) the caches of all the elements may take,
+    // 0 turning caching off and a negative value meaning no limit; it
+    // applies to the elements added to the domain from then on
+    static void setMaxMemory(double bytes);
+    static double getMaxMemory(void);
+    // the memory (bytes) taken by the caches
+    static double getMemory(void);
+    static int getNumCached(void);
+
+    // an array of n doubles for the cache of an element, 0 if caching is
+    // off or the array would take the caches over the limit
+    static double *allocate(int n);
+    static void release(double *data, int n);
+
+  private:
+    static double maxMemory;
+    static double memory;
+    static int numCached;
+};
+
+#endif
@@ -35,28 +35,32 @@
 
 Information::Information() 
   :theType(UnknownType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0),
+   theTarget(0), targetSize(0), targetWritten(false)
 {
     // does nothing
 }
 
 Information::Information(int val) 
   :theType(IntType), theInt(val),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theTarget(0), targetSize(0), targetWritten(false)
 {
     // does nothing
 }
 
 Information::Information(double val) 
   :theType(DoubleType), theDouble(val),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theTarget(0), targetSize(0), targetWritten(false)
 {
   // does nothing
 }
 
 Information::Information(const ID &val) 
   :theType(IdType),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theTarget(0), targetSize(0), targetWritten(false)
 {
   // Make a copy
   theID = new ID(val);
@@ -67,7 +71,8 @@ Information::Information(const ID &val)
 
 Information::Information(const Vector &val) 
   :theType(VectorType),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theTarget(0), targetSize(0), targetWritten(false)
 {
   // Make a copy
   theVector = new Vector(val);
@@ -78,7 +83,8 @@ Information::Information(const Vector &val)
 
 Information::Information(const Matrix &val) 
   :theType(MatrixType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0),
+   theTarget(0), targetSize(0), targetWritten(false)
 {
   // Make a copy
   theMatrix = new Matrix(val);
@@ -89,7 +95,8 @@ Information::Information(const Matrix &val)
 
 Information::Information(const ID &val1, const Vector &val2) 
   :theType(IdType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0),
+   theTarget(0), targetSize(0), targetWritten(false)
 {
   // Make a copy
   theID = new ID(val1);
@@ -124,6 +131,11 @@ Information::setInt(int newInt)
 int 
 Information::setDouble(double newDouble)
 {
+  if (theTarget != 0 && theType == DoubleType && targetSize == 1) {
+    theTarget[0] = newDouble;
+    targetWritten = true;
+  }
+
   theDouble = newDouble;
   
   return 0;
@@ -143,6 +155,14 @@ Information::setID(const ID &newID)
 int 
 Information::setVector(const Vector &newVector)
 {
+  int size = newVector.Size();
+  if (theTarget != 0 && theType == VectorType && size == targetSize) {
+    for (int i=0; i<size; i++)
+      theTarget[i] = newVector(i);
+    targetWritten = true;
+  }
+
+  // theVector is kept current as well for those reading it directly
   if (theVector != 0) {
     *theVector = newVector;
   } else {
@@ -235,6 +255,16 @@ Information::Print(ofstream &s, int flag)
   return;
 }
 
+int
+Information::setTarget(double *target, int size)
+{
+  theTarget = target;
+  targetSize = size;
+  targetWritten = false;
+
+  return 0;
+}
+
 const Vector &
 Information::getData(void) 
 {
@@ -75,6 +75,11 @@ class Information
     virtual void Print(ofstream &s, int flag = 0);
     virtual const Vector &getData(void);
 
+    // while a target is set, setVector() and setDouble() calls with data of
+    // the target size are also written straight into the target (e.g. a slice
+    // of a recorder's output Vector) and targetWritten is set to true
+    int setTarget(double *target, int size);
+
     // data that is stored in the information object
     InfoType	theType;   // information about data type
     int		theInt;    // an integer value
@@ -84,6 +89,10 @@ class Information
     Matrix	*theMatrix;// pointer to a Matrix object, created elsewhere
     char        *theString;// pointer to string
 
+    double      *theTarget;    // pointer to memory set by setTarget(), not owned
+    int         targetSize;
+    bool        targetWritten; // true if last set wrote into theTarget
+
   protected:
     
   private:        
@@ -37,6 +37,7 @@
 #include <NodeIter.h>
 #include <ElementIter.h>
 #include <vector>
+#include <algorithm>
 
 void* OPS_ElasticBeam2d(const ID& info);
 void* OPS_ForceBeamColumn2d(const ID& info);
@@ -52,6 +53,10 @@ void* OPS_ShellMITC4(const ID& info);
 // msh objects
 static MapOfTaggedObjects theMeshObjects;
 
+// tags of the elements removed by the meshes, reused for the new elements
+// so that remeshing every step does not run the tags up
+static std::vector<int> theFreeEleTags;
+
 bool OPS_addMesh(Mesh* msh) {
     return theMeshObjects.addComponent(msh);
 }
@@ -79,6 +84,7 @@ Mesh *OPS_getMesh(int tag) {
 
 void OPS_clearAllMesh(void) {
     theMeshObjects.clearAll();
+    theFreeEleTags.clear();
 }
 
 TaggedObjectIter& OPS_getAllMesh() {
@@ -115,6 +121,7 @@ Mesh::clearEles()
         Element* ele = domain->removeElement(eletags(i));
         if (ele != 0) {
             delete ele;
+            theFreeEleTags.push_back(eletags(i));
         }
     }
     eletags = ID();
@@ -146,6 +153,46 @@ Mesh::clearNodes()
     return 0;
 }
 
+// the nodes of each of num elements of elends in increasing order,
+// followed by the parity of the permutation which sorts them, so that two
+// elements with the same key have the same nodes in the same orientation
+static void
+elementKeys(const ID& elends, int num, int numnodes, std::vector<int>& keys)
+{
+    int keysize = numnodes+1;
+    keys.resize(num*keysize);
+
+#pragma omp parallel for
+    for (int i=0; i<num; ++i) {
+        int* key = &keys[i*keysize];
+        for (int j=0; j<numnodes; ++j) {
+            key[j] = elends(numnodes*i+j);
+        }
+        int swaps = 0;
+        for (int j=1; j<numnodes; ++j) {
+            for (int k=j; k>0 && key[k-1]>key[k]; --k) {
+                std::swap(key[k-1], key[k]);
+                ++swaps;
+            }
+        }
+        key[numnodes] = swaps%2;
+    }
+}
+
+// orders elements by their keys
+struct ElementKeyLess
+{
+    ElementKeyLess(const std::vector<int>& k, int size):keys(k), keysize(size) {}
+
+    bool operator()(int i, int j) const {
+        return std::lexicographical_compare(&keys[i*keysize], &keys[i*keysize]+keysize,
+                                            &keys[j*keysize], &keys[j*keysize]+keysize);
+    }
+
+    const std::vector<int>& keys;
+    int keysize;
+};
+
 void
 Mesh::Print(OPS_Stream &s, int flag)
 {
@@ -419,19 +466,41 @@ Mesh::newElements(const ID& elends)
 
 
 
-    int eletag = this->nextEleTag();
     int nodetag = this->nextNodeTag();
 
+    // element tags, the freed ones first; in ascending order, so that the
+    // elements are listed in eletags in the order of elends
+    int numeles = elends.Size()/numelenodes;
+    std::vector<int> tags;
+    tags.reserve(numeles);
+    while ((int)tags.size() < numeles && !theFreeEleTags.empty()) {
+        int tag = theFreeEleTags.back();
+        theFreeEleTags.pop_back();
+        if (domain->getElement(tag) == 0) {
+            tags.push_back(tag);
+        }
+    }
+    std::sort(tags.begin(), tags.end());
+    if ((int)tags.size() < numeles) {
+        int eletag = this->nextEleTag();
+        if (!tags.empty() && eletag <= tags.back()) {
+            eletag = tags.back()+1;
+        }
+        while ((int)tags.size() < numeles) {
+            tags.push_back(eletag++);
+        }
+    }
+    ID neweletags(numeles);
+    for (int i=0; i<numeles; ++i) {
+        neweletags(i) = tags[i];
+    }
+
     // create elements
-    ID neweletags(elends.Size()/numelenodes);
     std::vector<Element*> neweles(neweletags.Size());
 
 #pragma omp parallel for
     for (int i=0; i<neweletags.Size(); ++i) {
 
-	// element tag
-	neweletags(i) = eletag+i;
-
 	// info
 	ID info(numelenodes+4);
 	info(0) = 2; // load data
@@ -464,3 +533,116 @@ Mesh::newElements(const ID& elends)
 
     return 0;
 }
+
+int
+Mesh::updateElements(const ID& elends)
+{
+    Domain* domain = OPS_GetDomain();
+    if (domain == 0) {
+        opserr << "WARNING: domain is not created\n";
+        return -1;
+    }
+
+    // the nodes of the elements are only known if kept along the tags, as
+    // after mesh() or a previous update
+    int numold = eletags.Size();
+    if (eleType == 0 || numelenodes <= 0 || numold == 0 ||
+        elenodes.Size() != numold*numelenodes) {
+        if (this->clearEles() < 0) {
+            return -1;
+        }
+        if (this->newElements(elends) < 0) {
+            return -1;
+        }
+        if (eletags.Size()*numelenodes == elends.Size()) {
+            elenodes = elends;
+        }
+        return 0;
+    }
+
+    // match the old and new elements by their sorted keys
+    int numnew = elends.Size()/numelenodes;
+    int keysize = numelenodes+1;
+    std::vector<int> oldkeys, newkeys;
+    elementKeys(elenodes, numold, numelenodes, oldkeys);
+    elementKeys(elends, numnew, numelenodes, newkeys);
+
+    std::vector<int> oldorder(numold), neworder(numnew);
+    for (int i=0; i<numold; ++i) {
+        oldorder[i] = i;
+    }
+    for (int i=0; i<numnew; ++i) {
+        neworder[i] = i;
+    }
+    std::sort(oldorder.begin(), oldorder.end(), ElementKeyLess(oldkeys,keysize));
+    std::sort(neworder.begin(), neworder.end(), ElementKeyLess(newkeys,keysize));
+
+    std::vector<bool> keep(numold,false), found(numnew,false);
+    int io = 0, in = 0;
+    while (io < numold && in < numnew) {
+        const int* okey = &oldkeys[oldorder[io]*keysize];
+        const int* nkey = &newkeys[neworder[in]*keysize];
+        if (std::lexicographical_compare(okey, okey+keysize, nkey, nkey+keysize)) {
+            ++io;
+        } else if (std::lexicographical_compare(nkey, nkey+keysize, okey, okey+keysize)) {
+            ++in;
+        } else {
+            keep[oldorder[io++]] = true;
+            found[neworder[in++]] = true;
+        }
+    }
+
+    // remove the old elements which are not in the new mesh
+    ID keptTags(0, numold), keptNodes(0, numold*numelenodes);
+    for (int i=0; i<numold; ++i) {
+        if (keep[i]) {
+            keptTags[keptTags.Size()] = eletags(i);
+            for (int j=0; j<numelenodes; ++j) {
+                keptNodes[keptNodes.Size()] = elenodes(numelenodes*i+j);
+            }
+        } else {
+            Element* ele = domain->removeElement(eletags(i));
+            if (ele != 0) {
+                delete ele;
+                theFreeEleTags.push_back(eletags(i));
+            }
+        }
+    }
+    int numkept = keptTags.Size();
+
+    // create the new elements which are not in the old mesh, reusing the
+    // tags of those removed
+    ID addNodes(0, (numnew-numkept)*numelenodes);
+    for (int i=0; i<numnew; ++i) {
+        if (!found[i]) {
+            for (int j=0; j<numelenodes; ++j) {
+                addNodes[addNodes.Size()] = elends(numelenodes*i+j);
+            }
+        }
+    }
+
+    eletags = keptTags;
+    if (this->newElements(addNodes) < 0) {
+        return -1;
+    }
+
+    // the kept and new tags both ascend, so the nodes of the elements are
+    // merged in the order of eletags
+    elenodes = ID(0, eletags.Size()*numelenodes);
+    int ik = 0, ia = 0;
+    for (int i=0; i<eletags.Size(); ++i) {
+        if (ik < numkept && keptTags(ik) == eletags(i)) {
+            for (int j=0; j<numelenodes; ++j) {
+                elenodes[elenodes.Size()] = keptNodes(numelenodes*ik+j);
+            }
+            ++ik;
+        } else {
+            for (int j=0; j<numelenodes; ++j) {
+                elenodes[elenodes.Size()] = addNodes(numelenodes*ia+j);
+            }
+            ++ia;
+        }
+    }
+
+    return numkept;
+}
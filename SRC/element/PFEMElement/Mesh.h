@@ -87,6 +87,10 @@ public:
 
     // create new element
     virtual int newElements(const ID& elenodes);
+
+    // replace the elements by those of elenodes, keeping the elements
+    // whose nodes are unchanged; returns the number kept
+    virtual int updateElements(const ID& elenodes);
     virtual Node* newNode(int tag, const Vector& crds);
 
     // find the next available tag
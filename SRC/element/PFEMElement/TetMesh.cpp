@@ -38,6 +38,7 @@
 #include <map>
 #include <vector>
 #include <Pressure_Constraint.h>
+#include <chrono>
 
 int OPS_TetMesh()
 {
@@ -352,7 +353,7 @@ TetMesh::mesh()
 }
 
 int
-TetMesh::remesh(double alpha)
+TetMesh::remesh(double alpha, bool incremental, bool timing)
 {
     int ndm = OPS_GetNDM();
     if (ndm != 3) {
@@ -365,10 +366,11 @@ TetMesh::remesh(double alpha)
         return -1;
     }
 
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
     // get all nodes
     std::map<int, std::vector<int> > ndinfo;
     TaggedObjectIter& meshes = OPS_getAllMesh();
-    ID nodetags;
     Mesh* msh = 0;
     while((msh = dynamic_cast<Mesh*>(meshes())) != 0) {
 
@@ -383,7 +385,6 @@ TetMesh::remesh(double alpha)
             std::vector<int>& info = ndinfo[tags(i)];
             info.push_back(mtag);
             info.push_back(id);
-            nodetags.insert(tags(i));
         }
 
         // get internal nodes
@@ -392,11 +393,20 @@ TetMesh::remesh(double alpha)
             std::vector<int>& info = ndinfo[newtags(i)];
             info.push_back(mtag);
             info.push_back(id);
-            nodetags.insert(newtags(i));
         }
     }
 
-    if (nodetags.Size() == 0) return 0;
+    if (ndinfo.empty()) return 0;
+
+    // the nodes in increasing order and the meshes of each
+    ID nodetags((int)ndinfo.size());
+    std::vector<const std::vector<int>*> ptinfo(ndinfo.size());
+    int numpts = 0;
+    for (std::map<int, std::vector<int> >::iterator it=ndinfo.begin();
+         it!=ndinfo.end(); ++it) {
+        nodetags(numpts) = it->first;
+        ptinfo[numpts++] = &(it->second);
+    }
 
     // calling mesh generator
     TetMeshGenerator gen;
@@ -453,34 +463,39 @@ TetMesh::remesh(double alpha)
 
     // meshing
     gen.remesh(alpha);
+    std::chrono::steady_clock::time_point meshed = std::chrono::steady_clock::now();
 
-    // get elenodes
-    std::map<int,ID> meshelenodes;
-    for(int i=0; i<gen.getNumTets(); i++) {
+    // the mesh of each element, found in parallel as the elements are
+    // independent, 0 if not in a mesh
+    int numele = gen.getNumTets();
+    std::vector<int> elemesh(numele, 0);
+    std::vector<int> elends(4*numele);
+
+#pragma omp parallel for
+    for(int i=0; i<numele; i++) {
 
         // get points
-        int p1,p2,p3,p4;
-        gen.getTet(i,p1,p2,p3,p4);
+        int pts[4];
+        gen.getTet(i,pts[0],pts[1],pts[2],pts[3]);
 
         // get nodes
-        int nds[4];
-        nds[0] = nodetags(p1);
-        nds[1] = nodetags(p2);
-        nds[2] = nodetags(p3);
-	nds[3] = nodetags(p4);
+        int* nds = &elends[4*i];
+        for (int j=0; j<4; ++j) {
+            nds[j] = nodetags(pts[j]);
+        }
 
         // check if all nodes in same mesh
-        std::vector<int>& info1 = ndinfo[nds[0]];
+        const std::vector<int>& info1 = *ptinfo[pts[0]];
         int mtag = 0, id = 0;
         bool same = false;
         for (int k=0; k<(int)info1.size()/2; ++k) {
-            // check if any mesh of node 1 is same for another three nodes
+            // check if any mesh of node 1 is same for the other nodes
             mtag = info1[2*k];
             id = info1[2*k+1];
 
             int num = 0;
             for (int j=1; j<4; ++j) {
-                std::vector<int>& infoj = ndinfo[nds[j]];
+                const std::vector<int>& infoj = *ptinfo[pts[j]];
                 for (int kj=0; kj<(int)infoj.size()/2; ++kj) {
                     int mtagj = infoj[2*kj];
                     if (mtag == mtagj) {
@@ -501,7 +516,7 @@ TetMesh::remesh(double alpha)
             mtag = 0;
             id = 0;
             for (int j=0; j<4; ++j) {
-                std::vector<int>& info = ndinfo[nds[j]];
+                const std::vector<int>& info = *ptinfo[pts[j]];
                 for (int k=0; k<(int)info.size()/2; ++k) {
                     if (info[2*k+1] < id) {
                         if (dynamic_cast<TetMesh*>(OPS_getMesh(info[2*k])) != 0) {
@@ -516,14 +531,23 @@ TetMesh::remesh(double alpha)
         // if all connected to structure
         if (id >= 0) continue;
 
+        elemesh[i] = mtag;
+    }
+
+    // get elenodes
+    std::map<int,ID> meshelenodes;
+    for(int i=0; i<numele; i++) {
+        if (elemesh[i] == 0) continue;
+
         // add elenodes to its mesh
-        ID& elenodes = meshelenodes[mtag];
+        ID& elenodes = meshelenodes[elemesh[i]];
         for (int j=0; j<4; ++j) {
-            elenodes[elenodes.Size()] = nds[j];
+            elenodes[elenodes.Size()] = elends[4*i+j];
         }
     }
 
     // creat elements
+    int numeles = 0, numkept = 0;
     for (std::map<int,ID>::iterator it=meshelenodes.begin();
 	 it!=meshelenodes.end(); ++it) {
 
@@ -536,7 +560,15 @@ TetMesh::remesh(double alpha)
             int id = msh->getID();
 
             // remove mesh for id<0
-            if (id < 0) {
+            if (id < 0 && incremental) {
+                int kept = msh->updateElements(elenodes);
+                if (kept < 0) {
+                    opserr << "WARNING: failed to update elements in mesh"<<mtag<<"\n";
+                    return -1;
+                }
+                numkept += kept;
+
+            } else if (id < 0) {
                 if (msh->clearEles() < 0) {
                     opserr << "WARNING: failed to clear element in mesh"<<mtag<<"\n";
                     return -1;
@@ -547,8 +579,16 @@ TetMesh::remesh(double alpha)
                     return -1;
                 }
             }
+            numeles += elenodes.Size()/4;
         }
     }
 
+    if (timing) {
+        std::chrono::duration<double> meshTime = meshed - start;
+        std::chrono::duration<double> eleTime = std::chrono::steady_clock::now() - meshed;
+        opserr << "remesh: " << numeles << " elements, " << numkept << " kept -- ";
+        opserr << "mesh " << meshTime.count() << " s, elements " << eleTime.count() << " s\n";
+    }
+
     return 0;
 }
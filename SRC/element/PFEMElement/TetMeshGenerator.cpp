@@ -304,6 +304,8 @@ TetMeshGenerator::remesh(double alpha)
     int numtet = out.numberoftetrahedra;
     std::vector<double> radius(numtet);
     double avesize = 0.0;
+
+#pragma omp parallel for reduction(+:avesize)
     for(int i=0; i<numtet; i++) {
 
 	// triangle circumcenter
@@ -40,6 +40,7 @@
 #include <map>
 #include <vector>
 #include <Pressure_Constraint.h>
+#include <chrono>
 #include "BackgroundDef.h"
 #include <cmath>
 
@@ -432,7 +433,7 @@ TriMesh::mesh()
 }
 
 int
-TriMesh::remesh(double alpha)
+TriMesh::remesh(double alpha, bool incremental, bool timing)
 {
     if (OPS_GetNDM() != 2) {
 	opserr << "WARNING: TriMesh::remesh is only for 2D problem\n";
@@ -444,10 +445,11 @@ TriMesh::remesh(double alpha)
         return -1;
     }
 
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
     // get all nodes
     std::map<int, std::vector<int> > ndinfo;
     TaggedObjectIter& meshes = OPS_getAllMesh();
-    ID nodetags;
     Mesh* msh = 0;
     while((msh = dynamic_cast<Mesh*>(meshes())) != 0) {
 
@@ -462,7 +464,6 @@ TriMesh::remesh(double alpha)
             std::vector<int>& info = ndinfo[tags(i)];
             info.push_back(mtag);
             info.push_back(id);
-            nodetags.insert(tags(i));
         }
 
         // get internal nodes
@@ -471,11 +472,20 @@ TriMesh::remesh(double alpha)
             std::vector<int>& info = ndinfo[newtags(i)];
             info.push_back(mtag);
             info.push_back(id);
-            nodetags.insert(newtags(i));
         }
     }
 
-    if (nodetags.Size() == 0) return 0;
+    if (ndinfo.empty()) return 0;
+
+    // the nodes in increasing order and the meshes of each
+    ID nodetags((int)ndinfo.size());
+    std::vector<const std::vector<int>*> ptinfo(ndinfo.size());
+    int numpts = 0;
+    for (std::map<int, std::vector<int> >::iterator it=ndinfo.begin();
+         it!=ndinfo.end(); ++it) {
+        nodetags(numpts) = it->first;
+        ptinfo[numpts++] = &(it->second);
+    }
 
     // calling mesh generator
     TriangleMeshGenerator gen;
@@ -533,33 +543,39 @@ TriMesh::remesh(double alpha)
 
     // meshing
     gen.remesh(alpha);
+    std::chrono::steady_clock::time_point meshed = std::chrono::steady_clock::now();
 
-    // get elenodes
-    std::map<int,ID> meshelenodes;
-    for(int i=0; i<gen.getNumTriangles(); i++) {
+    // the mesh of each element, found in parallel as the elements are
+    // independent, 0 if not in a mesh
+    int numele = gen.getNumTriangles();
+    std::vector<int> elemesh(numele, 0);
+    std::vector<int> elends(3*numele);
+
+#pragma omp parallel for
+    for(int i=0; i<numele; i++) {
 
         // get points
-        int p1,p2,p3;
-        gen.getTriangle(i,p1,p2,p3);
+        int pts[3];
+        gen.getTriangle(i,pts[0],pts[1],pts[2]);
 
         // get nodes
-        int nds[3];
-        nds[0] = nodetags(p1);
-        nds[1] = nodetags(p2);
-        nds[2] = nodetags(p3);
+        int* nds = &elends[3*i];
+        for (int j=0; j<3; ++j) {
+            nds[j] = nodetags(pts[j]);
+        }
 
         // check if all nodes in same mesh
-        std::vector<int>& info1 = ndinfo[nds[0]];
+        const std::vector<int>& info1 = *ptinfo[pts[0]];
         int mtag = 0, id = 0;
         bool same = false;
         for (int k=0; k<(int)info1.size()/2; ++k) {
-            // check if any mesh of node 1 is same for another two nodes
+            // check if any mesh of node 1 is same for the other nodes
             mtag = info1[2*k];
             id = info1[2*k+1];
 
             int num = 0;
             for (int j=1; j<3; ++j) {
-                std::vector<int>& infoj = ndinfo[nds[j]];
+                const std::vector<int>& infoj = *ptinfo[pts[j]];
                 for (int kj=0; kj<(int)infoj.size()/2; ++kj) {
                     int mtagj = infoj[2*kj];
                     if (mtag == mtagj) {
@@ -580,7 +596,7 @@ TriMesh::remesh(double alpha)
             mtag = 0;
             id = 0;
             for (int j=0; j<3; ++j) {
-                std::vector<int>& info = ndinfo[nds[j]];
+                const std::vector<int>& info = *ptinfo[pts[j]];
                 for (int k=0; k<(int)info.size()/2; ++k) {
                     if (info[2*k+1] < id) {
                         if (dynamic_cast<TriMesh*>(OPS_getMesh(info[2*k])) != 0) {
@@ -595,14 +611,23 @@ TriMesh::remesh(double alpha)
         // if all connected to structure
         if (id >= 0) continue;
 
+        elemesh[i] = mtag;
+    }
+
+    // get elenodes
+    std::map<int,ID> meshelenodes;
+    for(int i=0; i<numele; i++) {
+        if (elemesh[i] == 0) continue;
+
         // add elenodes to its mesh
-        ID& elenodes = meshelenodes[mtag];
+        ID& elenodes = meshelenodes[elemesh[i]];
         for (int j=0; j<3; ++j) {
-            elenodes[elenodes.Size()] = nds[j];
+            elenodes[elenodes.Size()] = elends[3*i+j];
         }
     }
 
     // creat elements
+    int numeles = 0, numkept = 0;
     for (std::map<int,ID>::iterator it=meshelenodes.begin();
 	 it!=meshelenodes.end(); ++it) {
 
@@ -615,7 +640,15 @@ TriMesh::remesh(double alpha)
             int id = msh->getID();
 
             // remove mesh for id<0
-            if (id < 0) {
+            if (id < 0 && incremental) {
+                int kept = msh->updateElements(elenodes);
+                if (kept < 0) {
+                    opserr << "WARNING: failed to update elements in mesh"<<mtag<<"\n";
+                    return -1;
+                }
+                numkept += kept;
+
+            } else if (id < 0) {
                 if (msh->clearEles() < 0) {
                     opserr << "WARNING: failed to clear element in mesh"<<mtag<<"\n";
                     return -1;
@@ -626,8 +659,16 @@ TriMesh::remesh(double alpha)
                     return -1;
                 }
             }
+            numeles += elenodes.Size()/3;
         }
     }
 
+    if (timing) {
+        std::chrono::duration<double> meshTime = meshed - start;
+        std::chrono::duration<double> eleTime = std::chrono::steady_clock::now() - meshed;
+        opserr << "remesh: " << numeles << " elements, " << numkept << " kept -- ";
+        opserr << "mesh " << meshTime.count() << " s, elements " << eleTime.count() << " s\n";
+    }
+
     return 0;
 }
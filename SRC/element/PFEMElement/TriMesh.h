@@ -43,8 +43,9 @@ public:
 
     int mesh();
 
-    // remesh all
-    static int remesh(double alpha);
+    // remesh all; with timing the number of elements kept and the
+    // time spent meshing and updating the elements are printed
+    static int remesh(double alpha, bool incremental=false, bool timing=false);
 
 private:
     ID ltags;
@@ -211,6 +211,8 @@ TriangleMeshGenerator::remesh(double alpha)
     std::vector<double> radius(numtri);
     std::vector<double> beta(numtri);
     double avesize = 0.0;
+
+#pragma omp parallel for reduction(+:avesize)
     for(int i=0; i<numtri; i++) {
 
 	// triangle circumcenter
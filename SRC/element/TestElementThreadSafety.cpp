@@ -0,0 +1,354 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file is a driver to check the elements and materials which
+// report isThreadSafe(). Many copies of each are driven through a cyclic
+// history, once one after the other and once with the copies of each step
+// shared out over several threads, and the stresses, tangents, resisting
+// forces and stiffnesses of the two runs are compared bit for bit. An
+// element or material is only flagged thread safe once it passes here;
+// without OpenMP both runs are serial and the check is trivial.
+//
+// usage: testElementThreadSafety <numThreads?> <numCopies?> <numSteps?>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+
+#include <Steel01.h>
+#include <Concrete01.h>
+#include <UniaxialFiber3d.h>
+#include <FiberSection3d.h>
+#include <ElasticSection3d.h>
+#include <ElasticMembranePlateSection.h>
+#include <LinearCrdTransf3d.h>
+#include <LobattoBeamIntegration.h>
+#include <ForceBeamColumn3d.h>
+#include <ShellMITC4.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+// the displacement of dof of node tag at step, cyclic with a growing
+// amplitude; each copy gets a different amplitude and phase
+static double
+history(int tag, int dof, int step, double amp)
+{
+  double scale = 1.0 + 0.1*(tag % 7) + 0.05*dof;
+  return amp*scale*(0.2 + 0.02*step)*sin(0.3*step + 0.7*tag + 1.3*dof);
+}
+
+//
+// uniaxial materials
+//
+
+static int
+runMaterials(UniaxialMaterial **theMaterials, int numCopies, int numSteps,
+	     int numThreads, double *results)
+{
+  int res = 0;
+  for (int step = 0; step < numSteps; step++) {
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic) reduction(+:res)
+    for (int i = 0; i < numCopies; i++) {
+      double strain = history(i, 0, step, 0.01);
+      double stress, tangent;
+      res += theMaterials[i]->setTrial(strain, stress, tangent);
+      results[2*(step*numCopies+i)] = stress;
+      results[2*(step*numCopies+i)+1] = tangent;
+      theMaterials[i]->commitState();
+    }
+  }
+
+  return res;
+}
+
+static int
+checkMaterial(const char *name, UniaxialMaterial &theMaterial, int numCopies,
+	      int numSteps, int numThreads)
+{
+  UniaxialMaterial **serialCopies = new UniaxialMaterial *[numCopies];
+  UniaxialMaterial **parallelCopies = new UniaxialMaterial *[numCopies];
+  for (int i = 0; i < numCopies; i++) {
+    serialCopies[i] = theMaterial.getCopy();
+    parallelCopies[i] = theMaterial.getCopy();
+  }
+
+  int size = 2*numCopies*numSteps;
+  double *serial = new double[size];
+  double *parallel = new double[size];
+
+  runMaterials(serialCopies, numCopies, numSteps, 1, serial);
+  runMaterials(parallelCopies, numCopies, numSteps, numThreads, parallel);
+
+  int numDiff = 0;
+  for (int i = 0; i < size; i++)
+    if (memcmp(&serial[i], &parallel[i], sizeof(double)) != 0)
+      numDiff++;
+
+  printf("%-28s isThreadSafe %d  %d values  %d differ  %s\n", name,
+	 theMaterial.isThreadSafe(), size, numDiff, numDiff == 0 ? "PASSED" : "FAILED");
+
+  for (int i = 0; i < numCopies; i++) {
+    delete serialCopies[i];
+    delete parallelCopies[i];
+  }
+  delete [] serialCopies;
+  delete [] parallelCopies;
+  delete [] serial;
+  delete [] parallel;
+
+  return numDiff;
+}
+
+//
+// elements, each copy has its own nodes
+//
+
+static int
+runElements(Domain &theDomain, int numSteps, int numThreads, double *results)
+{
+  int numElements = theDomain.getNumElements();
+  Element **theElements = new Element *[numElements];
+  ElementIter &theEles = theDomain.getElements();
+  Element *theEle;
+  int numEle = 0;
+  while ((theEle = theEles()) != 0)
+    theElements[numEle++] = theEle;
+
+  int numDOF = theElements[0]->getNumDOF();
+  int stride = numDOF*numDOF + numDOF;
+  int res = 0;
+
+  for (int step = 0; step < numSteps; step++) {
+
+    // the nodal displacements are set one node after the other
+    NodeIter &theNodes = theDomain.getNodes();
+    Node *theNode;
+    while ((theNode = theNodes()) != 0) {
+      Vector disp(theNode->getNumberDOF());
+      for (int j = 0; j < disp.Size(); j++)
+	disp(j) = history(theNode->getTag(), j, step, 0.002);
+      theNode->setTrialDisp(disp);
+    }
+
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic) reduction(+:res)
+    for (int i = 0; i < numElements; i++) {
+      Element *theElement = theElements[i];
+      res += theElement->update();
+
+      double *result = &results[((long)step*numElements + i)*stride];
+      const Matrix &K = theElement->getTangentStiff();
+      for (int k = 0; k < numDOF; k++)
+	for (int j = 0; j < numDOF; j++)
+	  result[k*numDOF+j] = K(j,k);
+
+      const Vector &R = theElement->getResistingForce();
+      for (int j = 0; j < numDOF; j++)
+	result[numDOF*numDOF+j] = R(j);
+
+      theElement->commitState();
+    }
+
+    NodeIter &theCommitNodes = theDomain.getNodes();
+    while ((theNode = theCommitNodes()) != 0)
+      theNode->commitState();
+  }
+
+  delete [] theElements;
+
+  return res;
+}
+
+static int
+checkElements(const char *name, Domain &serialDomain, Domain &parallelDomain,
+	      int numSteps, int numThreads)
+{
+  ElementIter &theEles = serialDomain.getElements();
+  Element *theEle = theEles();
+  int numDOF = theEle->getNumDOF();
+  bool safe = theEle->isThreadSafe();
+
+  long size = (long)numSteps*serialDomain.getNumElements()*(numDOF*numDOF + numDOF);
+  double *serial = new double[size];
+  double *parallel = new double[size];
+
+  runElements(serialDomain, numSteps, 1, serial);
+  runElements(parallelDomain, numSteps, numThreads, parallel);
+
+  long numDiff = 0;
+  for (long i = 0; i < size; i++)
+    if (memcmp(&serial[i], &parallel[i], sizeof(double)) != 0)
+      numDiff++;
+
+  printf("%-28s isThreadSafe %d  %ld values  %ld differ  %s\n", name,
+	 safe, size, numDiff, numDiff == 0 ? "PASSED" : "FAILED");
+
+  delete [] serial;
+  delete [] parallel;
+
+  return (numDiff == 0) ? 0 : 1;
+}
+
+// numCopies columns with a fiber section (or an elastic section) of
+// length 120 along x
+static void
+buildBeams(Domain &theDomain, int numCopies, bool fibers)
+{
+  Steel01 steel(1, 60.0, 29000.0, 0.02);
+  Concrete01 concrete(2, -4.0, -0.002, -0.8, -0.006);
+
+  SectionForceDeformation *theSection;
+  if (fibers) {
+    // a 12 x 20 column, 8 x 10 concrete fibers and 4 corner bars
+    const int numFibers = 8*10 + 4;
+    Fiber *theFibers[numFibers];
+    Vector loc(2);
+    int num = 0;
+    for (int i = 0; i < 8; i++) {
+      for (int j = 0; j < 10; j++) {
+	loc(0) = -10.0 + 2.0*j + 1.0;
+	loc(1) = -6.0 + 1.5*i + 0.75;
+	theFibers[num] = new UniaxialFiber3d(num, concrete, 3.0, loc);
+	num++;
+      }
+    }
+    for (int i = 0; i < 4; i++) {
+      loc(0) = (i < 2) ? -8.0 : 8.0;
+      loc(1) = (i % 2 == 0) ? -4.0 : 4.0;
+      theFibers[num] = new UniaxialFiber3d(num, steel, 1.0, loc);
+      num++;
+    }
+    theSection = new FiberSection3d(1, numFibers, theFibers);
+    for (int i = 0; i < numFibers; i++)
+      delete theFibers[i];
+  } else
+    theSection = new ElasticSection3d(1, 3600.0, 240.0, 8000.0, 2880.0, 1500.0, 6000.0);
+
+  Vector vecxz(3);
+  vecxz(2) = 1.0;
+  LinearCrdTransf3d theTransf(1, vecxz);
+  LobattoBeamIntegration theIntegration;
+
+  const int numSections = 5;
+  SectionForceDeformation *theSections[numSections];
+  for (int i = 0; i < numSections; i++)
+    theSections[i] = theSection;
+
+  for (int i = 0; i < numCopies; i++) {
+    theDomain.addNode(new Node(2*i+1, 6, 0.0, 0.0, 0.0));
+    theDomain.addNode(new Node(2*i+2, 6, 120.0, 0.0, 0.0));
+    theDomain.addElement(new ForceBeamColumn3d(i+1, 2*i+1, 2*i+2, numSections, theSections,
+					       theIntegration, theTransf));
+  }
+
+  delete theSection;
+}
+
+// numCopies 1 x 1 shells, some of them warped
+static void
+buildShells(Domain &theDomain, int numCopies)
+{
+  ElasticMembranePlateSection theSection(1, 30000.0, 0.2, 0.5);
+
+  for (int i = 0; i < numCopies; i++) {
+    double warp = 0.05*(i % 3);
+    theDomain.addNode(new Node(4*i+1, 6, 0.0, 0.0, 0.0));
+    theDomain.addNode(new Node(4*i+2, 6, 1.0, 0.0, warp));
+    theDomain.addNode(new Node(4*i+3, 6, 1.0, 1.0, 0.0));
+    theDomain.addNode(new Node(4*i+4, 6, 0.0, 1.0, warp));
+    theDomain.addElement(new ShellMITC4(i+1, 4*i+1, 4*i+2, 4*i+3, 4*i+4, theSection));
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  int numThreads = 4;
+  int numCopies = 200;
+  int numSteps = 100;
+
+  if (argc > 1)
+    numThreads = atoi(argv[1]);
+  if (argc > 2)
+    numCopies = atoi(argv[2]);
+  if (argc > 3)
+    numSteps = atoi(argv[3]);
+
+#ifdef _OPENMP
+  printf("%d threads, %d copies, %d steps\n", numThreads, numCopies, numSteps);
+#else
+  printf("built without OpenMP, both runs are serial; %d copies, %d steps\n", numCopies, numSteps);
+#endif
+
+  int numFailed = 0;
+
+  Steel01 steel(1, 60.0, 29000.0, 0.02);
+  if (checkMaterial("Steel01", steel, numCopies, numSteps, numThreads) != 0)
+    numFailed++;
+
+  Concrete01 concrete(2, -4.0, -0.002, -0.8, -0.006);
+  if (checkMaterial("Concrete01", concrete, numCopies, numSteps, numThreads) != 0)
+    numFailed++;
+
+  {
+    Domain serialDomain, parallelDomain;
+    buildBeams(serialDomain, numCopies, true);
+    buildBeams(parallelDomain, numCopies, true);
+    numFailed += checkElements("ForceBeamColumn3d fiber", serialDomain, parallelDomain,
+			       numSteps, numThreads);
+  }
+
+  {
+    Domain serialDomain, parallelDomain;
+    buildBeams(serialDomain, numCopies, false);
+    buildBeams(parallelDomain, numCopies, false);
+    numFailed += checkElements("ForceBeamColumn3d elastic", serialDomain, parallelDomain,
+			       numSteps, numThreads);
+  }
+
+  {
+    Domain serialDomain, parallelDomain;
+    buildShells(serialDomain, numCopies);
+    buildShells(parallelDomain, numCopies);
+    numFailed += checkElements("ShellMITC4", serialDomain, parallelDomain,
+			       numSteps, numThreads);
+  }
+
+  printf("%d failed\n", numFailed);
+
+  return numFailed;
+}
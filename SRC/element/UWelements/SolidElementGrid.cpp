@@ -0,0 +1,276 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// SolidElementGrid.
+
+#include <SolidElementGrid.h>
+
+#include <math.h>
+#include <algorithm>
+
+#include <OPS_Globals.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Node.h>
+#include <Vector.h>
+
+// the boxes are widened by this fraction of their size, so that a point on
+// a face is found in spite of roundoff
+static const double boxTolerance = 1.0e-8;
+
+// at most this many cells per element
+static const double maxCellsPerElement = 2.0;
+
+SolidElementGrid::SolidElementGrid()
+  :numElements(0), cellSize(1.0)
+{
+    for (int i = 0; i < 3; i++) {
+        origin[i] = 0.0;
+        numCells[i] = 0;
+    }
+}
+
+SolidElementGrid::~SolidElementGrid()
+{
+}
+
+int
+SolidElementGrid::build(Domain &theDomain, const std::vector<int> &eleTags, bool useDisp)
+{
+    int numEle = (int)eleTags.size();
+
+    // the node pointers; the first call to getDisp() of a node allocates
+    // its vectors, so it is made here and not in the parallel loop
+    std::vector<Node *> theNodes(8*numEle);
+    for (int e = 0; e < numEle; e++) {
+        Element *theElement = theDomain.getElement(eleTags[e]);
+        if (theElement == 0 || theElement->getNumExternalNodes() != 8) {
+            opserr << "SolidElementGrid::build - element " << eleTags[e]
+                   << " is not an 8 node solid element in the domain\n";
+            return -1;
+        }
+        Node **nodePtrs = theElement->getNodePtrs();
+        for (int k = 0; k < 8; k++) {
+            theNodes[8*e+k] = nodePtrs[k];
+            if (useDisp)
+                nodePtrs[k]->getDisp();
+        }
+    }
+
+    numElements = numEle;
+    boxes.resize(6*numEle);
+
+#pragma omp parallel for
+    for (int e = 0; e < numEle; e++) {
+        double *box = &boxes[6*e];
+        for (int k = 0; k < 8; k++) {
+            Node *theNode = theNodes[8*e+k];
+            const Vector &crd = theNode->getCrds();
+            for (int i = 0; i < 3; i++) {
+                double x = crd(i);
+                if (useDisp)
+                    x = crd(i) + theNode->getDisp()(i);
+                if (k == 0 || x < box[i])
+                    box[i] = x;
+                if (k == 0 || x > box[3+i])
+                    box[3+i] = x;
+            }
+        }
+    }
+
+    return this->binElements();
+}
+
+int
+SolidElementGrid::build(int numEle, const int *nodes, const double *crds)
+{
+    numElements = numEle;
+    boxes.resize(6*numEle);
+
+#pragma omp parallel for
+    for (int e = 0; e < numEle; e++) {
+        double *box = &boxes[6*e];
+        for (int k = 0; k < 8; k++) {
+            const double *crd = &crds[3*nodes[8*e+k]];
+            for (int i = 0; i < 3; i++) {
+                if (k == 0 || crd[i] < box[i])
+                    box[i] = crd[i];
+                if (k == 0 || crd[i] > box[3+i])
+                    box[3+i] = crd[i];
+            }
+        }
+    }
+
+    return this->binElements();
+}
+
+// put the elements in the cells their boxes overlap
+int
+SolidElementGrid::binElements(void)
+{
+    int numEle = numElements;
+    cellStart.clear();
+    cellElements.clear();
+    for (int i = 0; i < 3; i++)
+        numCells[i] = 0;
+    if (numEle == 0)
+        return 0;
+
+    // widen the boxes, find the extent of the grid and a cell size about
+    // that of the elements
+    double sumSize = 0.0;
+    double lower[3], upper[3];
+    for (int i = 0; i < 3; i++) {
+        lower[i] = boxes[i];
+        upper[i] = boxes[3+i];
+    }
+
+#pragma omp parallel for reduction(+:sumSize)
+    for (int e = 0; e < numEle; e++) {
+        double *box = &boxes[6*e];
+        double size = 0.0;
+        for (int i = 0; i < 3; i++)
+            if (box[3+i] - box[i] > size)
+                size = box[3+i] - box[i];
+        for (int i = 0; i < 3; i++) {
+            box[i] -= boxTolerance*size;
+            box[3+i] += boxTolerance*size;
+        }
+        sumSize += size;
+    }
+
+    for (int e = 0; e < numEle; e++)
+        for (int i = 0; i < 3; i++) {
+            if (boxes[6*e+i] < lower[i])
+                lower[i] = boxes[6*e+i];
+            if (boxes[6*e+3+i] > upper[i])
+                upper[i] = boxes[6*e+3+i];
+        }
+
+    double extent = 0.0;
+    for (int i = 0; i < 3; i++) {
+        origin[i] = lower[i];
+        if (upper[i] - lower[i] > extent)
+            extent = upper[i] - lower[i];
+    }
+
+    cellSize = sumSize/numEle;
+    if (cellSize <= 0.0)
+        cellSize = (extent > 0.0) ? extent : 1.0;
+
+    double totalCells;
+    do {
+        totalCells = 1.0;
+        for (int i = 0; i < 3; i++) {
+            numCells[i] = (int)((upper[i] - lower[i])/cellSize) + 1;
+            totalCells *= numCells[i];
+        }
+        if (totalCells > maxCellsPerElement*numEle + 8.0)
+            cellSize *= 1.25;
+    } while (totalCells > maxCellsPerElement*numEle + 8.0);
+
+    int nx = numCells[0];
+    int ny = numCells[1];
+    int nz = numCells[2];
+    int numCell = nx*ny*nz;
+
+    // the range of cells of each element
+    std::vector<int> ranges(6*numEle);
+
+#pragma omp parallel for
+    for (int e = 0; e < numEle; e++) {
+        for (int i = 0; i < 3; i++) {
+            int i0 = (int)((boxes[6*e+i] - origin[i])/cellSize);
+            int i1 = (int)((boxes[6*e+3+i] - origin[i])/cellSize);
+            ranges[6*e+i] = (i0 < 0) ? 0 : i0;
+            ranges[6*e+3+i] = (i1 < numCells[i]) ? i1 : numCells[i]-1;
+        }
+    }
+
+    // count the elements of each cell, then fill the cells and sort them,
+    // as the threads fill them in any order
+    cellStart.assign(numCell+1, 0);
+
+#pragma omp parallel for
+    for (int e = 0; e < numEle; e++) {
+        const int *range = &ranges[6*e];
+        for (int k = range[2]; k <= range[5]; k++)
+            for (int j = range[1]; j <= range[4]; j++)
+                for (int i = range[0]; i <= range[3]; i++) {
+#pragma omp atomic
+                    cellStart[(k*ny + j)*nx + i + 1]++;
+                }
+    }
+
+    for (int c = 0; c < numCell; c++)
+        cellStart[c+1] += cellStart[c];
+
+    cellElements.resize(cellStart[numCell]);
+    std::vector<int> next(cellStart.begin(), cellStart.end()-1);
+
+#pragma omp parallel for
+    for (int e = 0; e < numEle; e++) {
+        const int *range = &ranges[6*e];
+        for (int k = range[2]; k <= range[5]; k++)
+            for (int j = range[1]; j <= range[4]; j++)
+                for (int i = range[0]; i <= range[3]; i++) {
+                    int pos;
+#pragma omp atomic capture
+                    pos = next[(k*ny + j)*nx + i]++;
+                    cellElements[pos] = e;
+                }
+    }
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (int c = 0; c < numCell; c++)
+        std::sort(cellElements.begin() + cellStart[c], cellElements.begin() + cellStart[c+1]);
+
+    return 0;
+}
+
+int
+SolidElementGrid::getCandidates(double x, double y, double z, std::vector<int> &candidates) const
+{
+    candidates.clear();
+    if (numElements == 0)
+        return 0;
+
+    double p[3] = {x, y, z};
+    int index[3];
+    for (int i = 0; i < 3; i++) {
+        double s = (p[i] - origin[i])/cellSize;
+        if (s < 0.0 || s >= numCells[i])
+            return 0;
+        index[i] = (int)s;
+    }
+
+    int c = (index[2]*numCells[1] + index[1])*numCells[0] + index[0];
+    for (int n = cellStart[c]; n < cellStart[c+1]; n++) {
+        int e = cellElements[n];
+        const double *box = &boxes[6*e];
+        if (x >= box[0] && x <= box[3] &&
+            y >= box[1] && y <= box[4] &&
+            z >= box[2] && z <= box[5])
+            candidates.push_back(e);
+    }
+
+    return (int)candidates.size();
+}
@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for
+// SolidElementGrid, a uniform grid over the bounding boxes of a set of 8
+// node solid elements, used to find the elements a point may lie in
+// without trying all of them. Each cell holds the elements whose box
+// overlaps it, in the order they were given, so trying the candidates of
+// a point in turn finds the same first element as a loop over the whole
+// set. Only the boxes are kept, 6 doubles per element, the points being
+// tried against the elements themselves by the caller. The boxes and the
+// cell lists are built in parallel when OpenMP is used.
+
+#ifndef SolidElementGrid_h
+#define SolidElementGrid_h
+
+#include <vector>
+
+class Domain;
+
+class SolidElementGrid
+{
+  public:
+    SolidElementGrid();
+    ~SolidElementGrid();
+
+    // build the grid of the elements eleTags of theDomain, their nodes at
+    // the coordinates plus, with useDisp, the committed displacements;
+    // -1 if an element is missing or has not 8 nodes
+    int build(Domain &theDomain, const std::vector<int> &eleTags, bool useDisp);
+    // build the grid of numElements elements of a mesh given by arrays,
+    // element e having the nodes nodes[8*e] to nodes[8*e+7] and node n the
+    // coordinates crds[3*n] to crds[3*n+2]
+    int build(int numElements, const int *nodes, const double *crds);
+
+    // the indices of the elements whose bounding box contains the point,
+    // in increasing order; returns their number
+    int getCandidates(double x, double y, double z, std::vector<int> &candidates) const;
+
+    int getNumElements(void) const {return numElements;}
+    int getNumCells(void) const {return numCells[0]*numCells[1]*numCells[2];}
+
+  private:
+    int binElements(void);
+
+    int numElements;
+    std::vector<double> boxes;      // min x, y, z then max x, y, z per element
+
+    double origin[3];               // lower corner of the grid
+    double cellSize;
+    int numCells[3];
+    std::vector<int> cellStart;     // elements of cell c at cellElements[cellStart[c] to cellStart[c+1]]
+    std::vector<int> cellElements;
+};
+
+#endif
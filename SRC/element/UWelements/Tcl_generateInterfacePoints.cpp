@@ -19,6 +19,7 @@
 #include <FileStream.h>
 
 #include "Tcl_generateInterfacePoints.h"
+#include "SolidElementGrid.h"
 
 // Need the domain to get access to the elements
 #ifdef _PARALLEL_PROCESSING
@@ -28,6 +29,59 @@ extern PartitionedDomain theDomain;
 extern Domain theDomain;
 #endif
 
+// find for each of the numPts points the first element of solidEleTags it
+// lies in, trying only the candidates of theGrid, and its isoparametric
+// coordinates; pointEle is -1 for a point in none of them. The points are
+// independent, so they are searched in parallel
+static void
+locatePoints(const SolidElementGrid &theGrid, const std::vector<int> &solidEleTags, bool useDisp,
+    const Vector &cXr, const Vector &cYr, const Vector &cZr, int numPts,
+    std::vector<int> &pointEle, std::vector<double> &pointIso)
+{
+    pointEle.assign(numPts, -1);
+    pointIso.assign(3 * numPts, 0.0);
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int jj = 0; jj < numPts; jj++)
+    {
+        std::vector<int> candidates;
+        Vector tempX(8), tempY(8), tempZ(8);
+        double xi, eta, zeta;
+        bool inBounds = false;
+
+        theGrid.getCandidates(cXr(jj), cYr(jj), cZr(jj), candidates);
+        for (int cc = 0; cc < (int)candidates.size(); cc++)
+        {
+            int ii = candidates[cc];
+            Node **solidNodesPtr = theDomain.getElement(solidEleTags[ii])->getNodePtrs();
+            for (int kk = 0; kk < 8; kk++)
+            {
+                if (useDisp)
+                {
+                    tempX(kk) = solidNodesPtr[kk]->getCrds()(0) + solidNodesPtr[kk]->getDisp()(0);
+                    tempY(kk) = solidNodesPtr[kk]->getCrds()(1) + solidNodesPtr[kk]->getDisp()(1);
+                    tempZ(kk) = solidNodesPtr[kk]->getCrds()(2) + solidNodesPtr[kk]->getDisp()(2);
+                }
+                else
+                {
+                    tempX(kk) = solidNodesPtr[kk]->getCrds()(0);
+                    tempY(kk) = solidNodesPtr[kk]->getCrds()(1);
+                    tempZ(kk) = solidNodesPtr[kk]->getCrds()(2);
+                }
+            }
+            // inBounds is left true when the mapping does not converge
+            if (invIsoMapping(tempX, tempY, tempZ, cXr(jj), cYr(jj), cZr(jj), xi, eta, zeta, inBounds) == 0 && inBounds)
+            {
+                pointEle[jj] = ii;
+                pointIso[3 * jj + 0] = xi;
+                pointIso[3 * jj + 1] = eta;
+                pointIso[3 * jj + 2] = zeta;
+                break;
+            }
+        }
+    }
+}
+
 int
 TclCommand_GenerateInterfacePoints(ClientData clientData, Tcl_Interp *interp, int argc,
     TCL_Char **argv)
@@ -439,6 +493,12 @@ TclCommand_GenerateInterfacePoints(ClientData clientData, Tcl_Interp *interp, in
     }
     int startTag = maxTag + 1;
 
+    // bin the solid elements, so that each point is only tried against the
+    // elements whose bounding box contains it
+    SolidElementGrid theGrid;
+    if (theGrid.build(theDomain, solidEleTags, true) < 0)
+        return -1;
+
     FileStream crdsFile, quadNodes, quadElems;
     if (writeCoords)
         crdsFile.setFile(crdsFN, APPEND);
@@ -471,7 +531,6 @@ TclCommand_GenerateInterfacePoints(ClientData clientData, Tcl_Interp *interp, in
             return -1;
         }
         
-        Node** solidNodesPtr;
         Node** beamNodePtr;
 
         // get beam node locations (considering initial displacements)
@@ -595,98 +654,91 @@ TclCommand_GenerateInterfacePoints(ClientData clientData, Tcl_Interp *interp, in
                     opserr << "point " << ii * nP + jj + 1 << " : " << cXr(ii * nP + jj) << " " << cYr(ii * nP + jj) << " " << cZr(ii * nP + jj) << endln;
 
 
-        Vector tempX(8), tempY(8), tempZ(8);
+        std::vector<int> pointEle;
+        std::vector<double> pointIso;
         bool contactElemFlag = false;
         double xi, eta, zeta;
-        bool inBounds = false;
         // find intersections and create interface elements.
+        locatePoints(theGrid, solidEleTags, true, cXr, cYr, cZr, nP*nL, pointEle, pointIso);
         for (int jj = 0; jj < nP*nL; jj++)
         {
-            for (int ii = 0; ii < solidEleTags.size(); ii++)
+            int ii = pointEle[jj];
+            if (ii >= 0)
             {
                 theElement = theDomain.getElement(solidEleTags[ii]);
-                solidNodesPtr = theElement->getNodePtrs();
-                for (int kk = 0; kk < 8; kk++)
+                xi = pointIso[3 * jj + 0];
+                eta = pointIso[3 * jj + 1];
+                zeta = pointIso[3 * jj + 2];
+                contactElemFlag = true;
+                if (debugFlag)
+                    opserr << "Beam tag : " << beamTag << ", Solid tag : " << solidEleTags[ii] << ", Real Coordinates = (" << cXr(jj) << "," << cYr(jj) << "," << cZr(jj) << "), Iso Coordinates = (" << xi << "," << eta << "," << zeta << ")" << endln;
+
+                eleTagsInContact_unique.insert(solidEleTags[ii]);
+                maxTag++;
+
+                if (lagrangeTag > 1)
                 {
-                    tempX(kk) = solidNodesPtr[kk]->getCrds()(0) + solidNodesPtr[kk]->getDisp()(0);
-                    tempY(kk) = solidNodesPtr[kk]->getCrds()(1) + solidNodesPtr[kk]->getDisp()(1);
-                    tempZ(kk) = solidNodesPtr[kk]->getCrds()(2) + solidNodesPtr[kk]->getDisp()(2);
+                    // This is for a global element
+                    solidEleTagsInContact.push_back(solidEleTags[ii]);
+                    beamEleTagsInContact.push_back(beamEleTags[beamCount]);
+                    contactPt_xi.push_back(xi);
+                    contactPt_eta.push_back(eta);
+                    contactPt_zeta.push_back(zeta);
+                    contactPt_rho.push_back(loc_rho(jj));
+                    contactPt_theta.push_back(loc_theta(jj));
+                    contactPt_area.push_back(area);
+                    contactPt_length.push_back(L);
                 }
-                invIsoMapping(tempX, tempY, tempZ, cXr(jj), cYr(jj), cZr(jj), xi, eta, zeta, inBounds);
-                if (inBounds)
+                else
                 {
-                    contactElemFlag = true;
-                    if (debugFlag)
-                        opserr << "Beam tag : " << beamTag << ", Solid tag : " << solidEleTags[ii] << ", Real Coordinates = (" << cXr(jj) << "," << cYr(jj) << "," << cZr(jj) << "), Iso Coordinates = (" << xi << "," << eta << "," << zeta << ")" << endln;
-
-                    eleTagsInContact_unique.insert(solidEleTags[ii]);
-                    maxTag++;
-
-                    if (lagrangeTag > 1)
-                    {
-                        // This is for a global element
-                        solidEleTagsInContact.push_back(solidEleTags[ii]);
-                        beamEleTagsInContact.push_back(beamEleTags[beamCount]);
-                        contactPt_xi.push_back(xi);
-                        contactPt_eta.push_back(eta);
-                        contactPt_zeta.push_back(zeta);
-                        contactPt_rho.push_back(loc_rho(jj));
-                        contactPt_theta.push_back(loc_theta(jj));
-                        contactPt_area.push_back(area);
-                        contactPt_length.push_back(L);
-                    }
-                    else
-                    {
-                        // This is for a local element
+                    // This is for a local element
 
-                        // 0 = local penalty, 1 = local Augmented Lagrangian, 2 = global Lagrange, 3 = global embedded lagrange
-                        if (lagrangeTag == 0) {
-                            // theElement = new EmbeddedBeamInterface(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area, writeConnectivity, connectivityFN);
+                    // 0 = local penalty, 1 = local Augmented Lagrangian, 2 = global Lagrange, 3 = global embedded lagrange
+                    if (lagrangeTag == 0) {
+                        // theElement = new EmbeddedBeamInterface(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area, writeConnectivity, connectivityFN);
 			}
-                        else if (lagrangeTag == 1)
+                    else if (lagrangeTag == 1)
  			{
-                            // theElement = new EmbeddedBeamInterfaceAL(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
+                        // theElement = new EmbeddedBeamInterfaceAL(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
 			}
-                        if (lagrangeTag == -1)
+                    if (lagrangeTag == -1)
 			{
-                            //theElement = new EmbeddedBeamContact(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
+                        //theElement = new EmbeddedBeamContact(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
 			}
 
-                        // Create the return of the tcl command
-                        char buffer[40];
-                        sprintf(buffer, "%10i", maxTag);
-                        Tcl_AppendResult(interp, buffer, NULL);
+                    // Create the return of the tcl command
+                    char buffer[40];
+                    sprintf(buffer, "%10i", maxTag);
+                    Tcl_AppendResult(interp, buffer, NULL);
 
-                        // Add the created element to the domain
-                        if (theElement != 0)
+                    // Add the created element to the domain
+                    if (theElement != 0)
+                    {
+                        if (theDomain.addElement(theElement) == false)
                         {
-                            if (theDomain.addElement(theElement) == false)
-                            {
-                                opserr << "WARNING could not add element with tag: " << theElement->getTag() << " and of type: "
-                                    << theElement->getClassType() << " to the Domain\n";
-                                delete theElement;
-                                return -1;
-                            }
+                            opserr << "WARNING could not add element with tag: " << theElement->getTag() << " and of type: "
+                                << theElement->getClassType() << " to the Domain\n";
+                            delete theElement;
+                            return -1;
                         }
-
                     }
 
-                    if (writeCoords)
-                        crdsFile << maxTag << "\t" << cXr(jj) << "\t" << cYr(jj) << "\t" << cZr(jj) << "\n";
-                    
-                    if (writeQuadInfo)
-                    {
-                        int setNum = (int)(jj / nP);
-                        int ptNum = (int)(jj % nP);
-                        int pt1 = tagOffset + beamCount * (nL + 1) * (nP + 1) + setNum * (nP + 1) + ptNum;
-                        int pt3 = tagOffset + beamCount * (nL + 1) * (nP + 1) + (setNum + 1) * (nP + 1) + ptNum;
+                }
 
-                        quadElems << contactPointCount << " " << pt1 << " " << pt1 + 1 << " " << pt3 + 1 << " " << pt3 << endln;
-                    }
+                if (writeCoords)
+                    crdsFile << maxTag << "\t" << cXr(jj) << "\t" << cYr(jj) << "\t" << cZr(jj) << "\n";
+                
+                if (writeQuadInfo)
+                {
+                    int setNum = (int)(jj / nP);
+                    int ptNum = (int)(jj % nP);
+                    int pt1 = tagOffset + beamCount * (nL + 1) * (nP + 1) + setNum * (nP + 1) + ptNum;
+                    int pt3 = tagOffset + beamCount * (nL + 1) * (nP + 1) + (setNum + 1) * (nP + 1) + ptNum;
 
-                    contactPointCount++;
-                    break;
+                    quadElems << contactPointCount << " " << pt1 << " " << pt1 + 1 << " " << pt3 + 1 << " " << pt3 << endln;
                 }
+
+                contactPointCount++;
             }
         }
     }
@@ -1044,10 +1096,13 @@ TclCommand_GenerateToeInterfacePoints(ClientData clientData, Tcl_Interp *interp,
     }
     int startTag = maxTag + 1;
 
+    // bin the solid elements, so that each point is only tried against the
+    // elements whose bounding box contains it
+    SolidElementGrid theGrid;
+    if (theGrid.build(theDomain, solidEleTags, false) < 0)
+        return -1;
 
 
-
-    Node** solidNodesPtr;
     Node** beamNodePtr;
     Node*  toeNode;
 
@@ -1109,11 +1164,11 @@ TclCommand_GenerateToeInterfacePoints(ClientData clientData, Tcl_Interp *interp,
                 opserr << "point " << ii + 1 << " : " << cXr(ii) << " " << cYr(ii) << " " << cZr(ii) << endln;
 
 
-    Vector tempX(8), tempY(8), tempZ(8);
+    std::vector<int> pointEle;
+    std::vector<double> pointIso;
     int contactElemCount = 0, contactPointCount = 0;
     bool contactElemFlag = false;
     double xi, eta, zeta;
-    bool inBounds = false;
 
 
 
@@ -1122,78 +1177,69 @@ TclCommand_GenerateToeInterfacePoints(ClientData clientData, Tcl_Interp *interp,
     if (writeCoords)
         crdsFile.open(crdsFN, std::fstream::app);
 
+    locatePoints(theGrid, solidEleTags, false, cXr, cYr, cZr, numPts, pointEle, pointIso);
+
     for (int jj = 0; jj < numPts; jj++)
     {
-        for (int ii = 0; ii < solidEleTags.size(); ii++)
+        int ii = pointEle[jj];
+        if (ii >= 0)
         {
             theElement = theDomain.getElement(solidEleTags[ii]);
-            solidNodesPtr = theElement->getNodePtrs();
+            xi = pointIso[3 * jj + 0];
+            eta = pointIso[3 * jj + 1];
+            zeta = pointIso[3 * jj + 2];
+            contactElemFlag = true;
+            if (debugFlag)
+                opserr << "Beam tag : " << beamTag << ", Solid tag : " << solidEleTags[ii] << ", Real Coordinates = (" << cXr(jj) << "," << cYr(jj) << "," << cZr(jj) << "), Iso Coordinates = (" << xi << "," << eta << "," << zeta << ")" << endln;
 
-            for (int kk = 0; kk < 8; kk++)
+
+            maxTag++;
+            if (lagrangeTag > 1)
             {
-                if (debugFlag)
-                    opserr << "    Node " << kk + 1 << " coordinates = " << solidNodesPtr[kk]->getCrds();
-                tempX(kk) = solidNodesPtr[kk]->getCrds()(0);
-                tempY(kk) = solidNodesPtr[kk]->getCrds()(1);
-                tempZ(kk) = solidNodesPtr[kk]->getCrds()(2);
+                solidEleTagsInContact.push_back(solidEleTags[ii]);
+                contactPt_xi.push_back(xi);
+                contactPt_eta.push_back(eta);
+                contactPt_zeta.push_back(zeta);
+                contactPt_rho.push_back(loc_rho(jj));
+                contactPt_theta.push_back(loc_theta(jj));
+                contactPt_radius.push_back(radius);
             }
-            invIsoMapping(tempX, tempY, tempZ, cXr(jj), cYr(jj), cZr(jj), xi, eta, zeta, inBounds);
-            if (inBounds)
+            else
             {
-                contactElemFlag = true;
-                if (debugFlag)
-                    opserr << "Beam tag : " << beamTag << ", Solid tag : " << solidEleTags[ii] << ", Real Coordinates = (" << cXr(jj) << "," << cYr(jj) << "," << cZr(jj) << "), Iso Coordinates = (" << xi << "," << eta << "," << zeta << ")" << endln;
-
-
-                maxTag++;
-                if (lagrangeTag > 1)
+                // 0 = local penalty, 1 = local Augmented Lagrangian, 2 = global Lagrange, 3 = global embedded lagrange
+                if (lagrangeTag == 0)
                 {
-                    solidEleTagsInContact.push_back(solidEleTags[ii]);
-                    contactPt_xi.push_back(xi);
-                    contactPt_eta.push_back(eta);
-                    contactPt_zeta.push_back(zeta);
-                    contactPt_rho.push_back(loc_rho(jj));
-                    contactPt_theta.push_back(loc_theta(jj));
-                    contactPt_radius.push_back(radius);
+                    // theElement = new EmbeddedBeamInterface(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
                 }
-                else
+                else if (lagrangeTag == 1)
                 {
-                    // 0 = local penalty, 1 = local Augmented Lagrangian, 2 = global Lagrange, 3 = global embedded lagrange
-                    if (lagrangeTag == 0)
-                    {
-                        // theElement = new EmbeddedBeamInterface(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
-                    }
-                    else if (lagrangeTag == 1)
-                    {
-                        //theElement = new EmbeddedBeamInterfaceAL(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
-                    }
+                    //theElement = new EmbeddedBeamInterfaceAL(maxTag, beamTag, solidEleTags[ii], transfTag, loc_rho(jj), loc_theta(jj), xi, eta, zeta, radius, area);
+                }
 
-                    char buffer[40];
-                    sprintf(buffer, "%10i", maxTag);
-                    Tcl_AppendResult(interp, buffer, NULL);
+                char buffer[40];
+                sprintf(buffer, "%10i", maxTag);
+                Tcl_AppendResult(interp, buffer, NULL);
 
-                    if (theElement != 0)
+                if (theElement != 0)
+                {
+                    if (theDomain.addElement(theElement) == false)
                     {
-                        if (theDomain.addElement(theElement) == false)
-                        {
-                            opserr << "WARNING could not add element with tag: " << theElement->getTag() << " and of type: "
-                                << theElement->getClassType() << " to the Domain\n";
-                            delete theElement;
-                            return -1;
-                        }
+                        opserr << "WARNING could not add element with tag: " << theElement->getTag() << " and of type: "
+                            << theElement->getClassType() << " to the Domain\n";
+                        delete theElement;
+                        return -1;
                     }
-
                 }
 
-                if (writeCoords)
-                    crdsFile << maxTag << "\t" << cXr(jj) << "\t" << cYr(jj) << "\t" << cZr(jj) << "\n";
+            }
 
+            if (writeCoords)
+                crdsFile << maxTag << "\t" << cXr(jj) << "\t" << cYr(jj) << "\t" << cZr(jj) << "\n";
 
-                eleTagsInContact_unique.insert(solidEleTags[ii]);
 
-                contactPointCount++;
-                break;
-            }
+            eleTagsInContact_unique.insert(solidEleTags[ii]);
+
+            contactPointCount++;
         }
     }
 
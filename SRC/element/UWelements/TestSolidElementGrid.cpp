@@ -0,0 +1,218 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file is a driver to time and check the search for the
+// solid elements the interface points of a pile lie in, as done by
+// generateInterfacePoints. A block of about the number of elements asked
+// for, with the inner nodes moved at random so the elements are not
+// boxes, is binned in a SolidElementGrid and the points of piles
+// through it, laid out as the command does, are located by trying the
+// candidates of the grid with invIsoMapping. The first points are also
+// located by trying all the elements in turn, as the command did before,
+// and the two must give the same element. The time to build the grid and
+// to locate the points is reported, so running it from 10k elements up
+// shows how the search scales with the size of the mesh.
+//
+// usage: testSolidElementGrid <-elements n> <-piles n> <-nP n> <-nL n>
+//          <-brute n>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Vector.h>
+
+#include <SolidElementGrid.h>
+#include <Tcl_generateInterfacePoints.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+// a portable random number in [-1,1), so the mesh is the same everywhere
+static unsigned long long seed = 12345;
+
+static double
+random11(void)
+{
+  seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+  return (seed >> 11)*(2.0/9007199254740992.0) - 1.0;
+}
+
+// the first element of those in elements, or of all numElements if 0,
+// the point lies in, -1 if none; as in generateInterfacePoints an element
+// is only taken when the mapping to it converges
+static int
+locate(const int *nodes, const double *crds, const int *elements, int numElements,
+       double x, double y, double z)
+{
+  Vector X(8), Y(8), Z(8);
+  double xi, eta, zeta;
+  bool inBounds = false;
+
+  for (int i = 0; i < numElements; i++) {
+    int e = (elements != 0) ? elements[i] : i;
+    for (int k = 0; k < 8; k++) {
+      const double *crd = &crds[3*nodes[8*e+k]];
+      X(k) = crd[0];
+      Y(k) = crd[1];
+      Z(k) = crd[2];
+    }
+    if (invIsoMapping(X, Y, Z, x, y, z, xi, eta, zeta, inBounds) == 0 && inBounds)
+      return e;
+  }
+
+  return -1;
+}
+
+int
+main(int argc, char **argv)
+{
+  int numElements = 100000;
+  int numPiles = 4;
+  int nP = 20;
+  int nL = 20;
+  int numBrute = 20;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-elements") == 0 && i+1 < argc)
+      numElements = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-piles") == 0 && i+1 < argc)
+      numPiles = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-nP") == 0 && i+1 < argc)
+      nP = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-nL") == 0 && i+1 < argc)
+      nL = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-brute") == 0 && i+1 < argc)
+      numBrute = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "testSolidElementGrid - unknown option %s\n", argv[i]);
+      fprintf(stderr, "usage: testSolidElementGrid <-elements n> <-piles n> <-nP n> <-nL n>\n"
+	      "         <-brute n>\n");
+      return -1;
+    }
+  }
+
+  // a block of n x n x nz unit elements, twice as wide as it is deep
+  int n = (int)ceil(pow(2.0*numElements, 1.0/3.0));
+  int nz = (n + 1)/2;
+  numElements = n*n*nz;
+  int numNodes = (n+1)*(n+1)*(nz+1);
+
+  std::vector<double> crds(3*numNodes);
+  for (int k = 0; k <= nz; k++)
+    for (int j = 0; j <= n; j++)
+      for (int i = 0; i <= n; i++) {
+	double *crd = &crds[3*((k*(n+1) + j)*(n+1) + i)];
+	bool inner = i > 0 && i < n && j > 0 && j < n && k > 0 && k < nz;
+	crd[0] = i + (inner ? 0.2*random11() : 0.0);
+	crd[1] = j + (inner ? 0.2*random11() : 0.0);
+	crd[2] = -nz + k + (inner ? 0.2*random11() : 0.0);
+      }
+
+  std::vector<int> nodes(8*numElements);
+  for (int k = 0; k < nz; k++)
+    for (int j = 0; j < n; j++)
+      for (int i = 0; i < n; i++) {
+	int *ele = &nodes[8*((k*n + j)*n + i)];
+	for (int c = 0; c < 2; c++) {
+	  int base = ((k+c)*(n+1) + j)*(n+1) + i;
+	  ele[4*c+0] = base;
+	  ele[4*c+1] = base + 1;
+	  ele[4*c+2] = base + n+1 + 1;
+	  ele[4*c+3] = base + n+1;
+	}
+      }
+
+  // vertical piles of radius 0.4 from the surface to half the depth, the
+  // points at the middle of nL segments along them and nP around
+  const double radius = 0.4;
+  double length = 0.5*nz;
+  int numPoints = numPiles*nL*nP;
+  std::vector<double> points(3*numPoints);
+  for (int p = 0; p < numPiles; p++) {
+    double x0 = (p + 0.5)*n/numPiles + 0.123;
+    double y0 = 0.5*n + 0.321;
+    for (int ii = 0; ii < nL; ii++)
+      for (int jj = 0; jj < nP; jj++) {
+	double t = (0.5 + jj)/nP*2.0*PI;
+	double *point = &points[3*((p*nL + ii)*nP + jj)];
+	point[0] = x0 + radius*cos(t);
+	point[1] = y0 + radius*sin(t);
+	point[2] = -(1.0 + 2.0*ii)/(2.0*nL)*length;
+      }
+  }
+
+  clock_t start = clock();
+  SolidElementGrid theGrid;
+  theGrid.build(numElements, &nodes[0], &crds[0]);
+  double timeBuild = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+  std::vector<int> found(numPoints);
+  int numCandidates = 0;
+  start = clock();
+  std::vector<int> candidates;
+  for (int i = 0; i < numPoints; i++) {
+    double *point = &points[3*i];
+    int num = theGrid.getCandidates(point[0], point[1], point[2], candidates);
+    numCandidates += num;
+    found[i] = (num > 0) ? locate(&nodes[0], &crds[0], &candidates[0], num,
+				  point[0], point[1], point[2]) : -1;
+  }
+  double timeLocate = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+  int numFound = 0;
+  for (int i = 0; i < numPoints; i++)
+    if (found[i] >= 0)
+      numFound++;
+
+  printf("%d elements, %d cells: built in %.3f s, %d of %d points located in %.3f s, "
+	 "%.1f candidates per point\n", numElements, theGrid.getNumCells(), timeBuild,
+	 numFound, numPoints, timeLocate, (double)numCandidates/numPoints);
+
+  if (numBrute > numPoints)
+    numBrute = numPoints;
+  int numDiff = 0;
+  start = clock();
+  for (int i = 0; i < numBrute; i++) {
+    double *point = &points[3*i];
+    if (locate(&nodes[0], &crds[0], 0, numElements, point[0], point[1], point[2]) != found[i])
+      numDiff++;
+  }
+  double timeBrute = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+  if (numBrute > 0) {
+    printf("search of all the elements: %d points in %.3f s, %.3f s for all the points\n",
+	   numBrute, timeBrute, timeBrute*numPoints/numBrute);
+    if (numDiff > 0) {
+      printf("%d of %d points in a different element  FAILED\n", numDiff, numBrute);
+      return -1;
+    }
+    printf("%d points in the same element  PASSED\n", numBrute);
+  }
+
+  return 0;
+}
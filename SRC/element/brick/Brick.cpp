@@ -29,6 +29,7 @@
 
 #include <stdio.h> 
 #include <stdlib.h> 
+#include <string.h>
 #include <math.h> 
 
 #include <ID.h> 
@@ -48,6 +49,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <ElementGeometryCache.h>
 
 void* OPS_Brick()
 {
@@ -108,10 +110,13 @@ const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0,
   
 static Matrix B(6,3) ;
 
+//the cache of an element holds Shape[4][8][8] then dvol[8]
+static const int geomSize = 4*8*8 + 8 ;
+
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
- connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+ connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), geomCache(0)
 {
   B.Zero();
 
@@ -140,7 +145,7 @@ Brick::Brick(int tag,
 	     NDMaterial &theMaterial,
 	     double b1, double b2, double b3)
   :Element(tag, ELE_TAG_Brick),
-   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), geomCache(0)
 {
   B.Zero();
 
@@ -184,7 +189,8 @@ Brick::~Brick( )
 
   if (Ki != 0)
     delete Ki;
-  
+
+  ElementGeometryCache::release(geomCache, geomSize);
 }
 
 
@@ -198,6 +204,19 @@ void  Brick::setDomain( Domain *theDomain )
   for ( i=0; i<8; i++ ) 
      nodePointers[i] = theDomain->getNode( connectedExternalNodes(i) ) ;
 
+  //keep the shape functions and volume elements of the gauss points
+  ElementGeometryCache::release(geomCache, geomSize);
+  geomCache = 0;
+  for ( i=0; i<8; i++ ) 
+    if (nodePointers[i] == 0)
+      break;
+  if (i == 8) {
+    double *geom = ElementGeometryCache::allocate(geomSize);
+    if (geom != 0)
+      formShapeFunctions((double (*)[8][8])geom, geom + 4*8*8);
+    geomCache = geom;
+  }
+
   this->DomainComponent::setDomain(theDomain);
 
 }
@@ -384,7 +403,6 @@ const Matrix&  Brick::getInitialStiff( )
     return *Ki;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
-  static const int ndm = 3 ;
   static const int ndf = 3 ; 
   static const int nstress = 6 ;
   static const int numberNodes = 8 ;
@@ -395,10 +413,7 @@ const Matrix&  Brick::getInitialStiff( )
   int jj, kk ;
 
   
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
   static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
   static Vector strain(nstress) ;  //strain
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
@@ -422,42 +437,8 @@ const Matrix&  Brick::getInitialStiff( )
   //zero stiffness and residual 
   stiff.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  formShapeFunctions( Shape, dvol ) ;
   
 
   //gauss loop 
@@ -659,8 +640,6 @@ const Vector&  Brick::getResistingForceIncInertia( )
 void   Brick::formInertiaTerms( int tangFlag ) 
 {
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int numberNodes = 8 ;
@@ -671,16 +650,12 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix 
-
   double dvol[numberGauss] ; //volume element
 
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
-
   static Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
@@ -692,39 +667,8 @@ void   Brick::formInertiaTerms( int tangFlag )
   //zero mass 
   mass.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  formShapeFunctions( Shape, dvol ) ;
   
 
 
@@ -800,8 +744,6 @@ Brick::update(void)
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int nstress = 6 ;
@@ -812,17 +754,11 @@ Brick::update(void)
 
   static const int nShape = 4 ;
 
-  int i, j, k, p, q ;
+  int i, j, p, q ;
   int success ;
   
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
   static double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
-
   static Vector strain(nstress) ;  //strain
 
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
@@ -842,42 +778,8 @@ Brick::update(void)
   //-------------------------------------------------------
 
   
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  formShapeFunctions( Shape, dvol ) ;
   
 
   //gauss loop 
@@ -967,8 +869,6 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int nstress = 6 ;
@@ -982,14 +882,8 @@ void  Brick::formResidAndTangent( int tang_flag )
   int i, j, k, p, q ;
 
 
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
   static double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
-
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
@@ -1020,42 +914,8 @@ void  Brick::formResidAndTangent( int tang_flag )
   stiff.Zero( ) ;
   resid.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  formShapeFunctions( Shape, dvol ) ;
   
 
   //gauss loop 
@@ -1202,6 +1062,65 @@ void   Brick::computeBasis( )
 
 }
 
+//*************************************************************************
+//shape functions and volume elements at the gauss points, copied from the
+//cache when there is one
+
+void   Brick::formShapeFunctions( double Shape[4][8][8], double dvol[8] )
+{
+  static const int nShape = 4 ;
+
+  static const int numberNodes = 8 ;
+
+  int i, j, k, p, q ;
+
+  static double xsj ;  // determinant jacaobian matrix 
+
+  static double gaussPoint[3] ;
+
+  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+
+  if (geomCache != 0) {
+    memcpy(Shape, geomCache, 4*8*8*sizeof(double));
+    memcpy(dvol, geomCache + 4*8*8, 8*sizeof(double));
+    return;
+  }
+
+  //compute basis vectors and local nodal coordinates
+  computeBasis( ) ;
+
+  //gauss loop to compute and save shape functions 
+
+  int count = 0 ;
+
+  for ( i = 0; i < 2; i++ ) {
+    for ( j = 0; j < 2; j++ ) {
+      for ( k = 0; k < 2; k++ ) {
+
+        gaussPoint[0] = sg[i] ;        
+	gaussPoint[1] = sg[j] ;        
+	gaussPoint[2] = sg[k] ;
+
+	//get shape functions    
+	shp3d( gaussPoint, xsj, shp, xl ) ;
+
+	//save shape functions
+	for ( p = 0; p < nShape; p++ ) {
+	  for ( q = 0; q < numberNodes; q++ )
+	    Shape[p][q][count] = shp[p][q] ;
+	} // end for p
+
+
+	//volume element to also be saved
+	dvol[count] = wg[count] * xsj ;  
+
+	count++ ;
+
+      } //end for k
+    } //end for j
+  } // end for i 
+}
+
 //*************************************************************************
 //compute B
 
@@ -100,6 +100,7 @@ class Brick : public Element {
     const Matrix &getTangentStiff();
     const Matrix &getInitialStiff();    
     const Matrix &getMass();    
+    bool hasConstantMassAndDamp(void) {return true;}
 
     void zeroLoad( ) ;
     int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -175,6 +176,11 @@ class Brick : public Element {
     //compute coordinate system
     void computeBasis( ) ;
 
+    //shape functions and volume elements at the gauss points, kept in
+    //geomCache from setDomain
+    void formShapeFunctions( double Shape[4][8][8], double dvol[8] ) ;
+    double *geomCache ;
+
     //compute B matrix
     const Matrix& computeB( int node, const double shp[4][8] ) ;
   
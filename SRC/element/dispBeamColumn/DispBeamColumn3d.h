@@ -76,6 +76,7 @@ class DispBeamColumn3d : public Element
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);
+    bool hasConstantMassAndDamp(void) {return cMass == 0;}
 
     void zeroLoad();
     int addLoad(ElementalLoad *theLoad, double loadFactor);
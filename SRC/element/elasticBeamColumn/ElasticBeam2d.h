@@ -70,6 +70,7 @@ class ElasticBeam2d : public Element
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
+    bool hasConstantMassAndDamp(void) {return cMass == 0;}
 
     void zeroLoad(void);	
     int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -942,13 +942,8 @@ ForceBeamColumn2d::update()
   static Vector vr(NEBD);       // element residual displacements
   static Matrix f(NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
-  
-  I.Zero();
-  for (i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
 
   int numSubdivide = 1;
   bool converged = false;
@@ -1104,27 +1099,36 @@ ForceBeamColumn2d::update()
 	      dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
 	    }
 	    
-	    // set section deformations
-	    if (initialFlag != 0)
-	      vsSubdivide[i] += dvs;
+	    // a section whose unbalance Ss - Ssr is negligible is left at its
+	    // trial state, with dvs as its residual deformation; the unbalance
+	    // stays in Ssr and the section is updated once it has grown
+	    bool skip = (l == 0 && initialFlag != 0 && numSubdivide == 1 &&
+			 fabs(dSs ^ dvs)*wtL < tol/numSections);
 
-	    if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-	      opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
-	      return -1;
-	    }
+	    if (!skip) {
+
+	      // set section deformations
+	      if (initialFlag != 0)
+		vsSubdivide[i] += dvs;
 
-	    // get section resisting forces
-	    SsrSubdivide[i] = sections[i]->getStressResultant();
+	      if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
+		opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
+		return -1;
+	      }
 
-	    // get section flexibility matrix
-	    fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	      // get section resisting forces
+	      SsrSubdivide[i] = sections[i]->getStressResultant();
 
-	    // calculate section residual deformations
-	    // dvs = fs * (Ss - Ssr);
-	    dSs = Ss;
-	    dSs.addVector(1.0, SsrSubdivide[i], -1.0);  // dSs = Ss - Ssr[i];
+	      // get section flexibility matrix
+	      fsSubdivide[i] = sections[i]->getSectionFlexibility();
+
+	      // calculate section residual deformations
+	      // dvs = fs * (Ss - Ssr);
+	      dSs = Ss;
+	      dSs.addVector(1.0, SsrSubdivide[i], -1.0);  // dSs = Ss - Ssr[i];
 	    
-	    dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
+	      dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
+	    }
 	    
 	    // integrate element flexibility matrix
 	    // f = f + (b^ fs * b) * wtL;
@@ -1209,7 +1213,7 @@ ForceBeamColumn2d::update()
 	  
 	  // calculate element stiffness matrix
 	  // invert3by3Matrix(f, kv);	  
-	  if (f.Solve(I, kvTrial) < 0)
+	  if (invertSmallMatrix(f, kvTrial) < 0)
 	    opserr << "ForceBeamColumn2d::update() -- could not invert flexibility\n";
 				    
 	  // dv = vin + dvTrial  - vr
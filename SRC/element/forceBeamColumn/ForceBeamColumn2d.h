@@ -102,6 +102,7 @@ class ForceBeamColumn2d: public Element
   const Matrix &getTangentStiff(void);
   const Matrix &getInitialStiff(void);
   const Matrix &getMass(void);    
+  bool hasConstantMassAndDamp(void) {return true;}
   
   void zeroLoad(void);	
   int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -84,13 +84,13 @@ using std::ifstream;
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3d::theMatrix(12,12);
-Vector ForceBeamColumn3d::theVector(12);
-double ForceBeamColumn3d::workArea[200];
+OPS_THREAD_LOCAL Matrix ForceBeamColumn3d::theMatrix(12,12);
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::theVector(12);
+OPS_THREAD_LOCAL double ForceBeamColumn3d::workArea[200];
 
-Vector *ForceBeamColumn3d::vsSubdivide = 0;
-Matrix *ForceBeamColumn3d::fsSubdivide = 0;
-Vector *ForceBeamColumn3d::SsrSubdivide = 0;
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::vsSubdivide[maxNumSections];
+OPS_THREAD_LOCAL Matrix ForceBeamColumn3d::fsSubdivide[maxNumSections];
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::SsrSubdivide[maxNumSections];
 
 void* OPS_ForceBeamColumn3d()
 {
@@ -196,16 +196,6 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   theNodes[0] = 0;  
   theNodes[1] = 0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0) 
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -247,16 +237,6 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
 
   this->setSectionPointers(numSec, sec);
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn3d():
@@ -495,17 +475,17 @@ ForceBeamColumn3d::getInitialStiff(void)
   if (Ki != 0)
     return *Ki;
 
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix  
+  static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
   
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
-  static Matrix kvInit(NEBD, NEBD);
+  static OPS_THREAD_LOCAL Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumn3d::getInitialStiff() -- could not invert flexibility";
 
@@ -674,6 +654,19 @@ void
   }
 }
 
+bool
+ForceBeamColumn3d::isThreadSafe(void)
+{
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (sections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
   /********* NEWTON , SUBDIVIDE AND INITIAL ITERATIONS ********************
    */
   int
@@ -690,13 +683,13 @@ void
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    static OPS_THREAD_LOCAL Vector dv(NEBD);
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    static OPS_THREAD_LOCAL Vector vin(NEBD);
     vin = v;
     vin -= dv;
     double L = crdTransf->getInitialLength();
@@ -708,29 +701,24 @@ void
     double wt[maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static OPS_THREAD_LOCAL Vector vr(NEBD);       // element residual displacements
+    static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm 
     int i, j;
 
-    I.Zero();
-    for (i=0; i<NEBD; i++)
-      I(i,i) = 1.0;
-
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static OPS_THREAD_LOCAL Vector dSe(NEBD);
+    static OPS_THREAD_LOCAL Vector dvToDo(NEBD);
+    static OPS_THREAD_LOCAL Vector dvTrial(NEBD);
+    static OPS_THREAD_LOCAL Vector SeTrial(NEBD);
+    static OPS_THREAD_LOCAL Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    static OPS_THREAD_LOCAL double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions = 10;
@@ -806,10 +794,10 @@ void
 	      int order      = sections[i]->getOrder();
 	      const ID &code = sections[i]->getType();
 
-	      static Vector Ss;
-	      static Vector dSs;
-	      static Vector dvs;
-	      static Matrix fb;
+	      static OPS_THREAD_LOCAL Vector Ss;
+	      static OPS_THREAD_LOCAL Vector dSs;
+	      static OPS_THREAD_LOCAL Vector dvs;
+	      static OPS_THREAD_LOCAL Matrix fb;
 
 	      Ss.setData(workArea, order);
 	      dSs.setData(&workArea[order], order);
@@ -890,37 +878,46 @@ void
 		dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
 	      }
 
-	      // set section deformations
-	      if (initialFlag != 0)
-		vsSubdivide[i] += dvs;
+	      // a section whose unbalance Ss - Ssr is negligible is left at its
+	      // trial state, with dvs as its residual deformation; the unbalance
+	      // stays in Ssr and the section is updated once it has grown
+	      bool skip = (l == 0 && initialFlag != 0 && numSubdivide == 1 &&
+			   fabs(dSs ^ dvs)*wtL < tol/numSections);
 
-	      if ( sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-		opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
-		return -1;
-	      }
+	      if (!skip) {
 
-	      // get section resisting forces
-	      SsrSubdivide[i] = sections[i]->getStressResultant();
+		// set section deformations
+		if (initialFlag != 0)
+		  vsSubdivide[i] += dvs;
 
-	      // get section flexibility matrix
-	      // FRANK 
-	      fsSubdivide[i] = sections[i]->getSectionFlexibility();
+		if ( sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
+		  opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
+		  return -1;
+		}
 
-	      /*
-	      const Matrix &sectionStiff = sections[i]->getSectionTangent();
-	      int n = sectionStiff.noRows();
-	      Matrix I(n,n); I.Zero(); for (int l=0; l<n; l++) I(l,l) = 1.0;
-	      Matrix sectionFlex(n,n);
-	      sectionStiff.SolveSVD(I, sectionFlex, 1.0e-6);
-	      fsSubdivide[i] = sectionFlex;	    
-	      */
+		// get section resisting forces
+		SsrSubdivide[i] = sections[i]->getStressResultant();
 
-	      // calculate section residual deformations
-	      // dvs = fs * (Ss - Ssr);
-	      dSs = Ss;
-	      dSs.addVector(1.0, SsrSubdivide[i], -1.0);  // dSs = Ss - Ssr[i];
+		// get section flexibility matrix
+		// FRANK 
+		fsSubdivide[i] = sections[i]->getSectionFlexibility();
 
-	      dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
+		/*
+		const Matrix &sectionStiff = sections[i]->getSectionTangent();
+		int n = sectionStiff.noRows();
+		Matrix I(n,n); I.Zero(); for (int l=0; l<n; l++) I(l,l) = 1.0;
+		Matrix sectionFlex(n,n);
+		sectionStiff.SolveSVD(I, sectionFlex, 1.0e-6);
+		fsSubdivide[i] = sectionFlex;	    
+		*/
+
+		// calculate section residual deformations
+		// dvs = fs * (Ss - Ssr);
+		dSs = Ss;
+		dSs.addVector(1.0, SsrSubdivide[i], -1.0);  // dSs = Ss - Ssr[i];
+
+		dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
+	      }
 
 	      // integrate element flexibility matrix
 	      // f = f + (b^ fs * b) * wtL;
@@ -1058,7 +1055,7 @@ void
 	    // invert3by3Matrix(f, kv);	  
 	    // FRANK
 	    //	  if (f.SolveSVD(I, kvTrial, 1.0e-12) < 0)
-	    if (f.Solve(I, kvTrial) < 0)
+	    if (invertSmallMatrix(f, kvTrial) < 0)
 	      opserr << "ForceBeamColumn3d::update() -- could not invert flexibility\n";
 	    
 	    // dv = vin + dvTrial  - vr
@@ -1599,7 +1596,7 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
     int i, j , k;
     int loc = 0;
 
-    static ID idData(11);  
+    static OPS_THREAD_LOCAL ID idData(11);  
     idData(0) = this->getTag();
     idData(1) = connectedExternalNodes(0);
     idData(2) = connectedExternalNodes(1);
@@ -1736,7 +1733,7 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
     int dbTag = this->getDbTag();
     int i,j,k;
 
-    static ID idData(11); // one bigger than needed 
+    static OPS_THREAD_LOCAL ID idData(11); // one bigger than needed 
 
     if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
       opserr << "ForceBeamColumn3d::recvSelf() - failed to recv ID data\n";
@@ -2149,7 +2146,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
       double xL1 = xL - 1.0;
       double wtL = wt[i] * L;
 
-      static Vector sp;
+      static OPS_THREAD_LOCAL Vector sp;
       sp.setData(workArea, order);
       sp.Zero();
 
@@ -2157,7 +2154,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
       const Matrix &fse = sections[i]->getInitialFlexibility();
 
-      static Vector e;
+      static OPS_THREAD_LOCAL Vector e;
       e.setData(&workArea[order], order);
 
       e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2197,13 +2194,13 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 					      Vector sectionDispls[]) const
   {
      // get basic displacements and increments
-     static Vector ub(NEBD);
+     static OPS_THREAD_LOCAL Vector ub(NEBD);
      ub = crdTransf->getBasicTrialDisp();    
 
      double L = crdTransf->getInitialLength();
 
      // get integration point positions and weights
-     static double pts[maxNumSections];
+     static OPS_THREAD_LOCAL double pts[maxNumSections];
      beamIntegr->getSectionLocations(numSections, L, pts);
 
      // setup Vandermode and CBDI influence matrices
@@ -2217,7 +2214,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      // get section curvatures
      Vector kappa_y(numSections);  // curvature
      Vector kappa_z(numSections);  // curvature
-     static Vector vs;                // section deformations 
+     static OPS_THREAD_LOCAL Vector vs;                // section deformations 
 
      for (i=0; i<numSections; i++) {
 	 // THIS IS VERY INEFFICIENT ... CAN CHANGE IF RUNS TOO SLOW
@@ -2252,8 +2249,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      //cout << "kappa_z: " << kappa_z;   
 
      Vector v(numSections), w(numSections);
-     static Vector xl(NDM), uxb(NDM);
-     static Vector xg(NDM), uxg(NDM); 
+     static OPS_THREAD_LOCAL Vector xl(NDM), uxb(NDM);
+     static OPS_THREAD_LOCAL Vector xg(NDM), uxg(NDM); 
      // double theta;                             // angle of twist of the sections
 
      // v = ls * kappa_z;  
@@ -2328,9 +2325,9 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer  
     else if (flag == 2) {
-       static Vector xAxis(3);
-       static Vector yAxis(3);
-       static Vector zAxis(3);
+       static OPS_THREAD_LOCAL Vector xAxis(3);
+       static OPS_THREAD_LOCAL Vector yAxis(3);
+       static OPS_THREAD_LOCAL Vector zAxis(3);
 
 
        crdTransf->getLocalAxes(xAxis, yAxis, zAxis);
@@ -2375,8 +2372,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 	 << T << ' ' << MY2 << ' '  <<  MZ2 << endln;
 
        // plastic hinge rotation
-       static Vector vp(6);
-       static Matrix fe(6,6);
+       static OPS_THREAD_LOCAL Vector vp(6);
+       static OPS_THREAD_LOCAL Matrix fe(6,6);
        this->getInitialFlexibility(fe);
        vp = crdTransf->getBasicTrialDisp();
        vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2384,9 +2381,9 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 	 << " " << 0.1*L << " " << 0.1*L << endln;
 
        // allocate array of vectors to store section coordinates and displacements
-       static int maxNumSections = 0;
-       static Vector *coords = 0;
-       static Vector *displs = 0;
+       static OPS_THREAD_LOCAL int maxNumSections = 0;
+       static OPS_THREAD_LOCAL Vector *coords = 0;
+       static OPS_THREAD_LOCAL Vector *displs = 0;
        if (maxNumSections < numSections) {
 	 if (coords != 0) 
 	   delete [] coords;
@@ -2488,8 +2485,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
   ForceBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes, int numModes)
   {
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static OPS_THREAD_LOCAL Vector v1(3);
+    static OPS_THREAD_LOCAL Vector v2(3);
 
     if (displayMode >= 0) {
 
@@ -2708,8 +2705,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 int 
 ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
+  static OPS_THREAD_LOCAL Vector vp(6);
+  static OPS_THREAD_LOCAL Matrix fe(6,6);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2793,7 +2790,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    static OPS_THREAD_LOCAL Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -2883,7 +2880,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static Vector d(4);
+    static OPS_THREAD_LOCAL Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -2997,7 +2994,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 	indata.close();
       }
 
-      static Vector result8(2);
+      static OPS_THREAD_LOCAL Vector result8(2);
       result8(0) = value;
       result8(1) = checkvalue1;      
       
@@ -3023,7 +3020,7 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    static OPS_THREAD_LOCAL Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -3048,7 +3045,7 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC3d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(6);
+    static OPS_THREAD_LOCAL Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -3141,14 +3138,14 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(6);
+    static OPS_THREAD_LOCAL Vector dvpdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(6,6);
+    static OPS_THREAD_LOCAL Matrix fe(6,6);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -3156,7 +3153,7 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(6,6);
+    static OPS_THREAD_LOCAL Matrix fek(6,6);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3313,7 +3310,7 @@ ForceBeamColumn3d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumn3d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(6);
+  static OPS_THREAD_LOCAL Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3323,7 +3320,7 @@ ForceBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 6);
 
-  static Vector P(12);
+  static OPS_THREAD_LOCAL Vector P(12);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3361,7 +3358,7 @@ ForceBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(6);
+  static OPS_THREAD_LOCAL Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3475,7 +3472,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(6);
+  static OPS_THREAD_LOCAL Vector dvdh(6);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3606,7 +3603,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(6,6);
+  static OPS_THREAD_LOCAL Matrix dfedh(6,6);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3614,7 +3611,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(6);
+  static OPS_THREAD_LOCAL Vector dqdh(6);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3625,7 +3622,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn3d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(6,6);
+  static OPS_THREAD_LOCAL Matrix dfedh(6,6);
 
   dfedh.Zero();
 
@@ -98,10 +98,12 @@ class ForceBeamColumn3d: public Element
   int revertToLastCommit(void);        
   int revertToStart(void);
   int update(void);    
+  bool isThreadSafe(void);
   
   const Matrix &getTangentStiff(void);
   const Matrix &getInitialStiff(void);
   const Matrix &getMass(void);    
+  bool hasConstantMassAndDamp(void) {return true;}
   
   void zeroLoad(void);	
   int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -193,18 +195,18 @@ class ForceBeamColumn3d: public Element
 
   bool isTorsion;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static OPS_THREAD_LOCAL Matrix theMatrix;
+  static OPS_THREAD_LOCAL Vector theVector;
+  static OPS_THREAD_LOCAL double workArea[];
   
   enum {maxNumSections = 10};
   
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
+  static OPS_THREAD_LOCAL Vector vsSubdivide[maxNumSections];
+  static OPS_THREAD_LOCAL Vector SsrSubdivide[maxNumSections];
+  static OPS_THREAD_LOCAL Matrix fsSubdivide[maxNumSections];
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
@@ -74,6 +74,7 @@ class FourNodeQuad : public Element
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);    
     const Matrix &getMass(void);    
+    bool hasConstantMassAndDamp(void) {return true;}
 
     void zeroLoad();
     int addLoad(ElementalLoad *theLoad, double loadFactor);
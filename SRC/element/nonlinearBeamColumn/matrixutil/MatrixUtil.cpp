@@ -95,6 +95,73 @@ void invertMatrix(int n, const Matrix &a, Matrix &b)
 }
 
 
+// inverse of a matrix of order up to 6 (the flexibility of a beam element)
+// by Gauss-Jordan elimination with partial pivoting, on local arrays so
+// without the copies and work arrays of Matrix::Solve() and LAPACK;
+// larger matrices go to Matrix::Invert(). Returns -1 if a is singular.
+int invertSmallMatrix(const Matrix &a, Matrix &b)
+{
+  int n = a.noRows();
+  if (n > 6 || n != a.noCols() || n != b.noRows() || n != b.noCols())
+    return a.Invert(b);
+
+  double m[6][6];
+  double inv[6][6];
+  int i, j, k;
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n; j++) {
+      m[i][j] = a(i,j);
+      inv[i][j] = (i == j) ? 1.0 : 0.0;
+    }
+
+  for (k = 0; k < n; k++) {
+
+    // pivot on the largest entry of column k
+    int p = k;
+    double pmax = fabs(m[k][k]);
+    for (i = k+1; i < n; i++)
+      if (fabs(m[i][k]) > pmax) {
+	pmax = fabs(m[i][k]);
+	p = i;
+      }
+
+    if (pmax == 0.0)
+      return -1;
+
+    if (p != k)
+      for (j = 0; j < n; j++) {
+	double tmp = m[k][j]; m[k][j] = m[p][j]; m[p][j] = tmp;
+	tmp = inv[k][j]; inv[k][j] = inv[p][j]; inv[p][j] = tmp;
+      }
+
+    double oneOverPivot = 1.0/m[k][k];
+    for (j = 0; j < n; j++) {
+      m[k][j] *= oneOverPivot;
+      inv[k][j] *= oneOverPivot;
+    }
+
+    for (i = 0; i < n; i++) {
+      if (i == k)
+	continue;
+      double mik = m[i][k];
+      if (mik == 0.0)
+	continue;
+      for (j = 0; j < n; j++) {
+	m[i][j] -= mik*m[k][j];
+	inv[i][j] -= mik*inv[k][j];
+      }
+    }
+  }
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n; j++)
+      b(i,j) = inv[i][j];
+
+  return 0;
+}
+
+
 
 void getCBDIinfluenceMatrix(int nIntegrPts, const Matrix &xi_pt, double L, Matrix &ls)
 {
@@ -31,6 +31,7 @@
 double invert2by2Matrix(const Matrix &a, Matrix &b);
 double invert3by3Matrix(const Matrix &a, Matrix &b);
 void   invertMatrix(int n, const Matrix &a, Matrix &b);
+int    invertSmallMatrix(const Matrix &a, Matrix &b);
 void   getCBDIinfluenceMatrix(int nIntegrPts, const Matrix &xi_pt, double L, Matrix &ls);
 void   getCBDIinfluenceMatrix(int nIntegrPts, double *pts, double L, Matrix &ls);
 
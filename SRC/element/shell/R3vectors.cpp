@@ -95,11 +95,11 @@ Vector LovelyEig( const Matrix &M )
   int     rot, its, i, j , k ;
   double  g, h, aij, sm, thresh, t, c, s, tau ;
 
-  static Matrix  v(3,3) ;
-  static Vector  d(3) ;
-  static Vector  a(3) ;
-  static Vector  b(3) ; 
-  static Vector  z(3) ;
+  static OPS_THREAD_LOCAL Matrix  v(3,3) ;
+  static OPS_THREAD_LOCAL Vector  d(3) ;
+  static OPS_THREAD_LOCAL Vector  a(3) ;
+  static OPS_THREAD_LOCAL Vector  b(3) ; 
+  static OPS_THREAD_LOCAL Vector  z(3) ;
 
   static const double tol = 1.0e-08 ;
  
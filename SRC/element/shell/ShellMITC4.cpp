@@ -49,6 +49,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <ElementGeometryCache.h>
 #include <map>
 
 #define min(a,b) ( (a)<(b) ? (a):(b) )
@@ -190,9 +191,9 @@ OPS_ShellMITC4(const ID& info)
 
 
 //static data
-Matrix  ShellMITC4::stiff(24,24) ;
-Vector  ShellMITC4::resid(24) ;
-Matrix  ShellMITC4::mass(24,24) ;
+OPS_THREAD_LOCAL Matrix  ShellMITC4::stiff(24,24) ;
+OPS_THREAD_LOCAL Vector  ShellMITC4::resid(24) ;
+OPS_THREAD_LOCAL Matrix  ShellMITC4::mass(24,24) ;
 
 //quadrature data
 const double  ShellMITC4::root3 = sqrt(3.0) ;
@@ -202,12 +203,21 @@ double ShellMITC4::sg[4] ;
 double ShellMITC4::tg[4] ;
 double ShellMITC4::wg[4] ;
 
+//geometry of a gauss point as formGeometry() leaves it: the B matrices
+//saveB[8][6][4], the drilling B matrices Bdrill[4][6], the shape functions
+//shp[3][4] and the volume element
+static const int geomB = 0 ;
+static const int geomDrill = geomB + 8*6*4 ;
+static const int geomShp = geomDrill + 4*6 ;
+static const int geomDvol = geomShp + 3*4 ;
+static const int geomSize = geomDvol + 1 ;
+
  
 
 //null constructor
 ShellMITC4::ShellMITC4( ) :
 Element( 0, ELE_TAG_ShellMITC4 ),
-connectedExternalNodes(4), load(0), Ki(0), doUpdateBasis(false)
+connectedExternalNodes(4), geomCache(0), doUpdateBasis(false), load(0), Ki(0)
 { 
   for (int i = 0 ;  i < 4; i++ ) 
     materialPointers[i] = 0;
@@ -239,7 +249,8 @@ ShellMITC4::ShellMITC4(  int tag,
 			 SectionForceDeformation &theMaterial,
 			 bool UpdateBasis) :
 Element( tag, ELE_TAG_ShellMITC4 ),
-connectedExternalNodes(4), load(0), Ki(0), doUpdateBasis(UpdateBasis)
+connectedExternalNodes(4), geomCache(0), doUpdateBasis(UpdateBasis),
+load(0), Ki(0)
 {
   int i;
 
@@ -294,6 +305,8 @@ ShellMITC4::~ShellMITC4( )
 
   if (Ki != 0)
     delete Ki;
+
+  ElementGeometryCache::release( geomCache, 4*geomSize ) ;
 }
 //**************************************************************************
 
@@ -302,8 +315,8 @@ ShellMITC4::~ShellMITC4( )
 void  ShellMITC4::setDomain( Domain *theDomain ) 
 {  
   int i, j ;
-  static Vector eig(3) ;
-  static Matrix ddMembrane(3,3) ;
+  static OPS_THREAD_LOCAL Vector eig(3) ;
+  static OPS_THREAD_LOCAL Matrix ddMembrane(3,3) ;
 
   //node pointers
   for ( i = 0; i < 4; i++ ) {
@@ -339,6 +352,15 @@ void  ShellMITC4::setDomain( Domain *theDomain )
   //basis vectors and local coordinates
   computeBasis( ) ;
 
+  //keep the geometry of the gauss points if the basis is not updated
+  ElementGeometryCache::release( geomCache, 4*geomSize ) ;
+  geomCache = 0 ;
+  if ( doUpdateBasis == false ) {
+    geomCache = ElementGeometryCache::allocate( 4*geomSize ) ;
+    if ( geomCache != 0 )
+      formGeometry( geomCache ) ;
+  }
+
   this->DomainComponent::setDomain(theDomain);
 }
 
@@ -413,6 +435,17 @@ int  ShellMITC4::revertToStart( )
   return success ;
 }
 
+//thread safe if its materials are
+bool  ShellMITC4::isThreadSafe( ) 
+{
+  for ( int i = 0; i < 4; i++ ) {
+    if ( materialPointers[i]->isThreadSafe( ) == false )
+      return false ;
+  }
+
+  return true ;
+}
+
 //print out element data
 void  ShellMITC4::Print( OPS_Stream &s, int flag )
 {
@@ -579,8 +612,8 @@ int
 ShellMITC4::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
-  static Vector stresses(32);
-  static Vector strains(32);
+  static OPS_THREAD_LOCAL Vector stresses(32);
+  static OPS_THREAD_LOCAL Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -656,186 +689,53 @@ const Matrix&  ShellMITC4::getInitialStiff( )
   int i,  j,  k, p, q ;
   int jj, kk ;
 
-  double volume = 0.0 ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[ngauss] ; //volume element
-
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
-
-  //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  double dvol ; //volume element
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static OPS_THREAD_LOCAL Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Matrix J0(2,2) ;  //Jacobian at center
- 
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  static OPS_THREAD_LOCAL Matrix dd(nstress,nstress) ;  //material tangent
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
+    static OPS_THREAD_LOCAL Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    static OPS_THREAD_LOCAL Matrix BJtran(ndf,nstress) ;
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    static OPS_THREAD_LOCAL Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    static OPS_THREAD_LOCAL Matrix BJtranD(ndf,nstress) ;
 
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    static OPS_THREAD_LOCAL double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    static OPS_THREAD_LOCAL double BdrillK[ndf] ;  
 
-    double *drillPointer ;
-
-    static double saveB[nstress][ndf][numnodes] ;
+    static OPS_THREAD_LOCAL double geomScratch[ngauss*geomSize] ;
 
   //-------------------------------------------------------
 
   stiff.Zero( ) ;
 
- 
-  double dx34 = xl[0][2]-xl[0][3];
-  double dy34 = xl[1][2]-xl[1][3];
-
-  double dx21 = xl[0][1]-xl[0][0];
-  double dy21 = xl[1][1]-xl[1][0];
-
-  double dx32 = xl[0][2]-xl[0][1];
-  double dy32 = xl[1][2]-xl[1][1];
-
-  double dx41 = xl[0][3]-xl[0][0];
-  double dy41 = xl[1][3]-xl[1][0];
-
-  Matrix G(4,12);
-  G.Zero();
-  double one_over_four = 0.25;
-  G(0,0)=-0.5;
-  G(0,1)=-dy41*one_over_four;
-  G(0,2)=dx41*one_over_four;
-  G(0,9)=0.5;
-  G(0,10)=-dy41*one_over_four;
-  G(0,11)=dx41*one_over_four;
-  G(1,0)=-0.5;
-  G(1,1)=-dy21*one_over_four;
-  G(1,2)=dx21*one_over_four;
-  G(1,3)=0.5;
-  G(1,4)=-dy21*one_over_four;
-  G(1,5)=dx21*one_over_four;
-  G(2,3)=-0.5;
-  G(2,4)=-dy32*one_over_four;
-  G(2,5)=dx32*one_over_four;
-  G(2,6)=0.5;
-  G(2,7)=-dy32*one_over_four;
-  G(2,8)=dx32*one_over_four;
-  G(3,6)=0.5;
-  G(3,7)=-dy34*one_over_four;
-  G(3,8)=dx34*one_over_four;
-  G(3,9)=-0.5;
-  G(3,10)=-dy34*one_over_four;
-  G(3,11)=dx34*one_over_four;
-
-  Matrix Ms(2,4);
-  Ms.Zero();
-  Matrix Bsv(2,12);
-  Bsv.Zero();
-
-  double Ax = -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
-  double Bx =  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
-  double Cx = -xl[0][0]-xl[0][1]+xl[0][2]+xl[0][3];
-
-  double Ay = -xl[1][0]+xl[1][1]+xl[1][2]-xl[1][3];
-  double By =  xl[1][0]-xl[1][1]+xl[1][2]-xl[1][3];
-  double Cy = -xl[1][0]-xl[1][1]+xl[1][2]+xl[1][3];
-
-  double alph = atan(Ay/Ax);
-  double beta = 3.141592653589793/2-atan(Cx/Cy);
-  Matrix Rot(2,2);
-  Rot.Zero();
-  Rot(0,0)=sin(beta);
-  Rot(0,1)=-sin(alph);
-  Rot(1,0)=-cos(beta);
-  Rot(1,1)=cos(alph);
-  Matrix Bs(2,12);
-  
-  double r1 = 0;
-  double r2 = 0;
-  double r3 = 0;
+  //B matrices and volume elements at the gauss points
+  const double *geom = geomCache ;
+  if ( geom == 0 ) {
+    formGeometry( geomScratch ) ;
+    geom = geomScratch ;
+  }
 
   //gauss loop 
   for ( i = 0; i < ngauss; i++ ) {
-    
-    r1 = Cx + sg[i]*Bx;
-    r3 = Cy + sg[i]*By;
-    r1 = r1*r1 + r3*r3;
-	r1 = sqrt (r1);
-	r2 = Ax + tg[i]*Bx;
-	r3 = Ay + tg[i]*By;
-	r2 = r2*r2 + r3*r3;
-	r2 = sqrt (r2);
 
-    //get shape functions    
-    shape2d( sg[i], tg[i], xl, shp, xsj ) ;
-    //volume element to also be saved
-    dvol[i] = wg[i] * xsj ;  
-    volume += dvol[i] ;
+    const double (*saveB)[ndf][numnodes] = 
+      (const double (*)[ndf][numnodes])( geom + i*geomSize + geomB ) ;
 
-    Ms(1,0)=1-sg[i];
-	Ms(0,1)=1-tg[i];
-	Ms(1,2)=1+sg[i];
-	Ms(0,3)=1+tg[i];
-	Bsv = Ms*G;
-
-    for ( j = 0; j < 12; j++ ) {
-		Bsv(0,j)=Bsv(0,j)*r1/(8*xsj);
-		Bsv(1,j)=Bsv(1,j)*r2/(8*xsj);
-    }
-    Bs=Rot*Bsv;
-    
-    // j-node loop to compute strain 
-    for ( j = 0; j < numnodes; j++ )  {
-
-      //compute B matrix 
+    const double (*Bdrill)[ndf] = 
+      (const double (*)[ndf])( geom + i*geomSize + geomDrill ) ;
 
-      Bmembrane = computeBmembrane( j, shp ) ;
-
-      Bbend = computeBbend( j, shp ) ;
-
-      for ( p = 0; p < 3; p++) {
-		  Bshear(0,p) = Bs(0,j*3+p);
-		  Bshear(1,p) = Bs(1,j*3+p);
-      }//end for p
-
-      BJ = assembleB( Bmembrane, Bbend, Bshear ) ;
-
-      //save the B-matrix
-      for (p=0; p<nstress; p++) {
-	    for (q=0; q<ndf; q++ )
-	      saveB[p][q][j] = BJ(p,q) ;
-      }//end for p
-
-      //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	    //BdrillJ[p] = *drillPointer++ ;
-	    BdrillJ[p] = *drillPointer ; //set p-th component
-	    drillPointer++ ;             //pointer arithmetic
-      }//end for p
-    } // end for j
-  
+    dvol = geom[ i*geomSize + geomDvol ] ;
 
     dd = materialPointers[i]->getInitialTangent( ) ;
-    dd *= dvol[i] ;
+    dd *= dvol ;
 
     //residual and tangent calculations node loops
 
@@ -864,17 +764,14 @@ const Matrix&  ShellMITC4::getInitialStiff( )
       }//end for p
 
       //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	BdrillJ[p] = *drillPointer ;
-	drillPointer++ ;
-      }//end for p
+      for (p=0; p<ndf; p++ )
+	BdrillJ[p] = Bdrill[j][p] ;
 
       //BJtranD = BJtran * dd ;
       BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 ) ;
       
       for (p=0; p<ndf; p++) 
-	BdrillJ[p] *= ( Ktt*dvol[i] ) ;
+	BdrillJ[p] *= ( Ktt*dvol ) ;
       
       kk = 0 ;
       for ( k = 0; k < numnodes; k++ ) {
@@ -887,11 +784,8 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 	
 	
 	//drilling B matrix
-	drillPointer = computeBdrill( k, shp ) ;
-	for (p=0; p<ndf; p++ ) {
-	  BdrillK[p] = *drillPointer ;
-	  drillPointer++ ;
-	}//end for p
+	for (p=0; p<ndf; p++ )
+	  BdrillK[p] = Bdrill[k][p] ;
 	
 	//stiffJK = BJtranD * BK  ;
 	// +  transpose( 1,ndf,BdrillJ ) * BdrillK ; 
@@ -951,7 +845,7 @@ int
 ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int tangFlag = 1 ;
-  static Vector r(24);
+  static OPS_THREAD_LOCAL Vector r(24);
 
   int i;
 
@@ -1001,7 +895,7 @@ const Vector&  ShellMITC4::getResistingForce( )
 //get residual with inertia terms
 const Vector&  ShellMITC4::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  static OPS_THREAD_LOCAL Vector res(24);
   int tang_flag = 0 ; //don't get the tangent
 
   //do tangent and residual here 
@@ -1046,9 +940,9 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static OPS_THREAD_LOCAL double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  static OPS_THREAD_LOCAL Vector momentum(ndf) ;
 
 
   int i, j, k, p;
@@ -1064,10 +958,19 @@ ShellMITC4::formInertiaTerms( int tangFlag )
   for ( i = 0; i < numberGauss; i++ ) {
 
     //get shape functions    
-    shape2d( sg[i], tg[i], xl, shp, xsj ) ;
+    if ( geomCache != 0 ) {
+      for ( p = 0; p < nShape; p++ ) {
+	for ( j = 0; j < numberNodes; j++ )
+	  shp[p][j] = geomCache[ i*geomSize + geomShp + p*numberNodes + j ] ;
+      }
+      dvol = geomCache[ i*geomSize + geomDvol ] ;
+    }
+    else {
+      shape2d( sg[i], tg[i], xl, shp, xsj ) ;
 
-    //volume element to also be saved
-    dvol = wg[i] * xsj ;  
+      //volume element to also be saved
+      dvol = wg[i] * xsj ;  
+    }
 
 
     //node loop to compute accelerations
@@ -1175,70 +1078,223 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 
   int success ;
   
-  double volume = 0.0 ;
+  double dvol ; //volume element
+
+  static OPS_THREAD_LOCAL Vector strain(nstress) ;  //strain
 
-  static double xsj ;  // determinant jacaobian matrix 
+  static OPS_THREAD_LOCAL Vector residJ(ndf) ; //nodeJ residual 
 
-  static double dvol[ngauss] ; //volume element
+  static OPS_THREAD_LOCAL Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector strain(nstress) ;  //strain
+  static OPS_THREAD_LOCAL Vector stress(nstress) ;  //stress resultants
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  static OPS_THREAD_LOCAL Matrix dd(nstress,nstress) ;  //material tangent
 
-  //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
+  double epsDrill = 0.0 ;  //drilling "strain"
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  double tauDrill = 0.0 ; //drilling "stress"
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  //---------B-matrices------------------------------------
 
-  static Vector stress(nstress) ;  //stress resultants
+    static OPS_THREAD_LOCAL Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+    static OPS_THREAD_LOCAL Matrix BJtran(ndf,nstress) ;
 
-  static Matrix J0(2,2) ;  //Jacobian at center
- 
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+    static OPS_THREAD_LOCAL Matrix BK(nstress,ndf) ;      // B matrix node k
 
-  double epsDrill = 0.0 ;  //drilling "strain"
+    static OPS_THREAD_LOCAL Matrix BJtranD(ndf,nstress) ;
 
-  double tauDrill = 0.0 ; //drilling "stress"
 
-  //---------B-matrices------------------------------------
+    static OPS_THREAD_LOCAL double BdrillJ[ndf] ; //drill B matrix
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static OPS_THREAD_LOCAL double BdrillK[ndf] ;  
 
-    static Matrix BJtran(ndf,nstress) ;
+    static OPS_THREAD_LOCAL double geomScratch[ngauss*geomSize] ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+  //------------------------------------------------------- 
 
-    static Matrix BJtranD(ndf,nstress) ;
+  //zero stiffness and residual 
+  stiff.Zero( ) ;
+  resid.Zero( ) ;
 
+  //B matrices and volume elements at the gauss points, formed here
+  //unless they were kept at setDomain
+  const double *geom = geomCache ;
+  if ( geom == 0 ) {
+//start Yuli Huang (yulihuang@gmail.com) & Xinzheng Lu (luxz@tsinghua.edu.cn)
+    if (doUpdateBasis == true)
+      updateBasis( );
+//end Yuli Huang (yulihuang@gmail.com) & Xinzheng Lu (luxz@tsinghua.edu.cn)
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    formGeometry( geomScratch ) ;
+    geom = geomScratch ;
+  }
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+  //gauss loop 
+  for ( i = 0; i < ngauss; i++ ) {
+
+    const double (*saveB)[ndf][numnodes] = 
+      (const double (*)[ndf][numnodes])( geom + i*geomSize + geomB ) ;
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    const double (*Bdrill)[ndf] = 
+      (const double (*)[ndf])( geom + i*geomSize + geomDrill ) ;
 
+    dvol = geom[ i*geomSize + geomDvol ] ;
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    //zero the strains
+    strain.Zero( ) ;
+    epsDrill = 0.0 ;
 
-    static double BdrillK[ndf] ;  
 
-    double *drillPointer ;
+    // j-node loop to compute strain 
+    for ( j = 0; j < numnodes; j++ )  {
 
-    static double saveB[nstress][ndf][numnodes] ;
+      //extract BJ
+      for (p=0; p<nstress; p++) {
+	for (q=0; q<ndf; q++ )
+	  BJ(p,q) = saveB[p][q][j] ;
+      }//end for p
 
-  //------------------------------------------------------- 
+      //nodal "displacements" 
+      const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
 
-  //zero stiffness and residual 
-  stiff.Zero( ) ;
-  resid.Zero( ) ;
+      //compute the strain
+      //strain += (BJ*ul) ; 
+      strain.addMatrixVector(1.0, BJ,ul,1.0 ) ;
+
+      //drilling "strain" 
+      for ( p = 0; p < ndf; p++ )
+	      epsDrill +=  Bdrill[j][p]*ul(p) ;
+    } // end for j
   
-//start Yuli Huang (yulihuang@gmail.com) & Xinzheng Lu (luxz@tsinghua.edu.cn)
-  if (doUpdateBasis == true)
-    updateBasis( );
-//end Yuli Huang (yulihuang@gmail.com) & Xinzheng Lu (luxz@tsinghua.edu.cn)
+
+    //send the strain to the material 
+    success = materialPointers[i]->setTrialSectionDeformation( strain ) ;
+
+    //compute the stress
+    stress = materialPointers[i]->getStressResultant( ) ;
+
+    //drilling "stress" 
+    tauDrill = Ktt * epsDrill ;
+
+    //multiply by volume element
+    stress   *= dvol ;
+    tauDrill *= dvol ;
+
+    if ( tang_flag == 1 ) {
+      dd = materialPointers[i]->getSectionTangent( ) ;
+      dd *= dvol ;
+    } //end if tang_flag
+
+
+    //residual and tangent calculations node loops
+
+    jj = 0 ;
+    for ( j = 0; j < numnodes; j++ ) {
+
+      //extract BJ
+      for (p=0; p<nstress; p++) {
+	    for (q=0; q<ndf; q++ )
+	      BJ(p,q) = saveB[p][q][j]   ;
+      }//end for p
+
+      //multiply bending terms by (-1.0) for correct statement
+      // of equilibrium  
+      for ( p = 3; p < 6; p++ ) {
+	    for ( q = 3; q < 6; q++ ) 
+	      BJ(p,q) *= (-1.0) ;
+      } //end for p
+
+      //transpose 
+      for (p=0; p<ndf; p++) {
+	    for (q=0; q<nstress; q++) 
+	      BJtran(p,q) = BJ(q,p) ;
+      }//end for p
+
+      residJ.addMatrixVector(0.0, BJtran,stress,1.0 ) ;
+
+      //drilling B matrix
+      for (p=0; p<ndf; p++ )
+	    BdrillJ[p] = Bdrill[j][p] ;
+
+      //residual including drill
+      for ( p = 0; p < ndf; p++ )
+        resid( jj + p ) += ( residJ(p) + BdrillJ[p]*tauDrill ) ;
+
+      if ( tang_flag == 1 ) {
+
+	    BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 ) ;
+
+	    for (p=0; p<ndf; p++) 
+	      BdrillJ[p] *= ( Ktt*dvol ) ;
+
+        kk = 0 ;
+        for ( k = 0; k < numnodes; k++ ) {
+
+	      //extract BK
+	      for (p=0; p<nstress; p++) {
+	        for (q=0; q<ndf; q++ )
+	          BK(p,q) = saveB[p][q][k]   ;
+	      }//end for p
+	  
+	      //drilling B matrix
+	      for (p=0; p<ndf; p++ )
+	        BdrillK[p] = Bdrill[k][p] ;
+ 
+          //stiffJK = BJtranD * BK  ;
+	      // +  transpose( 1,ndf,BdrillJ ) * BdrillK ; 
+	      stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 ) ;
+
+          for ( p = 0; p < ndf; p++ )  {
+	        for ( q = 0; q < ndf; q++ ) {
+	          stiff( jj+p, kk+q ) += stiffJK(p,q) 
+		                   + ( BdrillJ[p]*BdrillK[q] ) ;
+	        }//end for q
+          }//end for p
+
+          kk += ndf ;
+        } // end for k loop
+
+      } // end if tang_flag 
+
+    jj += ndf ;
+    } // end for j loop
+
+  } //end for i gauss loop 
+  
+  return ;
+}
+
+
+//************************************************************************
+//B matrices, drilling B matrices, shape functions and volume elements at
+//the gauss points from the local coordinates and basis, geomSize values
+//a gauss point laid out as given by geomB, geomDrill, geomShp and geomDvol
+
+void
+ShellMITC4::formGeometry( double *geom )
+{
+  static const int ndf = 6 ; //two membrane plus three bending plus one drill
+
+  static const int nstress = 8 ; //three membrane, three moment, two shear
+
+  static const int ngauss = 4 ;
+
+  static const int numnodes = 4 ;
+
+  int i, j, p, q ;
+
+  double xsj ;  // determinant jacaobian matrix 
+
+  static OPS_THREAD_LOCAL Matrix BJ(nstress,ndf) ;      // B matrix node J
+
+  static OPS_THREAD_LOCAL Matrix Bbend(3,3) ;  // bending B matrix
+
+  static OPS_THREAD_LOCAL Matrix Bshear(2,3) ; // shear B matrix
+
+  static OPS_THREAD_LOCAL Matrix Bmembrane(3,2) ; // membrane B matrix
+
+  double *drillPointer ;
 
   double dx34 = xl[0][2]-xl[0][3];
   double dy34 = xl[1][2]-xl[1][3];
@@ -1310,6 +1366,13 @@ ShellMITC4::formResidAndTangent( int tang_flag )
   //gauss loop 
   for ( i = 0; i < ngauss; i++ ) {
 
+    double (*saveB)[ndf][numnodes] = 
+      (double (*)[ndf][numnodes])( geom + i*geomSize + geomB ) ;
+
+    double (*Bdrill)[ndf] = (double (*)[ndf])( geom + i*geomSize + geomDrill ) ;
+
+    double (*shp)[numnodes] = (double (*)[numnodes])( geom + i*geomSize + geomShp ) ;
+
     r1 = Cx + sg[i]*Bx;
     r3 = Cy + sg[i]*By;
     r1 = r1*r1 + r3*r3;
@@ -1322,8 +1385,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
     //get shape functions    
     shape2d( sg[i], tg[i], xl, shp, xsj ) ;
     //volume element to also be saved
-    dvol[i] = wg[i] * xsj ;  
-    volume += dvol[i] ;
+    geom[ i*geomSize + geomDvol ] = wg[i] * xsj ;  
 
     Ms(1,0)=1-sg[i];
 	Ms(0,1)=1-tg[i];
@@ -1337,16 +1399,9 @@ ShellMITC4::formResidAndTangent( int tang_flag )
     }
     Bs=Rot*Bsv;
 
-    //zero the strains
-    strain.Zero( ) ;
-    epsDrill = 0.0 ;
-
-
-    // j-node loop to compute strain 
+    // j-node loop to compute the B matrices
     for ( j = 0; j < numnodes; j++ )  {
 
-      //compute B matrix 
-
       Bmembrane = computeBmembrane( j, shp ) ;
 
       Bbend = computeBbend( j, shp ) ;
@@ -1364,128 +1419,13 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 	  saveB[p][q][j] = BJ(p,q) ;
       }//end for p
 
-
-      //nodal "displacements" 
-      const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
-
-      //compute the strain
-      //strain += (BJ*ul) ; 
-      strain.addMatrixVector(1.0, BJ,ul,1.0 ) ;
-
       //drilling B matrix
       drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	      BdrillJ[p] = *drillPointer ; //set p-th component
-	      drillPointer++ ;             //pointer arithmetic
-      }//end for p
-
-      //drilling "strain" 
-      for ( p = 0; p < ndf; p++ )
-	      epsDrill +=  BdrillJ[p]*ul(p) ;
+      for (p=0; p<ndf; p++ )
+	Bdrill[j][p] = drillPointer[p] ;
     } // end for j
-  
-
-    //send the strain to the material 
-    success = materialPointers[i]->setTrialSectionDeformation( strain ) ;
-
-    //compute the stress
-    stress = materialPointers[i]->getStressResultant( ) ;
-
-    //drilling "stress" 
-    tauDrill = Ktt * epsDrill ;
-
-    //multiply by volume element
-    stress   *= dvol[i] ;
-    tauDrill *= dvol[i] ;
-
-    if ( tang_flag == 1 ) {
-      dd = materialPointers[i]->getSectionTangent( ) ;
-      dd *= dvol[i] ;
-    } //end if tang_flag
-
-
-    //residual and tangent calculations node loops
-
-    jj = 0 ;
-    for ( j = 0; j < numnodes; j++ ) {
-
-      //extract BJ
-      for (p=0; p<nstress; p++) {
-	    for (q=0; q<ndf; q++ )
-	      BJ(p,q) = saveB[p][q][j]   ;
-      }//end for p
-
-      //multiply bending terms by (-1.0) for correct statement
-      // of equilibrium  
-      for ( p = 3; p < 6; p++ ) {
-	    for ( q = 3; q < 6; q++ ) 
-	      BJ(p,q) *= (-1.0) ;
-      } //end for p
-
-      //transpose 
-      for (p=0; p<ndf; p++) {
-	    for (q=0; q<nstress; q++) 
-	      BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-      residJ.addMatrixVector(0.0, BJtran,stress,1.0 ) ;
-
-      //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	    BdrillJ[p] = *drillPointer ;
-	    drillPointer++ ;
-      }//end for p
-
-      //residual including drill
-      for ( p = 0; p < ndf; p++ )
-        resid( jj + p ) += ( residJ(p) + BdrillJ[p]*tauDrill ) ;
-
-      if ( tang_flag == 1 ) {
-
-	    BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 ) ;
-
-	    for (p=0; p<ndf; p++) 
-	      BdrillJ[p] *= ( Ktt*dvol[i] ) ;
-
-        kk = 0 ;
-        for ( k = 0; k < numnodes; k++ ) {
-
-	      //extract BK
-	      for (p=0; p<nstress; p++) {
-	        for (q=0; q<ndf; q++ )
-	          BK(p,q) = saveB[p][q][k]   ;
-	      }//end for p
-	  
-	      //drilling B matrix
-	      drillPointer = computeBdrill( k, shp ) ;
-	      for (p=0; p<ndf; p++ ) {
-	        BdrillK[p] = *drillPointer ;
-	        drillPointer++ ;
-	      }//end for p
- 
-          //stiffJK = BJtranD * BK  ;
-	      // +  transpose( 1,ndf,BdrillJ ) * BdrillK ; 
-	      stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 ) ;
-
-          for ( p = 0; p < ndf; p++ )  {
-	        for ( q = 0; q < ndf; q++ ) {
-	          stiff( jj+p, kk+q ) += stiffJK(p,q) 
-		                   + ( BdrillJ[p]*BdrillK[q] ) ;
-	        }//end for q
-          }//end for p
-
-          kk += ndf ;
-        } // end for k loop
-
-      } // end if tang_flag 
-
-    jj += ndf ;
-    } // end for j loop
 
   } //end for i gauss loop 
-  
-  return ;
 }
 
 
@@ -1500,11 +1440,11 @@ ShellMITC4::computeBasis( )
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  static OPS_THREAD_LOCAL Vector temp(3) ;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  static OPS_THREAD_LOCAL Vector v1(3) ;
+  static OPS_THREAD_LOCAL Vector v2(3) ;
+  static OPS_THREAD_LOCAL Vector v3(3) ;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1588,11 +1528,11 @@ ShellMITC4::updateBasis( )
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  static OPS_THREAD_LOCAL Vector temp(3) ;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  static OPS_THREAD_LOCAL Vector v1(3) ;
+  static OPS_THREAD_LOCAL Vector v2(3) ;
+  static OPS_THREAD_LOCAL Vector v3(3) ;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1674,10 +1614,10 @@ ShellMITC4::computeBdrill( int node, const double shp[3][4] )
 {
 
   //static Matrix Bdrill(1,6) ;
-  static double Bdrill[6] ;
-  static double B1 ;
-  static double B2 ;
-  static double B6 ;
+  static OPS_THREAD_LOCAL double Bdrill[6] ;
+  static OPS_THREAD_LOCAL double B1 ;
+  static OPS_THREAD_LOCAL double B2 ;
+  static OPS_THREAD_LOCAL double B6 ;
 
 
 //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
@@ -1732,17 +1672,17 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
 
-    static Matrix B(8,6) ;
+    static OPS_THREAD_LOCAL Matrix B(8,6) ;
 
-    static Matrix BmembraneShell(3,3) ; 
+    static OPS_THREAD_LOCAL Matrix BmembraneShell(3,3) ; 
     
-    static Matrix BbendShell(3,3) ; 
+    static OPS_THREAD_LOCAL Matrix BbendShell(3,3) ; 
 
-    static Matrix BshearShell(2,6) ;
+    static OPS_THREAD_LOCAL Matrix BshearShell(2,6) ;
  
-    static Matrix Gmem(2,3) ;
+    static OPS_THREAD_LOCAL Matrix Gmem(2,3) ;
 
-    static Matrix Gshear(3,6) ;
+    static OPS_THREAD_LOCAL Matrix Gshear(3,6) ;
 
     int p, q ;
     int pp ;
@@ -1849,7 +1789,7 @@ const Matrix&
 ShellMITC4::computeBmembrane( int node, const double shp[3][4] ) 
 {
 
-  static Matrix Bmembrane(3,2) ;
+  static OPS_THREAD_LOCAL Matrix Bmembrane(3,2) ;
 
 //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1880,7 +1820,7 @@ const Matrix&
 ShellMITC4::computeBbend( int node, const double shp[3][4] )
 {
 
-    static Matrix Bbend(3,2) ;
+    static OPS_THREAD_LOCAL Matrix Bbend(3,2) ;
 
 //---Bbend Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1923,8 +1863,8 @@ ShellMITC4::shape2d( double ss, double tt,
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static double xs[2][2] ;
-  static double sx[2][2] ;
+  static OPS_THREAD_LOCAL double xs[2][2] ;
+  static OPS_THREAD_LOCAL double sx[2][2] ;
 
   for ( i = 0; i < 4; i++ ) {
       shp[2][i] = ( 0.5 + s[i]*ss )*( 0.5 + t[i]*tt ) ;
@@ -2002,7 +1942,7 @@ int  ShellMITC4::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(14);
+  static OPS_THREAD_LOCAL ID idData(14);
   
   int i;
   for (i = 0; i < 4; i++) {
@@ -2034,7 +1974,7 @@ int  ShellMITC4::sendSelf (int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(5);
+  static OPS_THREAD_LOCAL Vector vectData(5);
   vectData(0) = Ktt;
   vectData(1) = alphaM;
   vectData(2) = betaK;
@@ -2067,7 +2007,7 @@ int  ShellMITC4::recvSelf (int commitTag,
   
   int dataTag = this->getDbTag();
 
-  static ID idData(14);
+  static OPS_THREAD_LOCAL ID idData(14);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -2085,7 +2025,7 @@ int  ShellMITC4::recvSelf (int commitTag,
   else
     doUpdateBasis = false;
 
-  static Vector vectData(5);
+  static OPS_THREAD_LOCAL Vector vectData(5);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellMITC4::sendSelf() - " << this->getTag() << " failed to send ID\n";
@@ -2159,9 +2099,9 @@ ShellMITC4::displaySelf(Renderer &theViewer, int displayMode, float fact, const
     const Vector &end3Crd = nodePointers[2]->getCrds();	
     const Vector &end4Crd = nodePointers[3]->getCrds();	
 
-    static Matrix coords(4,3);
-    static Vector values(4);
-    static Vector P(24) ;
+    static OPS_THREAD_LOCAL Matrix coords(4,3);
+    static OPS_THREAD_LOCAL Vector values(4);
+    static OPS_THREAD_LOCAL Vector P(24) ;
 
     for (int j=0; j<4; j++)
 		values(j) = 0.0;
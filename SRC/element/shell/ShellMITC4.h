@@ -84,6 +84,9 @@ class ShellMITC4 : public Element {
     //revert to start 
     int revertToStart( ) ;
 
+    //thread safe if its materials are
+    bool isThreadSafe( ) ;
+
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
 	
@@ -91,6 +94,7 @@ class ShellMITC4 : public Element {
     const Matrix &getTangentStiff( ) ;
     const Matrix &getInitialStiff( );
     const Matrix &getMass( );
+    bool hasConstantMassAndDamp( ) {return doUpdateBasis == false;}
 
     // methods for applying loads
     void zeroLoad( void );	
@@ -118,10 +122,10 @@ class ShellMITC4 : public Element {
   private : 
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static OPS_THREAD_LOCAL Matrix stiff ;
+    static OPS_THREAD_LOCAL Vector resid ;
+    static OPS_THREAD_LOCAL Matrix mass ;
+    static OPS_THREAD_LOCAL Matrix damping ;
 
     //quadrature data
     static const double root3 ;
@@ -151,6 +155,11 @@ class ShellMITC4 : public Element {
 
     //compute local coordinates and basis
     void computeBasis( ) ;
+
+    //B matrices, shape functions and volume elements at the gauss points,
+    //kept in geomCache from setDomain when the basis is not updated
+    void formGeometry( double *geom ) ;
+    double *geomCache ;
     //start Yuli Huang (yulihuang@gmail.com) & Xinzheng Lu (luxz@tsinghua.edu.cn)
     bool doUpdateBasis;
     void updateBasis( ) ;
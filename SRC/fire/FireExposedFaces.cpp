@@ -0,0 +1,169 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+
+#include <FireExposedFaces.h>
+#include <HeatFluxBC.h>
+#include <HeatFluxBCIter.h>
+#include <PrescribedSurfFlux.h>
+#include <HeatTransferDomain.h>
+#include <HeatTransferElement.h>
+#include <HeatTransferNode.h>
+#include <ID.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+
+FireExposedFaces::FireExposedFaces()
+:numFluxes(0), sizeFluxes(0), theFluxes(0), pointStart(0), centroids(0), faceValues(0),
+ numPoints(0), sizePoints(0), pointCrds(0), pointValues(0)
+{
+
+}
+
+
+FireExposedFaces::~FireExposedFaces()
+{
+	if (theFluxes != 0)
+		delete [] theFluxes;
+	if (pointStart != 0)
+		delete [] pointStart;
+	if (centroids != 0)
+		delete [] centroids;
+	if (faceValues != 0)
+		delete [] faceValues;
+	if (pointCrds != 0)
+		delete [] pointCrds;
+	if (pointValues != 0)
+		delete [] pointValues;
+}
+
+
+int
+FireExposedFaces::setFluxBCs(HeatFluxBCIter& theFluxIter, int num)
+{
+	// pointStart always has numFluxes+1 entries, also with no BCs
+	if (num > sizeFluxes || pointStart == 0) {
+		if (theFluxes != 0)
+			delete [] theFluxes;
+		if (pointStart != 0)
+			delete [] pointStart;
+		if (centroids != 0)
+			delete [] centroids;
+		if (faceValues != 0)
+			delete [] faceValues;
+		theFluxes = new HeatFluxBC*[num];
+		pointStart = new int[num+1];
+		centroids = new double[3*num];
+		faceValues = new double[num];
+		sizeFluxes = num;
+	}
+
+	numFluxes = 0;
+	HeatFluxBC* theFlux;
+	while ((theFlux = theFluxIter()) != 0 && numFluxes < num)
+		theFluxes[numFluxes++] = theFlux;
+
+	// first pass counts the points, the second stores them
+	numPoints = 0;
+	for (int pass = 0; pass < 2; pass++) {
+		if (pass == 1 && numPoints > sizePoints) {
+			if (pointCrds != 0)
+				delete [] pointCrds;
+			if (pointValues != 0)
+				delete [] pointValues;
+			pointCrds = new double[3*numPoints];
+			pointValues = new double[numPoints];
+			sizePoints = numPoints;
+		}
+
+		int point = 0;
+		for (int i = 0; i < numFluxes; i++) {
+			HeatFluxBC* theFlux = theFluxes[i];
+			HeatTransferDomain* theDomain = theFlux->getDomain();
+			if (theDomain == 0) {
+				opserr << "FireExposedFaces::setFluxBCs() - HeatFluxBC has not been associated with a domain\n";
+				return -1;
+			}
+
+			HeatTransferElement* theEle = theDomain->getElement(theFlux->getElementTag());
+			if (theEle == 0) {
+				opserr << "FireExposedFaces::setFluxBCs() - no element with tag "
+					<< theFlux->getElementTag() << " exists in the domain\n";
+				return -1;
+			}
+
+			const ID& faceNodes = theEle->getNodesOnFace(theFlux->getFaceTag());
+			int size = faceNodes.Size();
+			bool prescribed = theFlux->getTypeTag() == 3;
+
+			pointStart[i] = point;
+			if (pass == 0) {
+				if (prescribed)
+					numPoints += size;
+				continue;
+			}
+
+			double* centroid = &centroids[3*i];
+			centroid[0] = centroid[1] = centroid[2] = 0.0;
+			for (int j = 0; j < size; j++) {
+				HeatTransferNode* theNode = theDomain->getNode(faceNodes(j));
+				if (theNode == 0) {
+					opserr << "FireExposedFaces::setFluxBCs() - no node with tag "
+						<< faceNodes(j) << " exists in the domain\n";
+					return -1;
+				}
+
+				const Vector& coords = theNode->getCrds();
+				double crd[3] = {0.0, 0.0, 0.0};
+				for (int k = 0; k < coords.Size() && k < 3; k++)
+					crd[k] = coords(k);
+
+				for (int k = 0; k < 3; k++)
+					centroid[k] += crd[k];
+
+				if (prescribed) {
+					for (int k = 0; k < 3; k++)
+						pointCrds[3*point+k] = crd[k];
+					point++;
+				}
+			}
+			for (int k = 0; k < 3; k++)
+				centroid[k] /= size;
+		}
+		pointStart[numFluxes] = point;
+	}
+
+	return 0;
+}
+
+
+void
+FireExposedFaces::applyPointValues(int i)
+{
+	PrescribedSurfFlux* pflux = (PrescribedSurfFlux*)theFluxes[i];
+	Vector nodalFlux(&pointValues[pointStart[i]], pointStart[i+1] - pointStart[i]);
+	pflux->setData(nodalFlux);
+	pflux->applyFluxBC();
+}
@@ -0,0 +1,86 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Fire & Heat Transfer modules developed by:                         **
+**   Yaqiang Jiang (y.jiang@ed.ac.uk)                                 **
+**   Asif Usmani (asif.usmani@ed.ac.uk)                               **
+**                                                                    **
+** ****************************************************************** */
+
+
+//
+// FireExposedFaces holds the boundary fluxes of a FireImposedPattern as an
+// array, together with the coordinates of the faces they act on, so that a
+// FireModel can evaluate its flux or gas temperature at all the faces in one
+// call rather than one HeatFluxBC at a time. The nodes of the prescribed flux
+// faces (type 3) are stored as points x, y, z in turn (z = 0 in 2D), and the
+// centroid of every face is stored as well. The geometry does not change
+// during the analysis, so it is gathered once by setFluxBCs().
+//
+
+#ifndef FireExposedFaces_h
+#define FireExposedFaces_h
+
+class HeatFluxBC;
+class HeatFluxBCIter;
+
+class FireExposedFaces
+{
+    public:
+	  FireExposedFaces();
+	  ~FireExposedFaces();
+
+	  // gather the fluxes and their face geometry, returns -1 if an element
+	  // or a node of a face is not in the domain
+	  int setFluxBCs(HeatFluxBCIter& theFluxes, int numFluxes);
+
+	  int getNumFluxBCs(void) {return numFluxes;};
+	  HeatFluxBC* getFluxBC(int i) {return theFluxes[i];};
+
+	  // the face nodes of the prescribed fluxes, point i of flux j being
+	  // getPointStart(j) <= i < getPointStart(j+1); other fluxes have none
+	  int getNumPoints(void) {return numPoints;};
+	  int getPointStart(int i) {return pointStart[i];};
+	  const double* getPointCrds(void) {return pointCrds;};
+	  const double* getCentroids(void) {return centroids;};
+
+	  // scratch of one value per point and one per face for the fire model
+	  double* getPointValues(void) {return pointValues;};
+	  double* getFaceValues(void) {return faceValues;};
+
+	  // set the nodal data of prescribed flux i to its point values and apply it
+	  void applyPointValues(int i);
+
+    private:
+	  FireExposedFaces(const FireExposedFaces&);
+	  FireExposedFaces& operator=(const FireExposedFaces&);
+
+	  int numFluxes;
+	  int sizeFluxes;
+	  HeatFluxBC** theFluxes;
+	  int* pointStart;
+	  double* centroids;
+	  double* faceValues;
+
+	  int numPoints;
+	  int sizePoints;
+	  double* pointCrds;
+	  double* pointValues;
+};
+
+#endif
@@ -27,6 +27,7 @@
 //
 
 #include <FireModel.h>
+#include <FireExposedFaces.h>
 
 
 FireModel::FireModel(int tag, int fireTypeTag):TaggedObject(tag),
@@ -73,6 +74,33 @@ FireModel::getFireOut(double time, const Vector& locs)
 	return 0;
 }
 
+void
+FireModel::applyFluxBCs(FireExposedFaces& theFaces, double time)
+{
+	int numFluxes = theFaces.getNumFluxBCs();
+	for (int i = 0; i < numFluxes; i++)
+		this->applyFluxBC(theFaces.getFluxBC(i), time);
+}
+
+int
+FireModel::getFluxes(double time, const double* crds, int numPoints, double* fluxes)
+{
+	Vector locs(3);
+	for (int i = 0; i < numPoints; i++) {
+		locs(0) = crds[3*i];
+		locs(1) = crds[3*i+1];
+		locs(2) = crds[3*i+2];
+		fluxes[i] = this->getFireOut(time, locs);
+	}
+	return 0;
+}
+
+int
+FireModel::getGasTemperatures(double time, const double* crds, int numPoints, double* gasT)
+{
+	return -1;
+}
+
 void 
 FireModel::Print(OPS_Stream& s, int i)
 {
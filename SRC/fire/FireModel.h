@@ -36,6 +36,7 @@
 #include <Vector.h>
 class HeatTransferDomain;
 class HeatFluxBC;
+class FireExposedFaces;
 
 class FireModel: public TaggedObject
 {
@@ -45,11 +46,19 @@ class FireModel: public TaggedObject
 	  
 	  virtual void setDomain(HeatTransferDomain* theDomain);
 	  virtual void applyFluxBC(HeatFluxBC* theFlux, double time) = 0;
+	  // apply all the fluxes of a FireImposedPattern, by default one at a
+	  // time through applyFluxBC
+	  virtual void applyFluxBCs(FireExposedFaces& theFaces, double time);
 
 	  virtual int getFireTypeTag(void);
 	  virtual double getFirePars(int parTag=0);
 	  virtual int setFirePars(double time, const Vector& firePars = 0);
 	  virtual double getFireOut(double time, const Vector& locs = 0);
+	  // the incident flux and the gas temperature at numPoints points, crds
+	  // holding x, y, z of each point in turn (z = 0 in 2D); by default the
+	  // flux is getFireOut at each point and there is no gas temperature (-1)
+	  virtual int getFluxes(double time, const double* crds, int numPoints, double* fluxes);
+	  virtual int getGasTemperatures(double time, const double* crds, int numPoints, double* gasT);
 	  virtual void  Print(OPS_Stream&, int = 0);
 
 	protected:
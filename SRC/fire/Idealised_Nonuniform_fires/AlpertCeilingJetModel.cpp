@@ -35,6 +35,7 @@
 #include <HeatTransferDomain.h>
 #include <HeatTransferNode.h>
 #include <HeatTransferElement.h>
+#include <FireExposedFaces.h>
 
 
 AlpertCeilingJetModel::AlpertCeilingJetModel(int tag,
@@ -109,91 +110,61 @@ AlpertCeilingJetModel::getGasTemperature(HeatFluxBC* the_flux, double time)
 	if(size2 == 3)
 		crd3 = crd3 /size;
 
-    // first calculate r	
-	double deltaX1, deltaX2, sum, r;
-
-	if (centerLine == 1) {
-		//deltaX1 = x2 - crd1;
-		deltaX1 = x2 - crd2;
-		if (size2 == 3) {
-			// then heat transfer coordinate is 3D
-			//deltaX2 = x3 - crd2;
-			deltaX2 = x3 - crd3;
-			} else {
-				// then heat transfer coordinate is 2D
-				deltaX2 = x3;
-			}
-		} else if (centerLine == 2) {
-			deltaX1 = x1 - crd1;
-			if (size2 == 3) {
-				// then heat transfer coordinate is 3D
-				//deltaX2 = x3 - crd2;
-				deltaX2 = x3 - crd3;
-				} else {
-					// then heat transfer coordinate is 2D
-					deltaX2 = x3;
-				}
-		} else if (centerLine == 3) {
-			deltaX1 = x1 - crd1;
-			deltaX2 = x2 - crd2;
-			}
-
-		sum = deltaX1 * deltaX1 + deltaX2 * deltaX2;
-		r = sqrt(sum);
-
-		// now calculate ratio
-		double ratio = r / h;
-
-		double dT, Tmax;
-
-		if(ratio <= 0.18){
-			dT = 16.9 * pow(q,2.0/3.0) / pow(h,5.0/3.0);
-			}else if(ratio > 0.18){
-			dT = 5.38 * pow(q/r, 2.0/3.0)/h;
-			}
-		Tmax = dT + T0;
-		if(Tmax > Tf)
-			Tmax = Tf;
-		return Tmax;
+	return this->getGasTemperature(crd1, crd2, crd3);
 }
 
 
 double 
 AlpertCeilingJetModel::getGasTemperature(double xx1, double xx2, double xx3)
 {
-	
-	// first calculate r	
-	double deltaX1, deltaX2, sum, r;
+	double crds[3] = {xx1, xx2, xx3};
+	double Tmax;
+	this->getGasTemperatures(0.0, crds, 1, &Tmax);
+	return Tmax;
+}
+
 
+int
+AlpertCeilingJetModel::getGasTemperatures(double time, const double* crds, int numPoints, double* gasT)
+{
+	// r is measured in the plane normal to the central line
+	double fireX1 = x1;
+	double fireX2 = x2;
+	int i1 = 0, i2 = 1;
 	if (centerLine == 1) {
-		//deltaX1 = x2 - crd1;
-		deltaX1 = x2 - xx2;
-		deltaX2 = x3 - xx3;
-		} else if (centerLine == 2) {
-			deltaX1 = x1 - xx1;
-			deltaX2 = x3 - xx3;
-		} else if (centerLine == 3) {
-			deltaX1 = x1 - xx1;
-			deltaX2 = x2 - xx2;
-			}
+		fireX1 = x2;
+		fireX2 = x3;
+		i1 = 1;
+		i2 = 2;
+	} else if (centerLine == 2) {
+		fireX2 = x3;
+		i2 = 2;
+	}
 
-		sum = deltaX1 * deltaX1 + deltaX2 * deltaX2;
-		r = sqrt(sum);
+	// the temperature rise close to the plume is the same everywhere
+	double dT0 = 16.9 * pow(q,2.0/3.0) / pow(h,5.0/3.0);
+
+	for (int i = 0; i < numPoints; i++) {
+		double deltaX1 = fireX1 - crds[3*i+i1];
+		double deltaX2 = fireX2 - crds[3*i+i2];
+		double r = sqrt(deltaX1 * deltaX1 + deltaX2 * deltaX2);
 
 		// now calculate ratio
 		double ratio = r / h;
 
-		double dT, Tmax;
-
-		if(ratio <= 0.18){
-			dT = 16.9 * pow(q,2.0/3.0) / pow(h,5.0/3.0);
-			}else if(ratio > 0.18){
+		double dT;
+		if (ratio <= 0.18)
+			dT = dT0;
+		else
 			dT = 5.38 * pow(q/r, 2.0/3.0)/h;
-			}
-		Tmax = dT + T0;
-		if(Tmax > Tf)
+
+		double Tmax = dT + T0;
+		if (Tmax > Tf)
 			Tmax = Tf;
-		return Tmax;
+		gasT[i] = Tmax;
+	}
+
+	return 0;
 }
 
 void
@@ -220,3 +191,30 @@ AlpertCeilingJetModel::applyFluxBC(HeatFluxBC* theFlux, double time)
 	}
 
 
+
+
+void
+AlpertCeilingJetModel::applyFluxBCs(FireExposedFaces& theFaces, double time)
+{
+	// the gas temperatures at the centroids of all the faces in one go
+	int numFluxes = theFaces.getNumFluxBCs();
+	double* gasT = theFaces.getFaceValues();
+	this->getGasTemperatures(time, theFaces.getCentroids(), numFluxes, gasT);
+
+	static const double bzm = 5.67 * 1e-008;
+	for (int i = 0; i < numFluxes; i++) {
+		HeatFluxBC* theFlux = theFaces.getFluxBC(i);
+		int flux_type = theFlux->getTypeTag();
+		if (flux_type == 1) {
+			Convection* convec = (Convection*) theFlux;
+			convec->setSurroundingTemp(gasT[i]);
+			convec->applyFluxBC(time);
+			} else if (flux_type == 2) {
+				Radiation* rad = (Radiation*) theFlux;
+				rad->setIrradiation(bzm * pow(gasT[i], 4.0));
+				rad->applyFluxBC(time);
+			} else {
+				opserr << "AlpertCeilingJetModel::applyFluxBC() - incorrect flux type provided.\n";
+			}
+		}
+}
@@ -46,8 +46,10 @@ class AlpertCeilingJetModel : public FireModel
 	  virtual ~AlpertCeilingJetModel();
 	  
 	  void applyFluxBC(HeatFluxBC* theFlux, double time);
+	  void applyFluxBCs(FireExposedFaces& theFaces, double time);
 	  double getGasTemperature(double xx1, double xx2, double xx3);
 	  double getGasTemperature(HeatFluxBC* flux, double time);
+	  int getGasTemperatures(double time, const double* crds, int numPoints, double* gasT);
 	protected:
 
     private:
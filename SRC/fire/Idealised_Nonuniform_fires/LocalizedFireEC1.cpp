@@ -35,11 +35,13 @@
 #include <HeatTransferDomain.h>
 #include <HeatTransferNode.h>
 #include <HeatTransferElement.h>
+#include <FireExposedFaces.h>
 
 
 LocalizedFireEC1::LocalizedFireEC1(int tag, double crd1, double crd2, double crd3, double D,
 								   double Q, double H, int lineTag,bool forColumn,double startTime)
-:FireModel(tag,3),x1(crd1), x2(crd2), x3(crd3), d(D), q(Q), h(H), centerLine(lineTag),ForColumn(forColumn)
+:FireModel(tag,3),x1(crd1), x2(crd2), x3(crd3), d(D), q(Q), h(H), centerLine(lineTag),ForColumn(forColumn),
+ Lf(0.0), z_acute(0.0), Lt(0.0)
 {
     // check the direction of central line of a Hasemi fire
     // 1 indicates it is parrallel to x1 axis, 2 indicates
@@ -52,27 +54,13 @@ LocalizedFireEC1::LocalizedFireEC1(int tag, double crd1, double crd2, double crd
 		opserr << "LocalizedFireEC1::LocalizedFireEC1 - error in specifying the fire, diameter "
 			<< " shoudn't be greater than 10m, fire size shoudn't be greater than 50MW.\n";
 		}
-}
-
-
-LocalizedFireEC1::~LocalizedFireEC1()
-{
-
-}
 
+	// the flame length and the terms of y which do not depend on the
+	// location are fixed for this fire
+	Lf = 0.0148 * pow(q,0.4) - 1.02 * d;
 
-double 
-LocalizedFireEC1::getFlux(HeatTransferNode* node, double time)
-{
-    // first calculate flame length
-    double Lf = 0.0148 * pow(q,0.4) - 1.02 * d;
-	if (Lf < h) {
-		opserr << "LocalizedFireEC1::getFlux() - flame is not impinging ceiling, method has not implemented.\n";
-		return -1;
-		}
 	double constant = 1.11 * 1e6 * pow(d,2.5);
 	double Qd_ast = q / constant;
-	double z_acute;
 
 	if (Qd_ast < 1.0) {
 		double a = 0.66666666666666666666666666666667;
@@ -86,56 +74,74 @@ LocalizedFireEC1::getFlux(HeatTransferNode* node, double time)
 	double Qh_ast = q / term;
 
 	// now calculate H plus Lh
-	double Lt = 2.9 * h * pow(Qh_ast,0.33);
+	Lt = 2.9 * h * pow(Qh_ast,0.33);
+}
 
-	// now calculate r	
-	const Vector& coords = node->getCrds();
-	int size = coords.Size();
 
-	double deltaX1, deltaX2, sum, r;
+LocalizedFireEC1::~LocalizedFireEC1()
+{
+
+}
+
+
+int
+LocalizedFireEC1::getFluxes(double time, const double* crds, int numPoints, double* fluxes)
+{
+	if (Lf < h) {
+		opserr << "LocalizedFireEC1::getFlux() - flame is not impinging ceiling, method has not implemented.\n";
+		for (int i = 0; i < numPoints; i++)
+			fluxes[i] = -1;
+		return -1;
+		}
 
+	// r is measured in the plane normal to the central line
+	double fireX1 = x1;
+	double fireX2 = x2;
+	int i1 = 0, i2 = 1;
 	if (centerLine == 1) {
-		deltaX1 = x2 - coords(1);
-		if (size == 3) {
-			// then heat transfer coordinate is 3D
-			deltaX2 = x3 - coords(2);
-			} else {
-				// then heat transfer coordinate is 2D
-				deltaX2 = x3;
-			}
+		fireX1 = x2;
+		fireX2 = x3;
+		i1 = 1;
+		i2 = 2;
 	} else if (centerLine == 2) {
-		deltaX1 = x1 - coords(0);
-		if (size == 3) {
-			// then heat transfer coordinate is 3D
-			deltaX2 = x3 - coords(2);
-		} else {
-			// then heat transfer coordinate is 2D
-			deltaX2 = x3;
-		}
-	} else if (centerLine == 3) {
-			deltaX1 = x1 - coords(0);
-			deltaX2 = x2 - coords(1);
-			}
+		fireX2 = x3;
+		i2 = 2;
+	}
 
-    sum = deltaX1 * deltaX1 + deltaX2 * deltaX2;
-    r = sqrt(sum);
+	for (int i = 0; i < numPoints; i++) {
+		double deltaX1 = fireX1 - crds[3*i+i1];
+		double deltaX2 = fireX2 - crds[3*i+i2];
+		double r = sqrt(deltaX1 * deltaX1 + deltaX2 * deltaX2);
 
-	// now calculate y
-	double y = (r + h + z_acute) / (Lt + z_acute);
+		// now calculate y
+		double y = (r + h + z_acute) / (Lt + z_acute);
 
-	// now determine the flux
-	double q_dot;
-	if (y <= 0.3) {
-		q_dot = 100000;
-	} else if ((y > 0.3) && (y < 1.0)) {
-		q_dot = 136300 - 121000 * y;
-	} else if (y >= 1.0) {
-		q_dot = 15000 * pow(y,-3.7);
+		// now determine the flux
+		double q_dot;
+		if (y <= 0.3)
+			q_dot = 100000;
+		else if (y < 1.0)
+			q_dot = 136300 - 121000 * y;
+		else
+			q_dot = 15000 * pow(y,-3.7);
+
+		fluxes[i] = q_dot;
 	}
-	int tag = node->getTag();
-#ifdef _DEBUG
-	//opserr<<" NodeTag: "<<node->getTag()<< " r:  "<<r<<"____ "<< " q:  "<<q_dot<<"____ ";
-#endif
+
+	return 0;
+}
+
+
+double 
+LocalizedFireEC1::getFlux(HeatTransferNode* node, double time)
+{
+	const Vector& coords = node->getCrds();
+	double crds[3] = {0.0, 0.0, 0.0};
+	for (int i = 0; i < coords.Size() && i < 3; i++)
+		crds[i] = coords(i);
+
+	double q_dot;
+	this->getFluxes(time, crds, 1, &q_dot);
 	return q_dot;
 }
 
@@ -214,6 +220,28 @@ LocalizedFireEC1::applyFluxBC(HeatFluxBC* theFlux, double time)
 	}
 }
 
+void
+LocalizedFireEC1::applyFluxBCs(FireExposedFaces& theFaces, double time)
+{
+	// the prescribed fluxes at the nodes of all the faces in one go
+	this->getFluxes(time, theFaces.getPointCrds(), theFaces.getNumPoints(), theFaces.getPointValues());
+
+	int numFluxes = theFaces.getNumFluxBCs();
+	for (int i = 0; i < numFluxes; i++) {
+		HeatFluxBC* theFlux = theFaces.getFluxBC(i);
+		int flux_type = theFlux->getTypeTag();
+		if (flux_type == 1 || flux_type == 2)
+			theFlux->applyFluxBC(time);
+		else if (flux_type == 3)
+			theFaces.applyPointValues(i);
+		else {
+			opserr << "LocalizedFireEC1::applyFluxBC() - incorrect flux type "
+				<< flux_type << " provided\n";
+			exit(-1);
+		}
+	}
+}
+
 void 
 LocalizedFireEC1::Print(OPS_Stream& s, int i)
 {
@@ -50,7 +50,9 @@ class LocalizedFireEC1 : public FireModel
 	  virtual ~LocalizedFireEC1();
 	  
 	  void applyFluxBC(HeatFluxBC* theFlux, double time);
+	  void applyFluxBCs(FireExposedFaces& theFaces, double time);
 	  double getFlux(HeatTransferNode* the_node, double time);
+	  int getFluxes(double time, const double* crds, int numPoints, double* fluxes);
 	  void Print(OPS_Stream& s, int i = 0);
 	protected:
 
@@ -59,6 +61,7 @@ class LocalizedFireEC1 : public FireModel
 	  double x1, x2, x3, d, q, h;
 	  int centerLine;
 	  bool ForColumn;
+	  double Lf, z_acute, Lt;
 };
 
 #endif
@@ -36,12 +36,14 @@
 #include <HeatTransferNode.h>
 #include <HeatTransferElement.h>
 #include <PathTimeSeriesThermal.h>
+#include <FireExposedFaces.h>
 
 
 NaturalFire::NaturalFire(int tag, double D,
 	double Q, double H, int lineTag, double smokeTemp, PathTimeSeriesThermal* FireParPath)
 	:FireModel(tag, 7), FireParPath(FireParPath), fireLocs(3), d(D), hc(0),absorp(0),
-	q(Q), h(H), smokeT(smokeTemp),addq(1e5),centerLine(lineTag)
+	q(Q), h(H), smokeT(smokeTemp),addq(1e5),centerLine(lineTag),
+	termsSet(false), termsTime(0.0), Lf(0.0), z_acute(0.0), Lt(0.0), gas_t0(0.0)
 {
     // check the direction of central line of a Hasemi fire
     // 1 indicates it is parrallel to x1 axis, 2 indicates
@@ -58,7 +60,8 @@ NaturalFire::NaturalFire(int tag, double D,
 
 NaturalFire::NaturalFire(int tag, int lineTag, PathTimeSeriesThermal* FireParPath)
 	:FireModel(tag, 7), FireParPath(FireParPath), fireLocs(3), d(0.0), hc(0), absorp(0),
-	q(0.0), h(0.0), smokeT(0.0), addq(0.0), centerLine(lineTag)
+	q(0.0), h(0.0), smokeT(0.0), addq(0.0), centerLine(lineTag),
+	termsSet(false), termsTime(0.0), Lf(0.0), z_acute(0.0), Lt(0.0), gas_t0(0.0)
 {
 	// check the direction of central line of a Hasemi fire
 	// 1 indicates it is parrallel to x1 axis, 2 indicates
@@ -139,6 +142,7 @@ NaturalFire::setFirePars(double time, const Vector& firePars) {
 			opserr << "WARNING! NaturalFire::getFlux failed to get the location of fire origin" << endln;
 			return -1;
 		}
+	termsSet = false;
 #ifdef _DEBUG
 	//opserr << FirePars << endln;
 #endif // DEBUG
@@ -171,66 +175,25 @@ NaturalFire::getFirePars(int ParTag) {
 
 }
 
-double 
-NaturalFire::getFireOut( double time, const Vector& coords)
+int
+NaturalFire::setTimeTerms(double time)
 {
+	if (termsSet && (FireParPath == 0 || time == termsTime))
+		return 0;
+
 	if (FireParPath != 0) {
 		if (this->setFirePars(time) < 0)
-			exit(-1);
-	}
-
-	double gas_t = 0;
-	double q_dot = 0;
-	double Addqs = addq;
-
-
-	// now calculate r	
-	
-	int size = coords.Size();
-
-	double deltaX1, deltaX2, sum, r;
-
-
-
-	if (centerLine == 1) {
-		deltaX1 = fireLocs(1) - coords(1);
-		if (size == 3) {
-			// then heat transfer coordinate is 3D
-			deltaX2 = fireLocs(2) - coords(2);
-		}
-		else {
-			// then heat transfer coordinate is 2D
-			deltaX2 = fireLocs(2);
-		}
-	}
-	else if (centerLine == 2) {
-		deltaX1 = fireLocs(0) - coords(0);
-		if (size == 3) {
-			// then heat transfer coordinate is 3D
-			deltaX2 = fireLocs(2) - coords(2);
-		}
-		else {
-			// then heat transfer coordinate is 2D
-			deltaX2 = fireLocs(2);
-		}
-	}
-	else if (centerLine == 3) {
-		deltaX1 = fireLocs(0) - coords(0);
-		deltaX2 = fireLocs(1) - coords(1);
+			return -1;
 	}
 
-	sum = deltaX1 * deltaX1 + deltaX2 * deltaX2;
-	r = sqrt(sum);
-
 	if(abs(h)<1e-6)
 		opserr<< "Travelling fire: h got a zero "<< endln;
 
 	// first calculate flame length
-	double Lf = 0.0148 * pow(q, 0.4) - 1.02 * d;
+	Lf = 0.0148 * pow(q, 0.4) - 1.02 * d;
 
 	double constant = 1.11 * 1e6 * pow(d, 2.5);
 	double Qd_ast = q / constant;
-	double z_acute;
 
 	if (Qd_ast < 1.0) {
 		double a = 2.0 / 3.0;
@@ -245,86 +208,115 @@ NaturalFire::getFireOut( double time, const Vector& coords)
 	double Qh_ast = q / term;
 
 	// now calculate H plus Lh
-	double Lt = 2.9 * h * pow(Qh_ast, 0.33);
+	Lt = 2.9 * h * pow(Qh_ast, 0.33);
 
+	// gas temperature rise close to the plume (r/h <= 0.18) when the
+	// flame does not impinge the ceiling
+	gas_t0 = 16.9 * pow(q/1000.0, 2.0/3.0) / pow(h,5.0/3.0);
 
-	double q_smoke = absorp * 5.67e-8 * (pow(smokeT, 4) - pow(293.15, 4)) + hc * (smokeT - 293.15);
+	termsTime = time;
+	termsSet = true;
+	return 0;
+}
 
-	if (Lf < h) {
-//------------------not impinge ceiling----------------------------------------------
-		
-		if (r/ h > 0.18) {
-			gas_t = 5.38 * pow(q / 1000.0/r, 2.0 / 3.0) / h;
-		}
-		else {
-			gas_t = 16.9 * pow(q/1000.0, 2.0/3.0) / pow(h,5.0/3.0);
 
-		}
+int
+NaturalFire::getFluxes(double time, const double* crds, int numPoints, double* fluxes)
+{
+	if (this->setTimeTerms(time) < 0)
+		exit(-1);
 
-		//opserr << " GAS: " << gas_t << " Q: "<< q<<" h "<< pow(q / 1000.0 / r, 2.0 / 3.0);
-		gas_t = gas_t + 293.15;
+	// hc and absorp are taken from the convection and radiation BCs, so the
+	// smoke flux is found on each call
+	double q_smoke = absorp * 5.67e-8 * (pow(smokeT, 4) - pow(293.15, 4)) + hc * (smokeT - 293.15);
+	double q_amb = pow(293.15, 4);
 
+	double Addqs = addq;
+	if (Addqs > q_smoke)
+		Addqs = q_smoke;
 
-		if (Addqs > q_smoke)
-			Addqs = q_smoke;
+	// r is measured in the plane normal to the central line
+	int i1 = 0, i2 = 1;
+	if (centerLine == 1) {
+		i1 = 1;
+		i2 = 2;
+	}
+	else if (centerLine == 2) {
+		i1 = 0;
+		i2 = 2;
+	}
+	double fireX1 = fireLocs(i1);
+	double fireX2 = fireLocs(i2);
 
-		//if (r < d)
-			q_dot = absorp * 5.67e-8 * (pow(gas_t, 4) - pow(293.15, 4)) + hc * (gas_t - 293.15) + Addqs;
-		//else
-			//q_dot = 0.85 * 5.67e-8 * (pow(gas_t, 4) - pow(293.15, 4)) + 35 * (gas_t - 293.15);
-		
+	if (Lf < h) {
+//------------------not impinge ceiling----------------------------------------------
+		for (int i = 0; i < numPoints; i++) {
+			double deltaX1 = fireX1 - crds[3*i+i1];
+			double deltaX2 = fireX2 - crds[3*i+i2];
+			double r = sqrt(deltaX1 * deltaX1 + deltaX2 * deltaX2);
 
-		if (q_dot < q_smoke) {
-#ifdef _DEBUG
-			opserr << "Natural fire: q_dot " << q_dot << "q_smoke: " << q_smoke << endln;
-#endif
-			q_dot = q_smoke;
+			double gas_t;
+			if (r/ h > 0.18)
+				gas_t = 5.38 * pow(q / 1000.0/r, 2.0 / 3.0) / h;
+			else
+				gas_t = gas_t0;
+			gas_t = gas_t + 293.15;
+
+			double q_dot = absorp * 5.67e-8 * (pow(gas_t, 4) - q_amb) + hc * (gas_t - 293.15) + Addqs;
+
+			if (q_dot < q_smoke)
+				q_dot = q_smoke;
 
+			fluxes[i] = q_dot;
 		}
-		
 	}
 	else {
 //---------------------impinge ceiling--------------------------------------
-		// now calculate y
-		double y = (r + h + z_acute) / (Lt + z_acute);
-
-		// now determine the flux
-
-		if (y <= 0.3) {
-			q_dot = 100000;
-		}
-		else if ((y > 0.3) && (y < 1.0)) {
-			q_dot = 136300 - 121000 * y;
-		}
-		else if (y >= 1.0) {
-			q_dot = 15000 * pow(y, -3.7);
+		for (int i = 0; i < numPoints; i++) {
+			double deltaX1 = fireX1 - crds[3*i+i1];
+			double deltaX2 = fireX2 - crds[3*i+i2];
+			double r = sqrt(deltaX1 * deltaX1 + deltaX2 * deltaX2);
+
+			// now calculate y
+			double y = (r + h + z_acute) / (Lt + z_acute);
+
+			// now determine the flux
+			double q_dot;
+			if (y <= 0.3)
+				q_dot = 100000;
+			else if (y < 1.0)
+				q_dot = 136300 - 121000 * y;
+			else
+				q_dot = 15000 * pow(y, -3.7);
+
+			q_dot = q_dot + Addqs; //modify the maximum q
+
+			if (q_dot > 120000)
+				q_dot = 120000;
+
+			//adibadic temperature principle: eps*qr -eps*sigma*T^4 +h (smokeT-T)=0
+			// Gauge heat flux = eps*qr-eps*sigma*Tg^4+h(smokeT-Tg)
+			if (q_dot < q_smoke)
+				q_dot = q_smoke;
+
+			fluxes[i] = q_dot;
 		}
+	}
 
-		if (Addqs  > q_smoke)
-			Addqs = q_smoke;
-		q_dot = q_dot + Addqs; //modify the maximum q
-		
-		if (q_dot > 120000)
-			q_dot = 120000;
+	return 0;
+}
 
-		//adibadic temperature principle: eps*qr -eps*sigma*T^4 +h (smokeT-T)=0
-		// Gauge heat flux = eps*qr-eps*sigma*Tg^4+h(smokeT-Tg)
-		if (q_dot < q_smoke) {
-#ifdef _DEBUG
-			opserr << "Travelling fire: q_dot " << q_dot << "q_smoke: " << q_smoke << endln;
-#endif
-			q_dot = q_smoke;
 
-		}
-	}
-	
+double 
+NaturalFire::getFireOut( double time, const Vector& coords)
+{
+	double crds[3] = {0.0, 0.0, 0.0};
+	for (int i = 0; i < coords.Size() && i < 3; i++)
+		crds[i] = coords(i);
 
-#ifdef _DEBUG
-	//int tag = node->getTag();
-	//opserr<<" Travelling fire: "<<fireLocs(1)<<","<<x3<<", q"<<q<<" r:  "<<r<<"____ "<< " q:  "<<q_dot<<"____ ";
-#endif
+	double q_dot = 0;
+	this->getFluxes(time, crds, 1, &q_dot);
 	return q_dot;
-
 }
 
 
@@ -402,3 +394,38 @@ NaturalFire::applyFluxBC(HeatFluxBC* theFlux, double time)
 		}
 }
 
+
+
+void
+NaturalFire::applyFluxBCs(FireExposedFaces& theFaces, double time)
+{
+	int numFluxes = theFaces.getNumFluxBCs();
+
+	// hc and absorp enter the prescribed fluxes, so they are taken from the
+	// convection and radiation BCs before the fluxes are found
+	for (int i = 0; i < numFluxes; i++) {
+		HeatFluxBC* theFlux = theFaces.getFluxBC(i);
+		int flux_type = theFlux->getTypeTag();
+		if (flux_type == 1 && abs(hc) < 1e-5)
+			hc = ((Convection*)theFlux)->getParameter();
+		else if (flux_type == 2 && abs(absorp) < 1e-5)
+			absorp = ((Radiation*)theFlux)->getAbsorptivity();
+	}
+
+	// the prescribed fluxes at the nodes of all the faces in one go
+	this->getFluxes(time, theFaces.getPointCrds(), theFaces.getNumPoints(), theFaces.getPointValues());
+
+	for (int i = 0; i < numFluxes; i++) {
+		HeatFluxBC* theFlux = theFaces.getFluxBC(i);
+		int flux_type = theFlux->getTypeTag();
+		if (flux_type == 1 || flux_type == 2)
+			theFlux->applyFluxBC(time);
+		else if (flux_type == 3)
+			theFaces.applyPointValues(i);
+		else {
+			opserr << "NaturalFire::applyFluxBC() - incorrect flux type "
+				<< flux_type << " provided\n";
+			exit(-1);
+		}
+	}
+}
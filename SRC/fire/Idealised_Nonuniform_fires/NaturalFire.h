@@ -54,13 +54,16 @@ class NaturalFire : public FireModel
 	  virtual ~NaturalFire();
 	  
 	  void applyFluxBC(HeatFluxBC* theFlux, double time);
+	  void applyFluxBCs(FireExposedFaces& theFaces, double time);
 	  int setFirePars(double time,const Vector& firePars =0);
 	  double getFirePars(int ParTag=1);
 	  double getFireOut(double time, const Vector&);
+	  int getFluxes(double time, const double* crds, int numPoints, double* fluxes);
 	protected:
 
     private:
 	  double getFlux(HeatTransferNode* the_node, double time);
+	  int setTimeTerms(double time);
 	  PathTimeSeriesThermal* FireParPath;
 	  Vector fireLocs;
 	  double  d, q, h;
@@ -68,6 +71,12 @@ class NaturalFire : public FireModel
 	  double addq;
 	  int centerLine;
 	  double hc, absorp;
+
+	  // the terms which do not depend on the location, kept until the fire
+	  // parameters change
+	  bool termsSet;
+	  double termsTime;
+	  double Lf, z_acute, Lt, gas_t0;
 };
 
 #endif
@@ -36,12 +36,14 @@
 #include <HeatTransferNode.h>
 #include <HeatTransferElement.h>
 #include <PathTimeSeriesThermal.h>
+#include <FireExposedFaces.h>
 
 
 TravellingFire::TravellingFire(int tag, double D,
 	double Q, double H, int lineTag, double smokeTemp, PathTimeSeriesThermal* fireLocPath)
 	:FireModel(tag, 7), FireLocPath(fireLocPath), fireLocs(3), d(D), 
-	q(Q), h(H), smokeT(smokeTemp),maxq(1e5),centerLine(lineTag)
+	q(Q), h(H), smokeT(smokeTemp),maxq(1e5),centerLine(lineTag),
+	termsSet(false), termsTime(0.0), Lf(0.0), z_acute(0.0), Lt(0.0), q_smoke(0.0)
 {
     // check the direction of central line of a Hasemi fire
     // 1 indicates it is parrallel to x1 axis, 2 indicates
@@ -114,6 +116,7 @@ TravellingFire::setFirePars(double time, const Vector& firePars) {
 			opserr << "WARNING! TravellingFire::getFlux failed to get the location of fire origin" << endln;
 			return -1;
 		}
+	termsSet = false;
 #ifdef _DEBUG
 	opserr << FirePars << endln;
 #endif // DEBUG
@@ -146,23 +149,22 @@ TravellingFire::getFirePars(int ParTag) {
 
 }
 
-double 
-TravellingFire::getFireOut( double time, const Vector& coords)
+int
+TravellingFire::setTimeTerms(double time)
 {
+	if (termsSet && (FireLocPath == 0 || time == termsTime))
+		return 0;
+
 	if (FireLocPath != 0) {
 		if (this->setFirePars(time) < 0)
-			exit(-1);
+			return -1;
 	}
 
-
-	double q_dot = 0;
-
 	// first calculate flame length
-	double Lf = 0.0148 * pow(q, 0.4) - 1.02 * d;
+	Lf = 0.0148 * pow(q, 0.4) - 1.02 * d;
 	
 	double constant = 1.11 * 1e6 * pow(d, 2.5);
 	double Qd_ast = q / constant;
-	double z_acute;
 
 	if (Qd_ast < 1.0) {
 		double a = 2.0 / 3.0;
@@ -177,86 +179,81 @@ TravellingFire::getFireOut( double time, const Vector& coords)
 	double Qh_ast = q / term;
 
 	// now calculate H plus Lh
-	double Lt = 2.9 * h * pow(Qh_ast, 0.33);
+	Lt = 2.9 * h * pow(Qh_ast, 0.33);
 
-	// now calculate r	
-	
-	int size = coords.Size();
+	if (Lf < h)
+		opserr << "Lf: "<<Lf<<" h: "<<h<<endln;
 
-	double deltaX1, deltaX2, sum, r;
+	q_smoke = 0.8 * 5.67e-8 * (pow(smokeT, 4) - pow(293.15, 4)) + 35 * (smokeT - 293.15);
 
+	termsTime = time;
+	termsSet = true;
+	return 0;
+}
 
 
+int
+TravellingFire::getFluxes(double time, const double* crds, int numPoints, double* fluxes)
+{
+	if (this->setTimeTerms(time) < 0)
+		exit(-1);
+
+	// r is measured in the plane normal to the central line
+	int i1 = 0, i2 = 1;
 	if (centerLine == 1) {
-		deltaX1 = fireLocs(1) - coords(1);
-		if (size == 3) {
-			// then heat transfer coordinate is 3D
-			deltaX2 = fireLocs(2) - coords(2);
-		}
-		else {
-			// then heat transfer coordinate is 2D
-			deltaX2 = fireLocs(2);
-		}
+		i1 = 1;
+		i2 = 2;
 	}
 	else if (centerLine == 2) {
-		deltaX1 = fireLocs(0) - coords(0);
-		if (size == 3) {
-			// then heat transfer coordinate is 3D
-			deltaX2 = fireLocs(2) - coords(2);
-		}
-		else {
-			// then heat transfer coordinate is 2D
-			deltaX2 = fireLocs(2);
-		}
-	}
-	else if (centerLine == 3) {
-		deltaX1 = fireLocs(0) - coords(0);
-		deltaX2 = fireLocs(1) - coords(1);
+		i1 = 0;
+		i2 = 2;
 	}
+	double fireX1 = fireLocs(i1);
+	double fireX2 = fireLocs(i2);
+	bool impinging = !(Lf < h);
 
-	sum = deltaX1 * deltaX1 + deltaX2 * deltaX2;
-	r = sqrt(sum);
+	for (int i = 0; i < numPoints; i++) {
+		double deltaX1 = fireX1 - crds[3*i+i1];
+		double deltaX2 = fireX2 - crds[3*i+i2];
+		double r = sqrt(deltaX1 * deltaX1 + deltaX2 * deltaX2);
 
-	// now calculate y
-	double y = (r + h + z_acute) / (Lt + z_acute);
+		// now calculate y
+		double y = (r + h + z_acute) / (Lt + z_acute);
 
-	// now determine the flux
+		// now determine the flux
+		double q_dot;
+		if (y <= 0.3)
+			q_dot = 100000;
+		else if (y < 1.0)
+			q_dot = 136300 - 121000 * y;
+		else
+			q_dot = 15000 * pow(y, -3.7);
 
-	if (y <= 0.3) {
-		q_dot = 100000;
-	}
-	else if ((y > 0.3) && (y < 1.0)) {
-		q_dot = 136300 - 121000 * y;
-	}
-	else if (y >= 1.0) {
-		q_dot = 15000 * pow(y, -3.7);
-	}
+		q_dot = q_dot * maxq / 1e5; //modify the maximum q
 
-	q_dot = q_dot * maxq / 1e5; //modify the maximum q
+		if (!impinging)
+			q_dot = 0.0;
 
-	if (Lf < h) {
-		opserr << "Lf: "<<Lf<<" h: "<<h<<endln;
-		q_dot = 0.0;
-	}
-
-
-	double q_smoke = 0.8 * 5.67e-8 * (pow(smokeT, 4) - pow(293.15, 4)) + 35 * (smokeT - 293.15);
-	if (q_dot < q_smoke) {
-#ifdef _DEBUG
-		opserr << "Travelling fire: q_dot " << q_dot << "q_smoke: " << q_smoke << endln;
-#endif
-		q_dot = q_smoke;
+		if (q_dot < q_smoke)
+			q_dot = q_smoke;
 
+		fluxes[i] = q_dot;
 	}
 
+	return 0;
+}
 
 
-#ifdef _DEBUG
-	//int tag = node->getTag();
-	//opserr<<" Travelling fire: "<<fireLocs(1)<<","<<x3<<", q"<<q<<" r:  "<<r<<"____ "<< " q:  "<<q_dot<<"____ ";
-#endif
-	return q_dot;
+double 
+TravellingFire::getFireOut( double time, const Vector& coords)
+{
+	double crds[3] = {0.0, 0.0, 0.0};
+	for (int i = 0; i < coords.Size() && i < 3; i++)
+		crds[i] = coords(i);
 
+	double q_dot = 0;
+	this->getFluxes(time, crds, 1, &q_dot);
+	return q_dot;
 }
 
 
@@ -316,3 +313,24 @@ TravellingFire::applyFluxBC(HeatFluxBC* theFlux, double time)
 		}
 }
 
+
+
+void
+TravellingFire::applyFluxBCs(FireExposedFaces& theFaces, double time)
+{
+	int numFluxes = theFaces.getNumFluxBCs();
+	for (int i = 0; i < numFluxes; i++) {
+		int flux_type = theFaces.getFluxBC(i)->getTypeTag();
+		if (flux_type != 3) {
+			opserr << "TravellingFire::applyFluxBC() - incorrect flux type "
+				<< flux_type << " provided\n";
+			exit(-1);
+		}
+	}
+
+	// the fluxes at the nodes of all the faces in one go
+	this->getFluxes(time, theFaces.getPointCrds(), theFaces.getNumPoints(), theFaces.getPointValues());
+
+	for (int i = 0; i < numFluxes; i++)
+		theFaces.applyPointValues(i);
+}
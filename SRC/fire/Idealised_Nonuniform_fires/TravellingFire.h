@@ -52,19 +52,28 @@ class TravellingFire : public FireModel
 	  virtual ~TravellingFire();
 	  
 	  void applyFluxBC(HeatFluxBC* theFlux, double time);
+	  void applyFluxBCs(FireExposedFaces& theFaces, double time);
 	  int setFirePars(double time,const Vector& firePars =0);
 	  double getFirePars(int ParTag=1);
 	  double getFireOut(double time, const Vector&);
+	  int getFluxes(double time, const double* crds, int numPoints, double* fluxes);
 	protected:
 
     private:
 	  double getFlux(HeatTransferNode* the_node, double time);
+	  int setTimeTerms(double time);
 	  PathTimeSeriesThermal* FireLocPath;
 	  Vector fireLocs;
 	  double  d, q, h;
 	  double smokeT;
 	  double maxq;
 	  int centerLine;
+
+	  // the terms which do not depend on the location, kept until the fire
+	  // parameters change
+	  bool termsSet;
+	  double termsTime;
+	  double Lf, z_acute, Lt, q_smoke;
 };
 
 #endif
@@ -321,16 +321,20 @@ DataFileStream::write(Vector &data)
   Matrix &printMapping = *mapping;
 
   // write data
+  theRow.setFormat(theFile);
+  theRow.clear();
   if (doCSV == 0) {
     for (int i=0; i<maxCount+1; i++) {
       int fileID = (int)printMapping(0,i);
       int startLoc = (int)printMapping(1,i);
       int numData = (int)printMapping(2,i);
       double *data = theData[fileID];
-      for (int j=0; j<numData; j++)
-	theFile << data[startLoc++] << " ";
+      for (int j=0; j<numData; j++) {
+	theRow.add(data[startLoc++]);
+	theRow.add(' ');
+      }
     }
-    theFile << "\n";
+    theRow.add('\n');
   } else {
     for (int i=0; i<maxCount+1; i++) {
       int fileID = (int)printMapping(0,i);
@@ -338,13 +342,16 @@ DataFileStream::write(Vector &data)
       int numData = (int)printMapping(2,i);
       double *data = theData[fileID];
       int nM1 = numData-1;
-      for (int j=0; j<numData; j++)
+      for (int j=0; j<numData; j++) {
+	theRow.add(data[startLoc++]);
 	if ((i ==maxCount) && (j == nM1))
-	  theFile << data[startLoc++] << "\n";
+	  theRow.add('\n');
 	else
-	  theFile << data[startLoc++] << ",";
+	  theRow.add(',');
+      }
     }
   }
+  theFile.write(theRow.getData(), theRow.getSize());
 
   if (closeOnWrite == true)
     this->close();
@@ -410,18 +417,18 @@ DataFileStream::write(const double *s, int n)
 
   if (fileOpen != 0) {
     if (n > 0) {
-      if (doCSV == 0) {
-	int nm1 = n-1;
-	for (int i=0; i<nm1; i++) {
-	  theFile << s[i] << " ";
-	}
-	theFile << s[nm1] << "\n";
-      } else { int nm1 = n-1;
-	for (int i=0; i<nm1; i++) {
-	  theFile << s[i] << ",";
-	}
-	theFile << s[nm1] << "\n";
+      // format the whole row and write it in one go
+      char separator = (doCSV == 0) ? ' ' : ',';
+      int nm1 = n-1;
+      theRow.setFormat(theFile);
+      theRow.clear();
+      for (int i=0; i<nm1; i++) {
+	theRow.add(s[i]);
+	theRow.add(separator);
       }
+      theRow.add(s[nm1]);
+      theRow.add('\n');
+      theFile.write(theRow.getData(), theRow.getSize());
     }
   }
   return *this;
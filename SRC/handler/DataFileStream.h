@@ -26,6 +26,7 @@
 #define _DataFileStream
 
 #include <OPS_Stream.h>
+#include <DataRowFormatter.h>
 
 #include <fstream>
 using std::ofstream;
@@ -115,6 +116,8 @@ class DataFileStream : public OPS_Stream
 
   int thePrecision;
   bool doScientific;
+
+  DataRowFormatter theRow;
 };
 
 #endif
@@ -0,0 +1,169 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: implementation of DataRowFormatter. Values are formatted
+// with the same printf conversion libstdc++ and the msvc runtime use for
+// ostream::operator<<(double): %g by default, %e for scientific, %f for
+// fixed and %a when both are set. Integral values in %g format that have
+// no more digits than the precision are written directly, as printf would.
+
+#include <DataRowFormatter.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+DataRowFormatter::DataRowFormatter(int initialSize)
+  :data(0), sizeData(0), maxSizeData(0),
+   thePrecision(6), theFlags(std::ios_base::dec | std::ios_base::skipws),
+   usePrecision(true), maxValueSize(0), fastIntegers(false), maxFastInteger(0.0)
+{
+  if (initialSize < 64)
+    initialSize = 64;
+  this->resize(initialSize);
+
+  // the defaults of a newly constructed ostream
+  this->buildFormat(thePrecision, theFlags);
+}
+
+DataRowFormatter::~DataRowFormatter()
+{
+  if (data != 0)
+    free(data);
+}
+
+int
+DataRowFormatter::resize(int newSize)
+{
+  char *newData = (char *)realloc(data, newSize);
+  if (newData == 0) {
+    fprintf(stderr, "DataRowFormatter::resize() - out of memory\n");
+    exit(-1);
+  }
+  data = newData;
+  maxSizeData = newSize;
+  return 0;
+}
+
+void
+DataRowFormatter::setFormat(const std::ios_base &theStream)
+{
+  int prec = (int)theStream.precision();
+  std::ios_base::fmtflags flags = theStream.flags();
+
+  if (prec != thePrecision || flags != theFlags)
+    this->buildFormat(prec, flags);
+}
+
+void
+DataRowFormatter::buildFormat(int prec, std::ios_base::fmtflags flags)
+{
+  thePrecision = prec;
+  theFlags = flags;
+
+  std::ios_base::fmtflags field = flags & std::ios_base::floatfield;
+  bool upper = (flags & std::ios_base::uppercase) != 0;
+
+  int loc = 0;
+  theFormat[loc++] = '%';
+  if (flags & std::ios_base::showpos)
+    theFormat[loc++] = '+';
+  if (flags & std::ios_base::showpoint)
+    theFormat[loc++] = '#';
+
+  fastIntegers = false;
+  usePrecision = true;
+  if (field == (std::ios_base::fixed | std::ios_base::scientific)) {
+    theFormat[loc++] = upper ? 'A' : 'a';
+    usePrecision = false;
+    maxValueSize = 64;
+  } else {
+    theFormat[loc++] = '.';
+    theFormat[loc++] = '*';
+    if (field == std::ios_base::fixed) {
+      theFormat[loc++] = 'f';
+      maxValueSize = 320 + prec;
+    } else if (field == std::ios_base::scientific) {
+      theFormat[loc++] = upper ? 'E' : 'e';
+      maxValueSize = 32 + prec;
+    } else {
+      theFormat[loc++] = upper ? 'G' : 'g';
+      maxValueSize = 32 + prec;
+      fastIntegers = (flags & (std::ios_base::showpos | std::ios_base::showpoint)) == 0;
+    }
+  }
+  theFormat[loc] = '\0';
+
+  // integers with at most min(prec,15) digits are printed exactly by %g
+  int numDigits = (prec < 1) ? 1 : prec;
+  if (numDigits > 15)
+    numDigits = 15;
+  maxFastInteger = 1.0;
+  for (int i=0; i<numDigits; i++)
+    maxFastInteger *= 10.0;
+}
+
+void
+DataRowFormatter::add(double value)
+{
+  if (sizeData + maxValueSize >= maxSizeData)
+    this->resize(2*maxSizeData + maxValueSize);
+
+  char *loc = &data[sizeData];
+
+  if (fastIntegers == true && value > -maxFastInteger && value < maxFastInteger) {
+    long long intValue = (long long)value;
+    if ((double)intValue == value) {
+      if (value < 0.0 || (value == 0.0 && signbit(value))) {
+	*loc++ = '-';
+	intValue = -intValue;
+      }
+      char digits[24];
+      int numDigits = 0;
+      do {
+	digits[numDigits++] = '0' + (char)(intValue % 10);
+	intValue /= 10;
+      } while (intValue != 0);
+      while (numDigits > 0)
+	*loc++ = digits[--numDigits];
+      sizeData = loc - data;
+      return;
+    }
+  }
+
+  int numChar;
+  if (usePrecision == true)
+    numChar = snprintf(loc, maxSizeData - sizeData, theFormat, thePrecision, value);
+  else
+    numChar = snprintf(loc, maxSizeData - sizeData, theFormat, value);
+
+  if (numChar >= maxSizeData - sizeData) {
+    this->resize(sizeData + numChar + maxValueSize);
+    loc = &data[sizeData];
+    if (usePrecision == true)
+      numChar = snprintf(loc, maxSizeData - sizeData, theFormat, thePrecision, value);
+    else
+      numChar = snprintf(loc, maxSizeData - sizeData, theFormat, value);
+  }
+
+  if (numChar > 0)
+    sizeData += numChar;
+}
@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: DataRowFormatter formats rows of doubles as text into a
+// preallocated buffer so a stream can write a whole row with one call,
+// instead of going through the ostream sentry, locale and num_put machinery
+// for every value. The output is the same as inserting each value into an
+// ostream with the precision and floatfield flags passed to setFormat().
+
+#ifndef _DataRowFormatter
+#define _DataRowFormatter
+
+#include <ios>
+
+class DataRowFormatter
+{
+ public:
+  DataRowFormatter(int initialSize = 4096);
+  ~DataRowFormatter();
+
+  // take the precision and float field settings of the stream
+  void setFormat(const std::ios_base &theStream);
+
+  inline void add(char c);
+  void add(double value);
+
+  inline void clear(void) {sizeData = 0;}
+  inline const char *getData(void) const {return data;}
+  inline int getSize(void) const {return sizeData;}
+
+ private:
+  int resize(int newSize);
+  void buildFormat(int precision, std::ios_base::fmtflags flags);
+
+  char *data;
+  int sizeData;
+  int maxSizeData;
+
+  int thePrecision;
+  std::ios_base::fmtflags theFlags;
+  char theFormat[16];
+  bool usePrecision;    // false for hexfloat, which ignores the precision
+  int maxValueSize;     // upper bound on the characters for one value
+  bool fastIntegers;    // %g format, integral values written directly
+  double maxFastInteger;
+};
+
+inline void
+DataRowFormatter::add(char c)
+{
+  if (sizeData == maxSizeData)
+    this->resize(2*maxSizeData);
+  data[sizeData++] = c;
+}
+
+#endif
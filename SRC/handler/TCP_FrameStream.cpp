@@ -0,0 +1,468 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: implementation of TCP_FrameStream, see TCP_FrameStream.h
+// for the frame layout.
+
+#include <TCP_FrameStream.h>
+#include <Vector.h>
+#include <TCP_Socket.h>
+
+#include <stdio.h>
+#include <string.h>
+
+TCP_FrameStream::TCP_FrameStream(unsigned int other_Port, 
+				 const char *other_InetAddr,
+				 int maxRec)
+  :OPS_Stream(OPS_STREAM_TAGS_TCP_FrameStream), theChannel(0),
+   recordSize(0), maxRecords(maxRec), currentBatch(0),
+   thePayload(0), numSent(0), inFlight(false),
+   sequence(0), numDropped(0), attributeMode(false)
+{
+  if (maxRecords < 1)
+    maxRecords = 1;
+
+  theBatches[0] = 0;
+  theBatches[1] = 0;
+  numRecords[0] = 0;
+  numRecords[1] = 0;
+
+  theChannel = new TCP_Socket(other_Port, other_InetAddr);
+  if (theChannel->setUpConnection() < 0) {
+    opserr << "TCP_FrameStream - Failed to set up connection\n";
+    delete theChannel;
+    theChannel = 0;
+  } else if (theChannel->setBlocking(false) < 0) {
+    opserr << "TCP_FrameStream - Failed to make the socket non-blocking\n";
+  }
+}
+
+
+TCP_FrameStream::~TCP_FrameStream()
+{
+  this->close();
+
+  if (theChannel != 0) 
+    delete theChannel;
+
+  if (theBatches[0] != 0)
+    delete [] theBatches[0];
+  if (theBatches[1] != 0)
+    delete [] theBatches[1];
+}
+
+int 
+TCP_FrameStream::setFile(const char *name, openMode mode)
+{
+  return 0;
+}
+
+int 
+TCP_FrameStream::open(void)
+{
+  return 0;
+}
+
+int 
+TCP_FrameStream::close(void)
+{
+  if (theChannel == 0)
+    return 0;
+
+  // send everything still pending and the end of stream frame
+  if (this->sendBatch(true) == 0 &&
+      this->startFrame(TCP_FRAME_END, 0, 0, 0) == 0)
+    this->sendFrame(true);
+
+  if (theChannel != 0)
+    delete theChannel;
+  theChannel = 0;
+
+  return 0;
+}
+
+int 
+TCP_FrameStream::tag(const char *tagName)
+{
+  if (attributeMode == true)
+    schema += ">\n";
+  schema += "<";
+  schema += tagName;
+  openTags.push_back(tagName);
+  attributeMode = true;
+  return 0;
+}
+
+int 
+TCP_FrameStream::tag(const char *tagName, const char *value)
+{
+  if (attributeMode == true)
+    schema += ">\n";
+  attributeMode = false;
+  schema += "<";
+  schema += tagName;
+  schema += ">";
+  schema += value;
+  schema += "</";
+  schema += tagName;
+  schema += ">\n";
+  return 0;
+}
+
+int 
+TCP_FrameStream::endTag()
+{
+  if (openTags.empty())
+    return -1;
+
+  if (attributeMode == true)
+    schema += "/>\n";
+  else {
+    schema += "</";
+    schema += openTags.back();
+    schema += ">\n";
+  }
+  attributeMode = false;
+  openTags.pop_back();
+  return 0;
+}
+
+int 
+TCP_FrameStream::attr(const char *name, int value)
+{
+  char buffer[32];
+  sprintf(buffer, "%d", value);
+  return this->attr(name, buffer);
+}
+
+int 
+TCP_FrameStream::attr(const char *name, double value)
+{
+  char buffer[32];
+  sprintf(buffer, "%.15g", value);
+  return this->attr(name, buffer);
+}
+
+int 
+TCP_FrameStream::attr(const char *name, const char *value)
+{
+  schema += " ";
+  schema += name;
+  schema += "=\"";
+  schema += value;
+  schema += "\"";
+  return 0;
+}
+
+int 
+TCP_FrameStream::write(Vector &dataToSend)
+{
+  int sizeToSend = dataToSend.Size();
+  if (sizeToSend == 0 || theChannel == 0)
+    return 0;
+
+  // a new record size; send what we have and a new schema
+  if (sizeToSend != recordSize) {
+    if (this->sendBatch(true) < 0)
+      return -1;
+
+    for (int i=0; i<2; i++) {
+      if (theBatches[i] != 0)
+	delete [] theBatches[i];
+      theBatches[i] = new double[maxRecords*sizeToSend];
+      numRecords[i] = 0;
+    }
+    recordSize = sizeToSend;
+
+    if (this->sendSchema() < 0)
+      return -1;
+  }
+
+  // move the frame in flight along, if the batch being filled is full and
+  // the consumer is still busy drop the oldest record in it
+  if (this->sendBatch(false) < 0)
+    return -1;
+
+  if (numRecords[currentBatch] == maxRecords) {
+    double *theBatch = theBatches[currentBatch];
+    memmove(theBatch, theBatch + recordSize, (maxRecords-1)*recordSize*sizeof(double));
+    numRecords[currentBatch]--;
+    numDropped++;
+  }
+
+  double *theRecord = theBatches[currentBatch] + numRecords[currentBatch]*recordSize;
+  for (int i=0; i<recordSize; i++)
+    theRecord[i] = dataToSend(i);
+  numRecords[currentBatch]++;
+
+  // send now if the socket is free
+  if (this->sendBatch(false) < 0)
+    return -1;
+
+  return 0;
+}
+
+
+int
+TCP_FrameStream::startFrame(int type, const char *payload, int numBytes, int numRec)
+{
+  if (inFlight == true)
+    return -1;
+
+  theHeader.magic = TCP_FRAME_MAGIC;
+  theHeader.type = type;
+  theHeader.sequence = sequence++;
+  theHeader.numRecords = numRec;
+  theHeader.recordSize = recordSize;
+  theHeader.numDropped = (type == TCP_FRAME_DATA) ? numDropped : 0;
+  theHeader.numBytes = numBytes;
+  theHeader.pad = 0;
+
+  if (type == TCP_FRAME_DATA)
+    numDropped = 0;
+
+  thePayload = payload;
+  numSent = 0;
+  inFlight = true;
+
+  return 0;
+}
+
+
+// write as much of the frame in flight as the socket takes; returns 0 when
+// the frame has been sent, 1 if part of it is still pending and -1 on error.
+// To wait for the whole frame the socket is made blocking for the writes
+int
+TCP_FrameStream::sendFrame(bool wait)
+{
+  if (inFlight == false)
+    return 0;
+
+  if (wait == true)
+    theChannel->setBlocking(true);
+
+  int headerSize = sizeof(TCP_FrameHeader);
+  int frameSize = headerSize + theHeader.numBytes;
+
+  while (numSent < frameSize) {
+    const char *buffers[2];
+    int sizes[2];
+    int numBuffers = 0;
+    if (numSent < headerSize) {
+      buffers[numBuffers] = (const char *)&theHeader + numSent;
+      sizes[numBuffers++] = headerSize - numSent;
+      if (theHeader.numBytes != 0) {
+	buffers[numBuffers] = thePayload;
+	sizes[numBuffers++] = theHeader.numBytes;
+      }
+    } else {
+      buffers[numBuffers] = thePayload + numSent - headerSize;
+      sizes[numBuffers++] = frameSize - numSent;
+    }
+
+    int nwrite = theChannel->sendBuffers(buffers, sizes, numBuffers);
+    if (nwrite < 0) {
+      opserr << "TCP_FrameStream - failed to send data, closing stream\n";
+      delete theChannel;
+      theChannel = 0;
+      inFlight = false;
+      return -1;
+    }
+    numSent += nwrite;
+
+    if (nwrite == 0 && wait == false)
+      return 1;
+  }
+
+  if (wait == true)
+    theChannel->setBlocking(false);
+
+  inFlight = false;
+  return 0;
+}
+
+
+// finish the frame in flight and send the batch being filled as a data frame
+int
+TCP_FrameStream::sendBatch(bool wait)
+{
+  int res = this->sendFrame(wait);
+  if (res != 0)
+    return res;
+
+  if (numRecords[currentBatch] == 0)
+    return 0;
+
+  int numRec = numRecords[currentBatch];
+  this->startFrame(TCP_FRAME_DATA, (const char *)theBatches[currentBatch],
+		   numRec*recordSize*sizeof(double), numRec);
+
+  // the batch sent stays untouched until the frame is out
+  currentBatch = 1 - currentBatch;
+  numRecords[currentBatch] = 0;
+
+  res = this->sendFrame(wait);
+  if (res < 0)
+    return res;
+
+  return 0;
+}
+
+
+int
+TCP_FrameStream::sendSchema(void)
+{
+  if (this->sendFrame(true) < 0)
+    return -1;
+
+  if (attributeMode == true) {
+    schema += ">\n";
+    attributeMode = false;
+  }
+
+  this->startFrame(TCP_FRAME_SCHEMA, schema.c_str(), schema.length(), 0);
+
+  return this->sendFrame(true);
+}
+
+
+OPS_Stream& 
+TCP_FrameStream::write(const char *s,int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::write(const unsigned char*s,int n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::write(const signed char*s,int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::write(const void *s, int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(char c)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(unsigned char c)
+{  
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(signed char c)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(const char *s)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(const unsigned char *s)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(const signed char *s)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(const void *p)
+{
+  return *this;
+}
+
+OPS_Stream& 
+TCP_FrameStream::operator<<(int n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(unsigned int n)
+{  
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(long n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(unsigned long n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(short n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(unsigned short n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(bool b)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(double n)
+{
+  return *this;
+}
+OPS_Stream& 
+TCP_FrameStream::operator<<(float n)
+{
+  return *this;
+}
+
+
+int 
+TCP_FrameStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  return -1;
+}
+
+int 
+TCP_FrameStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return -1;
+}
@@ -0,0 +1,134 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: TCP_FrameStream is an OPS_Stream that sends recorder output
+// to a local consumer (dashboard, post-processor) as framed binary data over
+// a TCP_Socket. A schema frame, holding the record size and the xml meta data
+// the recorder writes through tag()/attr(), is sent before the first data
+// frame and whenever the record size changes. Records are copied once into a
+// batch buffer and written together with the frame header using a single
+// gather write. The socket is non-blocking: while a frame is still in flight
+// records accumulate in the next batch, up to maxRecords, after which the
+// oldest pending record is dropped for each new one and the number dropped is
+// reported in the next frame header so the analysis never waits on the
+// consumer.
+
+#ifndef _TCP_FrameStream
+#define _TCP_FrameStream
+
+#include <OPS_Stream.h>
+#include <string>
+#include <vector>
+
+class TCP_Socket;
+
+#define TCP_FRAME_MAGIC   0x4F505346  // 'OPSF'
+#define TCP_FRAME_SCHEMA  1
+#define TCP_FRAME_DATA    2
+#define TCP_FRAME_END     3
+
+// header in front of every frame, in the byte order of the sender; a consumer
+// that reads a byte swapped magic number must swap the header and data
+typedef struct tcpFrameHeader {
+  int magic;
+  int type;          // TCP_FRAME_SCHEMA, TCP_FRAME_DATA or TCP_FRAME_END
+  int sequence;      // frame number
+  int numRecords;    // records in a data frame
+  int recordSize;    // doubles per record
+  int numDropped;    // records dropped since the previous data frame
+  int numBytes;      // bytes following the header
+  int pad;
+} TCP_FrameHeader;
+
+class TCP_FrameStream : public OPS_Stream
+{
+ public:
+    TCP_FrameStream(unsigned int other_Port, 
+		    const char *other_InetAddr,
+		    int maxRecords = 64);
+    ~TCP_FrameStream();
+
+    int setFile(const char *fileName, openMode mode = OVERWRITE);
+    int open(void);
+    int close(void);
+    
+    // xml stuff
+    int tag(const char *);
+    int tag(const char *, const char *);
+    int endTag();
+    int attr(const char *name, int value);
+    int attr(const char *name, double value);
+    int attr(const char *name, const char *value);
+    int write(Vector &data);
+    
+    // regular stuff
+    OPS_Stream& write(const char *s, int n);
+    OPS_Stream& write(const unsigned char *s, int n);
+    OPS_Stream& write(const signed char *s, int n);
+    OPS_Stream& write(const void *s, int n);
+    OPS_Stream& operator<<(char c);
+    OPS_Stream& operator<<(unsigned char c);
+    OPS_Stream& operator<<(signed char c);
+    OPS_Stream& operator<<(const char *s);
+    OPS_Stream& operator<<(const unsigned char *s);
+    OPS_Stream& operator<<(const signed char *s);
+    OPS_Stream& operator<<(const void *p);
+    OPS_Stream& operator<<(int n);
+    OPS_Stream& operator<<(unsigned int n);
+    OPS_Stream& operator<<(long n);
+    OPS_Stream& operator<<(unsigned long n);
+    OPS_Stream& operator<<(short n);
+    OPS_Stream& operator<<(unsigned short n);
+    OPS_Stream& operator<<(bool b);
+    OPS_Stream& operator<<(double n);
+    OPS_Stream& operator<<(float n);
+    
+    int sendSelf(int commitTag, Channel &theChannel);  
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+ private:
+    int startFrame(int type, const char *payload, int numBytes, int numRecords);
+    int sendFrame(bool wait);
+    int sendBatch(bool wait);
+    int sendSchema(void);
+
+    TCP_Socket *theChannel;
+
+    int recordSize;          // doubles per record, 0 before the first write
+    int maxRecords;          // capacity of a batch
+    double *theBatches[2];   // batch being filled and batch in flight
+    int numRecords[2];
+    int currentBatch;
+
+    TCP_FrameHeader theHeader;  // header of the frame in flight
+    const char *thePayload;
+    int numSent;                // bytes of the frame in flight already sent
+    bool inFlight;
+
+    int sequence;
+    int numDropped;
+
+    std::string schema;
+    std::vector<std::string> openTags;
+    bool attributeMode;
+};
+
+#endif
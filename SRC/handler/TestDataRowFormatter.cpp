@@ -0,0 +1,151 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Purpose: This file is a driver to check that DataRowFormatter produces
+// exactly the text an ostream produces for the same precision and float
+// field settings, and to compare the throughput (MB/s) of the two paths.
+//
+// usage: testDataRowFormatter <numRows?> <numColumns?>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <sstream>
+#include <iomanip>
+#include <string>
+
+#include <DataRowFormatter.h>
+
+static double
+elapsedTime(clock_t start)
+{
+  return (double)(clock() - start)/CLOCKS_PER_SEC;
+}
+
+static void
+fillRow(double *row, int numColumns, int r)
+{
+  for (int j=0; j<numColumns; j++) {
+    int kind = (r*numColumns + j) % 5;
+    if (kind == 0)
+      row[j] = 0.0;
+    else if (kind == 1)
+      row[j] = (double)(r - j);
+    else if (kind == 2)
+      row[j] = sin(0.001*r + j)*pow(10.0, (r+j)%17 - 8);
+    else if (kind == 3)
+      row[j] = -1.0/(r+j+1);
+    else
+      row[j] = (r % 7 == 0) ? -0.0 : exp(0.01*((r*j)%4000) - 20.0);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int numRows = 20000;
+  int numColumns = 50;
+  if (argc > 1) numRows = atoi(argv[1]);
+  if (argc > 2) numColumns = atoi(argv[2]);
+
+  double *row = new double[numColumns];
+
+  //
+  // check the output is identical for a range of stream settings
+  //
+
+  int numFailed = 0;
+  std::ios_base::fmtflags fields[4] = {std::ios_base::fmtflags(0),
+				       std::ios_base::fixed,
+				       std::ios_base::scientific,
+				       std::ios_base::fixed | std::ios_base::scientific};
+
+  for (int f=0; f<4; f++) {
+    for (int prec=0; prec<=17; prec++) {
+      std::ostringstream theStream;
+      theStream << std::setprecision(prec);
+      theStream.setf(fields[f], std::ios_base::floatfield);
+
+      DataRowFormatter theFormatter;
+      theFormatter.setFormat(theStream);
+
+      for (int r=0; r<200; r++) {
+	fillRow(row, numColumns, r);
+	for (int j=0; j<numColumns; j++) {
+	  theStream << row[j] << " ";
+	  theFormatter.add(row[j]);
+	  theFormatter.add(' ');
+	}
+	theStream << "\n";
+	theFormatter.add('\n');
+      }
+
+      std::string expected = theStream.str();
+      if ((int)expected.size() != theFormatter.getSize() ||
+	  memcmp(expected.c_str(), theFormatter.getData(), expected.size()) != 0) {
+	fprintf(stderr, "FAILED: floatfield %d precision %d\n", f, prec);
+	numFailed++;
+      }
+    }
+  }
+
+  if (numFailed == 0)
+    fprintf(stderr, "output identical to ostream for all settings\n");
+
+  //
+  // throughput of the two paths at the default precision
+  //
+
+  std::ostringstream theStream;
+  clock_t start = clock();
+  for (int r=0; r<numRows; r++) {
+    fillRow(row, numColumns, r);
+    for (int j=0; j<numColumns; j++)
+      theStream << row[j] << " ";
+    theStream << "\n";
+  }
+  double timeStream = elapsedTime(start);
+  double numBytes = (double)theStream.str().size();
+
+  DataRowFormatter theFormatter;
+  theFormatter.setFormat(theStream);
+  std::ostringstream theOutput;
+  start = clock();
+  for (int r=0; r<numRows; r++) {
+    fillRow(row, numColumns, r);
+    theFormatter.clear();
+    for (int j=0; j<numColumns; j++) {
+      theFormatter.add(row[j]);
+      theFormatter.add(' ');
+    }
+    theFormatter.add('\n');
+    theOutput.write(theFormatter.getData(), theFormatter.getSize());
+  }
+  double timeFormatter = elapsedTime(start);
+
+  fprintf(stderr, "ostream:          %8.1f MB/s\n", numBytes/1.0e6/timeStream);
+  fprintf(stderr, "DataRowFormatter: %8.1f MB/s\n", numBytes/1.0e6/timeFormatter);
+
+  delete [] row;
+
+  return numFailed;
+}
@@ -0,0 +1,172 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Purpose: This file is a driver for TCP_FrameStream. It acts as the local
+// consumer: it waits on a port for the stream to connect, then reads frames
+// until the end of stream frame, printing the schema and the number of records
+// received and dropped. With -loopback a producer process is forked that
+// connects to 127.0.0.1 and writes numRecords records, which gives a quick
+// check of the frame layout and the throughput of the stream.
+//
+// usage: testTCP_FrameStream port? <-loopback numRecords? recordSize?>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#include <StandardStream.h>
+#include <TCP_Socket.h>
+#include <TCP_FrameStream.h>
+#include <Message.h>
+#include <Vector.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int
+produce(unsigned int port, int numRecords, int recordSize)
+{
+  TCP_FrameStream theStream(port, "127.0.0.1");
+
+  theStream.tag("OpenSeesOutput");
+  theStream.tag("NodeOutput");
+  theStream.attr("nodeTag", 1);
+  theStream.attr("numResponses", recordSize);
+  theStream.endTag();
+  theStream.endTag();
+
+  Vector data(recordSize);
+  for (int i=0; i<numRecords; i++) {
+    for (int j=0; j<recordSize; j++)
+      data(j) = i + 0.001*j;
+    theStream.write(data);
+  }
+
+  return theStream.close();
+}
+
+int main(int argc, char **argv)
+{
+  unsigned int port = 8090;
+  int numRecords = 0;
+  int recordSize = 10;
+
+  if (argc > 1) port = atoi(argv[1]);
+  if (argc > 3 && strcmp(argv[2],"-loopback") == 0) {
+    numRecords = atoi(argv[3]);
+    if (argc > 4) recordSize = atoi(argv[4]);
+  }
+
+#ifndef _WIN32
+  pid_t pid = 0;
+  if (numRecords > 0) {
+    pid = fork();
+    if (pid == 0) {
+      sleep(1);  // give the consumer time to listen
+      exit(produce(port, numRecords, recordSize));
+    }
+  }
+#endif
+
+  TCP_Socket theSocket(port);
+  if (theSocket.setUpConnection() != 0) {
+    fprintf(stderr, "testTCP_FrameStream - failed to set up connection\n");
+    return -1;
+  }
+
+  int numFrames = 0;
+  int numReceived = 0;
+  int numDropped = 0;
+  int lastSequence = -1;
+  double numBytes = 0;
+  int sizePayload = 0;
+  char *thePayload = 0;
+  int res = 0;
+
+  clock_t start = clock();
+  while (true) {
+    TCP_FrameHeader theHeader;
+    Message headerMsg((char *)&theHeader, sizeof(TCP_FrameHeader));
+    if (theSocket.recvMsg(0, 0, headerMsg) < 0 || theHeader.magic != TCP_FRAME_MAGIC) {
+      fprintf(stderr, "testTCP_FrameStream - bad frame header\n");
+      res = -1;
+      break;
+    }
+    if (theHeader.sequence != lastSequence+1) {
+      fprintf(stderr, "testTCP_FrameStream - frame %d out of sequence\n", theHeader.sequence);
+      res = -1;
+    }
+    lastSequence = theHeader.sequence;
+    numFrames++;
+
+    if (theHeader.numBytes > sizePayload) {
+      if (thePayload != 0)
+	delete [] thePayload;
+      sizePayload = theHeader.numBytes;
+      thePayload = new char[sizePayload+1];
+    }
+    if (theHeader.numBytes > 0) {
+      Message payloadMsg(thePayload, theHeader.numBytes);
+      if (theSocket.recvMsg(0, 0, payloadMsg) < 0) {
+	fprintf(stderr, "testTCP_FrameStream - failed to read frame data\n");
+	res = -1;
+	break;
+      }
+    }
+    numBytes += sizeof(TCP_FrameHeader) + theHeader.numBytes;
+
+    if (theHeader.type == TCP_FRAME_SCHEMA) {
+      thePayload[theHeader.numBytes] = '\0';
+      fprintf(stderr, "schema: record size %d\n%s", theHeader.recordSize, thePayload);
+    } else if (theHeader.type == TCP_FRAME_DATA) {
+      numReceived += theHeader.numRecords;
+      numDropped += theHeader.numDropped;
+    } else if (theHeader.type == TCP_FRAME_END)
+      break;
+  }
+  double time = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+  fprintf(stderr, "frames: %d records received: %d dropped: %d\n", 
+	  numFrames, numReceived, numDropped);
+  if (time > 0)
+    fprintf(stderr, "%8.1f MB/s\n", numBytes/1.0e6/time);
+
+  if (numRecords > 0 && numReceived + numDropped != numRecords) {
+    fprintf(stderr, "FAILED: %d records written\n", numRecords);
+    res = -1;
+  }
+
+#ifndef _WIN32
+  if (pid > 0) {
+    int status;
+    waitpid(pid, &status, 0);
+  }
+#endif
+
+  if (thePayload != 0)
+    delete [] thePayload;
+
+  return res;
+}
@@ -701,15 +701,20 @@ XmlFileStream::write(Vector &data)
   Matrix &printMapping = *mapping;
 
   // write data
+  theRow.setFormat(theFile);
+  theRow.clear();
   for (int i=0; i<maxCount+1; i++) {
     int fileID = (int)printMapping(0,i);
     int startLoc = (int)printMapping(1,i);
     int numData = (int)printMapping(2,i);
     double *data = theData[fileID];
-    for (int j=0; j<numData; j++)
-      theFile << data[startLoc++] << " ";
+    for (int j=0; j<numData; j++) {
+      theRow.add(data[startLoc++]);
+      theRow.add(' ');
+    }
   }
-  theFile << "\n";
+  theRow.add('\n');
+  theFile.write(theRow.getData(), theRow.getSize());
   return 0;
 }
 
@@ -794,9 +799,15 @@ XmlFileStream::write(const double *s, int n)
   }
 
   if (fileOpen != 0) {
-    for (int i=0; i<n; i++)
-      theFile << s[i] << " ";
-    theFile << endln;
+    // format the whole row and write it in one go
+    theRow.setFormat(theFile);
+    theRow.clear();
+    for (int i=0; i<n; i++) {
+      theRow.add(s[i]);
+      theRow.add(' ');
+    }
+    theRow.add('\n');
+    theFile.write(theRow.getData(), theRow.getSize());
   }
 
   return *this;
@@ -26,6 +26,7 @@
 #define _XmlFileStream
 
 #include <OPS_Stream.h>
+#include <DataRowFormatter.h>
 
 #include <fstream>
 using std::ofstream;
@@ -125,6 +126,8 @@ class XmlFileStream : public OPS_Stream
 
   int numXMLTags;
   ID *xmlColumns;
+
+  DataRowFormatter theRow;
 };
 
 #endif
@@ -49,6 +49,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <SectionForceDeformation.h>
 #include <SectionRepres.h>
 #include <TimeSeries.h>
+#include <TemperatureStore.h>
 #include <CrdTransf.h>
 #include <BeamIntegration.h>
 #include <NodalLoad.h>
@@ -544,7 +545,7 @@ OpenSeesCommands::setPFEMAnalysis()
 
     // create PFEM analysis
     if(OPS_GetNumRemainingInputArgs() < 3) {
-	opserr<<"WARNING: wrong no of args -- analysis PFEM dtmax dtmin gravity <ratio>\n";
+	opserr<<"WARNING: wrong no of args -- analysis PFEM dtmax dtmin gravity <ratio> <-timing>\n";
 	return -1;
     }
 
@@ -562,10 +563,18 @@ OpenSeesCommands::setPFEMAnalysis()
 	opserr<<"WARNING: invalid gravity \n";
 	return -1;
     }
-    if(OPS_GetNumRemainingInputArgs() > 0) {
-	if (OPS_GetDoubleInput(&numdata, &ratio) < 0) {
-	    opserr<<"WARNING: invalid ratio \n";
-	    return -1;
+    bool timing = false;
+    while(OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (opt != 0 && strcmp(opt, "-timing") == 0) {
+	    timing = true;
+	} else {
+	    // back one arg
+	    OPS_ResetCurrentInputArg(-1);
+	    if (OPS_GetDoubleInput(&numdata, &ratio) < 0) {
+		opserr<<"WARNING: invalid ratio \n";
+		return -1;
+	    }
 	}
     }
 
@@ -601,6 +610,7 @@ OpenSeesCommands::setPFEMAnalysis()
 				       *theSOE,
 				       *theTransientIntegrator,
 				       theTest,dtmax,dtmin,gravity,ratio);
+    thePFEMAnalysis->setTiming(timing);
 
     theTransientAnalysis = thePFEMAnalysis;
 
@@ -820,6 +830,9 @@ OpenSeesCommands::wipe()
     // wipe time series
     OPS_clearAllTimeSeries();
 
+    // wipe temperature stores
+    OPS_clearAllTemperatureStores();
+
     // wipe GeomTransf
     OPS_clearAllCrdTransf();
 
@@ -1377,15 +1377,33 @@ int OPS_remesh()
 	    return -1;
 	}
 
+	// keep the elements whose nodes are unchanged, print the timing
+	bool incremental = false;
+	bool timing = false;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* opt = OPS_GetString();
+	    if (opt == 0) {
+		opserr << "WARNING: invalid option -- remesh alpha <-incremental> <-timing>\n";
+		return -1;
+	    } else if (strcmp(opt, "-incremental") == 0) {
+		incremental = true;
+	    } else if (strcmp(opt, "-timing") == 0) {
+		timing = true;
+	    } else {
+		opserr << "WARNING: unknown option " << opt << " -- remesh alpha <-incremental> <-timing>\n";
+		return -1;
+	    }
+	}
+
 	int ndm = OPS_GetNDM();
 
 	if (ndm == 2) {
-	    if (TriMesh::remesh(alpha) < 0) {
+	    if (TriMesh::remesh(alpha, incremental, timing) < 0) {
 		opserr << "WARNING: failed to remesh\n";
 		return -1;
 	    }
 	} else if (ndm == 3) {
-	    if (TetMesh::remesh(alpha) < 0) {
+	    if (TetMesh::remesh(alpha, incremental, timing) < 0) {
 		opserr << "WARNING: failed to remesh\n";
 		return -1;
 	    }
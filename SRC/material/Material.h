@@ -59,6 +59,12 @@ class Material : public TaggedObject, public MovableObject
     // method for this material to update itself according to its new parameters
     virtual void update(void) {return;}
 
+    // true if the state determination of different objects (setting the
+    // trial state, returning stress and tangent, commit and revert) can be
+    // done on different threads at the same time, i.e. all the class wide
+    // and function local static scratch it writes is OPS_THREAD_LOCAL
+    virtual bool isThreadSafe(void) {return false;}
+
   protected:
     
   private:
@@ -67,6 +67,12 @@ Matrix              ManzariDafalias::mIIdevMix(6,6);
 Matrix              ManzariDafalias::mIIdevCo(6,6);
 ManzariDafalias::initTensors ManzariDafalias::initTensorOps;
 
+// the identity tensors for the kernels on fixed size tensors
+static const Voigt6  I1       = Voigt6::identity();
+static const Voigt66 IImix    = Voigt66::identity();
+static const Voigt66 IIvol    = Voigt66::dyadic(I1, I1);
+static const Voigt66 IIdevMix = IImix - 1.0/3.0*IIvol;
+
 static int numManzariDafaliasMaterials = 0;
 
 void *
@@ -136,10 +142,10 @@ ManzariDafalias::ManzariDafalias(int tag, double G0, double nu,
     int JacoType, double TolF, double TolR): NDMaterial(tag,ND_TAG_ManzariDafalias),
     mEpsilon(6), 
     mEpsilon_n(6),
-    mEpsilonE(6),
-    mEpsilonE_n(6),
     mSigma(6),
     mSigma_n(6),
+    mEpsilonE(6),
+    mEpsilonE_n(6),
     mAlpha(6),
     mAlpha_n(6),
     mAlpha_in(6),
@@ -189,10 +195,10 @@ ManzariDafalias::ManzariDafalias(int tag, int classTag, double G0, double nu,
     int JacoType, double TolF, double TolR): NDMaterial(tag, classTag),
     mEpsilon(6), 
     mEpsilon_n(6),
-    mEpsilonE(6),
-    mEpsilonE_n(6),
     mSigma(6),
     mSigma_n(6),
+    mEpsilonE(6),
+    mEpsilonE_n(6),
     mAlpha(6),
     mAlpha_n(6),
     mAlpha_in(6),
@@ -240,10 +246,10 @@ ManzariDafalias ::ManzariDafalias(int classTag)
     : NDMaterial(0, classTag),
     mEpsilon(6), 
     mEpsilon_n(6),
-    mEpsilonE(6),
-    mEpsilonE_n(6),
     mSigma(6),
     mSigma_n(6),
+    mEpsilonE(6),
+    mEpsilonE_n(6),
     mAlpha(6),
     mAlpha_n(6),
     mAlpha_in(6),
@@ -293,10 +299,10 @@ ManzariDafalias ::ManzariDafalias()
     : NDMaterial(0, ND_TAG_ManzariDafalias),
     mEpsilon(6), 
     mEpsilon_n(6),
-    mEpsilonE(6),
-    mEpsilonE_n(6),
     mSigma(6),
     mSigma_n(6),
+    mEpsilonE(6),
+    mEpsilonE_n(6),
     mAlpha(6),
     mAlpha_n(6),
     mAlpha_in(6),
@@ -860,11 +866,11 @@ void ManzariDafalias::integrate()
 	// I assume full elastic step and check if the new stress direction is "dramatically" 
 	// different from the stress path (in reference to the center of the yield surface). 
 	// Another method is to use the change in the stress direction.
-    Vector trialDirection(6);
+    Voigt6 trialDirection;
 	// trialDirection = GetNormalToYield(mSigma_n + mCe*(mEpsilon - mEpsilon_n), mAlpha_n);
-	trialDirection = mCe * (mEpsilon - mEpsilon_n);
+	trialDirection = Voigt66(mCe) * (Voigt6(mEpsilon) - Voigt6(mEpsilon_n));
 
-    if (DoubleDot2_2_Contr(mAlpha_n - mAlpha_in_n, trialDirection) < 0.0)
+    if ((Voigt6(mAlpha_n) - Voigt6(mAlpha_in_n)).ddotContr(trialDirection) < 0.0)
         mAlpha_in = mAlpha_n;
     else
         mAlpha_in = mAlpha_in_n;
@@ -881,14 +887,25 @@ void ManzariDafalias::integrate()
             BackwardEuler_CPPM(mSigma_n, mEpsilon_n, mEpsilonE_n, mAlpha_n, mFabric_n, mAlpha_in,
                 mEpsilon, mEpsilonE, mSigma, mAlpha, mFabric, mDGamma, mVoidRatio, mG, 
                 mK, mCe, mCep, mCep_Consistent);
-        // explicit schemes
-        else
-            explicit_integrator(mSigma_n, mEpsilon_n, mEpsilonE_n, mAlpha_n, mFabric_n, mAlpha_in,
-                mEpsilon, mEpsilonE, mSigma, mAlpha, mFabric, mDGamma, mVoidRatio, mG, 
-                mK, mCe, mCep, mCep_Consistent);
+        // explicit schemes, on fixed size tensors
+        else {
+            Voigt6 nEStrain(mEpsilonE), nStress(mSigma), nAlpha(mAlpha), nFabric(mFabric);
+            Voigt66 nCe(mCe), nCep(mCep), nCepC(mCep_Consistent);
+            explicit_integrator(Voigt6(mSigma_n), Voigt6(mEpsilon_n), Voigt6(mEpsilonE_n), Voigt6(mAlpha_n),
+                Voigt6(mFabric_n), Voigt6(mAlpha_in), Voigt6(mEpsilon), nEStrain, nStress, nAlpha, nFabric,
+                mDGamma, mVoidRatio, mG, mK, nCe, nCep, nCepC);
+            nEStrain.copyTo(mEpsilonE);
+            nStress.copyTo(mSigma);
+            nAlpha.copyTo(mAlpha);
+            nFabric.copyTo(mFabric);
+            nCe.copyTo(mCe);
+            nCep.copyTo(mCep);
+            nCepC.copyTo(mCep_Consistent);
+        }
     }
 }
 
+
 void ManzariDafalias::elastic_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
         const Vector& NextStrain, Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha,
         double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
@@ -915,11 +932,33 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
         const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
+{    
+    Voigt6 nEStrain(NextElasticStrain), nStress(NextStress), nAlpha(NextAlpha), nFabric(NextFabric);
+    Voigt66 nC(aC), nCep(aCep), nCepC(aCep_Consistent);
+
+    explicit_integrator(Voigt6(CurStress), Voigt6(CurStrain), Voigt6(CurElasticStrain), Voigt6(CurAlpha), Voigt6(CurFabric),
+        Voigt6(alpha_in), Voigt6(NextStrain), nEStrain, nStress, nAlpha, nFabric, NextDGamma, NextVoidRatio, G, K,
+        nC, nCep, nCepC);
+
+    nEStrain.copyTo(NextElasticStrain);
+    nStress.copyTo(NextStress);
+    nAlpha.copyTo(NextAlpha);
+    nFabric.copyTo(NextFabric);
+    nC.copyTo(aC);
+    nCep.copyTo(aCep);
+    nCepC.copyTo(aCep_Consistent);
+}
+
+
+void ManzariDafalias::explicit_integrator(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+        const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+        Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+        double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) 
 {    
     // function pointer to the integration scheme
-    void (ManzariDafalias::*exp_int) (const Vector& , const Vector& , const Vector& , const Vector& , const Vector& , const Vector& , 
-        const Vector& ,    Vector& , Vector& , Vector& , Vector& , double& , double& ,  double& , double& , 
-        Matrix& , Matrix& , Matrix& ) ;
+    void (ManzariDafalias::*exp_int) (const Voigt6& , const Voigt6& , const Voigt6& , const Voigt6& , const Voigt6& , const Voigt6& , 
+        const Voigt6& ,    Voigt6& , Voigt6& , Voigt6& , Voigt6& , double& , double& ,  double& , double& , 
+        Voigt66& , Voigt66& , Voigt66& ) ;
     
     switch (mScheme) {
         case INT_ForwardEuler     :    // Forward Euler
@@ -931,23 +970,14 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
             break;
 
         case INT_RungeKutta       :    // Runge Kutta 4th order
-            exp_int = &ManzariDafalias::RungeKutta4;
-            break;
-
-        case INT_RungeKutta45        :    // Runge Kutta 45 with error control after Sloan (J. Abell @ UANDES added)
-            exp_int = &ManzariDafalias::RungeKutta45;
-            break;        
-
+        case INT_RungeKutta45     :    // Runge Kutta 45 with error control after Sloan (J. Abell @ UANDES added)
         case INT_MAXSTR_FE        :    // Forward Euler constraining maximum strain increment
         case INT_MAXSTR_MFE       :    // Modified Euler constraining maximum strain increment
         case INT_MAXSTR_RK        :    // Runge-Kutta 4-th order constraining maximum strain increment
-            exp_int = &ManzariDafalias::MaxStrainInc;
-            break;
-
         case INT_MAXENE_FE        :    // Forward Euler constraining maximum energy increment
         case INT_MAXENE_MFE       :    // Modified Euler constraining maximum energy increment
         case INT_MAXENE_RK        :    //  Runge-Kutta 4-th order constraining maximum energy increment
-            exp_int = &ManzariDafalias::MaxEnergyInc;
+            exp_int = &ManzariDafalias::explicit_vector_scheme;
             break;
             
         default :
@@ -955,17 +985,17 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
             break;
     }
     double elasticRatio, p, pn, f, fn;
-    Vector dSigma(6), dStrain(6);
+    Voigt6 dSigma, dStrain;
     bool   p_tr_pos = true;
 
-    NextVoidRatio          = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    NextVoidRatio          = m_e_init - (1 + m_e_init) * NextStrain.trace();
     dStrain                = NextStrain - CurStrain;
     NextElasticStrain      = CurElasticStrain + dStrain;
-    aC                     = GetStiffness(K, G);
-    dSigma                 = DoubleDot4_2(aC, dStrain);
+    GetStiffness(K, G, aC);
+    dSigma                 = aC * dStrain;
     NextStress             = CurStress + dSigma;
     f                      = GetF(NextStress, CurAlpha);
-    p                      = one3 * GetTrace(NextStress) + m_Presidual;
+    p                      = one3 * NextStress.trace() + m_Presidual;
 
     if (p < m_Presidual)
         p_tr_pos = false;
@@ -982,12 +1012,12 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
 
     } else {
         fn = GetF(CurStress, CurAlpha);
-        pn = one3 * GetTrace(CurStress) + m_Presidual;
+        pn = one3 * CurStress.trace() + m_Presidual;
         if (pn < m_Presidual)
         {
             if (debugFlag) 
                 opserr << "Manzari Dafalias (tag = " << this->getTag() << ") : p_n < 0, This should have not happened!" << endln;
-            NextStress = m_Pmin * mI1;
+            NextStress = m_Pmin * I1;
             NextAlpha.Zero();
             return;
         }
@@ -1004,21 +1034,21 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
         } else if (fn < -mTolF) {
             // This is a transition from elastic to plastic
             elasticRatio = IntersectionFactor(CurStress, CurStrain, NextStrain, CurAlpha, 0.0, 1.0);
-            dSigma         = DoubleDot4_2(aC, elasticRatio*(NextStrain - CurStrain));
+            dSigma         = aC * (elasticRatio*(NextStrain - CurStrain));
             (this->*exp_int)(CurStress + dSigma, CurStrain + elasticRatio*(NextStrain - CurStrain), CurElasticStrain + elasticRatio*(NextStrain - CurStrain),
                 CurAlpha, CurFabric, alpha_in, NextStrain, NextElasticStrain, NextStress, NextAlpha, NextFabric, NextDGamma, NextVoidRatio, 
                 G, K, aC, aCep, aCep_Consistent);
 
         } else if (fabs(fn) < mTolF) {
 
-            if (DoubleDot2_2_Contr(GetNormalToYield(CurStress, CurAlpha),dSigma)/(GetNorm_Contr(dSigma) == 0 ? 1.0 : GetNorm_Contr(dSigma)) > (- sqrt(mTolF))) {
+            if (GetNormalToYield(CurStress, CurAlpha).ddotContr(dSigma)/(dSigma.normContr() == 0 ? 1.0 : dSigma.normContr()) > (- sqrt(mTolF))) {
                 // This is a pure plastic step
                 (this->*exp_int)(CurStress, CurStrain, CurElasticStrain, CurAlpha, CurFabric, alpha_in, NextStrain, NextElasticStrain, NextStress, NextAlpha, 
                     NextFabric, NextDGamma, NextVoidRatio, G, K, aC, aCep, aCep_Consistent);
             } else {
                 // This is an elastic unloding followed by plastic loading
                 elasticRatio = IntersectionFactor_Unloading(CurStress, CurStrain, NextStrain, CurAlpha);
-                dSigma         = DoubleDot4_2(aC, elasticRatio*(NextStrain - CurStrain));
+                dSigma         = aC * (elasticRatio*(NextStrain - CurStrain));
                 (this->*exp_int)(CurStress + dSigma, CurStrain + elasticRatio*(NextStrain - CurStrain), CurElasticStrain + elasticRatio*(NextStrain - CurStrain),
                     CurAlpha, CurFabric, alpha_in, NextStrain, NextElasticStrain, NextStress, NextAlpha, NextFabric, NextDGamma, NextVoidRatio, 
                     G, K, aC, aCep, aCep_Consistent);
@@ -1028,6 +1058,68 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
 }
 
 
+void ManzariDafalias::explicit_vector_scheme(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+        const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+        Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+        double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) 
+{
+    // the schemes still working on Vector and Matrix
+    void (ManzariDafalias::*exp_int) (const Vector& , const Vector& , const Vector& , const Vector& , const Vector& , const Vector& , 
+        const Vector& ,    Vector& , Vector& , Vector& , Vector& , double& , double& ,  double& , double& , 
+        Matrix& , Matrix& , Matrix& ) ;
+
+    switch (mScheme) {
+        case INT_RungeKutta       :    // Runge Kutta 4th order
+            exp_int = &ManzariDafalias::RungeKutta4;
+            break;
+
+        case INT_RungeKutta45     :    // Runge Kutta 45 with error control after Sloan (J. Abell @ UANDES added)
+            exp_int = &ManzariDafalias::RungeKutta45;
+            break;        
+
+        case INT_MAXSTR_FE        :    // Forward Euler constraining maximum strain increment
+        case INT_MAXSTR_MFE       :    // Modified Euler constraining maximum strain increment
+        case INT_MAXSTR_RK        :    // Runge-Kutta 4-th order constraining maximum strain increment
+            exp_int = &ManzariDafalias::MaxStrainInc;
+            break;
+
+        default :                      // constraining maximum energy increment
+            exp_int = &ManzariDafalias::MaxEnergyInc;
+            break;
+    }
+
+    Vector cStress(6), cStrain(6), cEStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), nStrain(6);
+    Vector nEStrain(6), nStress(6), nAlpha(6), nFabric(6);
+    Matrix nC(6,6), nCep(6,6), nCepC(6,6);
+
+    CurStress.copyTo(cStress);
+    CurStrain.copyTo(cStrain);
+    CurElasticStrain.copyTo(cEStrain);
+    CurAlpha.copyTo(cAlpha);
+    CurFabric.copyTo(cFabric);
+    alpha_in.copyTo(cAlpha_in);
+    NextStrain.copyTo(nStrain);
+    NextElasticStrain.copyTo(nEStrain);
+    NextStress.copyTo(nStress);
+    NextAlpha.copyTo(nAlpha);
+    NextFabric.copyTo(nFabric);
+    aC.copyTo(nC);
+    aCep.copyTo(nCep);
+    aCep_Consistent.copyTo(nCepC);
+
+    (this->*exp_int)(cStress, cStrain, cEStrain, cAlpha, cFabric, cAlpha_in, nStrain, nEStrain, nStress, nAlpha, 
+        nFabric, NextDGamma, NextVoidRatio, G, K, nC, nCep, nCepC);
+
+    NextElasticStrain = Voigt6(nEStrain);
+    NextStress        = Voigt6(nStress);
+    NextAlpha         = Voigt6(nAlpha);
+    NextFabric        = Voigt6(nFabric);
+    aC                = Voigt66(nC);
+    aCep              = Voigt66(nCep);
+    aCep_Consistent   = Voigt66(nCepC);
+}
+
+
 void ManzariDafalias::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
         const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric, 
@@ -1062,7 +1154,7 @@ void ManzariDafalias::MaxStrainInc(const Vector& CurStress, const Vector& CurStr
         Vector cStress(6), cStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), cEStrain(6);
         Vector nStrain(6) ,nEStrain(6), nStress(6), nAlpha(6), nFabric(6), nAlpha_in(6);
         Matrix nCe(6,6), nCep(6,6), nCepC(6,6);
-        double nDGamma, nVoidRatio, nG, nK;
+        double nDGamma, nVoidRatio, nG = G, nK = K;
                 
         // create temporary variables
         cStress = CurStress; cStrain = CurStrain; cAlpha = CurAlpha; cFabric = CurFabric;
@@ -1150,7 +1242,7 @@ void ManzariDafalias::MaxEnergyInc(const Vector& CurStress, const Vector& CurStr
         Vector cStress(6), cStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), cEStrain(6);
         Vector nStrain(6) ,nEStrain(6), nStress(6), nAlpha(6), nFabric(6), nAlpha_in(6);
         Matrix nCe(6,6), nCep(6,6), nCepC(6,6);
-        double nDGamma, nVoidRatio, nG, nK;
+        double nDGamma, nVoidRatio, nG = G, nK = K;
         Vector n(6), d(6), b(6), R(6), dPStrain(6); 
         //double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
                 
@@ -1195,42 +1287,62 @@ void ManzariDafalias::ForwardEuler(const Vector& CurStress, const Vector& CurStr
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
-    double CurVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
-    NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    Voigt6 nEStrain(NextElasticStrain), nStress(NextStress), nAlpha(NextAlpha), nFabric(NextFabric);
+    Voigt66 nC(aC), nCep(aCep), nCepC(aCep_Consistent);
+
+    ForwardEuler(Voigt6(CurStress), Voigt6(CurStrain), Voigt6(CurElasticStrain), Voigt6(CurAlpha), Voigt6(CurFabric),
+        Voigt6(alpha_in), Voigt6(NextStrain), nEStrain, nStress, nAlpha, nFabric, NextDGamma, NextVoidRatio, G, K,
+        nC, nCep, nCepC);
+
+    nEStrain.copyTo(NextElasticStrain);
+    nStress.copyTo(NextStress);
+    nAlpha.copyTo(NextAlpha);
+    nFabric.copyTo(NextFabric);
+    nC.copyTo(aC);
+    nCep.copyTo(aCep);
+    nCepC.copyTo(aCep_Consistent);
+}
+
+
+void ManzariDafalias::ForwardEuler(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+        const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+        Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+        double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) 
+{    
+    double CurVoidRatio = m_e_init - (1 + m_e_init) * CurStrain.trace();
+    NextVoidRatio     = m_e_init - (1 + m_e_init) * NextStrain.trace();
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
-    aC = GetStiffness(K, G);
-    Vector n(6), d(6), b(6), R(6), dPStrain(6); 
+    GetStiffness(K, G, aC);
+    Voigt6 n, d, b, R, dPStrain; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
     GetStateDependent(CurStress, CurAlpha, CurFabric, CurVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0,
         A, D, B, C, R);
-    double dVolStrain = GetTrace(NextStrain - CurStrain);
-    Vector dDevStrain = GetDevPart(NextStrain - CurStrain);
-    double p = one3 * GetTrace(CurStress) + m_Presidual;
+    double dVolStrain = (NextStrain - CurStrain).trace();
+    Voigt6 dDevStrain = (NextStrain - CurStrain).dev();
+    double p = one3 * CurStress.trace() + m_Presidual;
 
-    Vector r(6);
-    if (p > small)
-        Vector r = GetDevPart(CurStress) / p;
+    Voigt6 r;
 
-    double Kp = two3 * p * h * DoubleDot2_2_Contr(b, n);
+    double Kp = two3 * p * h * b.ddotContr(n);
     
-    double temp4 = (Kp + 2.0*G*(B-C*GetTrace(SingleDot(n,SingleDot(n,n)))) 
-        - K*D*DoubleDot2_2_Contr(n,r));
+    double temp4 = (Kp + 2.0*G*(B-C*n.dot(n.dot(n)).trace()) 
+        - K*D*n.ddotContr(r));
 
     // TODO: if temp4 == 0, the whole step is plastic. Take correct steps here.
     if (fabs(temp4) < small) temp4 = small;
 
-    NextDGamma      = (2.0*G*DoubleDot2_2_Mixed(n,dDevStrain) - K*dVolStrain*DoubleDot2_2_Contr(n,r))/temp4;
-    Vector dSigma   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
-              (2.0*G*(B*n-C*(SingleDot(n,n)-one3*mI1)) + K*D*mI1);
-    Vector dAlpha   = Macauley(NextDGamma) * two3 * h * b;
-    Vector dFabric  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
-           dPStrain = NextDGamma * ToCovariant(R);
+    NextDGamma      = (2.0*G*n.ddotMixed(dDevStrain) - K*dVolStrain*n.ddotContr(r))/temp4;
+    Voigt6 dSigma   = 2.0*G* dDevStrain.toContravariant() + K*dVolStrain*I1 - Macauley(NextDGamma)*
+              (2.0*G*(B*n-C*(n.dot(n)-one3*I1)) + K*D*I1);
+    Voigt6 dAlpha   = Macauley(NextDGamma) * two3 * h * b;
+    Voigt6 dFabric  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
+           dPStrain = NextDGamma * R.toCovariant();
 
-    Matrix temp1 = 2.0*G*mIIdevMix + K*mIIvol;
-    Vector temp2 = 2.0*G*n - DoubleDot2_2_Contr(n,r)*mI1;
-    Vector temp3 = 2.0*G*(B*n-C*(SingleDot(n,n)-one3*mI1)) + K*D*mI1;
+    Voigt66 temp1 = 2.0*G*IIdevMix + K*IIvol;
+    Voigt6 temp2 = 2.0*G*n - n.ddotContr(r)*I1;
+    Voigt6 temp3 = 2.0*G*(B*n-C*(n.dot(n)-one3*I1)) + K*D*I1;
 
-    aCep = temp1 - MacauleyIndex(NextDGamma) * Dyadic2_2(temp3, temp2) / temp4;
+    aCep = temp1 - MacauleyIndex(NextDGamma) * Voigt66::dyadic(temp3, temp2) / temp4;
     aCep_Consistent = aCep;
 
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain) - dPStrain;
@@ -1246,34 +1358,56 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
         const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
+{    
+    Voigt6 nEStrain(NextElasticStrain), nStress(NextStress), nAlpha(NextAlpha), nFabric(NextFabric);
+    Voigt66 nC(aC), nCep(aCep), nCepC(aCep_Consistent);
+
+    ModifiedEuler(Voigt6(CurStress), Voigt6(CurStrain), Voigt6(CurElasticStrain), Voigt6(CurAlpha), Voigt6(CurFabric),
+        Voigt6(alpha_in), Voigt6(NextStrain), nEStrain, nStress, nAlpha, nFabric, NextDGamma, NextVoidRatio, G, K,
+        nC, nCep, nCepC);
+
+    nEStrain.copyTo(NextElasticStrain);
+    nStress.copyTo(NextStress);
+    nAlpha.copyTo(NextAlpha);
+    nFabric.copyTo(NextFabric);
+    nC.copyTo(aC);
+    nCep.copyTo(aCep);
+    nCepC.copyTo(aCep_Consistent);
+}
+
+
+void ManzariDafalias::ModifiedEuler(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+        const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+        Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+        double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) 
 {    
     double dVolStrain;
-    Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
+    Voigt6 n, d, b, R, dDevStrain, r; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0,A, B, C, D, p, Kp;
 
     double T = 0.0, dT = 1.0, dT_min = 1e-6 , TolE = 1e-4;
     
-    Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
-    Vector dSigma1(6), dSigma2(6), dAlpha1(6), dAlpha2(6), dFabric1(6), dFabric2(6),
-           dPStrain1(6), dPStrain2(6);
-    Matrix aCep1(6,6), aCep2(6,6), aCep_thisStep(6,6), aD(6,6);
+    Voigt6 nStress, nAlpha, nFabric, ndPStrain;
+    Voigt6 dSigma1, dSigma2, dAlpha1, dAlpha2, dFabric1, dFabric2,
+           dPStrain1, dPStrain2;
+    Voigt66 aCep1, aCep2, aCep_thisStep, aD;
     double temp4, curStepError, q = 1.0;
 
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
 
-    aC = GetStiffness(K, G);
-    aD = GetCompliance(K, G);
+    GetStiffness(K, G, aC);
+    GetCompliance(K, G, aD);
 
     NextStress = CurStress;
     NextAlpha = CurAlpha;
     NextFabric = CurFabric;
 
-    p = one3 * GetTrace(NextStress) + m_Presidual;
+    p = one3 * NextStress.trace() + m_Presidual;
     if (p < m_Pmin + m_Presidual)
     {
         if (debugFlag)
             opserr << "Tag = " << this->getTag() << " : I have a problem (p < 0) - This should not happen!!!" << endln;        
-        NextStress = GetDevPart(NextStress) + m_Pmin * mI1;
+        NextStress = NextStress.dev() + m_Pmin * I1;
 		p = m_Pmin;
     }
     // Set aCep_Consistent to zero for substepping process
@@ -1281,21 +1415,21 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
 
     while (T < 1.0)
     {
-        NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
+        NextVoidRatio     = m_e_init - (1 + m_e_init) * (NextStrain + T * (NextStrain - CurStrain)).trace();
         
-        dVolStrain = dT * GetTrace(NextStrain - CurStrain);
-        dDevStrain = dT * GetDevPart(NextStrain - CurStrain);
+        dVolStrain = dT * (NextStrain - CurStrain).trace();
+        dDevStrain = dT * (NextStrain - CurStrain).dev();
 
         // Calc Delta 1
-        p = one3 * GetTrace(NextStress) + m_Presidual;
+        p = one3 * NextStress.trace() + m_Presidual;
         GetStateDependent(NextStress, NextAlpha, NextFabric, NextVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
                 b0, A, D, B, C, R);
 
-        r = GetDevPart(NextStress) / p;
-        Kp = two3 * p * h * DoubleDot2_2_Contr(b, n);
+        r = NextStress.dev() / p;
+        Kp = two3 * p * h * b.ddotContr(n);
 
-        temp4 = (Kp + 2.0*G*(B-C*GetTrace(SingleDot(n,SingleDot(n,n)))) 
-            - K*D*DoubleDot2_2_Contr(n,r));
+        temp4 = (Kp + 2.0*G*(B-C*n.dot(n.dot(n)).trace()) 
+            - K*D*n.ddotContr(r));
 
         if (fabs(temp4) < small) 
         {
@@ -1303,33 +1437,33 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
             dSigma1.Zero();
             dAlpha1.Zero();
             dFabric1.Zero();
-            dPStrain1 = dDevStrain + dVolStrain*mI1;
+            dPStrain1 = dDevStrain + dVolStrain*I1;
             
         } else {
-            NextDGamma      = (2.0*G*DoubleDot2_2_Mixed(n,dDevStrain) - K*dVolStrain*DoubleDot2_2_Contr(n,r))/temp4;
+            NextDGamma      = (2.0*G*n.ddotMixed(dDevStrain) - K*dVolStrain*n.ddotContr(r))/temp4;
              
             if (NextDGamma < -small)
             {
                if (debugFlag)
                     opserr << "dGamma cannot be negative! This should not happen. Setting dGamma = 0." << endln;
                 NextDGamma = 0.0;
-                dSigma1   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1;
-                dAlpha1   = 3.0*(GetDevPart(NextStress + dSigma1) / GetTrace(NextStress + dSigma1) - GetDevPart(NextStress) / GetTrace(NextStress)) ;
+                dSigma1   = 2.0*G* dDevStrain.toContravariant() + K*dVolStrain*I1;
+                dAlpha1   = 3.0*((NextStress + dSigma1).dev() / (NextStress + dSigma1).trace() - NextStress.dev() / NextStress.trace()) ;
                 dFabric1.Zero();
                 dPStrain1.Zero();
                 mUseElasticTan = true;
             } else {
-                dSigma1   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
-                  (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
+                dSigma1   = 2.0*G* dDevStrain.toContravariant() + K*dVolStrain*I1 - Macauley(NextDGamma)*
+                  (2.0*G*(B*n-C*(n.dot(n)-1.0/3.0*I1)) + K*D*I1);
                 dAlpha1   = Macauley(NextDGamma) * two3 * h * b;
                 dFabric1  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
-                dPStrain1 = NextDGamma * ToCovariant(R);
+                dPStrain1 = NextDGamma * R.toCovariant();
             }
             aCep1 = GetElastoPlasticTangent(NextStress + dSigma1, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
         }
 
         // Calc Delta 2
-        p = one3 * GetTrace(NextStress + dSigma1) + m_Presidual;
+        p = one3 * (NextStress + dSigma1).trace() + m_Presidual;
 
         if (p < m_Presidual)
         {
@@ -1342,11 +1476,11 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
         GetStateDependent(NextStress + dSigma1, NextAlpha + dAlpha1, NextFabric + dFabric1, NextVoidRatio, alpha_in, n, d, b, 
                 Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, D, B, C, R);
 
-        r = GetDevPart(NextStress + dSigma1) / p;
-        Kp = two3 * p * h * DoubleDot2_2_Contr(b, n);
+        r = (NextStress + dSigma1).dev() / p;
+        Kp = two3 * p * h * b.ddotContr(n);
         
-        temp4 = (Kp + 2.0*G*(B-C*GetTrace(SingleDot(n,SingleDot(n,n)))) 
-            - K*D*DoubleDot2_2_Contr(n,r));
+        temp4 = (Kp + 2.0*G*(B-C*n.dot(n.dot(n)).trace()) 
+            - K*D*n.ddotContr(r));
 
         if (fabs(temp4) < small) 
         {
@@ -1354,26 +1488,26 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
             dSigma2.Zero();
             dAlpha2.Zero();
             dFabric2.Zero();
-            dPStrain2 = dDevStrain + dVolStrain*mI1;
+            dPStrain2 = dDevStrain + dVolStrain*I1;
         
         } else {
 
-            NextDGamma      = (2.0*G*DoubleDot2_2_Mixed(n,dDevStrain) - K*dVolStrain*DoubleDot2_2_Contr(n,r))/temp4;
+            NextDGamma      = (2.0*G*n.ddotMixed(dDevStrain) - K*dVolStrain*n.ddotContr(r))/temp4;
 
             if (NextDGamma < 0.0)
             {
                 NextDGamma = 0.0;
-                dSigma2   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1;
-                dAlpha2   = 3.0*(GetDevPart(NextStress + dSigma2) / GetTrace(NextStress + dSigma2) - GetDevPart(NextStress) / GetTrace(NextStress)) ;
+                dSigma2   = 2.0*G* dDevStrain.toContravariant() + K*dVolStrain*I1;
+                dAlpha2   = 3.0*((NextStress + dSigma2).dev() / (NextStress + dSigma2).trace() - NextStress.dev() / NextStress.trace()) ;
                 dFabric2.Zero();
                 dPStrain2.Zero();
                 mUseElasticTan = true;
             } else {
-                dSigma2   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
-                  (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
+                dSigma2   = 2.0*G* dDevStrain.toContravariant() + K*dVolStrain*I1 - Macauley(NextDGamma)*
+                  (2.0*G*(B*n-C*(n.dot(n)-1.0/3.0*I1)) + K*D*I1);
                 dAlpha2   = Macauley(NextDGamma) * two3 * h * b;
                 dFabric2  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric + dFabric1);
-                dPStrain2 = NextDGamma * ToCovariant(R);
+                dPStrain2 = NextDGamma * R.toCovariant();
             }
         }
         
@@ -1384,7 +1518,7 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
         nFabric = NextFabric + 0.5 * (dFabric1 + dFabric2);
         
 
-        p = one3 * GetTrace(nStress) + m_Presidual;
+        p = one3 * nStress.trace() + m_Presidual;
         
         if (p < m_Presidual)
         {
@@ -1394,11 +1528,11 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
             continue;
         }
 
-            double stressNorm = GetNorm_Contr(NextStress);
+            double stressNorm = NextStress.normContr();
             if (stressNorm < 0.5)
-                curStepError = GetNorm_Contr(dSigma2 - dSigma1);
+                curStepError = (dSigma2 - dSigma1).normContr();
             else 
-                curStepError = GetNorm_Contr(dSigma2 - dSigma1) / (2 * stressNorm);
+                curStepError = (dSigma2 - dSigma1).normContr() / (2 * stressNorm);
         
         
         if (curStepError > TolE)
@@ -1414,10 +1548,10 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
 
                 NextElasticStrain -= 0.5* (dPStrain1 + dPStrain2);
                 NextStress = nStress;
-                double eta = sqrt(13.5) * GetNorm_Contr(GetDevPart(NextStress)) / GetTrace(NextStress);
+                double eta = sqrt(13.5) * NextStress.dev().normContr() / NextStress.trace();
                 if (eta > m_Mc)
-                    NextStress = one3 * GetTrace(NextStress) * mI1 + m_Mc / eta * GetDevPart(NextStress);
-                NextAlpha  = CurAlpha + 3.0 * (GetDevPart(NextStress)/GetTrace(NextStress) - GetDevPart(CurStress)/GetTrace(CurStress));
+                    NextStress = one3 * NextStress.trace() * I1 + m_Mc / eta * NextStress.dev();
+                NextAlpha  = CurAlpha + 3.0 * (NextStress.dev()/NextStress.trace() - CurStress.dev()/CurStress.trace());
                 
                 T += dT;
             }
@@ -1438,7 +1572,7 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
             T += dT;
 
             aCep_thisStep = 0.5 * (aCep1 + aCep2);
-            aCep_Consistent = aCep_thisStep * (aD * aCep_Consistent + T * mIImix);
+            aCep_Consistent = aCep_thisStep * (aD * aCep_Consistent + T * IImix);
         
             q = fmax(0.8 * sqrt(TolE / curStepError), 0.5);
             dT = fmax(q * dT, dT_min);
@@ -2068,7 +2202,7 @@ int ManzariDafalias::BackwardEuler_CPPM(const Vector& CurStress, const Vector& C
                 Vector StrainInc(6), cStress(6), cStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), cEStrain(6);
                 Vector nStrain(6) ,nEStrain(6), nStress(6), nAlpha(6), nFabric(6);
                 Matrix nCe(6,6), nCep(6,6), nCepC(6,6);
-                double nDGamma, nVoidRatio, nG, nK;
+                double nDGamma, nVoidRatio, nG = G, nK = K;
                 int numSteps;
 
                 // original strain increment
@@ -2202,29 +2336,32 @@ int ManzariDafalias::BackwardEuler_CPPM(const Vector& CurStress, const Vector& C
 
 
 double
-ManzariDafalias::IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha, 
+ManzariDafalias::IntersectionFactor(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& NextStrain, const Voigt6& CurAlpha, 
     double a0, double a1)
 {
     double a = a0;
     double G, K, vR, f, f0, f1;
-    Vector dSigma(6), dSigma0(6), dSigma1(6), strainInc(6);
+    Voigt6 dSigma, dSigma0, dSigma1, strainInc;
+    Voigt66 aC;
 
     strainInc = NextStrain - CurStrain;
 
-    vR      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + a0 * strainInc);
+    vR      = m_e_init - (1 + m_e_init) * (CurStrain + a0 * strainInc).trace();
     GetElasticModuli(CurStress, vR, K, G);
-    dSigma0 = a0 * DoubleDot4_2(GetStiffness(K, G), strainInc);
+    GetStiffness(K, G, aC);
+    dSigma0 = a0 * (aC * strainInc);
     f0 = GetF(CurStress + dSigma0, CurAlpha);
 
-    vR      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + a1 * strainInc);
+    vR      = m_e_init - (1 + m_e_init) * (CurStrain + a1 * strainInc).trace();
     GetElasticModuli(CurStress, vR, K, G);
-    dSigma1 = a1 * DoubleDot4_2(GetStiffness(K, G), strainInc);
+    GetStiffness(K, G, aC);
+    dSigma1 = a1 * (aC * strainInc);
     f1 = GetF(CurStress + dSigma1, CurAlpha);
 
     for (int i = 1; i <= 10; i++)
     {
         a    = a1 - f1 * (a1-a0)/(f1-f0);
-        dSigma = a * DoubleDot4_2(GetStiffness(K, G), strainInc);
+        dSigma = a * (aC * strainInc);
         f    = GetF(CurStress + dSigma, CurAlpha);
         if (fabs(f) < mTolF) 
         {
@@ -2255,19 +2392,21 @@ ManzariDafalias::IntersectionFactor(const Vector& CurStress, const Vector& CurSt
 
 
 double
-ManzariDafalias::IntersectionFactor_Unloading(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha)
+ManzariDafalias::IntersectionFactor_Unloading(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& NextStrain, const Voigt6& CurAlpha)
 {
     double a = 0.0, a0 = 0.0 , a1 = 1.0, da;
     double G, K, vR, f;
     int nSub = 20;
-    Vector dSigma(6), dSigma0(6), dSigma1(6), strainInc(6);
+    Voigt6 dSigma, dSigma0, dSigma1, strainInc;
+    Voigt66 aC;
 
     strainInc = NextStrain - CurStrain;
     
     
-    vR    = m_e_init - (1 + m_e_init) * GetTrace(CurStrain ); 
+    vR    = m_e_init - (1 + m_e_init) * CurStrain.trace(); 
     GetElasticModuli(CurStress, vR, K, G);
-    dSigma = DoubleDot4_2(GetStiffness(K, G), strainInc);
+    GetStiffness(K, G, aC);
+    dSigma = aC * strainInc;
 
     for (int i = 1; i < nSub; i++)
     {
@@ -2299,21 +2438,21 @@ ManzariDafalias::IntersectionFactor_Unloading(const Vector& CurStress, const Vec
 
 
 void    
-ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-        const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
-        Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-        double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+ManzariDafalias::Stress_Correction(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+        const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+        Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+        double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent)
 {
     if (!mStressCorrectionInUse) return;
 
-    Vector n(6), d(6), b(6), dPStrain(6), R(6), devStress(6), dSigma(6), dAlpha(6), dSigmaP(6), aBar(6), zBar(6);
-    Vector r(6), dfrOverdSigma(6), dfrOverdAlpha(6);
+    Voigt6 n, d, b, dPStrain, R, devStress, dSigma, dAlpha, dSigmaP, aBar, zBar;
+    Voigt6 r, dfrOverdSigma, dfrOverdAlpha;
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0;
     double A, B, C, D, p, fr, lambda, NextDLambda;
     int maxIter = 50;
 
     // see if p < 0
-    p = one3 * GetTrace(NextStress) + m_Presidual;
+    p = one3 * NextStress.trace() + m_Presidual;
     if (p < m_Pmin + m_Presidual)
     {
         p = m_Pmin + m_Presidual;
@@ -2323,29 +2462,30 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
         if (fr < mTolF)
         {
             NextDLambda = (m_Pmin - p) / K;
-            NextElasticStrain += one3 * NextDLambda * mI1;
-            NextStress += K * NextDLambda * mI1;
+            NextElasticStrain += one3 * NextDLambda * I1;
+            NextStress += K * NextDLambda * I1;
             NextDGamma = 0.0;
-            aCep_Consistent = aCep = aC = GetStiffness(K, G);
+            GetStiffness(K, G, aC);
+            aCep_Consistent = aCep = aC;
 
         } else {
 
             // Do Newton iterations to find NextDGamma
             GetStateDependent(NextStress, NextAlpha, NextFabric, NextVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
                     b0, A, D, B, C, R);
-            R = GetDevPart(R);
+            R = R.dev();
             NextDGamma  = 0.0;
             NextDLambda = 0.0;
 
-            Vector N(6); N = GetDevPart(NextStress) - p*NextAlpha;
-            double fr1  = GetNorm_Contr(N)-root23*m_m*p;
+            Voigt6 N = NextStress.dev() - p*NextAlpha;
+            double fr1  = N.normContr()-root23*m_m*p;
             double fr2  = m_Pmin - p;
             double J11, J12, J21, J22;
 
             for (int i = 1; i <= maxIter; i++)
             {
-                J11 = DoubleDot2_2_Contr(N/GetNorm_Contr(N),-2.0*G*R+K*D*NextAlpha)+root23*m_m*K*D;
-                J12 = DoubleDot2_2_Contr(N/GetNorm_Contr(N),-K*NextAlpha)-root23*m_m*K;
+                J11 = (N/N.normContr()).ddotContr(-2.0*G*R+K*D*NextAlpha)+root23*m_m*K*D;
+                J12 = (N/N.normContr()).ddotContr(-K*NextAlpha)-root23*m_m*K;
                 J21 = K*D;
                 J22 = -K;
                 
@@ -2354,9 +2494,9 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
                 NextDGamma  -= det * (J22*fr1-J12*fr2);
                 NextDLambda -= det * (J11*fr2-J21*fr1);
 
-                N = GetDevPart(NextStress) - p*NextAlpha - 2.0*G*NextDGamma*R + K*(D*NextDGamma-NextDLambda)*NextAlpha;
+                N = NextStress.dev() - p*NextAlpha - 2.0*G*NextDGamma*R + K*(D*NextDGamma-NextDLambda)*NextAlpha;
 
-                fr1  = GetNorm_Contr(N)-root23*m_m*(p-K*(D*NextDGamma-NextDLambda));
+                fr1  = N.normContr()-root23*m_m*(p-K*(D*NextDGamma-NextDLambda));
                 fr2  = m_Pmin - p + K*(D*NextDGamma-NextDLambda);
 
 
@@ -2367,23 +2507,23 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
                 {
                     if (debugFlag) 
                         opserr << "Still outside with f =  " << fr << endln;
-                    NextStress = m_Pmin * mI1;
+                    NextStress = m_Pmin * I1;
                     NextAlpha.Zero();
                     return;
                 }
                 
             }
 
-            p = one3 * GetTrace(NextStress) + m_Presidual;
+            p = one3 * NextStress.trace() + m_Presidual;
 
-            Vector dPStrain(6);
-            dPStrain = ToCovariant(NextDGamma * R + one3*(NextDGamma*D - NextDLambda) * mI1);
+            Voigt6 dPStrain;
+            dPStrain = (NextDGamma * R + one3*(NextDGamma*D - NextDLambda) * I1).toCovariant();
             NextElasticStrain -= dPStrain;
             NextStress -= aC * dPStrain;
         }
 
     }
-        NextStress = p * mI1;
+        NextStress = p * I1;
         NextAlpha.Zero();
         return;
     } else {
@@ -2397,36 +2537,36 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
                 opserr << "ManzariDafalias::StressCorrection() Stress state inside yield surface." << endln;
             return;
         } else {
-            Vector nStress = NextStress;
-            Vector nAlpha  = NextAlpha;
+            Voigt6 nStress = NextStress;
+            Voigt6 nAlpha  = NextAlpha;
             for (int i = 1; i <= maxIter; i++)
             {
                 if (debugFlag) 
                     opserr << "ManzariDafalias::StressCorrection() Stress state outside yield surface. Correction step =  " << i << ", f = " << fr << endln;
                 
-                devStress = GetDevPart(nStress);
+                devStress = nStress.dev();
             
                 // do I need to update G and K? check this!
                 // GetElasticModuli(CurStress, CurVoidRatio, K, G);
 
-                aC = GetStiffness(K, G);
+                GetStiffness(K, G, aC);
 
                 GetStateDependent(nStress, nAlpha, NextFabric, NextVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
                     b0, A, D, B, C, R);
 
-                dSigmaP = DoubleDot4_2(aC, ToCovariant(R));
+                dSigmaP = aC * R.toCovariant();
                 aBar = two3 * h * b;
                 r = devStress / p ;
-                dfrOverdSigma = n - one3 * DoubleDot2_2_Contr(n, r) * mI1;
+                dfrOverdSigma = n - one3 * n.ddotContr(r) * I1;
                 dfrOverdAlpha = - p * n;
-                lambda = fr / (DoubleDot2_2_Contr(dfrOverdSigma, dSigmaP)-DoubleDot2_2_Contr(dfrOverdAlpha, aBar));
+                lambda = fr / (dfrOverdSigma.ddotContr(dSigmaP)-dfrOverdAlpha.ddotContr(aBar));
 
                 if (fabs(GetF(nStress - lambda * dSigmaP, nAlpha + lambda * aBar)) < fabs(fr))
                 {
                     nStress -= lambda * dSigmaP;
                     nAlpha  += lambda * aBar;
                 } else {
-                    lambda = fr / DoubleDot2_2_Contr(dfrOverdSigma, dfrOverdSigma);
+                    lambda = fr / dfrOverdSigma.ddotContr(dfrOverdSigma);
                     if (fabs(GetF(nStress - lambda * dfrOverdSigma, nAlpha)) < fabs(fr))
                         nStress -= lambda * dfrOverdSigma;
                     else
@@ -2451,7 +2591,7 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
                         opserr << "Still outside with f =  " << fr << endln;
                     if (GetF(CurStress, NextAlpha) < mTolF)
                     {
-                        Vector dSigma = NextStress - CurStress;
+                        Voigt6 dSigma = NextStress - CurStress;
                         double alpha_up = 1.0;
                         double alpha_mid = 0.5;
                         double alpha_down = 0.0;
@@ -2485,9 +2625,11 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
                     }
                 }
                 
-                p = one3 * GetTrace(NextStress) + m_Presidual;
+                p = one3 * NextStress.trace() + m_Presidual;
             }
-            NextElasticStrain = CurElasticStrain + DoubleDot4_2(GetCompliance(K, G), NextStress - CurStress);
+            Voigt66 aD;
+            GetCompliance(K, G, aD);
+            NextElasticStrain = CurElasticStrain + aD * (NextStress - CurStress);
             aCep = GetElastoPlasticTangent(NextStress, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
             aCep_Consistent = aCep;
         }
@@ -4383,12 +4525,19 @@ ManzariDafalias::g(const double cos3theta, const double c)
 
 double 
 ManzariDafalias::GetF(const Vector& nStress, const Vector& nAlpha)
+{
+    return GetF(Voigt6(nStress), Voigt6(nAlpha));
+}
+
+
+double 
+ManzariDafalias::GetF(const Voigt6& nStress, const Voigt6& nAlpha)
 {
     // Manzari's yield function
-    Vector s(6); s = GetDevPart(nStress);
-    double p = one3 * GetTrace(nStress) + m_Presidual;
+    Voigt6 s = nStress.dev();
+    double p = one3 * nStress.trace() + m_Presidual;
     s = s - p * nAlpha;
-    return GetNorm_Contr(s) - root23 * m_m * p;
+    return s.normContr() - root23 * m_m * p;
 }
 
 
@@ -4400,10 +4549,10 @@ ManzariDafalias::GetPSI(const double& e, const double& p)
 
 
 double 
-ManzariDafalias::GetLodeAngle(const Vector& n)
+ManzariDafalias::GetLodeAngle(const Voigt6& n)
 // Returns cos(3*theta)
 {
-    double Cos3Theta = sqrt(6.0) * GetTrace(SingleDot(n,SingleDot(n,n)));
+    double Cos3Theta = sqrt(6.0) * n.dot(n.dot(n)).trace();
     Cos3Theta = Cos3Theta > 1 ? 1 : Cos3Theta;
     Cos3Theta = Cos3Theta < -1 ? -1 : Cos3Theta;
     return Cos3Theta;
@@ -4460,7 +4609,15 @@ void
 ManzariDafalias::GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G)
 // Calculates G, K
 {
-    double pn = one3 * GetTrace(sigma);
+    GetElasticModuli(Voigt6(sigma), en, K, G);
+}
+
+
+void
+ManzariDafalias::GetElasticModuli(const Voigt6& sigma, const double& en, double &K, double &G)
+// Calculates G, K
+{
+    double pn = one3 * sigma.trace();
     pn = (pn <= m_Pmin) ? m_Pmin : pn;
 
     if (mElastFlag == 0) 
@@ -4476,13 +4633,23 @@ ManzariDafalias::GetStiffness(const double& K, const double& G)
 // returns the stiffness matrix in its contravarinat-contravariant form
 {
     Matrix C(6,6);
+    Voigt66 aC;
+    GetStiffness(K, G, aC);
+    aC.copyTo(C);
+    return C;
+}
+
+
+void
+ManzariDafalias::GetStiffness(const double& K, const double& G, Voigt66& C)
+{
     double a = K + 4.0*one3 * G;
     double b = K - 2.0*one3 * G;
+    C.Zero();
     C(0,0) = C(1,1) = C(2,2) = a;
     C(3,3) = C(4,4) = C(5,5) = G;
     C(0,1) = C(0,2) = C(1,2) = b;
     C(1,0) = C(2,0) = C(2,1) = b;
-    return C;
 }
 
 
@@ -4491,14 +4658,24 @@ ManzariDafalias::GetCompliance(const double& K, const double& G)
 // returns the compliance matrix in its covariant-covariant form
 {
     Matrix D(6,6);
+    Voigt66 aD;
+    GetCompliance(K, G, aD);
+    aD.copyTo(D);
+    return D;
+}
+
+
+void
+ManzariDafalias::GetCompliance(const double& K, const double& G, Voigt66& D)
+{
     double a = 1 / (9*K) + 1 / (3*G);
     double b = 1 / (9*K) - 1 / (6*G);
     double c = 1 / G;
+    D.Zero();
     D(0,0) = D(1,1) = D(2,2) = a;
     D(3,3) = D(4,4) = D(5,5) = c;
     D(0,1) = D(0,2) = D(1,2) = b;
     D(1,0) = D(2,0) = D(2,1) = b;
-    return D;
 }
 
 
@@ -4509,23 +4686,37 @@ ManzariDafalias::GetElastoPlasticTangent(const Vector& NextStress, const double&
                     const double& C,const double& D, const double& h, 
                     const Vector& n, const Vector& d, const Vector& b) 
 {    
-    double p = one3 * GetTrace(NextStress) + m_Presidual;
+    Matrix aCep(6,6);
+    GetElastoPlasticTangent(Voigt6(NextStress), NextDGamma, Voigt6(CurStrain), Voigt6(NextStrain), G, K, B, C, D, h,
+        Voigt6(n), Voigt6(d), Voigt6(b)).copyTo(aCep);
+    return aCep;
+}
+
+
+Voigt66
+ManzariDafalias::GetElastoPlasticTangent(const Voigt6& NextStress, const double& NextDGamma, 
+                    const Voigt6& CurStrain, const Voigt6& NextStrain,
+                    const double& G, const double& K, const double& B, 
+                    const double& C,const double& D, const double& h, 
+                    const Voigt6& n, const Voigt6& d, const Voigt6& b) 
+{    
+    double p = one3 * NextStress.trace() + m_Presidual;
     p = (p < small + m_Presidual) ? small + m_Presidual : p;
-    Vector r = GetDevPart(NextStress) / p;
-    double Kp = two3 * p * h * DoubleDot2_2_Contr(b, n);
+    Voigt6 r = NextStress.dev() / p;
+    double Kp = two3 * p * h * b.ddotContr(n);
     
-    Matrix aC(6,6), aCep(6,6);
-    Vector temp1(6), temp2(6), R(6);
+    Voigt66 aC, aCep;
+    Voigt6 temp1, temp2, R;
     double temp3;
 
-    aC  = GetStiffness(K, G);
-    R = ToCovariant((B * n ) - (C * (SingleDot(n,n)-one3*mI1)) + (one3 * D * mI1));
-    temp1 = DoubleDot4_2(aC, ToCovariant(R));
-    temp2 = DoubleDot2_4(ToCovariant(n - one3 * DoubleDot2_2_Contr(n,r) * mI1), aC);
-    temp3 = DoubleDot2_2_Contr(temp2, R) + Kp;
+    GetStiffness(K, G, aC);
+    R = ((B * n ) - (C * (n.dot(n)-one3*I1)) + (one3 * D * I1)).toCovariant();
+    temp1 = aC * R.toCovariant();
+    temp2 = aC ^ (n - one3 * n.ddotContr(r) * I1).toCovariant();
+    temp3 = temp2.ddotContr(R) + Kp;
     if (fabs(temp3) < small) return aC;
     
-    aCep = (aC - (MacauleyIndex(NextDGamma) / temp3 * (Dyadic2_2(temp1, temp2))));
+    aCep = (aC - (MacauleyIndex(NextDGamma) / temp3 * (Voigt66::dyadic(temp1, temp2))));
     return aCep;
 }
 
@@ -4533,17 +4724,26 @@ ManzariDafalias::GetElastoPlasticTangent(const Vector& NextStress, const double&
 Vector
 ManzariDafalias::GetNormalToYield(const Vector &stress, const Vector &alpha)
 {
-    Vector devStress(6); devStress = GetDevPart(stress);
+    Vector n(6);
+    GetNormalToYield(Voigt6(stress), Voigt6(alpha)).copyTo(n);
+    return n;
+}
+
+
+Voigt6
+ManzariDafalias::GetNormalToYield(const Voigt6 &stress, const Voigt6 &alpha)
+{
+    Voigt6 devStress = stress.dev();
 
-    double p = one3 * GetTrace(stress) + m_Presidual;
+    double p = one3 * stress.trace() + m_Presidual;
 
-    Vector n(6); 
+    Voigt6 n; 
     if (fabs(p) < small)
     {
         n.Zero();
     } else {
         n = devStress - p * alpha;
-        double normN = GetNorm_Contr(n);
+        double normN = n.normContr();
         normN = (normN < small) ? 1.0 : normN;
         n = n / normN;
     }
@@ -4588,15 +4788,32 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
                 , double &cos3Theta, double &h, double &psi, double &alphaBtheta
                 , double &alphaDtheta, double &b0, double& A, double& D, double& B
                 , double& C, Vector& R)
+{
+    Voigt6 vn, vd, vb, vR;
+    GetStateDependent(Voigt6(stress), Voigt6(alpha), Voigt6(fabric), e, Voigt6(alpha_in), vn, vd, vb, cos3Theta, h, psi,
+        alphaBtheta, alphaDtheta, b0, A, D, B, C, vR);
+    vn.copyTo(n);
+    vd.copyTo(d);
+    vb.copyTo(b);
+    vR.copyTo(R);
+}
+
+
+void 
+ManzariDafalias::GetStateDependent(const Voigt6 &stress, const Voigt6 &alpha, const Voigt6 &fabric
+                , const double &e, const Voigt6 &alpha_in, Voigt6 &n, Voigt6 &d, Voigt6 &b
+                , double &cos3Theta, double &h, double &psi, double &alphaBtheta
+                , double &alphaDtheta, double &b0, double& A, double& D, double& B
+                , double& C, Voigt6& R)
 {
     double D_factor = 1.0;
-    double p = one3 * GetTrace(stress) + m_Presidual;
+    double p = one3 * stress.trace() + m_Presidual;
     p = (p < small) ? small : p;
 
     n = GetNormalToYield(stress, alpha);
 
     double AlphaAlphaInDotN;
-    AlphaAlphaInDotN = DoubleDot2_2_Contr(alpha - alpha_in,n);
+    AlphaAlphaInDotN = (alpha - alpha_in).ddotContr(n);
 
     psi = GetPSI(e, p);
 
@@ -4617,9 +4834,9 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 	else
 		h = b0 / AlphaAlphaInDotN;
 
-    A = m_A0 * (1 + Macauley(DoubleDot2_2_Contr(fabric, n)));
+    A = m_A0 * (1 + Macauley(fabric.ddotContr(n)));
 
-    D = A * DoubleDot2_2_Contr(d, n);
+    D = A * d.ddotContr(n);
 
     // Apply a factor to D so it doesn't go very big when p is small
     if (p < 0.05 * m_P_atm)
@@ -4635,9 +4852,10 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 
     C = 3.0 * sqrt(1.5) * (1 - m_c)/ m_c * g(cos3Theta, m_c);
 
-    R = B * n - C * (SingleDot(n,n) - one3 * mI1) + one3 * D * mI1;
+    R = B * n - C * (n.dot(n) - one3 * I1) + one3 * D * I1;
 }
 
+
 int
 ManzariDafalias::Elastic2Plastic()
 {
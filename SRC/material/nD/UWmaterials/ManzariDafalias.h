@@ -35,6 +35,7 @@
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <VoigtTensor.h>
 
 #include <Information.h>
 //#include <MaterialResponse.h>
@@ -231,6 +232,16 @@ class ManzariDafalias : public NDMaterial
 					const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
 					Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
 					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) ;
+	// the explicit schemes work on fixed size tensors; those still on Vector
+	// and Matrix are called through explicit_vector_scheme
+	void	explicit_integrator(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+					const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+					Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) ;
+	void	explicit_vector_scheme(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+					const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+					Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) ;
 	void	MaxEnergyInc(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
 					const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
 					Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
@@ -243,10 +254,18 @@ class ManzariDafalias : public NDMaterial
 					const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
 					Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric, 
 					double& NextDGamma, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) ;
+	void	ForwardEuler(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+					const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+					Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) ;
 	void	ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
 					const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
 					Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
 					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) ;
+	void	ModifiedEuler(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+					const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+					Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent) ;
 	void	RungeKutta4(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
 					const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
 					Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
@@ -261,13 +280,13 @@ class ManzariDafalias : public NDMaterial
 					double& NextDGamma,	double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent, 
 					int implicitLevel = 1) ;
 
-	double	IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha, 
+	double	IntersectionFactor(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& NextStrain, const Voigt6& CurAlpha, 
 				double a0, double a1);
-	double	IntersectionFactor_Unloading(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha);
-	void	Stress_Correction(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-					const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& NextStrain,
-					Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
+	double	IntersectionFactor_Unloading(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& NextStrain, const Voigt6& CurAlpha);
+	void	Stress_Correction(const Voigt6& CurStress, const Voigt6& CurStrain, const Voigt6& CurElasticStrain,
+					const Voigt6& CurAlpha, const Voigt6& CurFabric, const Voigt6& alpha_in, const Voigt6& NextStrain,
+					Voigt6& NextElasticStrain, Voigt6& NextStress, Voigt6& NextAlpha, Voigt6& NextFabric,
+					double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Voigt66& aC, Voigt66& aCep, Voigt66& aCep_Consistent);
 	
 	int		NewtonIter(const Vector& xo, const Vector& inVar, Vector& x, Matrix& aCepPart);
 	int		NewtonIter2(const Vector& xo, const Vector& inVar, Vector& sol, Matrix& aCepPart);
@@ -292,24 +311,37 @@ class ManzariDafalias : public NDMaterial
 	double	MacauleyIndex(double x);
 	double	g(const double cos3theta, const double c);
 	double	GetF(const Vector& nStress, const Vector& nAlpha);
+	double	GetF(const Voigt6& nStress, const Voigt6& nAlpha);
 	double	GetPSI(const double& e, const double& p);
-	double	GetLodeAngle(const Vector& n);
+	double	GetLodeAngle(const Voigt6& n);
 	void	GetElasticModuli(const Vector& sigma, const double& en, const double& en1,
 				const Vector& nEStrain, const Vector& cEStrain, double &K, 
 				double &G);
 	void	GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G);
+	void	GetElasticModuli(const Voigt6& sigma, const double& en, double &K, double &G);
 	void	GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G, const double& D);
 	Matrix	GetStiffness(const double& K, const double& G);
+	void	GetStiffness(const double& K, const double& G, Voigt66& C);
 	Matrix	GetCompliance(const double& K, const double& G);
+	void	GetCompliance(const double& K, const double& G, Voigt66& D);
 	void	GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &fabric
 				, const double &e, const Vector &alpha_in, Vector &n, Vector &d, Vector &b
 				, double &cos3Theta, double &h, double &psi, double &alphaBtheta
 				, double &alphaDtheta, double &b0, double& A, double& D, double& B
 				, double& C, Vector& R);
+	void	GetStateDependent(const Voigt6 &stress, const Voigt6 &alpha, const Voigt6 &fabric
+				, const double &e, const Voigt6 &alpha_in, Voigt6 &n, Voigt6 &d, Voigt6 &b
+				, double &cos3Theta, double &h, double &psi, double &alphaBtheta
+				, double &alphaDtheta, double &b0, double& A, double& D, double& B
+				, double& C, Voigt6& R);
 	Matrix	GetElastoPlasticTangent(const Vector& NextStress, const double& NextDGamma, const Vector& CurStrain, const Vector& NextStrain,
 				const double& G, const double& K, const double& B, const double& C,const double& D, const double& h, 
 				const Vector& n, const Vector& d, const Vector& b) ;
+	Voigt66	GetElastoPlasticTangent(const Voigt6& NextStress, const double& NextDGamma, const Voigt6& CurStrain, const Voigt6& NextStrain,
+				const double& G, const double& K, const double& B, const double& C,const double& D, const double& h, 
+				const Voigt6& n, const Voigt6& d, const Voigt6& b) ;
 	Vector	GetNormalToYield(const Vector &stress, const Vector &alpha);
+	Voigt6	GetNormalToYield(const Voigt6 &stress, const Voigt6 &alpha);
 	int	Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha);
         int     Elastic2Plastic();
 
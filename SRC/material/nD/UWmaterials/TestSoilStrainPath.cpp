@@ -0,0 +1,337 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file is a driver to time and check the critical state
+// sand models on a strain path. The path is read from a file, one step per
+// line with the strain components in the order of the material (6 for the
+// 3D models, 3 for plane strain), and a line "stage n" setting the
+// material stage (0 elastic, 1 elastoplastic) from there on; without a
+// file a one-dimensional consolidation followed by undrained cyclic simple
+// shear of growing amplitude is used, y being the vertical. The material is taken through the
+// path once, recording the stress and tangent of every step, and then as
+// many more times as asked for on fresh copies to time it, the speed
+// being reported in material point evaluations (setTrialStrain,
+// getStress, getTangent and commitState) per second.
+//
+// With -record the stresses and tangents are written to a file, with
+// -check they are compared against such a file, so the results of a
+// change to a model can be checked against those of the code before it:
+// run the old build with -record and the new one with -check. The
+// comparison is bit for bit unless a relative tolerance is given.
+//
+// usage: testSoilStrainPath material <-scheme n> <-cycles n> <-repeat n>
+//          <-path file> <-record file> <-check file> <-tol tol>
+//   material: ManzariDafalias, PM4Sand or PM4Silt
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Information.h>
+
+#include <ManzariDafalias3D.h>
+#include <PM4Sand.h>
+#include <PM4Silt.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+// a step of the path: a new material stage or the strains
+struct PathStep {
+  int stage;
+  double strain[6];
+};
+
+static int
+readPath(const char *fileName, int order, PathStep *&path)
+{
+  FILE *file = fopen(fileName, "r");
+  if (file == 0) {
+    fprintf(stderr, "testSoilStrainPath - could not open %s\n", fileName);
+    return -1;
+  }
+
+  int sizePath = 1024;
+  int numSteps = 0;
+  path = new PathStep[sizePath];
+
+  char word[64];
+  while (fscanf(file, "%63s", word) == 1) {
+    if (numSteps == sizePath) {
+      PathStep *newPath = new PathStep[2*sizePath];
+      memcpy(newPath, path, sizePath*sizeof(PathStep));
+      delete [] path;
+      path = newPath;
+      sizePath *= 2;
+    }
+    PathStep &step = path[numSteps];
+    step.stage = -1;
+    if (strcmp(word, "stage") == 0) {
+      if (fscanf(file, "%d", &step.stage) != 1)
+	break;
+    } else {
+      step.strain[0] = atof(word);
+      int i = 1;
+      while (i < order && fscanf(file, "%lf", &step.strain[i]) == 1)
+	i++;
+      if (i < order)
+	break;
+    }
+    numSteps++;
+  }
+
+  fclose(file);
+
+  return numSteps;
+}
+
+// one-dimensional consolidation then undrained cyclic simple shear
+static int
+defaultPath(int order, int numCycles, PathStep *&path)
+{
+  const int numConsolidation = 10;
+  const int stepsPerCycle = 40;
+  int shear = (order == 6) ? 3 : 2;
+
+  path = new PathStep[numConsolidation + numCycles*stepsPerCycle + 2];
+  int numSteps = 0;
+
+  PathStep step;
+  step.stage = -1;
+  for (int j = 0; j < 6; j++)
+    step.strain[j] = 0.0;
+
+  path[numSteps++].stage = 0;
+  double epsVol = -0.004;
+  for (int i = 1; i <= numConsolidation; i++) {
+    step.strain[1] = epsVol*i/numConsolidation;
+    path[numSteps++] = step;
+  }
+
+  path[numSteps++].stage = 1;
+  for (int c = 0; c < numCycles; c++) {
+    double amp = 0.001*(1.0 + 0.5*c);
+    for (int i = 1; i <= stepsPerCycle; i++) {
+      step.strain[shear] = amp*sin(2.0*3.14159265358979*i/stepsPerCycle);
+      path[numSteps++] = step;
+    }
+  }
+
+  return numSteps;
+}
+
+// the plane strain models only copy themselves for a given type
+static NDMaterial *
+copyMaterial(NDMaterial *theMaterial, int order)
+{
+  if (order == 3)
+    return theMaterial->getCopy("PlaneStrain");
+  else
+    return theMaterial->getCopy();
+}
+
+// take theMaterial through the path; if results is not 0 the stress and
+// tangent of each step are stored there
+static int
+runPath(NDMaterial *theMaterial, int order, PathStep *path, int numSteps, double *results)
+{
+  Vector strain(order);
+  int numEvaluations = 0;
+
+  for (int s = 0; s < numSteps; s++) {
+    PathStep &step = path[s];
+    if (step.stage >= 0) {
+      Information info(step.stage);
+      theMaterial->updateParameter(1, info);
+      continue;
+    }
+
+    for (int i = 0; i < order; i++)
+      strain(i) = step.strain[i];
+    theMaterial->setTrialStrain(strain);
+    const Vector &stress = theMaterial->getStress();
+    const Matrix &tangent = theMaterial->getTangent();
+    if (results != 0) {
+      double *result = &results[numEvaluations*(order + order*order)];
+      for (int i = 0; i < order; i++)
+	result[i] = stress(i);
+      for (int j = 0; j < order; j++)
+	for (int i = 0; i < order; i++)
+	  result[order + j*order + i] = tangent(i,j);
+    }
+    theMaterial->commitState();
+    numEvaluations++;
+  }
+
+  return numEvaluations;
+}
+
+int
+main(int argc, char **argv)
+{
+  if (argc < 2) {
+    fprintf(stderr, "usage: testSoilStrainPath material <-scheme n> <-cycles n> <-repeat n>\n"
+	    "         <-path file> <-record file> <-check file> <-tol tol>\n"
+	    "  material: ManzariDafalias, PM4Sand or PM4Silt\n");
+    return -1;
+  }
+
+  const char *matName = argv[1];
+  int scheme = 1;
+  int numCycles = 10;
+  int numRepeat = 20;
+  const char *pathFile = 0;
+  const char *recordFile = 0;
+  const char *checkFile = 0;
+  double tol = 0.0;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "-scheme") == 0 && i+1 < argc)
+      scheme = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-cycles") == 0 && i+1 < argc)
+      numCycles = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-repeat") == 0 && i+1 < argc)
+      numRepeat = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-path") == 0 && i+1 < argc)
+      pathFile = argv[++i];
+    else if (strcmp(argv[i], "-record") == 0 && i+1 < argc)
+      recordFile = argv[++i];
+    else if (strcmp(argv[i], "-check") == 0 && i+1 < argc)
+      checkFile = argv[++i];
+    else if (strcmp(argv[i], "-tol") == 0 && i+1 < argc)
+      tol = atof(argv[++i]);
+    else {
+      fprintf(stderr, "testSoilStrainPath - unknown option %s\n", argv[i]);
+      return -1;
+    }
+  }
+
+  // parameters of Toyoura sand (Dafalias & Manzari 2004)
+  // and the default calibrations of PM4Sand and PM4Silt
+  NDMaterial *theMaterial = 0;
+  int order = 6;
+  if (strcmp(matName, "ManzariDafalias") == 0)
+    theMaterial = new ManzariDafalias3D(1, 125.0, 0.05, 0.8, 1.25, 0.712, 0.019, 0.934, 0.7,
+					100.0, 0.01, 7.05, 0.968, 1.1, 0.704, 3.5, 4.0, 600.0, 1.42,
+					scheme);
+  else if (strcmp(matName, "PM4Sand") == 0) {
+    theMaterial = new PM4Sand(1, 0.55, 476.0, 0.53, 1.42);
+    order = 3;
+  } else if (strcmp(matName, "PM4Silt") == 0) {
+    theMaterial = new PM4Silt(1, 20.0, 0.0, 500.0, 0.6, 1.42);
+    order = 3;
+  } else {
+    fprintf(stderr, "testSoilStrainPath - unknown material %s\n", matName);
+    return -1;
+  }
+
+  PathStep *path = 0;
+  int numSteps = (pathFile != 0) ? readPath(pathFile, order, path) :
+    defaultPath(order, numCycles, path);
+  if (numSteps <= 0)
+    return -1;
+
+  int numEvaluations = 0;
+  for (int s = 0; s < numSteps; s++)
+    if (path[s].stage < 0)
+      numEvaluations++;
+  int size = numEvaluations*(order + order*order);
+  double *results = new double[size];
+
+  NDMaterial *theCopy = copyMaterial(theMaterial, order);
+  runPath(theCopy, order, path, numSteps, results);
+  delete theCopy;
+
+  clock_t start = clock();
+  for (int r = 0; r < numRepeat; r++) {
+    theCopy = copyMaterial(theMaterial, order);
+    runPath(theCopy, order, path, numSteps, 0);
+    delete theCopy;
+  }
+  double time = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+  printf("%s: %d steps, %d evaluations in %.3f s, %.0f evaluations per second\n",
+	 matName, numEvaluations, numEvaluations*numRepeat, time,
+	 (time > 0.0) ? numEvaluations*numRepeat/time : 0.0);
+
+  int res = 0;
+
+  if (recordFile != 0) {
+    FILE *file = fopen(recordFile, "w");
+    if (file == 0) {
+      fprintf(stderr, "testSoilStrainPath - could not open %s\n", recordFile);
+      res = -1;
+    } else {
+      for (int i = 0; i < size; i++)
+	fprintf(file, "%.17g\n", results[i]);
+      fclose(file);
+    }
+  }
+
+  if (checkFile != 0) {
+    FILE *file = fopen(checkFile, "r");
+    if (file == 0) {
+      fprintf(stderr, "testSoilStrainPath - could not open %s\n", checkFile);
+      res = -1;
+    } else {
+      int numDiff = 0;
+      int firstDiff = -1;
+      double maxDiff = 0.0;
+      int i = 0;
+      double value;
+      for (i = 0; i < size && fscanf(file, "%lf", &value) == 1; i++) {
+	double diff = fabs(results[i] - value);
+	double scale = (fabs(value) > 1.0) ? fabs(value) : 1.0;
+	if (memcmp(&results[i], &value, sizeof(double)) != 0 && diff > tol*scale) {
+	  if (firstDiff < 0)
+	    firstDiff = i/(order + order*order);
+	  numDiff++;
+	}
+	if (diff/scale > maxDiff)
+	  maxDiff = diff/scale;
+      }
+      fclose(file);
+
+      if (i < size) {
+	printf("%s: %s has %d values, %d expected  FAILED\n", matName, checkFile, i, size);
+	res = -1;
+      } else if (numDiff > 0) {
+	printf("%s: %d of %d values differ, first at step %d, max relative difference %g  FAILED\n",
+	       matName, numDiff, size, firstDiff, maxDiff);
+	res = -1;
+      } else
+	printf("%s: %d values match, max relative difference %g  PASSED\n", matName, size, maxDiff);
+    }
+  }
+
+  delete [] results;
+  delete [] path;
+  delete theMaterial;
+
+  return res;
+}
@@ -0,0 +1,289 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definitions for Voigt6 and
+// Voigt66, fixed size versions of the 6 component Vector and 6x6 Matrix
+// the nD materials use for symmetric 3x3 second order tensors and for the
+// fourth order tensors acting on them. They hold their data in place, so
+// they can be used for the locals of a return mapping or sub-stepping loop
+// without going to the heap, and everything is inline, most of it
+// constexpr. The storage order is that of the materials,
+// 11, 22, 33, 12, 23, 13, with the shear components of a stress-like
+// (contravariant) tensor as they are and those of a strain-like
+// (covariant) tensor doubled; Voigt66 is stored by columns like Matrix.
+//
+// The operators work component by component in the same order as the
+// Vector and Matrix ones (M*v and M^v as Matrix::operator*(Vector) and
+// Matrix::operator^(Vector), A*B as Matrix::operator*(Matrix), A/d
+// multiplying by 1/d as Matrix::operator/), so a computation moved over
+// from Vector and Matrix gives the same results to the last bit.
+//
+// What: "@(#) VoigtTensor.h, revA"
+
+#ifndef VoigtTensor_h
+#define VoigtTensor_h
+
+#include <math.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+class Voigt6
+{
+  public:
+    constexpr Voigt6() :v{0.0, 0.0, 0.0, 0.0, 0.0, 0.0} {}
+    constexpr Voigt6(double v0, double v1, double v2, double v3, double v4, double v5)
+      :v{v0, v1, v2, v3, v4, v5} {}
+    explicit Voigt6(const Vector &V) {
+      for (int i = 0; i < 6; i++)
+	v[i] = V(i);
+    }
+
+    // the 2nd order identity tensor
+    static constexpr Voigt6 identity() {return Voigt6(1.0, 1.0, 1.0, 0.0, 0.0, 0.0);}
+
+    double &operator()(int i) {return v[i];}
+    constexpr double operator()(int i) const {return v[i];}
+
+    void Zero(void) {
+      for (int i = 0; i < 6; i++)
+	v[i] = 0.0;
+    }
+    void copyTo(Vector &V) const {
+      for (int i = 0; i < 6; i++)
+	V(i) = v[i];
+    }
+
+    Voigt6 &operator+=(const Voigt6 &b) {
+      for (int i = 0; i < 6; i++)
+	v[i] += b.v[i];
+      return *this;
+    }
+    Voigt6 &operator-=(const Voigt6 &b) {
+      for (int i = 0; i < 6; i++)
+	v[i] -= b.v[i];
+      return *this;
+    }
+    Voigt6 &operator*=(double a) {
+      for (int i = 0; i < 6; i++)
+	v[i] *= a;
+      return *this;
+    }
+
+    constexpr double trace() const {return v[0] + v[1] + v[2];}
+    // the deviatoric part
+    constexpr Voigt6 dev() const {return shiftDiagonal(1.0/3.0 * trace());}
+    // this.b, both contravariant
+    constexpr Voigt6 dot(const Voigt6 &b) const {
+      return Voigt6(v[0]*b.v[0] + v[3]*b.v[3] + v[5]*b.v[5],
+		    v[3]*b.v[3] + v[1]*b.v[1] + v[4]*b.v[4],
+		    v[5]*b.v[5] + v[4]*b.v[4] + v[2]*b.v[2],
+		    0.5*(v[0]*b.v[3] + v[3]*b.v[0] + v[3]*b.v[1] + v[1]*b.v[3] + v[5]*b.v[4] + v[4]*b.v[5]),
+		    0.5*(v[3]*b.v[5] + v[5]*b.v[3] + v[1]*b.v[4] + v[4]*b.v[1] + v[4]*b.v[2] + v[2]*b.v[4]),
+		    0.5*(v[0]*b.v[5] + v[5]*b.v[0] + v[3]*b.v[4] + v[4]*b.v[3] + v[5]*b.v[2] + v[2]*b.v[5]));
+    }
+    // this:b with both contravariant, both covariant, and one of each
+    constexpr double ddotContr(const Voigt6 &b) const {
+      return v[0]*b.v[0] + v[1]*b.v[1] + v[2]*b.v[2]
+	+ (v[3]*b.v[3] + v[3]*b.v[3]) + (v[4]*b.v[4] + v[4]*b.v[4]) + (v[5]*b.v[5] + v[5]*b.v[5]);
+    }
+    constexpr double ddotCov(const Voigt6 &b) const {
+      return v[0]*b.v[0] + v[1]*b.v[1] + v[2]*b.v[2]
+	+ (v[3]*b.v[3] - 0.5*v[3]*b.v[3]) + (v[4]*b.v[4] - 0.5*v[4]*b.v[4]) + (v[5]*b.v[5] - 0.5*v[5]*b.v[5]);
+    }
+    constexpr double ddotMixed(const Voigt6 &b) const {
+      return v[0]*b.v[0] + v[1]*b.v[1] + v[2]*b.v[2] + v[3]*b.v[3] + v[4]*b.v[4] + v[5]*b.v[5];
+    }
+    double normContr() const {return sqrt(ddotContr(*this));}
+    double normCov() const {return sqrt(ddotCov(*this));}
+
+    constexpr Voigt6 toContravariant() const {
+      return Voigt6(v[0], v[1], v[2], 0.5*v[3], 0.5*v[4], 0.5*v[5]);
+    }
+    constexpr Voigt6 toCovariant() const {
+      return Voigt6(v[0], v[1], v[2], 2.0*v[3], 2.0*v[4], 2.0*v[5]);
+    }
+
+    constexpr double det() const {
+      return v[0]*v[1]*v[2] + 2*v[3]*v[4]*v[5] - v[0]*v[5]*v[5] - v[2]*v[3]*v[3] - v[1]*v[4]*v[4];
+    }
+    // the inverse, the tensor itself if it is singular
+    constexpr Voigt6 inv() const {
+      return det() == 0.0 ? *this : adjugate().divide(det());
+    }
+
+  private:
+    constexpr Voigt6 shiftDiagonal(double s) const {
+      return Voigt6(v[0] - s, v[1] - s, v[2] - s, v[3], v[4], v[5]);
+    }
+    constexpr Voigt6 adjugate() const {
+      return Voigt6(v[1]*v[2] - v[4]*v[4], v[0]*v[2] - v[5]*v[5], v[0]*v[1] - v[3]*v[3],
+		    v[4]*v[5] - v[2]*v[3], v[3]*v[5] - v[0]*v[4], v[3]*v[4] - v[1]*v[5]);
+    }
+    constexpr Voigt6 divide(double a) const {
+      return Voigt6(v[0]/a, v[1]/a, v[2]/a, v[3]/a, v[4]/a, v[5]/a);
+    }
+
+    double v[6];
+
+    friend constexpr Voigt6 operator+(const Voigt6 &a, const Voigt6 &b);
+    friend constexpr Voigt6 operator-(const Voigt6 &a, const Voigt6 &b);
+    friend constexpr Voigt6 operator*(const Voigt6 &a, double s);
+    friend constexpr Voigt6 operator/(const Voigt6 &a, double s);
+};
+
+inline constexpr Voigt6
+operator+(const Voigt6 &a, const Voigt6 &b)
+{
+  return Voigt6(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2],
+		a.v[3] + b.v[3], a.v[4] + b.v[4], a.v[5] + b.v[5]);
+}
+
+inline constexpr Voigt6
+operator-(const Voigt6 &a, const Voigt6 &b)
+{
+  return Voigt6(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2],
+		a.v[3] - b.v[3], a.v[4] - b.v[4], a.v[5] - b.v[5]);
+}
+
+inline constexpr Voigt6
+operator*(const Voigt6 &a, double s)
+{
+  return Voigt6(a.v[0]*s, a.v[1]*s, a.v[2]*s, a.v[3]*s, a.v[4]*s, a.v[5]*s);
+}
+
+inline constexpr Voigt6
+operator*(double s, const Voigt6 &a)
+{
+  return a*s;
+}
+
+inline constexpr Voigt6
+operator/(const Voigt6 &a, double s)
+{
+  return a.divide(s);
+}
+
+
+class Voigt66
+{
+  public:
+    constexpr Voigt66() :m{} {}
+    explicit Voigt66(const Matrix &M) {
+      for (int j = 0; j < 6; j++)
+	for (int i = 0; i < 6; i++)
+	  m[j*6+i] = M(i,j);
+    }
+
+    // the mixed variant 4th order identity tensor
+    static Voigt66 identity() {
+      Voigt66 I;
+      for (int i = 0; i < 6; i++)
+	I.m[i*6+i] = 1.0;
+      return I;
+    }
+    // a (x) b
+    static Voigt66 dyadic(const Voigt6 &a, const Voigt6 &b) {
+      Voigt66 D;
+      for (int j = 0; j < 6; j++)
+	for (int i = 0; i < 6; i++)
+	  D.m[j*6+i] = a(i) * b(j);
+      return D;
+    }
+
+    double &operator()(int i, int j) {return m[j*6+i];}
+    constexpr double operator()(int i, int j) const {return m[j*6+i];}
+
+    void Zero(void) {
+      for (int i = 0; i < 36; i++)
+	m[i] = 0.0;
+    }
+    void copyTo(Matrix &M) const {
+      for (int j = 0; j < 6; j++)
+	for (int i = 0; i < 6; i++)
+	  M(i,j) = m[j*6+i];
+    }
+
+    Voigt66 &operator+=(const Voigt66 &B) {
+      for (int i = 0; i < 36; i++)
+	m[i] += B.m[i];
+      return *this;
+    }
+
+    Voigt66 operator+(const Voigt66 &B) const {
+      Voigt66 C;
+      for (int i = 0; i < 36; i++)
+	C.m[i] = m[i] + B.m[i];
+      return C;
+    }
+    Voigt66 operator-(const Voigt66 &B) const {
+      Voigt66 C;
+      for (int i = 0; i < 36; i++)
+	C.m[i] = m[i] - B.m[i];
+      return C;
+    }
+    Voigt66 operator*(double s) const {
+      Voigt66 C;
+      for (int i = 0; i < 36; i++)
+	C.m[i] = m[i] * s;
+      return C;
+    }
+    Voigt66 operator/(double s) const {
+      return *this * (1.0/s);
+    }
+
+    // this:b, the second index of this and b of opposite variance
+    Voigt6 operator*(const Voigt6 &b) const {
+      Voigt6 c;
+      for (int j = 0; j < 6; j++)
+	for (int i = 0; i < 6; i++)
+	  c(i) += m[j*6+i] * b(j);
+      return c;
+    }
+    // b:this, the first index of this and b of opposite variance
+    Voigt6 operator^(const Voigt6 &b) const {
+      Voigt6 c;
+      for (int j = 0; j < 6; j++)
+	for (int i = 0; i < 6; i++)
+	  c(j) += m[j*6+i] * b(i);
+      return c;
+    }
+    // this:B
+    Voigt66 operator*(const Voigt66 &B) const {
+      Voigt66 C;
+      for (int j = 0; j < 6; j++)
+	for (int k = 0; k < 6; k++) {
+	  double bkj = B.m[j*6+k];
+	  for (int i = 0; i < 6; i++)
+	    C.m[j*6+i] += m[k*6+i] * bkj;
+	}
+      return C;
+    }
+
+  private:
+    double m[36];
+};
+
+inline Voigt66
+operator*(double s, const Voigt66 &A)
+{
+  return A*s;
+}
+
+#endif
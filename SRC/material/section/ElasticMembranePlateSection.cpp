@@ -37,8 +37,8 @@
 const double ElasticMembranePlateSection::five6 = 5.0/6.0 ; //shear correction
 
 //static vector and matrices
-Vector  ElasticMembranePlateSection::stress(8) ;
-Matrix  ElasticMembranePlateSection::tangent(8,8) ;
+OPS_THREAD_LOCAL Vector  ElasticMembranePlateSection::stress(8) ;
+OPS_THREAD_LOCAL Matrix  ElasticMembranePlateSection::tangent(8,8) ;
 ID      ElasticMembranePlateSection::array(8) ;
 
 void* OPS_ElasticMembranePlateSection()
@@ -340,7 +340,7 @@ void  ElasticMembranePlateSection::Print( OPS_Stream &s, int flag )
 int ElasticMembranePlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(5);
+  static OPS_THREAD_LOCAL Vector data(5);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = nu;
@@ -359,7 +359,7 @@ int ElasticMembranePlateSection::recvSelf(int cTag, Channel &theChannel,
 				      FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(5);
+  static OPS_THREAD_LOCAL Vector data(5);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticMembranePlateSection::recvSelf() - failed to recv data\n";
@@ -83,6 +83,8 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
     //revert to start
     int revertToStart( ) ;
 
+    bool isThreadSafe( ) {return true;}
+
     //get the strain and integrate plasticity equations
     int setTrialSectionDeformation( const Vector &strain_from_element ) ;
 
@@ -119,9 +121,9 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
 
     Vector strain ;
 
-    static Vector stress ;
+    static OPS_THREAD_LOCAL Vector stress ;
 
-    static Matrix tangent ;
+    static OPS_THREAD_LOCAL Matrix tangent ;
 
     static ID array ;  
 
@@ -35,8 +35,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection3d::s(4);
-Matrix ElasticSection3d::ks(4,4);
+OPS_THREAD_LOCAL Vector ElasticSection3d::s(4);
+OPS_THREAD_LOCAL Matrix ElasticSection3d::ks(4,4);
 ID ElasticSection3d::code(4);
 
 void* OPS_ElasticSection3d()
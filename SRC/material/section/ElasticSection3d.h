@@ -60,6 +60,8 @@ class ElasticSection3d : public SectionForceDeformation
   SectionForceDeformation *getCopy(void);
   const ID &getType(void);
   int getOrder(void) const;
+
+  bool isThreadSafe(void) {return true;}
   
   int sendSelf(int commitTag, Channel &theChannel);
   int recvSelf(int commitTag, Channel &theChannel,
@@ -82,8 +84,8 @@ class ElasticSection3d : public SectionForceDeformation
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static OPS_THREAD_LOCAL Vector s;
+  static OPS_THREAD_LOCAL Matrix ks;
   static ID code;
 
   int parameterID;
@@ -453,6 +453,8 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector& deforms)
     }
   }
 
+  this->setFiberStencils(fiberLocs);
+
 	for (int i = 0; i < numFibers; i++) {
 
 		// initializing material strain and set it
@@ -469,9 +471,7 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector& deforms)
 		else
 		{
 			//caculate the fiber tempe, T=T1-(Y-Y1)*(T1-T2)/(Y1-Y2)
-			Vector TempV= this->determineFiberTemperature( DataMixed, fiberLocs[i]);
-			FiberTemperature = TempV(0);
-			FiberTempMax= TempV(1);
+			FiberTemperature = theStencil.getTemperature(DataMixed, i);
 		}
 		// get the data from thermal material
 		static Vector tData(4);
@@ -606,6 +606,7 @@ FiberSection2dThermal::getTemperatureStress(const Vector &dataMixed)
 
 
   //------updata fiber initial Modulus corresponding to its temperature----------------
+  this->setFiberStencils(fiberLocs);
 
   double DeltaThermalElong[1000];
   for( int i=0; i< numFibers; i++) {
@@ -624,8 +625,7 @@ FiberSection2dThermal::getTemperatureStress(const Vector &dataMixed)
     else
 	{
 		//caculate the fiber tempe, T=T1-(Y-Y1)*(T1-T2)/(Y1-Y2)
-		Vector TempV= this->determineFiberTemperature( dataMixed, fiberLocs[i]);
-		FiberTemperature = TempV(0);FiberTempMax= TempV(1);
+		FiberTemperature = theStencil.getTemperature(DataMixed, i);
 	}
 
     // obtaining new thermal Elongation
@@ -1516,6 +1516,26 @@ FiberSection2dThermal::commitSensitivity(const Vector& defSens,
 // AddingSensitivity:END ///////////////////////////////////
 
 
+// find the interval of DataMixed holding each fiber, as determineFiberTemperature
+// does, and keep it with the interpolation weights
+int
+FiberSection2dThermal::setFiberStencils(const double *fiberLocs)
+{
+  if (theStencil.needsUpdate(DataMixed, FiberTemperatureStencil::loc18, 9, numFibers) == false)
+    return 0;
+
+  if (fabs(DataMixed(1)) <= 1e-10 && fabs(DataMixed(17)) <= 1e-10) //no tempe load
+    return 0;
+
+  for (int i = 0; i < numFibers; i++) {
+    if (theStencil.setInterpolation(i, DataMixed, FiberTemperatureStencil::loc18,
+				    FiberTemperatureStencil::temp18, 9, fiberLocs[i]) < 0)
+      opserr << "FiberSection2dThermal::setFiberStencils -- fiber loc " << fiberLocs[i] << " is out of the section" << endln;
+  }
+
+  return 0;
+}
+
 const Vector&
 FiberSection2dThermal::determineFiberTemperature(const Vector& DataMixed, double fiberLoc)
 {
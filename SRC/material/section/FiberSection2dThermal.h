@@ -36,6 +36,7 @@
 #include <SectionForceDeformation.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <FiberTemperatureStencil.h>
 
 
 class UniaxialMaterial;
@@ -97,6 +98,7 @@ class FiberSection2dThermal : public SectionForceDeformation
     // AddingSensitivity:END ///////////////////////////////////////////
 
     const Vector& determineFiberTemperature(const Vector& , double );  //Added by Liming (UoE)
+    int setFiberStencils(const double *fiberLocs);
 
   protected:
 
@@ -124,6 +126,7 @@ class FiberSection2dThermal : public SectionForceDeformation
     double *Fiber_Tangent;
     double *Fiber_ElongP;
     Vector AverageThermalElong;
+    FiberTemperatureStencil theStencil; // interpolation of the fiber temperatures
 	//Basiclly this data stores the last committed fiber tangent for calculating thermal foreces
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     Vector dedh; // MHS hack
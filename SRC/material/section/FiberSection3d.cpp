@@ -44,11 +44,16 @@
 #include <UniaxialMaterial.h>
 #include <ElasticMaterial.h>
 #include <SectionIntegration.h>
+#include <ThreadScratch.h>
+#include <PackedFiberMaterials.h>
 #include <elementAPI.h>
 #include <string.h>
 
 ID FiberSection3d::code(4);
 
+// fiber locations and areas during the state determination
+static OPS_THREAD_LOCAL ThreadScratch fiberScratch;
+
 void* OPS_FiberSection3d()
 {
     int numData = OPS_GetNumRemainingInputArgs();
@@ -79,7 +84,8 @@ void* OPS_FiberSection3d()
 FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers, UniaxialMaterial *torsion): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
+  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0),
+  packedMaterials(0), trialState(0), committedState(0)
 {
   if (numFibers != 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -153,7 +159,8 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers, UniaxialMateria
 FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial *torsion): 
     SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
     numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
-    QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
+    QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0),
+  packedMaterials(0), trialState(0), committedState(0)
 {
     if(sizeFibers != 0) {
 	theMaterials = new UniaxialMaterial *[sizeFibers];
@@ -210,7 +217,8 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si, UniaxialMaterial *torsion):
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
+  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0),
+  packedMaterials(0), trialState(0), committedState(0)
 {
   if (numFibers != 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -287,7 +295,8 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 FiberSection3d::FiberSection3d():
   SectionForceDeformation(0, SEC_TAG_FiberSection3d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
-  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
+  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0),
+  packedMaterials(0), trialState(0), committedState(0)
 {
   s = new Vector(sData, 4);
   ks = new Matrix(kData, 4, 4);
@@ -309,6 +318,11 @@ FiberSection3d::FiberSection3d():
 int
 FiberSection3d::addFiber(Fiber &newFiber)
 {
+  if (packedMaterials != 0) {
+    opserr << "FiberSection3d::addFiber -- fibers can not be added to a section with packed materials\n";
+    return -1;
+  }
+
   // need to create a larger array
   if(numFibers == sizeFibers) {
       int newSize = 2*sizeFibers;
@@ -375,19 +389,60 @@ FiberSection3d::addFiber(Fiber &newFiber)
   return 0;
 }
 
+int
+FiberSection3d::packMaterials(void)
+{
+  if (packedMaterials != 0 || numFibers == 0)
+    return 0;
+
+  PackedFiberMaterials *thePacked = new PackedFiberMaterials(numFibers, theMaterials);
+
+  int size = thePacked->getStateSize();
+  if (size <= 0) {
+    opserr << "FiberSection3d::packMaterials -- section " << this->getTag()
+	   << ", not all the materials have a packed state, the fibers keep their own copies\n";
+    thePacked->detach();
+    return -1;
+  }
+
+  for (int i = 0; i < numFibers; i++) {
+    delete theMaterials[i];
+    theMaterials[i] = thePacked->getMaterial(i);
+  }
+
+  packedMaterials = thePacked;
+  trialState = new double[size];
+  committedState = new double[size];
+
+  packedMaterials->revertToStart(committedState);
+  memcpy(trialState, committedState, size*sizeof(double));
+
+  return 0;
+}
+
 
 
 // destructor:
 FiberSection3d::~FiberSection3d()
 {
   if (theMaterials != 0) {
-    for (int i = 0; i < numFibers; i++)
-      if (theMaterials[i] != 0)
-	delete theMaterials[i];
+    if (packedMaterials == 0)
+      for (int i = 0; i < numFibers; i++)
+	if (theMaterials[i] != 0)
+	  delete theMaterials[i];
       
     delete [] theMaterials;
   }
 
+  if (packedMaterials != 0)
+    packedMaterials->detach();
+
+  if (trialState != 0)
+    delete [] trialState;
+
+  if (committedState != 0)
+    delete [] committedState;
+
   if (matData != 0)
     delete [] matData;
 
@@ -420,9 +475,9 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   double d2 = deforms(2);
   double d3 = deforms(3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = fiberScratch.get(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &zLocs[numFibers];
  
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -447,7 +502,14 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 
     // determine material strain and set it
     double strain = d0 - y*d1 + z*d2;
-    res += theMat->setTrial(strain, stress, tangent);
+    if (packedMaterials != 0) {
+      int offset = packedMaterials->getOffset(i);
+      double *state = &trialState[offset];
+      res += theMat->setTrialPacked(strain, &committedState[offset], state);
+      stress = state[1];
+      tangent = state[2];
+    } else
+      res += theMat->setTrial(strain, stress, tangent);
 
     double value = tangent * A;
     double vas1 = -y*value;
@@ -484,14 +546,14 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  static OPS_THREAD_LOCAL double kInitialData[16];
+  static OPS_THREAD_LOCAL Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = fiberScratch.get(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &zLocs[numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -584,7 +646,10 @@ FiberSection3d::getCopy(void)
       theCopy->matData[i*3] = matData[i*3];
       theCopy->matData[i*3+1] = matData[i*3+1];
       theCopy->matData[i*3+2] = matData[i*3+2];
-      theCopy->theMaterials[i] = theMaterials[i]->getCopy();
+      if (packedMaterials != 0)
+	theCopy->theMaterials[i] = theMaterials[i];
+      else
+	theCopy->theMaterials[i] = theMaterials[i]->getCopy();
 
       if (theCopy->theMaterials[i] == 0) {
 	opserr << "FiberSection3d::getCopy -- failed to get copy of a Material\n";
@@ -593,6 +658,16 @@ FiberSection3d::getCopy(void)
     }    
   }
 
+  if (packedMaterials != 0) {
+    packedMaterials->attach();
+    theCopy->packedMaterials = packedMaterials;
+    int size = packedMaterials->getStateSize();
+    theCopy->trialState = new double[size];
+    theCopy->committedState = new double[size];
+    memcpy(theCopy->trialState, trialState, size*sizeof(double));
+    memcpy(theCopy->committedState, committedState, size*sizeof(double));
+  }
+
   theCopy->e = e;
   theCopy->QzBar = QzBar;
   theCopy->QyBar = QyBar;
@@ -633,13 +708,28 @@ FiberSection3d::getOrder () const
   return 4;
 }
 
+bool
+FiberSection3d::isThreadSafe(void)
+{
+  // the packed state determination does not change the shared materials
+  if (packedMaterials == 0)
+    for (int i = 0; i < numFibers; i++)
+      if (theMaterials[i]->isThreadSafe() == false)
+	return false;
+
+  return (theTorsion == 0 || theTorsion->isThreadSafe());
+}
+
 int
 FiberSection3d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  if (packedMaterials != 0)
+    memcpy(committedState, trialState, packedMaterials->getStateSize()*sizeof(double));
+  else
+    for (int i = 0; i < numFibers; i++)
+      err += theMaterials[i]->commitState();
 
   err += theTorsion->commitState();
 
@@ -651,15 +741,18 @@ FiberSection3d::revertToLastCommit(void)
 {
   int err = 0;
 
+  if (packedMaterials != 0)
+    memcpy(trialState, committedState, packedMaterials->getStateSize()*sizeof(double));
+
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   kData[4] = 0.0; kData[5] = 0.0; kData[6] = 0.0; kData[7] = 0.0;
   kData[8] = 0.0; 
   kData[15] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = fiberScratch.get(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &zLocs[numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -679,11 +772,18 @@ FiberSection3d::revertToLastCommit(void)
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
+    double tangent, stress;
+    if (packedMaterials != 0) {
+      double *state = &trialState[packedMaterials->getOffset(i)];
+      tangent = state[2];
+      stress = state[1];
+    } else {
+      // invoke revertToLast on the material
+      err += theMat->revertToLastCommit();
+
+      tangent = theMat->getTangent();
+      stress = theMat->getStress();
+    }
 
     double value = tangent * A;
     double vas1 = -y*value;
@@ -721,15 +821,20 @@ FiberSection3d::revertToStart(void)
   // revert the fibers to start    
   int err = 0;
 
+  if (packedMaterials != 0) {
+    err += packedMaterials->revertToStart(committedState);
+    memcpy(trialState, committedState, packedMaterials->getStateSize()*sizeof(double));
+  }
+
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   kData[4] = 0.0; kData[5] = 0.0; kData[6] = 0.0; kData[7] = 0.0;
   kData[8] = 0.0;
   kData[15] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = fiberScratch.get(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &zLocs[numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -749,11 +854,18 @@ FiberSection3d::revertToStart(void)
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
 
-    // invoke revertToStart on the material
-    err += theMat->revertToStart();
-
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
+    double tangent, stress;
+    if (packedMaterials != 0) {
+      double *state = &trialState[packedMaterials->getOffset(i)];
+      tangent = state[2];
+      stress = state[1];
+    } else {
+      // invoke revertToStart on the material
+      err += theMat->revertToStart();
+
+      tangent = theMat->getTangent();
+      stress = theMat->getStress();
+    }
 
     double value = tangent * A;
     double vas1 = -y*value;
@@ -791,6 +903,11 @@ FiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
 
+  if (packedMaterials != 0) {
+    opserr << "FiberSection3d::sendSelf - not available for a section with packed materials\n";
+    return -1;
+  }
+
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
   static ID data(3);
@@ -852,6 +969,11 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
+  if (packedMaterials != 0) {
+    opserr << "FiberSection3d::recvSelf - not available for a section with packed materials\n";
+    return -1;
+  }
+
   static ID data(3);
   
   int dbTag = this->getDbTag();
@@ -999,7 +1121,11 @@ FiberSection3d::Print(OPS_Stream &s, int flag)
   if (flag == 3) {
     for (int i = 0; i < numFibers; i++) {
       s << theMaterials[i]->getTag() << " " << matData[3*i] << " "  << matData[3*i+1] << " "  << matData[3*i+2] << " " ;
-      s << theMaterials[i]->getStress() << " "  << theMaterials[i]->getStrain() << endln;
+      if (packedMaterials != 0) {
+	double *state = &trialState[packedMaterials->getOffset(i)];
+	s << state[1] << " "  << state[0] << endln;
+      } else
+	s << theMaterials[i]->getStress() << " "  << theMaterials[i]->getStrain() << endln;
     } 
   }
     
@@ -1176,12 +1302,20 @@ FiberSection3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 
   } else if ((strcmp(argv[0],"numFailedFiber") == 0) || 
 	     (strcmp(argv[0],"numFiberFailed") == 0)) {
+    if (packedMaterials != 0) {
+      opserr << "FiberSection3d::setResponse - " << argv[0] << " not available for a section with packed materials\n";
+      return 0;
+    }
     int count = 0;
     theResponse = new MaterialResponse(this, 6, count);
 
   } else if ((strcmp(argv[0],"sectionFailed") == 0) ||
 	     (strcmp(argv[0],"hasSectionFailed") == 0) ||
 	     (strcmp(argv[0],"hasFailed") == 0)) {
+    if (packedMaterials != 0) {
+      opserr << "FiberSection3d::setResponse - " << argv[0] << " not available for a section with packed materials\n";
+      return 0;
+    }
 
     int count = 0;
     return theResponse = new MaterialResponse(this, 7, count);
@@ -1269,7 +1403,10 @@ FiberSection3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 	output.attr("zLoc",matData[3*key+1]);
 	output.attr("area",matData[3*key+2]);
 	
-	theResponse =  theMaterials[key]->setResponse(&argv[passarg], argc-passarg, output);
+	if (packedMaterials != 0)
+	  opserr << "FiberSection3d::setResponse - fiber material responses not available for a section with packed materials\n";
+	else
+	  theResponse =  theMaterials[key]->setResponse(&argv[passarg], argc-passarg, output);
 	
 	output.endTag();
       }
@@ -1295,13 +1432,22 @@ FiberSection3d::getResponse(int responseID, Information &sectInfo)
       yLoc = matData[3*j];
       zLoc = matData[3*j+1];
       A = matData[3*j+2];
-      stress = theMaterials[j]->getStress();
-      strain = theMaterials[j]->getStrain();
+      if (packedMaterials != 0) {
+	double *state = &trialState[packedMaterials->getOffset(j)];
+	stress = state[1];
+	strain = state[0];
+      } else {
+	stress = theMaterials[j]->getStress();
+	strain = theMaterials[j]->getStrain();
+      }
       data(count) = yLoc; data(count+1) = zLoc; data(count+2) = A;
       data(count+3) = stress; data(count+4) = strain;
       count += 5;
     }
     return sectInfo.setVector(data);	
+  } else if ((responseID == 6 || responseID == 7) && packedMaterials != 0) {
+    // the shared materials do not hold the state of the fibers
+    return -1;
   } else  if (responseID == 6) {
     int count = 0;
     for (int j = 0; j < numFibers; j++) {    
@@ -1333,6 +1479,11 @@ FiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
   if (argc < 1)
     return -1;
 
+  if (packedMaterials != 0) {
+    opserr << "FiberSection3d::setParameter - not available for a section with packed materials\n";
+    return -1;
+  }
+
   int result = 0;
 
   // A material parameter
@@ -1406,6 +1557,12 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   static Vector ds(4);
   
   ds.Zero();
+
+  // the shared materials do not hold the state of the fibers
+  if (packedMaterials != 0) {
+    opserr << "FiberSection3d::getStressResultantSensitivity - not available for a section with packed materials\n";
+    return ds;
+  }
   
   double y, z, A;
   double stress = 0;
@@ -1514,6 +1671,11 @@ FiberSection3d::getSectionTangentSensitivity(int gradIndex)
 int
 FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numGrads)
 {
+  // would change the state of materials that all the fibers share
+  if (packedMaterials != 0) {
+    opserr << "FiberSection3d::commitSensitivity - not available for a section with packed materials\n";
+    return -1;
+  }
 
   double d0 = defSens(0);
   double d1 = defSens(1);
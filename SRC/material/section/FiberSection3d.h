@@ -41,6 +41,7 @@ class UniaxialMaterial;
 class Fiber;
 class Response;
 class SectionIntegration;
+class PackedFiberMaterials;
 
 class FiberSection3d : public SectionForceDeformation
 {
@@ -69,6 +70,8 @@ class FiberSection3d : public SectionForceDeformation
     SectionForceDeformation *getCopy(void);
     const ID &getType (void);
     int getOrder (void) const;
+
+    bool isThreadSafe(void);
     
     int sendSelf(int cTag, Channel &theChannel);
     int recvSelf(int cTag, Channel &theChannel, 
@@ -81,6 +84,16 @@ class FiberSection3d : public SectionForceDeformation
 
     int addFiber(Fiber &theFiber);
 
+    // switch to packed materials: the fibers, of this section and of its
+    // copies, share one copy of each material and their states are kept
+    // here in contiguous trial and committed arrays. The fibers are set
+    // back to their initial state. Returns -1, leaving the section as it
+    // is, if one of the materials does not support a packed state. The
+    // material responses of single fibers, the failed fiber counts,
+    // parameters, sensitivity and sendSelf are not available on a packed
+    // section.
+    int packMaterials(void);
+
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int setParameter(const char **argv, int argc, Parameter &param);
 
@@ -115,6 +128,10 @@ class FiberSection3d : public SectionForceDeformation
     Matrix *ks;        // section stiffness
 
     UniaxialMaterial *theTorsion;
+
+    PackedFiberMaterials *packedMaterials; // the shared materials if packed
+    double *trialState;      // the packed states of the fibers
+    double *committedState;
 };
 
 #endif
@@ -482,26 +482,24 @@ FiberSection3dThermal::getTemperatureStress(const Vector& dataMixed)
           ThermalElong[i]=0;
   }
 
+  // the fiber temperatures, one gather over the stencils which are only
+  // rebuilt when the locations in dataMixed change
+  this->setFiberStencils(dataMixed);
+  if (dataMixed.Size() == 25 && fabs(dataMixed(0)) <= 1e-10 && fabs(dataMixed(10)) <= 1e-10 &&
+      fabs(dataMixed(11)) <= 1e-10) { //no tempe load
+    for (int i = 0; i < numFibers; i++)
+      Fiber_T[i] = 0;
+  }
+  else
+    theStencil.getTemperatures(dataMixed, Fiber_T);
+
   for (int i = 0; i < numFibers; i++) {
 
     UniaxialMaterial *theMat = theMaterials[i];
 
-	//double seefiberlocs1,seefiberlocs2;
-    //seefiberlocs1 = fiberLocsZ[i];
-	int jy;
-	int jz;
-    jy = i*3; //retrieve temp along y
-	jz = i*3+1; //retrieve temp along z
-	double yi;
-	double zi;
-	yi = matData[jy];
-    zi = matData[jz];
-
-	double FiberTemperature = 0 ; //JZ
+	double FiberTemperature = Fiber_T[i]; //JZ
 	double FiberTempMax=0; //PK add for max temp
 
-	FiberTemperature= this->determineFiberTemperature( dataMixed, -yi, zi);
-
     // determine material strain and set it
 	double tangent =0.0;
 	double ThermalElongation =0.0;
@@ -1321,6 +1319,50 @@ FiberSection3dThermal::commitSensitivity(const Vector& defSens, int gradIndex, i
 // AddingSensitivity:END ///////////////////////////////////
 
 
+// find the interval of DataMixed holding each fiber, as determineFiberTemperature
+// does, and keep it with the interpolation weights
+int
+FiberSection3dThermal::setFiberStencils(const Vector &dataMixed)
+{
+  int size = dataMixed.Size();
+  const int *locIdx = (size == 25) ? FiberTemperatureStencil::loc25 : FiberTemperatureStencil::loc18;
+  int numLocs = (size == 25) ? 10 : ((size == 18) ? 9 : 0);
+
+  if (theStencil.needsUpdate(dataMixed, locIdx, numLocs, numFibers) == false)
+    return 0;
+
+  if (size == 18 && fabs(dataMixed(1)) <= 1e-10 && fabs(dataMixed(17)) <= 1e-10) //no tempe load
+    return 0;
+
+  for (int i = 0; i < numFibers; i++) {
+    double yi = -matData[3*i];
+    double zi = matData[3*i+1];
+    int res = 0;
+
+    if (size == 18) {
+      res = theStencil.setInterpolation(i, dataMixed, FiberTemperatureStencil::loc18,
+					FiberTemperatureStencil::temp18, 9, yi);
+    }
+    else if (size == 25) {
+      if (yi <= dataMixed(1))
+	res = theStencil.setInterpolation(i, dataMixed, &FiberTemperatureStencil::loc25[5],
+					  FiberTemperatureStencil::bottomTemp25, 5, zi);
+      else if (yi <= dataMixed(9))
+	res = theStencil.setInterpolation(i, dataMixed, FiberTemperatureStencil::loc25,
+					  FiberTemperatureStencil::temp18, 5, yi);
+      else
+	res = theStencil.setInterpolation(i, dataMixed, &FiberTemperatureStencil::loc25[5],
+					  FiberTemperatureStencil::topTemp25, 5, zi);
+    }
+
+    if (res < 0)
+      opserr<<"WARNING: FiberSection3dThermal failed to find the fiber with locy: "<<yi <<" , locZ: "<<zi <<endln;
+  }
+
+  return 0;
+}
+
+
 double
 FiberSection3dThermal::determineFiberTemperature(const Vector& DataMixed, double fiberLocy, double fiberLocz)
 {
@@ -38,6 +38,7 @@
 #include <SectionForceDeformation.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <FiberTemperatureStencil.h>
 
 class UniaxialMaterial;
 class Fiber;
@@ -96,6 +97,7 @@ class FiberSection3dThermal : public SectionForceDeformation
   protected:
 
   private:
+    int setFiberStencils(const Vector &dataMixed);
     int numFibers, sizeFibers;                   // number of fibers in the section
     UniaxialMaterial **theMaterials; // array of pointers to materials
     double   *matData;               // data for the materials [yloc and area]
@@ -124,6 +126,7 @@ class FiberSection3dThermal : public SectionForceDeformation
 	//double  *TemperatureTangent; // JZ  the E of E*A*alpha*DeltaT
     double *Fiber_T;  //An array storing the TempT of the fibers.
 	double *Fiber_TMax; //An array storing the TempTMax of the fibers.
+    FiberTemperatureStencil theStencil; // interpolation of the fiber temperatures
 
 };
 
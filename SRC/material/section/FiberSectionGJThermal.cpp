@@ -50,9 +50,9 @@ Matrix FiberSectionGJThermal::ks(4,4);
 // constructors:
 FiberSectionGJThermal::FiberSectionGJThermal(int tag, int num, Fiber **fibers, double gj):
   SectionForceDeformation(tag, SEC_TAG_FiberSectionGJThermal),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),dataMixed(25),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), ABar(0.0),
-  yBar(0.0), zBar(0.0), e(4), eCommit(4), GJ(gj),AverageThermalElong(3)
+  yBar(0.0), zBar(0.0), e(4), eCommit(4), GJ(gj), dataMixed(25), AverageThermalElong(3)
 {
   if (numFibers != 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -125,9 +125,9 @@ FiberSectionGJThermal::FiberSectionGJThermal(int tag, int num, Fiber **fibers, d
 
 FiberSectionGJThermal::FiberSectionGJThermal(int tag, int num, double gj):
   SectionForceDeformation(tag, SEC_TAG_FiberSectionGJThermal),
-  numFibers(0), sizeFibers(num), theMaterials(0), matData(0),dataMixed(25),
+  numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), ABar(0.0),
-  yBar(0.0), zBar(0.0), e(4), eCommit(4), GJ(gj),AverageThermalElong(3)
+  yBar(0.0), zBar(0.0), e(4), eCommit(4), GJ(gj), dataMixed(25), AverageThermalElong(3)
 {
   sData[0] = 0.0;
   sData[1] = 0.0;
@@ -157,9 +157,9 @@ FiberSectionGJThermal::FiberSectionGJThermal(int tag, int num, double gj):
 // constructor for blank object that recvSelf needs to be invoked upon
 FiberSectionGJThermal::FiberSectionGJThermal():
   SectionForceDeformation(0, SEC_TAG_FiberSectionGJThermal),
-  numFibers(0), sizeFibers(0), theMaterials(0), matData(0),dataMixed(25),
+  numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), ABar(0.0),
-  yBar(0.0), zBar(0.0), e(4), eCommit(4), GJ(1.0),AverageThermalElong(3)
+  yBar(0.0), zBar(0.0), e(4), eCommit(4), GJ(1.0), dataMixed(25), AverageThermalElong(3)
 {
   sData[0] = 0.0;
   sData[1] = 0.0;
@@ -289,6 +289,8 @@ FiberSectionGJThermal::setTrialSectionDeformation (const Vector &deforms)
 
   int loc = 0;
 
+  this->setFiberStencils();
+
   double d0 = deforms(0);
   double d1 = deforms(1);
   double d2 = deforms(2);
@@ -301,7 +303,7 @@ FiberSectionGJThermal::setTrialSectionDeformation (const Vector &deforms)
 	double FiberTemperature = 0 ; 
 	double FiberTempMax = 0;
 
-	FiberTemperature = this->determineFiberTemperature( dataMixed, -yi-yBar,zi+zBar);
+	FiberTemperature = this->getFiberTemperature(i);
 
 	//---Calculating the Fiber Temperature---end
 
@@ -433,6 +435,7 @@ FiberSectionGJThermal::getTemperatureStress(const Vector& DataMixed)
 {
    AverageThermalElong.Zero();
   dataMixed = DataMixed;
+  this->setFiberStencils();
 
   double ThermalTangent[1000];
   double DeltaThermalElong[1000];
@@ -446,18 +449,10 @@ FiberSectionGJThermal::getTemperatureStress(const Vector& DataMixed)
 
     UniaxialMaterial *theMat = theMaterials[i];
 
-	//double seefiberlocs1,seefiberlocs2;
-    //seefiberlocs1 = fiberLocsZ[i];
-	int jy;
-	int jz;
-    jy = i*3; //retrieve temp along y
-	jz = i*3+1; //retrieve temp along z
-	double yi = matData[jy];
-	double zi = matData[jz];
 	double FiberTemperature = 0 ; 
 	double FiberTempMax = 0;
 
-	FiberTemperature= this->determineFiberTemperature( dataMixed, -yi, zi);
+	FiberTemperature= this->getFiberTemperature(i);
     // determine material strain and set it
 	double tangent =0.0;
 	double ThermalElongation =0.0;
@@ -1034,6 +1029,75 @@ FiberSectionGJThermal::setZaxis(bool z_Axis)
     zAxis = z_Axis;
 }
 
+// find the interval of dataMixed holding each fiber, as determineFiberTemperature
+// does for the 18 and 25 entry data, and keep it with the interpolation weights
+int
+FiberSectionGJThermal::setFiberStencils(void)
+{
+  int size = dataMixed.Size();
+  if (size != 18 && size != 25)
+    return 0;
+
+  const int *locIdx = (size == 25) ? FiberTemperatureStencil::loc25 : FiberTemperatureStencil::loc18;
+  int numLocs = (size == 25) ? 10 : 9;
+
+  if (theStencil.needsUpdate(dataMixed, locIdx, numLocs, numFibers) == false)
+    return 0;
+
+  if (size == 18 && fabs(dataMixed(1)) <= 1e-10 && fabs(dataMixed(17)) <= 1e-10) //no tempe load
+    return 0;
+
+  const int *locY = FiberTemperatureStencil::loc25;
+  const int *locZ = &FiberTemperatureStencil::loc25[5];
+
+  for (int i = 0; i < numFibers; i++) {
+    double yi = -matData[3*i];
+    double zi = matData[3*i+1];
+    int res = 0;
+
+    if (size == 18)
+      res = theStencil.setInterpolation(i, dataMixed, FiberTemperatureStencil::loc18,
+					FiberTemperatureStencil::temp18, 9, yi);
+    else if (!zAxis) {
+      if (yi <= dataMixed(1))
+	res = theStencil.setInterpolation(i, dataMixed, locZ, FiberTemperatureStencil::bottomTemp25, 5, zi);
+      else if (yi <= dataMixed(9))
+	res = theStencil.setInterpolation(i, dataMixed, locY, FiberTemperatureStencil::temp18, 5, yi);
+      else
+	res = theStencil.setInterpolation(i, dataMixed, locZ, FiberTemperatureStencil::topTemp25, 5, zi);
+    }
+    else {
+      if (zi <= dataMixed(12))
+	res = theStencil.setInterpolation(i, dataMixed, locY, FiberTemperatureStencil::bottomTemp25, 5, yi);
+      else if (zi <= dataMixed(24))
+	res = theStencil.setInterpolation(i, dataMixed, locZ, FiberTemperatureStencil::temp18, 5, zi);
+      else
+	res = theStencil.setInterpolation(i, dataMixed, locY, FiberTemperatureStencil::topTemp25, 5, yi);
+    }
+
+    if (res < 0)
+      opserr << "WARNING: FiberSectionGJThermal " << this->getTag() << " failed to find the fiber with locy: "
+	     << yi << " , locZ: " << zi << endln;
+  }
+
+  return 0;
+}
+
+// temperature of fiber i for the current dataMixed
+double
+FiberSectionGJThermal::getFiberTemperature(int i)
+{
+  int size = dataMixed.Size();
+  if (size != 18 && size != 25)
+    return this->determineFiberTemperature(dataMixed, -matData[3*i], matData[3*i+1]);
+
+  if (size == 25 && fabs(dataMixed(0)) <= 1e-10 && fabs(dataMixed(10)) <= 1e-10 &&
+      fabs(dataMixed(11)) <= 1e-10) //no tempe load
+    return 0;
+
+  return theStencil.getTemperature(dataMixed, i);
+}
+
 double  
 FiberSectionGJThermal::determineFiberTemperature(const Vector& DataMixed, double fiberLocy, double fiberLocz) 
 {
@@ -36,6 +36,7 @@
 #include <SectionForceDeformation.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <FiberTemperatureStencil.h>
 
 class UniaxialMaterial;
 class Fiber;
@@ -89,6 +90,9 @@ class FiberSectionGJThermal : public SectionForceDeformation
  protected:
 
  private:
+  int setFiberStencils(void);
+  double getFiberTemperature(int i);
+
     int numFibers, sizeFibers;                   // number of fibers in the section
   UniaxialMaterial **theMaterials; // array of pointers to materials
   double *matData;               // data for the materials [yloc and area]
@@ -114,6 +118,7 @@ class FiberSectionGJThermal : public SectionForceDeformation
 	double *Fiber_ElongP;
 	Vector AverageThermalElong;
 	bool zAxis = false; // Added by Mhd Anwar Orabi 2021 for zAxis flag
+	FiberTemperatureStencil theStencil; // interpolation of the fiber temperatures
 
 };
 
@@ -0,0 +1,148 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// FiberTemperatureStencil.
+//
+// What: "@(#) FiberTemperatureStencil.cpp, revA"
+
+#include <FiberTemperatureStencil.h>
+#include <Vector.h>
+
+const int FiberTemperatureStencil::loc18[9] = {1, 3, 5, 7, 9, 11, 13, 15, 17};
+const int FiberTemperatureStencil::temp18[9] = {0, 2, 4, 6, 8, 10, 12, 14, 16};
+const int FiberTemperatureStencil::loc25[10] = {1, 3, 5, 7, 9, 12, 15, 18, 21, 24};
+const int FiberTemperatureStencil::bottomTemp25[5] = {10, 13, 16, 19, 22};
+const int FiberTemperatureStencil::topTemp25[5] = {11, 14, 17, 20, 23};
+
+FiberTemperatureStencil::FiberTemperatureStencil()
+  :numFibers(0), sizeFibers(0), index(0), weight(0),
+   sizeData(-1), numLocs(0), sizeLocs(0), locIndex(0), locs(0)
+{
+
+}
+
+FiberTemperatureStencil::~FiberTemperatureStencil()
+{
+  if (index != 0)
+    delete [] index;
+  if (weight != 0)
+    delete [] weight;
+  if (locIndex != 0)
+    delete [] locIndex;
+  if (locs != 0)
+    delete [] locs;
+}
+
+bool
+FiberTemperatureStencil::needsUpdate(const Vector &DataMixed, const int *locIdx, int nLocs, int nFibers)
+{
+  bool changed = (nFibers != numFibers || DataMixed.Size() != sizeData || nLocs != numLocs);
+  for (int j = 0; j < nLocs && changed == false; j++)
+    if (locIdx[j] != locIndex[j] || DataMixed(locIdx[j]) != locs[j])
+      changed = true;
+
+  if (changed == false)
+    return false;
+
+  if (nFibers > sizeFibers) {
+    if (index != 0)
+      delete [] index;
+    if (weight != 0)
+      delete [] weight;
+    index = new int[2*nFibers];
+    weight = new double[2*nFibers];
+    sizeFibers = nFibers;
+  }
+  numFibers = nFibers;
+  for (int i = 0; i < 2*numFibers; i++) {
+    index[i] = 0;
+    weight[i] = 0.0;
+  }
+
+  if (nLocs > sizeLocs) {
+    if (locIndex != 0)
+      delete [] locIndex;
+    if (locs != 0)
+      delete [] locs;
+    locIndex = new int[nLocs];
+    locs = new double[nLocs];
+    sizeLocs = nLocs;
+  }
+  numLocs = nLocs;
+  for (int j = 0; j < numLocs; j++) {
+    locIndex[j] = locIdx[j];
+    locs[j] = DataMixed(locIdx[j]);
+  }
+  sizeData = DataMixed.Size();
+
+  return true;
+}
+
+int
+FiberTemperatureStencil::setInterpolation(int i, const Vector &DataMixed, const int *locIdx,
+					  const int *tempIdx, int n, double loc)
+{
+  if (loc <= DataMixed(locIdx[0]))
+    return -1;
+
+  for (int j = 1; j < n; j++) {
+    double loc1 = DataMixed(locIdx[j]);
+    if (loc <= loc1) {
+      double loc0 = DataMixed(locIdx[j-1]);
+      double w = (loc - loc0)/(loc1 - loc0);
+      index[2*i] = tempIdx[j-1];
+      index[2*i+1] = tempIdx[j];
+      weight[2*i] = 1.0 - w;
+      weight[2*i+1] = w;
+      return 0;
+    }
+  }
+
+  return -1;
+}
+
+void
+FiberTemperatureStencil::setConstant(int i, int tempIdx)
+{
+  this->setWeights(i, tempIdx, 1.0, tempIdx, 0.0);
+}
+
+void
+FiberTemperatureStencil::setWeights(int i, int i0, double w0, int i1, double w1)
+{
+  index[2*i] = i0;
+  index[2*i+1] = i1;
+  weight[2*i] = w0;
+  weight[2*i+1] = w1;
+}
+
+double
+FiberTemperatureStencil::getTemperature(const Vector &DataMixed, int i)
+{
+  return weight[2*i]*DataMixed(index[2*i]) + weight[2*i+1]*DataMixed(index[2*i+1]);
+}
+
+void
+FiberTemperatureStencil::getTemperatures(const Vector &DataMixed, double *fiberT)
+{
+  for (int i = 0; i < numFibers; i++)
+    fiberT[i] = weight[2*i]*DataMixed(index[2*i]) + weight[2*i+1]*DataMixed(index[2*i+1]);
+}
@@ -0,0 +1,90 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for
+// FiberTemperatureStencil. The thermal sections find the temperature of a
+// fiber by locating it between the points of the temperature data vector
+// (DataMixed) of their thermal load and interpolating linearly. The fibers
+// do not move and the locations in DataMixed stay the same from step to
+// step, only the temperatures change, so the interval and the weights are
+// found once per fiber and kept here. The temperature of every fiber is
+// then w0*DataMixed(i0) + w1*DataMixed(i1).
+//
+// What: "@(#) FiberTemperatureStencil.h, revA"
+
+#ifndef FiberTemperatureStencil_h
+#define FiberTemperatureStencil_h
+
+class Vector;
+
+class FiberTemperatureStencil
+{
+  public:
+    FiberTemperatureStencil();
+    ~FiberTemperatureStencil();
+
+    // true if the stencils have to be (re)built, i.e. the number of fibers,
+    // the size of DataMixed or any of its location entries locIdx have
+    // changed since the last call; the stencils are then all set to zero
+    bool needsUpdate(const Vector &DataMixed, const int *locIdx, int numLocs, int numFibers);
+
+    // set the stencil of fiber i to the interpolation at loc along the
+    // points (DataMixed(locIdx[j]), DataMixed(tempIdx[j])), j = 0..n-1, loc
+    // being in (DataMixed(locIdx[0]), DataMixed(locIdx[n-1])]; returns -1
+    // and leaves the stencil at zero if loc is outside
+    int setInterpolation(int i, const Vector &DataMixed, const int *locIdx,
+			 const int *tempIdx, int n, double loc);
+    // set the temperature of fiber i to DataMixed(tempIdx)
+    void setConstant(int i, int tempIdx);
+    // set the temperature of fiber i to w0*DataMixed(i0) + w1*DataMixed(i1)
+    void setWeights(int i, int i0, double w0, int i1, double w1);
+
+    double getTemperature(const Vector &DataMixed, int i);
+    // the temperatures of all the fibers
+    void getTemperatures(const Vector &DataMixed, double *fiberT);
+
+    // the points of the 18 entry data (T1, y1, ... T9, y9), and of the
+    // 25 entry data: y1..y5 then z1..z5 as locations, with the web (T1..T5),
+    // bottom and top flange temperatures
+    static const int loc18[9];
+    static const int temp18[9];
+    static const int loc25[10];
+    static const int bottomTemp25[5];
+    static const int topTemp25[5];
+
+  protected:
+
+  private:
+    FiberTemperatureStencil(const FiberTemperatureStencil &);
+    FiberTemperatureStencil &operator=(const FiberTemperatureStencil &);
+
+    int numFibers;
+    int sizeFibers;
+    int *index;      // i0, i1 of each fiber
+    double *weight;  // w0, w1 of each fiber
+
+    int sizeData;
+    int numLocs;
+    int sizeLocs;
+    int *locIndex;
+    double *locs;    // DataMixed(locIndex[j]) at the last build
+};
+
+#endif
@@ -180,7 +180,7 @@ const double  LayeredShellFiberSectionThermal::root56 = 1 ; //shear correction
 //null constructor
 LayeredShellFiberSectionThermal::LayeredShellFiberSectionThermal( ) : 
 SectionForceDeformation( 0, SEC_TAG_LayeredShellFiberSectionThermal ), 
-strainResultant(8), nLayers(0),countnGauss(0),AverageThermalMomentP(0), AverageThermalForceP(0),sT(0), ThermalElongation(0), Offset(0), AverageThermalElongP(0)
+nLayers(0), Offset(0), strainResultant(8), sT(0), ThermalElongation(0), countnGauss(0), AverageThermalForceP(0), AverageThermalMomentP(0), AverageThermalElongP(0)
 {
 
 }
@@ -192,7 +192,7 @@ LayeredShellFiberSectionThermal::LayeredShellFiberSectionThermal(
                                    double *thickness, 
                                    NDMaterial **fibers, double offset) :
 SectionForceDeformation( tag, SEC_TAG_LayeredShellFiberSectionThermal ),
-strainResultant(8), countnGauss(0), AverageThermalMomentP(0), AverageThermalForceP(0),sT(0), ThermalElongation(0), Offset(offset), AverageThermalElongP(0)
+Offset(offset), strainResultant(8), sT(0), ThermalElongation(0), countnGauss(0), AverageThermalForceP(0), AverageThermalMomentP(0), AverageThermalElongP(0)
 {
   this->nLayers = iLayers;
   sg = new double[iLayers];
@@ -242,8 +242,8 @@ LayeredShellFiberSectionThermal::LayeredShellFiberSectionThermal(
     double* thickness, double* loc,
     NDMaterial** fibers, double flath, double ribh, double ribangle):
     SectionForceDeformation(tag, SEC_TAG_LayeredShellFiberSectionThermal),
-    strainResultant(8), countnGauss(0), AverageThermalMomentP(0), AverageThermalForceP(0), 
-    sT(0), ThermalElongation(0), Offset(0), AverageThermalElongP(0),flatH (flath), ribH(ribh),ribAng(ribangle)
+    Offset(0), flatH(flath), ribH(ribh), ribAng(ribangle), strainResultant(8),
+    sT(0), ThermalElongation(0), countnGauss(0), AverageThermalForceP(0), AverageThermalMomentP(0), AverageThermalElongP(0)
 {
     this->nLayers = iLayers;
     ti = new double[iLayers];
@@ -582,50 +582,15 @@ LayeredShellFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
   AverageThermalElongP = 0.0;
   //double *thickness = new double[nLayers];
 
+  this->setFiberStencils(dataMixed);
+
   for (int i = 0; i < nLayers; i++) {
 	  
 	double thickness = ti[i];
 
-    double yi = loci[i] - Offset;
-     //double yi = (0.5 * h) * sg[i];
-
 	double tangent, elongation;
 
-    int matType =0;
-    if (ribH > 1e-6 && flatH > 1e-6) {
-        //composite section with rib
-        const char* layerType = theFibers[i]->getType();
-        if (strcmp(layerType,"PlateFiberThermal")==0) {
-            matType = 0;
-        }
-        else{
-            if (yi > -flatH / 2.0) {
-                //steel rebars in the flat part
-                if (strcmp(layerType,"PlateFiberThermalSteel")==0)
-                    matType = 1;
-                else if (strcmp(layerType, "PlateRebarThermalPar")==0) {
-                    if (ribAng < 1e-4)
-                        matType = 20; //steel rebar is parallel to the ribs;   matType = 20;
-                    else if (ribAng - 90 < 1e-4 && ribAng - 90 > -1e-4)
-                        matType = 21; //steel rebar is perpendicular to the ribs; 21
-                }
-                else if (strcmp(layerType, "PlateRebarThermalPer")==0) {
-                    if (ribAng < 1e-4)
-                        matType = 21; //steel rebar is perpendicular to the ribs;  21
-                    else if (ribAng - 90 < 1e-4 && ribAng - 90 > -1e-4)
-                        matType = 20; //steel rebar is parallel to the ribs;
-                }
-                else
-                    opserr << "LayeredShellThermal can not identify matType" << endln;
-            }
-            else {
-                    matType = 3; // profile steel
-            }
-        }
-    }
-    
-
-	FiberTemperature = this->determineFiberTemperature( dataMixed, yi, matType);
+	FiberTemperature = theStencil.getTemperature(dataMixed, i);
 
 	theFibers[i]->getThermalTangentAndElongation(FiberTemperature, tangent, elongation);
 
@@ -1039,6 +1004,80 @@ LayeredShellFiberSectionThermal::recvSelf(int commitTag, Channel &theChannel, FE
 
 
 
+// find the interval of dataMixed holding each layer, as determineFiberTemperature
+// does, and keep it with the interpolation weights; the layers and the locations
+// in dataMixed do not change between calls so this is only done when they do
+int
+LayeredShellFiberSectionThermal::setFiberStencils(const Vector& dataMixed)
+{
+  if (theStencil.needsUpdate(dataMixed, FiberTemperatureStencil::loc18, 9, nLayers) == false)
+    return 0;
+
+  for (int i = 0; i < nLayers; i++) {
+
+    double yi = loci[i] - Offset;
+
+    int matType =0;
+    if (ribH > 1e-6 && flatH > 1e-6) {
+        //composite section with rib
+        const char* layerType = theFibers[i]->getType();
+        if (strcmp(layerType,"PlateFiberThermal")==0) {
+            matType = 0;
+        }
+        else{
+            if (yi > -flatH / 2.0) {
+                //steel rebars in the flat part
+                if (strcmp(layerType,"PlateFiberThermalSteel")==0)
+                    matType = 1;
+                else if (strcmp(layerType, "PlateRebarThermalPar")==0) {
+                    if (ribAng < 1e-4)
+                        matType = 20; //steel rebar is parallel to the ribs;   matType = 20;
+                    else if (ribAng - 90 < 1e-4 && ribAng - 90 > -1e-4)
+                        matType = 21; //steel rebar is perpendicular to the ribs; 21
+                }
+                else if (strcmp(layerType, "PlateRebarThermalPer")==0) {
+                    if (ribAng < 1e-4)
+                        matType = 21; //steel rebar is perpendicular to the ribs;  21
+                    else if (ribAng - 90 < 1e-4 && ribAng - 90 > -1e-4)
+                        matType = 20; //steel rebar is parallel to the ribs;
+                }
+                else
+                    opserr << "LayeredShellThermal can not identify matType" << endln;
+            }
+            else {
+                    matType = 3; // profile steel
+            }
+        }
+    }
+
+    if (yi < dataMixed(1) || yi > dataMixed(17)) {
+        opserr << "LayeredShellFiberSectionThermal::setFiberStencils -- fiber loc: "<<yi<<" is out of the section range "<< dataMixed(1) <<", "<< dataMixed(17) <<endln;
+        continue;
+    }
+
+    if (matType == 3) {
+        //for steel profile
+        theStencil.setConstant(i, 0);
+        continue;
+    }
+
+    double loc = yi;
+    if (matType == 20)
+        loc = yi - ribH;  //for steel layer in flat section
+
+    // the first interval also takes the points below it
+    if (loc <= dataMixed(3)) {
+        double w = (loc - dataMixed(1)) / (dataMixed(3) - dataMixed(1));
+        theStencil.setWeights(i, 0, 1.0 - w, 2, w);
+    }
+    else
+        theStencil.setInterpolation(i, dataMixed, FiberTemperatureStencil::loc18,
+                                    FiberTemperatureStencil::temp18, 9, loc);
+  }
+
+  return 0;
+}
+
 double
 LayeredShellFiberSectionThermal::determineFiberTemperature(const Vector& DataMixed, double fiberLoc, int matType)
 {
@@ -42,6 +42,7 @@ Earthquake Engineering & Structural Dynamics, 2013, 42(5): 705-723*/
 #include <NDMaterial.h>
 
 #include <SectionForceDeformation.h>
+#include <FiberTemperatureStencil.h>
 
 
 class LayeredShellFiberSectionThermal : public SectionForceDeformation{
@@ -120,7 +121,8 @@ class LayeredShellFiberSectionThermal : public SectionForceDeformation{
 
 
   private :
-    
+    int setFiberStencils(const Vector& dataMixed);
+
     int nLayers;
     //quadrature data
     double *sg;
@@ -151,6 +153,7 @@ class LayeredShellFiberSectionThermal : public SectionForceDeformation{
 	double AverageThermalForceP ;
 	double AverageThermalMomentP;
     double AverageThermalElongP;
+    FiberTemperatureStencil theStencil; // interpolation of the layer temperatures
 
 } ; //end of LayeredShellFiberSectionThermal declarations
 
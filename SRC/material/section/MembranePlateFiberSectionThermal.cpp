@@ -333,6 +333,34 @@ const Vector&  MembranePlateFiberSectionThermal::getStressResultant( )
 
    return this->stressResultant ;
 }
+// find the interval of dataMixed holding each of the five fibers and keep it
+// with the interpolation weights, they only change with the locations in dataMixed
+int
+MembranePlateFiberSectionThermal::setFiberStencils(const Vector& dataMixed)
+{
+  if (theStencil.needsUpdate(dataMixed, FiberTemperatureStencil::loc18, 9, 5) == false)
+    return 0;
+
+  if ( fabs(dataMixed(1)) <= 1e-10 && fabs(dataMixed(17)) <= 1e-10 ) //no tempe load
+    return 0;
+
+  for (int i = 0; i < 5; i++) {
+    double yi = ( 0.5*h ) * sg[i] ;
+
+    if (yi < dataMixed(1))
+      opserr <<"MembranePlateFiberSectionThermal::setFiberStencils -- fiber loc is out of the section" << endln;
+    else if (yi <= dataMixed(3)) {
+      double w = (yi - dataMixed(1)) / (dataMixed(3) - dataMixed(1));
+      theStencil.setWeights(i, 0, 1.0 - w, 2, w);
+    }
+    else
+      theStencil.setInterpolation(i, dataMixed, FiberTemperatureStencil::loc18,
+				  FiberTemperatureStencil::temp18, 9, yi);
+  }
+
+  return 0;
+}
+
 const Vector&
 MembranePlateFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
 {
@@ -350,60 +378,12 @@ MembranePlateFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
   }
   double FiberTemperature = 0 ;
   double tangent, elongation;
-  for (int i = 0; i < 5; i++) {
 
-    double yi = ( 0.5*h ) * sg[i] ;;
-    
-	 
-	if ( fabs(dataTempe[1]) <= 1e-10 && fabs(dataTempe[17]) <= 1e-10 ) 
-	{
-		FiberTemperature = 0;
-	}
-	else
-	{
-	//caculate the fiber tempe, T=T1-(Y-Y1)*(T1-T2)/(Y1-Y2)
-	if (  yi < dataTempe[1]) 
-	{
-		opserr <<"MembranePlateFiberSectionThermal::setTrialSectionDeformationup -- fiber loc is out of the section";
-	}
-	else if (yi <= dataTempe[3])
-	{
-		FiberTemperature = dataTempe[0] - (dataTempe[1] - yi) * (dataTempe[0] - dataTempe[2])/(dataTempe[1] - dataTempe[3]);
-	}
-	else if (   yi <= dataTempe[5] )
-	{
-		FiberTemperature = dataTempe[2] - (dataTempe[3] - yi) * (dataTempe[2] - dataTempe[4])/(dataTempe[3] - dataTempe[5]);
-	}
-	else if ( yi <= dataTempe[7] )
-	{
-		FiberTemperature = dataTempe[4] - (dataTempe[5] - yi) * (dataTempe[4] - dataTempe[6])/(dataTempe[5] - dataTempe[7]);
-	}
-	else if ( yi <= dataTempe[9] )
-	{
-		FiberTemperature = dataTempe[6] - (dataTempe[7] - yi) * (dataTempe[6] - dataTempe[8])/(dataTempe[7] - dataTempe[9]);
-	}
-	else if (yi <= dataTempe[11] )
-	{
-		FiberTemperature = dataTempe[8] - (dataTempe[9] - yi) * (dataTempe[8] - dataTempe[10])/(dataTempe[9] - dataTempe[11]);
-	}
-	else if (yi <= dataTempe[13] )
-	{
-		FiberTemperature = dataTempe[10] - (dataTempe[11] - yi) * (dataTempe[10] - dataTempe[12])/(dataTempe[11] - dataTempe[13]);
-	}
-	else if (yi <= dataTempe[15] )
-	{
-		FiberTemperature = dataTempe[12] - (dataTempe[13] - yi) * (dataTempe[12] - dataTempe[14])/(dataTempe[13] - dataTempe[15]);
-	}
-	else if ( yi <= dataTempe[17] )
-	{
-		FiberTemperature = dataTempe[14] - (dataTempe[15] - yi) * (dataTempe[14] - dataTempe[16])/(dataTempe[15] - dataTempe[17]);
-	}
+  this->setFiberStencils(dataMixed);
 
-	else 
-	{
-		//opserr <<"MembranePlateFiberSectionThermal::setTrialSectionDeformationdown -- fiber loc is out of the section";
-	}
-	}
+  for (int i = 0; i < 5; i++) {
+
+	FiberTemperature = theStencil.getTemperature(dataMixed, i);
 
     // determine material strain and set it
     double tangent, elongation;
@@ -38,6 +38,7 @@
 #include <NDMaterial.h>
 
 #include <SectionForceDeformation.h>
+#include <FiberTemperatureStencil.h>
 
 
 class MembranePlateFiberSectionThermal : public SectionForceDeformation{
@@ -109,6 +110,7 @@ class MembranePlateFiberSectionThermal : public SectionForceDeformation{
 
 
   private :
+    int setFiberStencils(const Vector& dataMixed);
 
     //quadrature data
     static const double sg[5] ;
@@ -133,6 +135,7 @@ class MembranePlateFiberSectionThermal : public SectionForceDeformation{
 	double  ThermalElongation[5]; // Temperature dependent elasticity modulus
 	int countnGauss;
 	double ThermalGradientShink;
+	FiberTemperatureStencil theStencil; // interpolation of the fiber temperatures
 
 } ; //end of MembranePlateFiberSectionThermal declarations
 
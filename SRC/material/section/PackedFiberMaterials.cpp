@@ -0,0 +1,90 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// PackedFiberMaterials.
+//
+// What: "@(#) PackedFiberMaterials.cpp, revA"
+
+#include <PackedFiberMaterials.h>
+#include <UniaxialMaterial.h>
+#include <OPS_Globals.h>
+
+PackedFiberMaterials::PackedFiberMaterials(int num, UniaxialMaterial **theMaterials)
+  :numFibers(num), numMaterials(0), materials(0), matIndex(0), offset(0), numRefs(1)
+{
+  materials = new UniaxialMaterial *[numFibers > 0 ? numFibers : 1];
+  matIndex = new int[numFibers > 0 ? numFibers : 1];
+  offset = new int[numFibers+1];
+
+  bool packable = true;
+  offset[0] = 0;
+  for (int i = 0; i < numFibers; i++) {
+    UniaxialMaterial *theMat = theMaterials[i];
+
+    // a section has few distinct materials, a linear search will do
+    int j = 0;
+    while (j < numMaterials && (materials[j]->getTag() != theMat->getTag() ||
+				materials[j]->getClassTag() != theMat->getClassTag()))
+      j++;
+
+    if (j == numMaterials) {
+      materials[j] = theMat->getCopy();
+      numMaterials++;
+    }
+    matIndex[i] = j;
+
+    int size = materials[j]->getPackedStateSize();
+    if (size <= 0)
+      packable = false;
+    offset[i+1] = offset[i] + size;
+  }
+
+  if (packable == false)
+    offset[numFibers] = 0;
+}
+
+PackedFiberMaterials::~PackedFiberMaterials()
+{
+  for (int j = 0; j < numMaterials; j++)
+    delete materials[j];
+
+  delete [] materials;
+  delete [] matIndex;
+  delete [] offset;
+}
+
+int
+PackedFiberMaterials::revertToStart(double *state)
+{
+  int err = 0;
+  for (int i = 0; i < numFibers; i++)
+    err += materials[matIndex[i]]->revertToStartPacked(&state[offset[i]]);
+
+  return err;
+}
+
+void
+PackedFiberMaterials::detach(void)
+{
+  numRefs--;
+  if (numRefs <= 0)
+    delete this;
+}
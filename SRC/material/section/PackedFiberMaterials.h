@@ -0,0 +1,77 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for
+// PackedFiberMaterials. The fibers of a section usually each get their own
+// copy of a material, parameters included, although many fibers (and all
+// the copies of the section along the elements) use the same few
+// materials. With PackedFiberMaterials there is one copy of each distinct
+// material (by tag and class), shared by all the fibers using it and by
+// all the copies of the section; the history of each fiber is kept by the
+// section in a block of doubles (see UniaxialMaterial::setTrialPacked),
+// the blocks of all the fibers being contiguous.
+//
+// What: "@(#) PackedFiberMaterials.h, revA"
+
+#ifndef PackedFiberMaterials_h
+#define PackedFiberMaterials_h
+
+class UniaxialMaterial;
+
+class PackedFiberMaterials
+{
+  public:
+    // theMaterials[i] is the material of fiber i; getStateSize() is 0 if
+    // one of them does not support the packed state
+    PackedFiberMaterials(int numFibers, UniaxialMaterial **theMaterials);
+    ~PackedFiberMaterials();
+
+    int getNumFibers(void) {return numFibers;}
+    int getNumMaterials(void) {return numMaterials;}
+    // the size of the state of all the fibers
+    int getStateSize(void) {return offset[numFibers];}
+
+    // the shared material of fiber i and the start of its state block
+    UniaxialMaterial *getMaterial(int i) {return materials[matIndex[i]];}
+    int getOffset(int i) {return offset[i];}
+
+    // set the state of all the fibers to their initial state
+    int revertToStart(double *state);
+
+    // the sections sharing the materials; the last one to detach
+    // deletes them
+    void attach(void) {numRefs++;}
+    void detach(void);
+
+  protected:
+
+  private:
+    PackedFiberMaterials(const PackedFiberMaterials &);
+    PackedFiberMaterials &operator=(const PackedFiberMaterials &);
+
+    int numFibers;
+    int numMaterials;
+    UniaxialMaterial **materials;  // the distinct materials
+    int *matIndex;                 // the material of each fiber
+    int *offset;                   // start of the state of each fiber, numFibers+1
+    int numRefs;
+};
+
+#endif
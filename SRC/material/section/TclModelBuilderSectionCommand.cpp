@@ -1789,7 +1789,7 @@ static bool currentSectionIsWarping = false;
     
 int
 buildSection(Tcl_Interp *interp, TclModelBuilder *theTclModelBuilder,
-	     int secTag, bool isTorsion, double GJ);
+	     int secTag, bool isTorsion, double GJ, bool isPacked);
 
 int
 buildSectionInt(Tcl_Interp *interp, TclModelBuilder *theTclModelBuilder,
@@ -1849,6 +1849,15 @@ TclCommand_addFiberSection (ClientData clientData, Tcl_Interp *interp, int argc,
       brace = 5;
     }
 
+    // the fibers share the materials and keep only their state
+    bool isPacked = false;
+    if (brace < argc-1 && strcmp(argv[brace],"-packed") == 0) {
+      isPacked = true;
+      brace++;
+      if (theTclModelBuilder->getNDM() != 3 || currentSectionIsND)
+	opserr << "WARNING -packed is only available for 3d uniaxial fiber sections, ignored\n";
+    }
+
     // parse the information inside the braces (patches and reinforcing layers)
     if (Tcl_Eval(interp, argv[brace]) != TCL_OK) {
 	opserr << "WARNING - error reading information in { } \n";
@@ -1856,7 +1865,7 @@ TclCommand_addFiberSection (ClientData clientData, Tcl_Interp *interp, int argc,
     }
 
     // build the fiber section (for analysis)
-    if (buildSection(interp, theTclModelBuilder, secTag, isTorsion, GJ) != TCL_OK) {
+    if (buildSection(interp, theTclModelBuilder, secTag, isTorsion, GJ, isPacked) != TCL_OK) {
 	opserr << "WARNING - error constructing the section\n";
 	return TCL_ERROR;
     }
@@ -2838,7 +2847,7 @@ TclCommand_addReinfLayer(ClientData clientData, Tcl_Interp *interp, int argc,
 // build the section
 int 
 buildSection(Tcl_Interp *interp, TclModelBuilder *theTclModelBuilder,
-	     int secTag, bool isTorsion, double GJ)
+	     int secTag, bool isTorsion, double GJ, bool isPacked)
 {
    SectionRepres *sectionRepres = theTclModelBuilder->getSectionRepres(secTag);
    if (sectionRepres == 0) 
@@ -3083,6 +3092,9 @@ buildSection(Tcl_Interp *interp, TclModelBuilder *theTclModelBuilder,
             opserr <<  "WARNING - cannot construct section\n";
             return TCL_ERROR;
          }
+
+	 if (isPacked && !currentSectionIsND)
+	   ((FiberSection3d *)section)->packMaterials();
        
          //if (theTclModelBuilder->addSection (*section) < 0) {
 	 if (OPS_addSectionForceDeformation(section) != true) {
@@ -60,6 +60,8 @@ class Concrete01 : public UniaxialMaterial
   int commitState(void);
   int revertToLastCommit(void);    
   int revertToStart(void);        
+
+  bool isThreadSafe(void) {return true;}
   
   UniaxialMaterial *getCopy(void);
   
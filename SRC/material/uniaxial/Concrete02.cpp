@@ -131,21 +131,54 @@ Concrete02::getInitialTangent(void)
 
 int
 Concrete02::setTrialStrain(double trialStrain, double strainRate)
+{
+  double hstvP[5];
+  double hstv[5];
+
+  hstvP[0] = epsP;
+  hstvP[1] = sigP;
+  hstvP[2] = eP;
+  hstvP[3] = ecminP;
+  hstvP[4] = deptP;
+
+  hstv[1] = sig;
+  hstv[2] = e;
+
+  this->setTrialState(trialStrain, hstvP, hstv);
+
+  eps = hstv[0];
+  sig = hstv[1];
+  e = hstv[2];
+  ecmin = hstv[3];
+  dept = hstv[4];
+
+  return 0;
+}
+
+void
+Concrete02::setTrialState(double trialStrain, const double *hstvP, double *hstv) const
 {
   double  ec0 = fc * 2. / epsc0;
 
   // retrieve concrete hitory variables
 
-  ecmin = ecminP;
-  dept = deptP;
+  double ecmin = hstvP[3];
+  double dept = hstvP[4];
 
   // calculate current strain
 
-  eps = trialStrain;
-  double deps = eps - epsP;
+  double eps = trialStrain;
+  double deps = eps - hstvP[0];
+
+  hstv[0] = eps;
+  hstv[3] = ecmin;
+  hstv[4] = dept;
 
   if (fabs(deps) < DBL_EPSILON)
-    return 0;
+    return;
+
+  double sigP = hstvP[1];
+  double sig, e;
 
   // if the current strain is less than the smallest previous strain 
   // call the monotonic envelope in compression and reset minimum strain 
@@ -227,6 +260,34 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
     }
   }
 
+  hstv[1] = sig;
+  hstv[2] = e;
+  hstv[3] = ecmin;
+  hstv[4] = dept;
+}
+
+int
+Concrete02::getPackedStateSize(void)
+{
+  return 5;
+}
+
+int
+Concrete02::revertToStartPacked(double *state)
+{
+  state[0] = 0.0;
+  state[1] = 0.0;
+  state[2] = 2.0*fc/epsc0;
+  state[3] = 0.0;
+  state[4] = 0.0;
+
+  return 0;
+}
+
+int
+Concrete02::setTrialPacked(double strain, const double *committedState, double *trialState)
+{
+  this->setTrialState(strain, committedState, trialState);
   return 0;
 }
 
@@ -372,7 +433,7 @@ Concrete02::Print(OPS_Stream &s, int flag)
 
 
 void
-Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
+Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect) const
 {
 /*-----------------------------------------------------------------------
 ! monotonic envelope of concrete in tension (positive envelope)
@@ -409,7 +470,7 @@ Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
 
   
 void
-Concrete02::Compr_Envlp (double epsc, double &sigc, double &Ect) 
+Concrete02::Compr_Envlp (double epsc, double &sigc, double &Ect) const
 {
 /*-----------------------------------------------------------------------
 ! monotonic envelope of concrete in compression (negative envelope)
@@ -64,6 +64,11 @@ class Concrete02 : public UniaxialMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+
+    // packed state: eps, sig, e, ecmin and dept
+    int getPackedStateSize(void);
+    int revertToStartPacked(double *state);
+    int setTrialPacked(double strain, const double *committedState, double *trialState);
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -76,8 +81,13 @@ class Concrete02 : public UniaxialMaterial
  protected:
     
  private:
-    void Tens_Envlp (double epsc, double &sigc, double &Ect);
-    void Compr_Envlp (double epsc, double &sigc, double &Ect);
+    void Tens_Envlp (double epsc, double &sigc, double &Ect) const;
+    void Compr_Envlp (double epsc, double &sigc, double &Ect) const;
+
+    // the state determination, from the committed history variables
+    // hstvP to the trial ones hstv, both in the packed layout; the trial
+    // stress and tangent are left as they are when the strain is unchanged
+    void setTrialState(double trialStrain, const double *hstvP, double *hstv) const;
 
     // matpar : Concrete FIXED PROPERTIES
     double fc;    // concrete compression strength           : mp(1)
@@ -61,6 +61,8 @@ class ElasticMaterial : public UniaxialMaterial
     int revertToLastCommit(void);    
     int revertToStart(void);        
 
+    bool isThreadSafe(void) {return true;}
+
     UniaxialMaterial *getCopy(void);
     
     int sendSelf(int commitTag, Channel &theChannel);  
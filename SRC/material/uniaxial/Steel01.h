@@ -68,6 +68,8 @@ class Steel01 : public UniaxialMaterial
     int revertToLastCommit(void);    
     int revertToStart(void);        
 
+    bool isThreadSafe(void) {return true;}
+
     UniaxialMaterial *getCopy(void);
     
     int sendSelf(int commitTag, Channel &theChannel);  
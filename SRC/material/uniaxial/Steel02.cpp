@@ -247,10 +247,50 @@ Steel02::getInitialTangent(void)
 
 int
 Steel02::setTrialStrain(double trialStrain, double strainRate)
+{
+  double hstvP[11];
+  double hstv[11];
+
+  hstvP[0] = epsP;
+  hstvP[1] = sigP;
+  hstvP[2] = eP;
+  hstvP[3] = epsminP;
+  hstvP[4] = epsmaxP;
+  hstvP[5] = epsplP;
+  hstvP[6] = epss0P;
+  hstvP[7] = sigs0P;
+  hstvP[8] = epssrP;
+  hstvP[9] = sigsrP;
+  hstvP[10] = konP;
+
+  this->setTrialState(trialStrain, hstvP, hstv);
+
+  eps = hstv[0];
+  sig = hstv[1];
+  e = hstv[2];
+  epsmin = hstv[3];
+  epsmax = hstv[4];
+  epspl = hstv[5];
+  epss0 = hstv[6];
+  sigs0 = hstv[7];
+  epsr = hstv[8];
+  sigr = hstv[9];
+  kon = (int)hstv[10];
+
+  return 0;
+}
+
+void
+Steel02::setTrialState(double trialStrain, const double *hstvP, double *hstv) const
 {
   double Esh = b * E0;
   double epsy = Fy / E0;
 
+  double epsP = hstvP[0];
+  double sigP = hstvP[1];
+
+  double eps, sig, e;
+
   // modified C-P. Lamarche 2006
   if (sigini != 0.0) {
     double epsini = sigini/E0;
@@ -261,27 +301,24 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
   double deps = eps - epsP;
   
-  epsmax = epsmaxP;
-  epsmin = epsminP;
-  epspl  = epsplP;
-  epss0  = epss0P;  
-  sigs0  = sigs0P; 
-  epsr   = epssrP;  
-  sigr   = sigsrP;  
-  kon = konP;
+  double epsmin = hstvP[3];
+  double epsmax = hstvP[4];
+  double epspl  = hstvP[5];
+  double epss0  = hstvP[6];
+  double sigs0  = hstvP[7];
+  double epsr   = hstvP[8];
+  double sigr   = hstvP[9];
+  int kon = (int)hstvP[10];
 
-  if (kon == 0 || kon == 3) { // modified C-P. Lamarche 2006
+  if ((kon == 0 || kon == 3) && fabs(deps) < 10.0*DBL_EPSILON) { // modified C-P. Lamarche 2006
 
+    e = E0;
+    sig = sigini;                // modified C-P. Lamarche 2006
+    kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
 
-    if (fabs(deps) < 10.0*DBL_EPSILON) {
-
-      e = E0;
-      sig = sigini;                // modified C-P. Lamarche 2006
-      kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
-      return 0;
-
-    } else {
+  } else {
 
+    if (kon == 0 || kon == 3) {
       epsmax = epsy;
       epsmin = -epsy;
       if (deps < 0.0) {
@@ -296,69 +333,110 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 	epspl = epsmax;
       }
     }
-  }
-  
-  // in case of load reversal from negative to positive strain increment, 
-  // update the minimum previous strain, store the last load reversal 
-  // point and calculate the stress and strain (sigs0 and epss0) at the 
-  // new intersection between elastic and strain hardening asymptote 
-  // To include isotropic strain hardening shift the strain hardening 
-  // asymptote by sigsft before calculating the intersection point 
-  // Constants a3 and a4 control this stress shift on the tension side 
   
-  if (kon == 2 && deps > 0.0) {
-
-
-    kon = 1;
-    epsr = epsP;
-    sigr = sigP;
-    //epsmin = min(epsP, epsmin);
-    if (epsP < epsmin)
-      epsmin = epsP;
-    double d1 = (epsmax - epsmin) / (2.0*(a4 * epsy));
-    double shft = 1.0 + a3 * pow(d1, 0.8);
-    epss0 = (Fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = Fy * shft + Esh * (epss0 - epsy * shft);
-    epspl = epsmax;
-
-  } else if (kon == 1 && deps < 0.0) {
-    
-    // update the maximum previous strain, store the last load reversal 
+    // in case of load reversal from negative to positive strain increment, 
+    // update the minimum previous strain, store the last load reversal 
     // point and calculate the stress and strain (sigs0 and epss0) at the 
     // new intersection between elastic and strain hardening asymptote 
     // To include isotropic strain hardening shift the strain hardening 
     // asymptote by sigsft before calculating the intersection point 
-    // Constants a1 and a2 control this stress shift on compression side 
-
-    kon = 2;
-    epsr = epsP;
-    sigr = sigP;
-    //      epsmax = max(epsP, epsmax);
-    if (epsP > epsmax)
-      epsmax = epsP;
+    // Constants a3 and a4 control this stress shift on the tension side 
+  
+    if (kon == 2 && deps > 0.0) {
+
+      kon = 1;
+      epsr = epsP;
+      sigr = sigP;
+      //epsmin = min(epsP, epsmin);
+      if (epsP < epsmin)
+	epsmin = epsP;
+      double d1 = (epsmax - epsmin) / (2.0*(a4 * epsy));
+      double shft = 1.0 + a3 * pow(d1, 0.8);
+      epss0 = (Fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
+      sigs0 = Fy * shft + Esh * (epss0 - epsy * shft);
+      epspl = epsmax;
+
+    } else if (kon == 1 && deps < 0.0) {
     
-    double d1 = (epsmax - epsmin) / (2.0*(a2 * epsy));
-    double shft = 1.0 + a1 * pow(d1, 0.8);
-    epss0 = (-Fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = -Fy * shft + Esh * (epss0 + epsy * shft);
-    epspl = epsmin;
-  }
+      // update the maximum previous strain, store the last load reversal 
+      // point and calculate the stress and strain (sigs0 and epss0) at the 
+      // new intersection between elastic and strain hardening asymptote 
+      // To include isotropic strain hardening shift the strain hardening 
+      // asymptote by sigsft before calculating the intersection point 
+      // Constants a1 and a2 control this stress shift on compression side 
+
+      kon = 2;
+      epsr = epsP;
+      sigr = sigP;
+      //      epsmax = max(epsP, epsmax);
+      if (epsP > epsmax)
+	epsmax = epsP;
+    
+      double d1 = (epsmax - epsmin) / (2.0*(a2 * epsy));
+      double shft = 1.0 + a1 * pow(d1, 0.8);
+      epss0 = (-Fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
+      sigs0 = -Fy * shft + Esh * (epss0 + epsy * shft);
+      epspl = epsmin;
+    }
 
   
-  // calculate current stress sig and tangent modulus E 
+    // calculate current stress sig and tangent modulus E 
+
+    double xi     = fabs((epspl-epss0)/epsy);
+    double R      = R0*(1.0 - (cR1*xi)/(cR2+xi));
+    double epsrat = (eps-epsr)/(epss0-epsr);
+    double dum1  = 1.0 + pow(fabs(epsrat),R);
+    double dum2  = pow(dum1,(1/R));
 
-  double xi     = fabs((epspl-epss0)/epsy);
-  double R      = R0*(1.0 - (cR1*xi)/(cR2+xi));
-  double epsrat = (eps-epsr)/(epss0-epsr);
-  double dum1  = 1.0 + pow(fabs(epsrat),R);
-  double dum2  = pow(dum1,(1/R));
+    sig   = b*epsrat +(1.0-b)*epsrat/dum2;
+    sig   = sig*(sigs0-sigr)+sigr;
 
-  sig   = b*epsrat +(1.0-b)*epsrat/dum2;
-  sig   = sig*(sigs0-sigr)+sigr;
+    e = b + (1.0-b)/(dum1*dum2);
+    e = e*(sigs0-sigr)/(epss0-epsr);
+  }
+
+  hstv[0] = eps;
+  hstv[1] = sig;
+  hstv[2] = e;
+  hstv[3] = epsmin;
+  hstv[4] = epsmax;
+  hstv[5] = epspl;
+  hstv[6] = epss0;
+  hstv[7] = sigs0;
+  hstv[8] = epsr;
+  hstv[9] = sigr;
+  hstv[10] = kon;
+}
 
-  e = b + (1.0-b)/(dum1*dum2);
-  e = e*(sigs0-sigr)/(epss0-epsr);
+int
+Steel02::getPackedStateSize(void)
+{
+  return 11;
+}
 
+int
+Steel02::revertToStartPacked(double *state)
+{
+  state[0] = 0.0;
+  state[1] = 0.0;
+  state[2] = E0;
+  state[3] = -Fy/E0;
+  state[4] = Fy/E0;
+  for (int i = 5; i < 11; i++)
+    state[i] = 0.0;
+
+  if (sigini != 0.0) {
+    state[0] = sigini/E0;
+    state[1] = sigini;
+  }
+
+  return 0;
+}
+
+int
+Steel02::setTrialPacked(double strain, const double *committedState, double *trialState)
+{
+  this->setTrialState(strain, committedState, trialState);
   return 0;
 }
 
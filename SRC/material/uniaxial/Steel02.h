@@ -75,6 +75,12 @@ class Steel02 : public UniaxialMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+
+    // packed state: eps, sig, e, epsmin, epsmax, epspl, epss0, sigs0,
+    // epsr, sigr and kon
+    int getPackedStateSize(void);
+    int revertToStartPacked(double *state);
+    int setTrialPacked(double strain, const double *committedState, double *trialState);
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -122,6 +128,10 @@ class Steel02 : public UniaxialMaterial
     double sig;   
     double e;     
     double eps;   //  = strain at current step
+
+    // the state determination, from the committed history variables
+    // hstvP to the trial ones hstv, both in the packed layout
+    void setTrialState(double trialStrain, const double *hstvP, double *hstv) const;
 };
 
 
@@ -374,6 +374,26 @@ UniaxialMaterial::getResponse(int responseID, Information &matInfo)
   }
 }
 
+int
+UniaxialMaterial::getPackedStateSize(void)
+{
+  return 0;
+}
+
+int
+UniaxialMaterial::revertToStartPacked(double *state)
+{
+  opserr << "UniaxialMaterial::revertToStartPacked() - not implemented for material of type " << this->getClassType() << endln;
+  return -1;
+}
+
+int
+UniaxialMaterial::setTrialPacked(double strain, const double *committedState, double *trialState)
+{
+  opserr << "UniaxialMaterial::setTrialPacked() - not implemented for material of type " << this->getClassType() << endln;
+  return -1;
+}
+
 
 // AddingSensitivity:BEGIN ////////////////////////////////////////
 double
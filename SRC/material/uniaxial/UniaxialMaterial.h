@@ -81,6 +81,17 @@ class UniaxialMaterial : public Material
     virtual int getResponse (int responseID, Information &matInformation);    
     virtual bool hasFailed(void) {return false;}
 
+    // packed state: a single copy of the material holds the parameters
+    // and is shared by many fibers, each of which keeps its history in
+    // a block of getPackedStateSize() doubles owned by the caller; the
+    // first three entries of a block are the strain, stress and tangent.
+    // setTrialPacked() sets the trial block from the committed one without
+    // changing the material, commit and revert are done by copying the
+    // blocks. A size of 0 means the material does not support it.
+    virtual int getPackedStateSize(void);
+    virtual int revertToStartPacked(double *state);
+    virtual int setTrialPacked(double strain, const double *committedState, double *trialState);
+
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     virtual double getStressSensitivity     (int gradIndex, bool conditional);
     virtual double getStrainSensitivity     (int gradIndex);
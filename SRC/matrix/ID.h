@@ -85,6 +85,7 @@ class ID
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
     
   private:
     static int ID_NOT_VALID_ENTRY;
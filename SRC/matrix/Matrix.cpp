@@ -50,11 +50,11 @@ using std::nothrow;
 
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
+OPS_THREAD_LOCAL int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
+OPS_THREAD_LOCAL int Matrix::sizeIntWork = INT_WORK_AREA;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
+OPS_THREAD_LOCAL double *Matrix::matrixWork = 0;
+OPS_THREAD_LOCAL int    *Matrix::intWork =0;
 
 //double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
 
@@ -385,7 +385,7 @@ Matrix::Solve(const Vector &b, Vector &x) const
 #endif
     
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
+    if (dataSize > sizeDoubleWork || matrixWork == 0) {
 
       if (matrixWork != 0) {
 	delete [] matrixWork;
@@ -401,7 +401,7 @@ Matrix::Solve(const Vector &b, Vector &x) const
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
+    if (n > sizeIntWork || intWork == 0) {
 
       if (intWork != 0) {
 	delete [] intWork;
@@ -480,7 +480,7 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
+    if (dataSize > sizeDoubleWork || matrixWork == 0) {
 
       if (matrixWork != 0) {
 	delete [] matrixWork;
@@ -496,7 +496,7 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
+    if (n > sizeIntWork || intWork == 0) {
 
       if (intWork != 0) {
 	delete [] intWork;
@@ -579,7 +579,7 @@ Matrix::Invert(Matrix &theInverse) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
+    if (dataSize > sizeDoubleWork || matrixWork == 0) {
 
       if (matrixWork != 0) {
 	delete [] matrixWork;
@@ -595,7 +595,7 @@ Matrix::Invert(Matrix &theInverse) const
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
+    if (n > sizeIntWork || intWork == 0) {
 
       if (intWork != 0) {
 	delete [] intWork;
@@ -962,7 +962,7 @@ Matrix::addMatrixTripleProduct(double thisFact,
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (sizeWork > sizeDoubleWork || matrixWork == 0) {
       this->addMatrix(thisFact, T^B*T, otherFact);
       return 0;
     }
@@ -1060,7 +1060,7 @@ Matrix::addMatrixTripleProduct(double thisFact,
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (sizeWork > sizeDoubleWork || matrixWork == 0) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
     }
@@ -1817,11 +1817,11 @@ Matrix::Eigen3(const Matrix &M)
   int     rot, its, i, j , k ;
   double  g, h, aij, sm, thresh, t, c, s, tau ;
 
-  static Matrix  v(3,3) ;
-  static Vector  d(3) ;
-  static Vector  a(3) ;
-  static Vector  b(3) ; 
-  static Vector  z(3) ;
+  static OPS_THREAD_LOCAL Matrix  v(3,3) ;
+  static OPS_THREAD_LOCAL Vector  d(3) ;
+  static OPS_THREAD_LOCAL Vector  a(3) ;
+  static OPS_THREAD_LOCAL Vector  b(3) ; 
+  static OPS_THREAD_LOCAL Vector  z(3) ;
 
   static const double tol = 1.0e-08 ;
 
@@ -1941,7 +1941,7 @@ Matrix::Eigen3(const Matrix &M)
     sm = fabs(a(0)) + fabs(a(1)) + fabs(a(2)) ;
 
   } //end while sm
-  static Vector  dd(3) ;
+  static OPS_THREAD_LOCAL Vector  dd(3) ;
   if (d(0)>d(1))
     {
       if (d(0)>d(2))
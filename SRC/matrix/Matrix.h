@@ -150,15 +150,18 @@ class Matrix
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
 
   protected:
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    // work areas for Solve(), Invert() and the triple products, one set
+    // per thread (see OPS_THREAD_LOCAL)
+    static OPS_THREAD_LOCAL double *matrixWork;
+    static OPS_THREAD_LOCAL int *intWork;
+    static OPS_THREAD_LOCAL int sizeDoubleWork;
+    static OPS_THREAD_LOCAL int sizeIntWork;
 
     int numRows;
     int numCols;
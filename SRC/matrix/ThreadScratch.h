@@ -0,0 +1,65 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for ThreadScratch.
+// ThreadScratch is a work array of doubles for scratch whose size is only
+// known at run time (the fibers of a section, ...), in place of a large
+// fixed size static array. It is kept between calls and grown when a
+// larger one is asked for. Declared as
+//
+//   static OPS_THREAD_LOCAL ThreadScratch theScratch;
+//
+// each thread gets its own array when built with OpenMP, which is freed
+// when the thread exits.
+//
+// What: "@(#) ThreadScratch.h, revA"
+
+#ifndef ThreadScratch_h
+#define ThreadScratch_h
+
+#include <OPS_Globals.h>
+
+class ThreadScratch
+{
+  public:
+    ThreadScratch() :data(0), size(0) {}
+    ~ThreadScratch() {if (data != 0) delete [] data;}
+
+    // an array of at least n doubles; the contents are not kept when it
+    // has to be grown
+    double *get(int n) {
+      if (n > size) {
+	if (data != 0)
+	  delete [] data;
+	size = (n > 2*size) ? n : 2*size;
+	data = new double[size];
+      }
+      return data;
+    }
+
+  private:
+    ThreadScratch(const ThreadScratch &);
+    ThreadScratch &operator=(const ThreadScratch &);
+
+    double *data;
+    int size;
+};
+
+#endif
@@ -123,6 +123,7 @@ class Vector
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
     
   private:
     static double VECTOR_NOT_VALID_ENTRY;
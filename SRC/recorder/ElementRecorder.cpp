@@ -285,7 +285,7 @@ OPS_ElementRecorder()
 
 ElementRecorder::ElementRecorder()
 :Recorder(RECORDER_TAGS_ElementRecorder),
- numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
+ numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), responseSize(0),
  theDomain(0), theOutputHandler(0),
  echoTimeFlag(true), deltaT(0), nextTimeStampToRecord(0.0), data(0), 
  initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
@@ -302,7 +302,7 @@ ElementRecorder::ElementRecorder(const ID *ele,
 				 double dT,
 				 const ID *theDOFs)
 :Recorder(RECORDER_TAGS_ElementRecorder),
- numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
+ numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), responseSize(0),
  theDomain(&theDom), theOutputHandler(&theOutputHandler),
  echoTimeFlag(echoTime), deltaT(dT), nextTimeStampToRecord(0.0), data(0),
  initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
@@ -367,6 +367,9 @@ ElementRecorder::~ElementRecorder()
     delete [] theResponses;
   }
 
+  if (responseSize != 0)
+    delete responseSize;
+
   if (data != 0)
     delete data;
   
@@ -408,19 +411,29 @@ ElementRecorder::record(int commitTag, double timeStamp)
     //
     // for each element if responses exist, put them in response vector
     //
-    for (int i=0; i< numEle; i++) {
-      if (theResponses[i] != 0) {
-	// ask the element for the reponse
-	int res;
-	if (( res = theResponses[i]->getResponse()) < 0)
-	  result += res;
-	else {
-	  Information &eleInfo = theResponses[i]->getInformation();
-	  const Vector &eleData = eleInfo.getData();
-	  if (numDOF == 0) {
-	    for (int j=0; j<eleData.Size(); j++)
-	      (*data)(loc++) = eleData(j);
-	  } else {
+    if (numDOF == 0) {
+      // all the data: each response writes straight into its slice
+      for (int i=0; i< numEle; i++) {
+	if (theResponses[i] != 0) {
+	  int size = (*responseSize)(i);
+	  if (size != 0) {
+	    int res;
+	    if ((res = theResponses[i]->writeResponse(&(*data)(loc), size)) < 0)
+	      result += res;
+	  }
+	  loc += size;
+	}
+      }
+    } else {
+      for (int i=0; i< numEle; i++) {
+	if (theResponses[i] != 0) {
+	  // ask the element for the reponse
+	  int res;
+	  if (( res = theResponses[i]->getResponse()) < 0)
+	    result += res;
+	  else {
+	    Information &eleInfo = theResponses[i]->getInformation();
+	    const Vector &eleData = eleInfo.getData();
 	    int dataSize = data->Size();
 	    for (int j=0; j<numDOF; j++) {
 	      int index = (*dof)(j);
@@ -912,6 +925,14 @@ ElementRecorder::initialize(void)
     opserr << "ElementRecorder::initialize() - out of memory\n";
     return -1;
   }
+
+  // the size of each response, i.e. of the slice of data it writes into
+  if (responseSize != 0)
+    delete responseSize;
+  responseSize = new ID(numEle);
+  for (int i=0; i<numEle; i++)
+    if (theResponses[i] != 0)
+      (*responseSize)(i) = theResponses[i]->getInformation().getData().Size();
   
   theOutputHandler->tag("Data");
   initializationDone = true;
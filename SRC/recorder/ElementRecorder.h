@@ -84,6 +84,7 @@ class ElementRecorder: public Recorder
     ID *dof;
 
     Response **theResponses;
+    ID *responseSize;              // size of each response's slice of data
 
     Domain *theDomain;
     OPS_Stream *theOutputHandler;
@@ -79,6 +79,7 @@ extern void* OPS_MPCORecorder();
  #include <DatabaseStream.h>
  #include <DummyStream.h>
  #include <TCP_Stream.h>
+ #include <TCP_FrameStream.h>
 
  #include <packages.h>
  #include <elementAPI.h>
@@ -105,7 +106,7 @@ extern void* OPS_MPCORecorder();
 
  static ExternalRecorderCommand *theExternalRecorderCommands = NULL;
 
-enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, DATA_STREAM_ADD};
+enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, DATA_STREAM_ADD, TCP_FRAME_STREAM};
 
 
  #include <EquiSolnAlgo.h>
@@ -406,6 +407,15 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   loc += 3;
 	 }	    
 
+	 else if (strcmp(argv[loc],"-tcpFrames") == 0) {
+	   inetAddr = argv[loc+1];
+	   if (Tcl_GetInt(interp, argv[loc+2], &inetPort) != TCL_OK) {
+	     ;
+	   }
+	   eMode = TCP_FRAME_STREAM;
+	   loc += 3;
+	 }	    
+
 	 else if ((strcmp(argv[loc],"-binary") == 0)) {
 	   // allow user to specify load pattern other than current
 	   fileName = argv[loc+1];
@@ -450,6 +460,8 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new BinaryFileStream(fileName);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
+       } else if (eMode == TCP_FRAME_STREAM && inetAddr != 0) {
+	 theOutputStream = new TCP_FrameStream(inetPort, inetAddr);
        } else 
 	 theOutputStream = new StandardStream();
 
@@ -1160,6 +1172,15 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos += 3;
 	 }	    
 
+	 else if (strcmp(argv[pos],"-tcpFrames") == 0) {
+	   inetAddr = argv[pos+1];
+	   if (Tcl_GetInt(interp, argv[pos+2], &inetPort) != TCL_OK) {
+	     return TCL_ERROR;
+	   }
+	   eMode = TCP_FRAME_STREAM;
+	   pos += 3;
+	 }	    
+
 	 else if ((strcmp(argv[pos],"-nees") == 0) || (strcmp(argv[pos],"-xml") == 0)) {
 	   // allow user to specify load pattern other than current
 	   fileName = argv[pos+1];
@@ -1354,6 +1375,8 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new BinaryFileStream(fileName);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
+       } else if (eMode == TCP_FRAME_STREAM && inetAddr != 0) {
+	 theOutputStream = new TCP_FrameStream(inetPort, inetAddr);
        } else {
 	 theOutputStream = new StandardStream();
        }
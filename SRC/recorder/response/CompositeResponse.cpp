@@ -168,3 +168,31 @@ CompositeResponse::getResponse(void)
 }
 
 
+int 
+CompositeResponse::writeResponse(double *data, int size)
+{
+  if (myInfo.theType != VectorType || myInfo.theVector->Size() != size)
+    return this->Response::writeResponse(data, size);
+
+  //
+  // each response writes into its own part of data
+  //
+
+  int res = 0;
+  int currentLoc = 0;
+  for (int i=0; i<numResponses; i++) {
+    Response *theResponse = theResponses[i];
+    Information &otherType = theResponse->getInformation();
+
+    int otherSize = 0;
+    if (otherType.theType == DoubleType)
+      otherSize = 1;
+    else if (otherType.theType == VectorType)
+      otherSize = otherType.theVector->Size();
+
+    res += theResponse->writeResponse(&data[currentLoc], otherSize);
+    currentLoc += otherSize;
+  }
+
+  return res;
+}
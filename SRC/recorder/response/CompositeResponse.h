@@ -45,6 +45,7 @@ class CompositeResponse: public Response
 
   int addResponse(Response *);  
   int getResponse(void);
+  int writeResponse(double *data, int size);
 
  protected:
 
@@ -28,6 +28,7 @@
 // Description: This file contains the Response class implementation
 
 #include <Response.h>
+#include <Vector.h>
 
 Response::Response(void)
  :myInfo()
@@ -76,6 +77,27 @@ Response::~Response()
 
 }
 
+int
+Response::writeResponse(double *data, int size)
+{
+  myInfo.setTarget(data, size);
+  int res = this->getResponse();
+  bool written = myInfo.targetWritten;
+  myInfo.setTarget(0, 0);
+
+  if (res < 0)
+    return res;
+
+  if (written == false) {
+    const Vector &theData = myInfo.getData();
+    int dataSize = theData.Size();
+    for (int i=0; i<size; i++)
+      data[i] = (i < dataSize) ? theData(i) : 0.0;
+  }
+
+  return res;
+}
+
 void
 Response::Print(OPS_Stream &s, int flag)
 {
@@ -53,6 +53,12 @@ class Response
   virtual int getResponseSensitivity(int gradNumber) {return 0;}
   virtual Information &getInformation(void);
 
+  // obtains the response and writes it straight into data, an array of
+  // size values (e.g. a slice of a recorder's output Vector); an element
+  // or material setting a Vector or double of that size writes into data
+  // directly, any other response is copied from the Information object
+  virtual int writeResponse(double *data, int size);
+
   virtual void Print(OPS_Stream &s, int flag = 0);
   virtual void Print(ofstream &s, int flag = 0);
 
@@ -51,6 +51,7 @@ extern "C" {
 extern void OPS_clearAllUniaxialMaterial(void);
 extern void OPS_clearAllNDMaterial(void);
 extern void OPS_clearAllSectionForceDeformation(void);
+extern void OPS_clearAllTemperatureStores(void);
 
 
 // the following is a little kludgy but it works!
@@ -78,6 +79,13 @@ OPS_Stream *opserrPtr = &sserr;
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <errno.h>
+#endif
+
 #include <packages.h>
 
 #include <FEM_ObjectBrokerAllClasses.h>
@@ -584,6 +592,7 @@ static Timer *theTimer = 0;
 
 #include <FileStream.h>
 #include <SimulationInformation.h>
+#include <ElementGeometryCache.h>
 SimulationInformation simulationInfo;
 SimulationInformation *theSimulationInfoPtr = 0;
 
@@ -625,6 +634,9 @@ printB(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 setPrecision(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+geometryCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 logFile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -634,6 +646,9 @@ version(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 getPID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+forkDomain(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 getNP(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -975,6 +990,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL); 
     Tcl_CreateCommand(interp, "setPrecision", &setPrecision, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL); 
+    Tcl_CreateCommand(interp, "geometryCache", &geometryCache, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL); 
     Tcl_CreateCommand(interp, "exit", &OpenSeesExit, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "quit", &OpenSeesExit, 
@@ -986,6 +1003,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "getPID", &getPID, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "fork", &forkDomain, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "barrier", &opsBarrier, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "send", &opsSend, 
@@ -1504,6 +1523,7 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   OPS_clearAllUniaxialMaterial();
   OPS_clearAllNDMaterial();
   OPS_clearAllSectionForceDeformation();
+  OPS_clearAllTemperatureStores();
 
   ops_Dt = 0.0;
 
@@ -8360,6 +8380,37 @@ setPrecision(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 }
 
 
+// geometryCache <maxMemory?>
+//
+// sets the most memory (MB) the elements which keep their gauss point
+// geometry (ShellMITC4, Brick) may take for it, 0 (the default) turning
+// the caching off and -1 meaning no limit; it applies to the elements added
+// from then on. Returns the memory (MB) taken and the number of elements
+// holding a cache.
+int 
+geometryCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc > 1) {
+    double maxMemory;
+    if (Tcl_GetDouble(interp, argv[1], &maxMemory) != TCL_OK) {
+      opserr << "WARNING geometryCache <maxMemory?> - invalid maxMemory " << argv[1] << endln;
+      return TCL_ERROR;
+    }
+    if (maxMemory < 0.0)
+      ElementGeometryCache::setMaxMemory(-1.0);
+    else
+      ElementGeometryCache::setMaxMemory(maxMemory*1024.0*1024.0);
+  }
+
+  char buffer[80];
+  sprintf(buffer, "%.6g %d", ElementGeometryCache::getMemory()/(1024.0*1024.0),
+	  ElementGeometryCache::getNumCached());
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+
 int 
 exit(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -8414,6 +8465,133 @@ getNP(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;  
 }
 
+//
+// fork numBranches? <-jobs maxRunning?>
+//
+// forks numBranches child processes from the current committed state of the
+// model and analysis. The children share the model definition with the parent
+// through copy-on-write pages, so a common prefix (e.g. gravity + pushover)
+// only needs to be analysed once. In each child the command returns the branch
+// number (0 to numBranches-1) and the script continues with that branch; the
+// parent waits for all children to finish, running at most maxRunning at once,
+// and then returns -1. Recorders defined before the fork are closed before the
+// branches start so their output is not duplicated; each branch should define
+// its own recorders after the fork.
+//
+
+#if !defined(_WIN32) && !defined(_PARALLEL_PROCESSING) && !defined(_PARALLEL_INTERPRETERS)
+// wait for one of the branches still running to finish; only the branch
+// processes are reaped, so other children of the interpreter are left alone.
+// returns -1 if no branch is running
+static int
+waitForBranch(pid_t *branchPids, int numBranches, int &numFailed)
+{
+  while (true) {
+    bool isRunning = false;
+    for (int i=0; i<numBranches; i++) {
+      if (branchPids[i] <= 0)
+	continue;
+
+      int status = 0;
+      pid_t res = waitpid(branchPids[i], &status, WNOHANG);
+      if (res == 0 || (res < 0 && errno == EINTR)) {
+	isRunning = true;
+	continue;
+      }
+
+      branchPids[i] = 0;
+      if (res < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+	numFailed++;
+      return 0;
+    }
+
+    if (isRunning == false)
+      return -1;
+
+    usleep(10000);
+  }
+}
+#endif
+
+int 
+forkDomain(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+#if defined(_WIN32) || defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+  opserr << "WARNING fork - not available in this build\n";
+  return TCL_ERROR;
+#else
+  if (argc < 2) {
+    opserr << "WARNING want - fork numBranches? <-jobs maxRunning?>\n";
+    return TCL_ERROR;
+  }
+
+  int numBranches;
+  if (Tcl_GetInt(interp, argv[1], &numBranches) != TCL_OK || numBranches < 1) {
+    opserr << "WARNING fork - invalid numBranches " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+
+  int maxRunning = numBranches;
+  if (argc > 3 && strcmp(argv[2],"-jobs") == 0) {
+    if (Tcl_GetInt(interp, argv[3], &maxRunning) != TCL_OK || maxRunning < 1) {
+      opserr << "WARNING fork - invalid maxRunning " << argv[3] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  // make sure nothing buffered is written by both parent and children
+  theDomain.removeRecorders();
+  fflush(0);
+
+  int numRunning = 0;
+  int numFailed = 0;
+  pid_t *branchPids = new pid_t[numBranches];
+  for (int branch=0; branch<numBranches; branch++)
+    branchPids[branch] = 0;
+
+  for (int branch=0; branch<numBranches; branch++) {
+
+    if (numRunning == maxRunning) {
+      if (waitForBranch(branchPids, branch, numFailed) == 0)
+	numRunning--;
+    }
+
+    pid_t pid = fork();
+
+    if (pid == 0) {
+      // the child: continue the script as branch
+      delete [] branchPids;
+      char buffer[30];
+      sprintf(buffer,"%d",branch);
+      Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+      return TCL_OK;
+    } else if (pid < 0) {
+      opserr << "WARNING fork - failed to fork branch " << branch << endln;
+      numFailed++;
+    } else {
+      branchPids[branch] = pid;
+      numRunning++;
+    }
+  }
+
+  // the parent: wait for the remaining branches
+  while (numRunning > 0) {
+    if (waitForBranch(branchPids, numBranches, numFailed) != 0)
+      break;
+    numRunning--;
+  }
+
+  delete [] branchPids;
+
+  if (numFailed != 0)
+    opserr << "WARNING fork - " << numFailed << " of " << numBranches << " branches failed\n";
+
+  Tcl_SetResult(interp, (char *)"-1", TCL_VOLATILE);
+
+  return TCL_OK;  
+#endif
+}
+
 int
 getEleTags(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {